@@ -0,0 +1,97 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A base class for builders of direct (Coulomb) and exchange matrices, which allow Fock matrices to be constructed without the full four-index two-electron integrals.
+ *
+ *  The direct matrix J and the exchange matrix K of a density matrix D are defined as
+ *      J(mu nu) = (mu nu|rho lambda) D(rho lambda),
+ *      K(mu lambda) = (mu nu|rho lambda) D(rho nu),
+ *  in accordance with the contractions that are used in `QCModel::RHF`, `QCModel::UHF` and `QCModel::GHF`.
+ */
+class BaseJKBuilder {
+public:
+    /*
+     *  MARK: Destructor
+     */
+
+    virtual ~BaseJKBuilder() = default;
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The number of basis functions over which the direct and exchange matrices are expressed.
+     */
+    virtual size_t numberOfBasisFunctions() const = 0;
+
+
+    /*
+     *  MARK: Building
+     */
+
+    /**
+     *  Calculate the direct and exchange matrices for the given density matrices.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+     */
+    virtual std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) = 0;
+
+    /**
+     *  Update the direct and exchange matrices for the given density matrices, as is done once in every SCF iteration.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+     *
+     *  @note By default, this calculates the direct and exchange matrices from scratch. Builders that can reuse the results of previous iterations should override this method.
+     */
+    virtual std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> updateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) { return this->calculateDirectAndExchangeMatrices(densities); }
+
+    /**
+     *  @param D            A density matrix, expressed in the scalar basis.
+     *
+     *  @return The direct (Coulomb) matrix J(D).
+     */
+    SquareMatrix<double> calculateDirectMatrix(const SquareMatrix<double>& D) { return this->calculateDirectAndExchangeMatrices({D}).first[0]; }
+
+    /**
+     *  @param D            A density matrix, expressed in the scalar basis.
+     *
+     *  @return The exchange matrix K(D).
+     */
+    SquareMatrix<double> calculateExchangeMatrix(const SquareMatrix<double>& D) { return this->calculateDirectAndExchangeMatrices({D}).second[0]; }
+};
+
+
+}  // namespace GQCP
@@ -19,6 +19,7 @@
 
 
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
 
 
 namespace GQCP {
@@ -60,6 +61,30 @@ public:
      *  @return a buffer containing the calculated integrals
      */
     virtual std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const Shell& shell1, const Shell& shell2, const Shell& shell3, const Shell& shell4) = 0;
+
+
+    // PUBLIC VIRTUAL METHODS
+
+    /**
+     *  Calculate all the integrals over the shells of the given bra and ket shell pairs.
+     *  @note This method is not marked const to allow the Engine's internals to be changed
+     * 
+     *  @param bra_shell_pairs          the shell pair list that contains the bra shell pair
+     *  @param bra_index                the index of the bra shell pair (i.e. the first and second shell) in its shell pair list
+     *  @param ket_shell_pairs          the shell pair list that contains the ket shell pair
+     *  @param ket_index                the index of the ket shell pair (i.e. the third and fourth shell) in its shell pair list
+     * 
+     *  @return a buffer containing the calculated integrals
+     * 
+     *  By default, this forwards to the shell-based calculate(). Engines that can use the precomputed shell pair data should override this method.
+     */
+    virtual std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const ShellPairList<Shell>& bra_shell_pairs, const size_t bra_index, const ShellPairList<Shell>& ket_shell_pairs, const size_t ket_index) {
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+        return this->calculate(bra_shell_pairs.shell(bra.first_shell_index), bra_shell_pairs.shell(bra.second_shell_index),
+                               ket_shell_pairs.shell(ket.first_shell_index), ket_shell_pairs.shell(ket.second_shell_index));
+    }
 };
 
 
@@ -0,0 +1,99 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseJKBuilder.hpp"
+#include "Basis/Integrals/DensityFittingFactors.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A builder for direct (Coulomb) and exchange matrices that uses density-fitted two-electron integrals, without ever forming the four-index integrals.
+ *
+ *  In terms of the density fitting factors B^m, the direct and exchange matrices are calculated as
+ *      J = sum_m B^m (B^m : D),
+ *      K = sum_m B^m D^T B^m.
+ *  For symmetric density matrices, the exchange matrix is calculated through the eigendecomposition D = V d V^T, i.e. K = sum_m (B^m V) d (B^m V)^T, in which only the eigenvectors with a non-zero eigenvalue contribute. For SCF density matrices, this reduces the cost of the exchange build from O(naux K^3) to O(naux K^2 N).
+ */
+class DensityFittedJKBuilder:
+    public BaseJKBuilder {
+private:
+    // The density fitting factors over the scalar basis.
+    DensityFittingFactors factors;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param factors              The density fitting factors over the scalar basis.
+     */
+    DensityFittedJKBuilder(const DensityFittingFactors& factors);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a density-fitted JK builder that uses Libint2 to calculate the three-center and two-center integrals.
+     *
+     *  @param scalar_basis                     The scalar basis over whose basis functions the direct and exchange matrices should be expressed.
+     *  @param auxiliary_scalar_basis           The auxiliary (fitting) scalar basis.
+     *
+     *  @return A density-fitted JK builder that uses Libint2 to calculate the three-center and two-center integrals.
+     */
+    static DensityFittedJKBuilder Libint(const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_scalar_basis);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The density fitting factors over the scalar basis.
+     */
+    const DensityFittingFactors& densityFittingFactors() const { return this->factors; }
+
+    /**
+     *  @return The number of basis functions over which the direct and exchange matrices are expressed.
+     */
+    size_t numberOfBasisFunctions() const override { return this->factors.numberOfRows(); }
+
+
+    /*
+     *  MARK: Building
+     */
+
+    /**
+     *  Calculate the direct and exchange matrices for the given density matrices.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+     */
+    std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) override;
+};
+
+
+}  // namespace GQCP
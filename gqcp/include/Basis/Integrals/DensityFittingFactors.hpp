@@ -0,0 +1,197 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+
+#include <functional>
+
+
+namespace GQCP {
+
+
+/**
+ *  The factors B^m(p q) of a density-fitted (resolution-of-the-identity) approximation to the two-electron Coulomb repulsion integrals
+ *      (p q|r s) ~ sum_m B^m(p q) B^m(r s).
+ *
+ *  In terms of the three-center integrals (P|p q) and the two-center Coulomb metric (P|Q) of an auxiliary basis, the factors are
+ *      B^m(p q) = sum_P (P|p q) U(P m) / sqrt(lambda_m),
+ *  in which (P|Q) = U lambda U^T. Eigenvalues of the Coulomb metric below a threshold are discarded, which makes the fitting robust against (near-)linear dependencies in the auxiliary basis.
+ *
+ *  Alternatively, the factors can be the Cholesky vectors of the two-electron integrals, see the `Cholesky` named constructors, which approximate the integrals to within a user-defined threshold without the need for an auxiliary basis.
+ *
+ *  The factors are stored as one (rows * columns x number of factors)-matrix, in which every column represents the column-major storage of one factor B^m. Storing only these factors reduces the memory requirements from K^4 to K^2 times the number of factors, and allows contractions to be performed as matrix-matrix products.
+ */
+class DensityFittingFactors {
+private:
+    // The number of rows of one factor B^m, i.e. the dimension of the index p.
+    size_t rows;
+
+    // The number of columns of one factor B^m, i.e. the dimension of the index q.
+    size_t cols;
+
+    // The factors, where column m contains the column-major storage of the factor B^m.
+    MatrixX<double> B;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param B                The factors, where column m contains the column-major storage of the factor B^m.
+     *  @param rows             The number of rows of one factor B^m.
+     *  @param cols             The number of columns of one factor B^m.
+     */
+    DensityFittingFactors(const MatrixX<double>& B, const size_t rows, const size_t cols);
+
+    /**
+     *  Fit the factors from the three-center and two-center integrals over an auxiliary basis.
+     *
+     *  @param three_center_integrals           The three-center integrals, where the element (P, p, q) represents (P|p q).
+     *  @param two_center_integrals             The two-center integrals (P|Q), i.e. the Coulomb metric of the auxiliary basis.
+     *  @param threshold                        The threshold below which eigenvalues of the Coulomb metric are discarded.
+     */
+    DensityFittingFactors(const Tensor<double, 3>& three_center_integrals, const SquareMatrix<double>& two_center_integrals, const double threshold = 1.0e-10);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Calculate the density fitting factors over a scalar basis, using an auxiliary scalar basis and Libint2 for the three-center and two-center integrals.
+     *
+     *  @param scalar_basis                     The scalar basis over whose basis functions the two-electron integrals should be approximated.
+     *  @param auxiliary_scalar_basis           The auxiliary (fitting) scalar basis, e.g. one that is read in from a 'cc-pvdz-ri' or 'def2-universal-jkfit' basis set.
+     *  @param threshold                        The threshold below which eigenvalues of the Coulomb metric are discarded.
+     *
+     *  @return The density fitting factors over the given scalar basis.
+     */
+    static DensityFittingFactors Libint(const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_scalar_basis, const double threshold = 1.0e-10);
+
+    /**
+     *  Perform a pivoted (incomplete) Cholesky decomposition of a positive semi-definite supermatrix M(p + rows * q, r + rows * s), whose columns are only calculated when they are chosen as a pivot.
+     *
+     *  In every step, the largest remaining diagonal element is chosen as the pivot, and the procedure stops when all remaining diagonal elements are smaller than the threshold. Since the error matrix is positive semi-definite as well, every element of M is then reproduced to within the threshold.
+     *
+     *  @param diagonal                         The diagonal of the supermatrix.
+     *  @param calculate_column                 A function that calculates the column of the supermatrix that corresponds to the given compound index.
+     *  @param rows                             The number of rows of one factor.
+     *  @param cols                             The number of columns of one factor.
+     *  @param threshold                        The threshold on the remaining diagonal elements.
+     *
+     *  @return The Cholesky vectors as factors.
+     */
+    static DensityFittingFactors PivotedCholesky(const VectorX<double>& diagonal, const std::function<VectorX<double>(const size_t)>& calculate_column, const size_t rows, const size_t cols, const double threshold);
+
+    /**
+     *  Perform a pivoted Cholesky decomposition of the given two-electron integrals.
+     *
+     *  @param g                                The two-electron integrals, in chemist's notation.
+     *  @param threshold                        The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+     *
+     *  @return The Cholesky vectors of the two-electron integrals.
+     */
+    static DensityFittingFactors Cholesky(const Tensor<double, 4>& g, const double threshold = 1.0e-08);
+
+    /**
+     *  Perform a pivoted Cholesky decomposition of the Coulomb repulsion integrals over a scalar basis, using Libint2. Only the diagonal integrals (p q|p q) and the columns (. .|r s) of the chosen pivots are ever calculated, so the full set of two-electron integrals is never stored.
+     *
+     *  @param scalar_basis                     The scalar basis over whose basis functions the two-electron integrals should be decomposed.
+     *  @param threshold                        The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+     *
+     *  @return The Cholesky vectors of the Coulomb repulsion integrals.
+     */
+    static DensityFittingFactors LibintCholesky(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-08);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The number of factors B^m, which is at most the number of auxiliary basis functions.
+     */
+    size_t numberOfFactors() const { return this->B.cols(); }
+
+    /**
+     *  @return The number of rows of one factor B^m.
+     */
+    size_t numberOfRows() const { return this->rows; }
+
+    /**
+     *  @return The number of columns of one factor B^m.
+     */
+    size_t numberOfColumns() const { return this->cols; }
+
+    /**
+     *  @return The factors, where column m contains the column-major storage of the factor B^m.
+     */
+    const MatrixX<double>& matrix() const { return this->B; }
+
+    /**
+     *  @param m            The index of the factor.
+     *
+     *  @return The factor B^m as a (rows x columns)-matrix.
+     */
+    MatrixX<double> factor(const size_t m) const;
+
+
+    /*
+     *  MARK: Transformations
+     */
+
+    /**
+     *  Transform both indices of every factor, i.e. B'^m = C_left^T B^m C_right. By choosing only some columns of the coefficient matrices, the factors can be restricted to e.g. the occupied-virtual block.
+     *
+     *  @param C_left           The coefficient matrix that transforms the first index of every factor.
+     *  @param C_right          The coefficient matrix that transforms the second index of every factor.
+     *
+     *  @return The transformed factors.
+     */
+    DensityFittingFactors transformed(const MatrixX<double>& C_left, const MatrixX<double>& C_right) const;
+
+    /**
+     *  Transform both indices of every factor with the same coefficient matrix, i.e. B'^m = C^T B^m C.
+     *
+     *  @param C                The coefficient matrix.
+     *
+     *  @return The transformed factors.
+     */
+    DensityFittingFactors transformed(const MatrixX<double>& C) const { return this->transformed(C, C); }
+
+
+    /*
+     *  MARK: Integrals
+     */
+
+    /**
+     *  @return The density-fitted two-electron integrals (p q|r s) = sum_m B^m(p q) B^m(r s), in chemist's notation.
+     */
+    Tensor<double, 4> calculateIntegrals() const;
+};
+
+
+}  // namespace GQCP
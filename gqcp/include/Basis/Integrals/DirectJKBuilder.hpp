@@ -0,0 +1,191 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseJKBuilder.hpp"
+#include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A builder for direct (Coulomb) and exchange matrices that never stores the two-electron integrals, as used in direct SCF calculations.
+ *
+ *  For every build, the (8-fold symmetry-unique) shell quartets are recalculated and contracted with the given density matrices straight away. A shell quartet is skipped if its Schwarz bound, multiplied with the largest density matrix element it is contracted with, is smaller than the screening threshold.
+ */
+class DirectJKBuilder:
+    public BaseJKBuilder {
+public:
+    // The type of engine that is used to calculate the two-electron integrals.
+    using Engine = BaseTwoElectronIntegralEngine<GTOShell, 1, double>;
+
+
+private:
+    // The engine that calculates the Coulomb repulsion integrals over shell quartets.
+    std::shared_ptr<Engine> engine;
+
+    // The significant shell pairs of the scalar basis, including their Schwarz bounds.
+    ShellPairList<GTOShell> shell_pairs;
+
+    // The indices (inside `shell_pairs`) of the shell pairs (a, b) with a >= b.
+    std::vector<size_t> unique_pair_indices;
+
+    // The threshold for the density-weighted Schwarz screening of shell quartets.
+    double screening_threshold;
+
+    // Every `full_rebuild_frequency`-th update rebuilds the direct and exchange matrices from scratch, to avoid the accumulation of screening errors.
+    size_t full_rebuild_frequency;
+
+    // The density matrices that the stored direct and exchange matrices correspond to.
+    std::vector<SquareMatrix<double>> reference_densities;
+
+    // The direct and exchange matrices that correspond to the reference density matrices.
+    std::vector<SquareMatrix<double>> reference_direct_matrices;
+    std::vector<SquareMatrix<double>> reference_exchange_matrices;
+
+    // The number of incremental builds since the last full build.
+    size_t number_of_incremental_builds = 0;
+
+    // The number of shell quartets that have been calculated during the most recent build.
+    size_t number_of_calculated_shell_quartets = 0;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param shell_pairs                  The significant shell pairs of the scalar basis over whose basis functions the direct and exchange matrices should be expressed.
+     *  @param engine                       The engine that is used to calculate the Coulomb repulsion integrals.
+     *  @param screening_threshold          The threshold for the density-weighted Schwarz screening of shell quartets.
+     *  @param full_rebuild_frequency       The number of updates after which the direct and exchange matrices are rebuilt from scratch, i.e. every `full_rebuild_frequency`-th update is a full build. A frequency of 1 effectively disables incremental builds.
+     */
+    template <typename DerivedEngine>
+    DirectJKBuilder(const ShellPairList<GTOShell>& shell_pairs, const DerivedEngine& engine, const double screening_threshold = 1.0e-12, const size_t full_rebuild_frequency = 8) :
+        engine {std::make_shared<DerivedEngine>(engine)},
+        shell_pairs {shell_pairs},
+        screening_threshold {screening_threshold},
+        full_rebuild_frequency {full_rebuild_frequency} {
+
+        if (full_rebuild_frequency == 0) {
+            throw std::invalid_argument("DirectJKBuilder::DirectJKBuilder(const ShellPairList<GTOShell>&, const DerivedEngine&, const double, const size_t): The full rebuild frequency should be at least 1.");
+        }
+
+        this->shell_pairs.calculateSchwarzBounds(*this->engine);
+
+        for (size_t i = 0; i < this->shell_pairs.numberOfShellPairs(); i++) {
+            const auto& pair = this->shell_pairs.shellPair(i);
+            if (pair.first_shell_index >= pair.second_shell_index) {
+                this->unique_pair_indices.push_back(i);
+            }
+        }
+    }
+
+
+    /**
+     *  @param shell_set                    The shell set over whose basis functions the direct and exchange matrices should be expressed.
+     *  @param engine                       The engine that is used to calculate the Coulomb repulsion integrals.
+     *  @param screening_threshold          The threshold for the density-weighted Schwarz screening of shell quartets.
+     *  @param full_rebuild_frequency       The number of updates after which the direct and exchange matrices are rebuilt from scratch, i.e. every `full_rebuild_frequency`-th update is a full build. A frequency of 1 effectively disables incremental builds.
+     */
+    template <typename DerivedEngine>
+    DirectJKBuilder(const ShellSet<GTOShell>& shell_set, const DerivedEngine& engine, const double screening_threshold = 1.0e-12, const size_t full_rebuild_frequency = 8) :
+        DirectJKBuilder(ShellPairList<GTOShell>(shell_set), engine, screening_threshold, full_rebuild_frequency) {}
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a direct JK builder that uses Libint2 to calculate the Coulomb repulsion integrals.
+     *
+     *  @param scalar_basis                 The scalar basis over whose basis functions the direct and exchange matrices should be expressed.
+     *  @param screening_threshold          The threshold for the density-weighted Schwarz screening of shell quartets.
+     *  @param full_rebuild_frequency       The number of updates after which the direct and exchange matrices are rebuilt from scratch, i.e. every `full_rebuild_frequency`-th update is a full build.
+     *
+     *  @return A direct JK builder that uses Libint2 to calculate the Coulomb repulsion integrals.
+     */
+    static DirectJKBuilder Libint(const ScalarBasis<GTOShell>& scalar_basis, const double screening_threshold = 1.0e-12, const size_t full_rebuild_frequency = 8);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The number of basis functions over which the direct and exchange matrices are expressed.
+     */
+    size_t numberOfBasisFunctions() const override;
+
+    /**
+     *  @return The number of shell quartets that have been calculated during the most recent build, i.e. the ones that survived the screening.
+     */
+    size_t numberOfCalculatedShellQuartets() const { return this->number_of_calculated_shell_quartets; }
+
+    /**
+     *  @return The threshold for the density-weighted Schwarz screening of shell quartets.
+     */
+    double screeningThreshold() const { return this->screening_threshold; }
+
+
+    /*
+     *  MARK: Building
+     */
+
+    /**
+     *  Calculate the direct and exchange matrices for the given density matrices, in one pass over the shell quartets.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+     */
+    std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) override;
+
+    /**
+     *  Update the direct and exchange matrices for the given density matrices, using the density matrices of the previous update as a reference.
+     *
+     *  Since J and K are linear in the density matrix, only the contributions of the density matrix differences ΔD have to be calculated. Since ΔD becomes smaller during an SCF procedure, the density-weighted screening then neglects more and more shell quartets, which makes late iterations cheaper.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+     *
+     *  @note A full build is performed for the first update, for every `full_rebuild_frequency`-th update after it (i.e. after `full_rebuild_frequency - 1` incremental updates), and whenever the number of density matrices changes.
+     */
+    std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> updateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) override;
+
+    /**
+     *  Forget the reference density matrices, such that the next update is a full build.
+     */
+    void resetIncrementalBuilds();
+};
+
+
+}  // namespace GQCP
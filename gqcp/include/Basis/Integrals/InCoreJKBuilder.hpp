@@ -0,0 +1,81 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/BaseJKBuilder.hpp"
+#include "Mathematical/Representation/PackedSquareRankFourTensor.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A builder for direct (Coulomb) and exchange matrices from two-electron integrals that are kept in memory.
+ *
+ *  The integrals are stored using their eight-fold permutational symmetry (see `PackedSquareRankFourTensor`), and the direct and exchange matrices of all the given density matrices are calculated together, in a single pass over the unique integrals. Using this builder in an SCF environment avoids both the full K^4 two-electron integrals and the generic tensor contractions in every Fock matrix calculation.
+ */
+class InCoreJKBuilder:
+    public BaseJKBuilder {
+private:
+    // The packed two-electron integrals over the scalar basis, in chemist's notation.
+    PackedSquareRankFourTensor<double> g;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param g                    The packed two-electron integrals over the scalar basis, in chemist's notation.
+     */
+    InCoreJKBuilder(const PackedSquareRankFourTensor<double>& g);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The packed two-electron integrals over the scalar basis.
+     */
+    const PackedSquareRankFourTensor<double>& integrals() const { return this->g; }
+
+    /**
+     *  @return The number of basis functions over which the direct and exchange matrices are expressed.
+     */
+    size_t numberOfBasisFunctions() const override { return this->g.dimension(); }
+
+
+    /*
+     *  MARK: Building
+     */
+
+    /**
+     *  Calculate the direct and exchange matrices for the given density matrices.
+     *
+     *  @param densities            The density matrices, expressed in the scalar basis.
+     *
+     *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+     */
+    std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) override;
+};
+
+
+}  // namespace GQCP
@@ -23,6 +23,7 @@
 #include "Basis/Integrals/IntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibcintInterfacer.hpp"
 #include "Basis/Integrals/Interfaces/LibintInterfacer.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
 #include "Basis/ScalarBasis/ScalarBasis.hpp"
 #include "Basis/ScalarBasis/ShellSet.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
@@ -162,6 +163,195 @@ public:
     }
 
 
+    /**
+     *  Calculate all two-electron integrals over the basis functions inside the given shell pair lists, skipping the shell quartets that are negligible according to the Schwarz inequality.
+     * 
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param bra_shell_pairs              the list of the significant shell pairs that should appear on the left of the operator
+     *  @param ket_shell_pairs              the list of the significant shell pairs that should appear on the right of the operator
+     *  @param threshold                    the threshold for the Schwarz screening: a shell quartet is skipped if Q_ab * Q_cd < threshold. Screening is only applied if the Schwarz bounds of the shell pairs have been calculated
+     * 
+     *  @tparam Shell                       the type of shell the integral engine is able to handle
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static auto calculate(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellPairList<Shell>& bra_shell_pairs, const ShellPairList<Shell>& ket_shell_pairs, const double threshold = 0.0) -> std::array<Tensor<IntegralScalar, 4>, N> {
+
+        // Initialize the N components of the matrix representations of the operator.
+        size_t nbf_left = 0;
+        for (size_t shell_index = 0; shell_index < bra_shell_pairs.numberOfShells(); shell_index++) {
+            nbf_left += bra_shell_pairs.shell(shell_index).numberOfBasisFunctions();
+        }
+
+        size_t nbf_right = 0;
+        for (size_t shell_index = 0; shell_index < ket_shell_pairs.numberOfShells(); shell_index++) {
+            nbf_right += ket_shell_pairs.shell(shell_index).numberOfBasisFunctions();
+        }
+
+        std::array<Tensor<IntegralScalar, 4>, N> components;
+        for (auto& component : components) {
+            component = Tensor<IntegralScalar, 4>(nbf_left, nbf_left, nbf_right, nbf_right);
+            component.setZero();
+        }
+
+
+        // Loop over all significant bra and ket shell pairs and let the engine calculate the integrals over the corresponding shell quartets.
+        const auto apply_screening = (threshold > 0.0) && bra_shell_pairs.hasSchwarzBounds() && ket_shell_pairs.hasSchwarzBounds();
+
+        for (size_t bra_index = 0; bra_index < bra_shell_pairs.numberOfShellPairs(); bra_index++) {
+            const auto& bra = bra_shell_pairs.shellPair(bra_index);
+
+            for (size_t ket_index = 0; ket_index < ket_shell_pairs.numberOfShellPairs(); ket_index++) {
+                const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+                // Skip the shell quartets whose integrals are guaranteed to be negligible.
+                if (apply_screening && (bra.schwarz_bound * ket.schwarz_bound < threshold)) {
+                    continue;
+                }
+
+                const auto buffer = engine.calculate(bra_shell_pairs, bra_index, ket_shell_pairs, ket_index);
+
+                // Only if the integrals are not all zero, place them inside the full matrices
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+                buffer->emplace(components, bra.first_basis_function_index, bra.second_basis_function_index, ket.first_basis_function_index, ket.second_basis_function_index);  // place the calculated integrals inside the full tensors
+            }
+        }
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate all three-center two-electron integrals (P|ab) between the basis functions inside an auxiliary shell set and pairs of basis functions inside a shell set, as used in density fitting.
+     * 
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param auxiliary_shell_set          the set of (auxiliary) shells that should appear on the left of the operator
+     *  @param shell_set                    the set of shells whose pairs should appear on the right of the operator
+     * 
+     *  @tparam Shell                       the type of shell the integral engine is able to handle. It should be able to produce a unit shell
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     * 
+     *  @return the three-center integrals, where the element (P, a, b) represents (P|ab)
+     * 
+     *  @note The three-center integrals are calculated as the four-center integrals (P 1|ab), in which 1 represents a unit shell.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static auto calculateThreeCenter(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& auxiliary_shell_set, const ShellSet<Shell>& shell_set) -> std::array<Tensor<IntegralScalar, 3>, N> {
+
+        // Initialize the N components of the tensor representations of the operator.
+        const auto naux = auxiliary_shell_set.numberOfBasisFunctions();
+        const auto nbf = shell_set.numberOfBasisFunctions();
+
+        std::array<Tensor<IntegralScalar, 3>, N> components;
+        for (auto& component : components) {
+            component = Tensor<IntegralScalar, 3>(naux, nbf, nbf);
+            component.setZero();
+        }
+
+
+        // Loop over all auxiliary shells and the symmetry-unique shell pairs, since (P|ab) = (P|ba) for real basis functions.
+        const auto unit_shell = Shell::Unit();
+        const auto auxiliary_shells = auxiliary_shell_set.asVector();
+        const auto shells = shell_set.asVector();
+
+        for (size_t auxiliary_shell_index = 0; auxiliary_shell_index < auxiliary_shells.size(); auxiliary_shell_index++) {
+            const auto auxiliary_bf_index = auxiliary_shell_set.basisFunctionIndex(auxiliary_shell_index);
+            const auto& auxiliary_shell = auxiliary_shells[auxiliary_shell_index];
+
+            for (size_t shell_index1 = 0; shell_index1 < shells.size(); shell_index1++) {
+                const auto bf1_index = shell_set.basisFunctionIndex(shell_index1);
+                const auto& shell1 = shells[shell_index1];
+
+                for (size_t shell_index2 = 0; shell_index2 <= shell_index1; shell_index2++) {
+                    const auto bf2_index = shell_set.basisFunctionIndex(shell_index2);
+                    const auto& shell2 = shells[shell_index2];
+
+                    const auto buffer = engine.calculate(auxiliary_shell, unit_shell, shell1, shell2);
+
+                    // Only if the integrals are not all zero, place them inside the full tensors.
+                    if (buffer->areIntegralsAllZero()) {
+                        continue;
+                    }
+
+                    for (size_t i = 0; i < N; i++) {
+                        for (size_t f1 = 0; f1 < auxiliary_shell.numberOfBasisFunctions(); f1++) {
+                            for (size_t f3 = 0; f3 < shell1.numberOfBasisFunctions(); f3++) {
+                                for (size_t f4 = 0; f4 < shell2.numberOfBasisFunctions(); f4++) {
+                                    const auto value = buffer->value(i, f1, 0, f3, f4);
+                                    components[i](auxiliary_bf_index + f1, bf1_index + f3, bf2_index + f4) = value;
+                                    components[i](auxiliary_bf_index + f1, bf2_index + f4, bf1_index + f3) = value;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return components;
+    }
+
+
+    /**
+     *  Calculate all two-center two-electron integrals (P|Q) between the basis functions inside an auxiliary shell set, i.e. the Coulomb metric that is used in density fitting.
+     * 
+     *  @param engine                       the engine that can calculate two-electron integrals over shells
+     *  @param auxiliary_shell_set          the set of (auxiliary) shells that should appear on both sides of the operator
+     * 
+     *  @tparam Shell                       the type of shell the integral engine is able to handle. It should be able to produce a unit shell
+     *  @tparam N                           the number of components the operator has
+     *  @tparam IntegralScalar              the scalar representation of an integral
+     * 
+     *  @return the two-center integrals, where the element (P, Q) represents (P|Q)
+     * 
+     *  @note The two-center integrals are calculated as the four-center integrals (P 1|Q 1), in which 1 represents a unit shell.
+     */
+    template <typename Shell, size_t N, typename IntegralScalar>
+    static auto calculateTwoCenter(BaseTwoElectronIntegralEngine<Shell, N, IntegralScalar>& engine, const ShellSet<Shell>& auxiliary_shell_set) -> std::array<SquareMatrix<IntegralScalar>, N> {
+
+        // Initialize the N components of the matrix representations of the operator.
+        const auto naux = auxiliary_shell_set.numberOfBasisFunctions();
+
+        std::array<SquareMatrix<IntegralScalar>, N> components;
+        for (auto& component : components) {
+            component = SquareMatrix<IntegralScalar>::Zero(naux);
+        }
+
+
+        // Loop over all pairs of auxiliary shells, using the symmetry (P|Q) = (Q|P) for real basis functions.
+        const auto unit_shell = Shell::Unit();
+        const auto auxiliary_shells = auxiliary_shell_set.asVector();
+
+        for (size_t shell_index1 = 0; shell_index1 < auxiliary_shells.size(); shell_index1++) {
+            const auto bf1_index = auxiliary_shell_set.basisFunctionIndex(shell_index1);
+            const auto& shell1 = auxiliary_shells[shell_index1];
+
+            for (size_t shell_index2 = 0; shell_index2 <= shell_index1; shell_index2++) {
+                const auto bf2_index = auxiliary_shell_set.basisFunctionIndex(shell_index2);
+                const auto& shell2 = auxiliary_shells[shell_index2];
+
+                const auto buffer = engine.calculate(shell1, unit_shell, shell2, unit_shell);
+
+                for (size_t i = 0; i < N; i++) {
+                    for (size_t f1 = 0; f1 < shell1.numberOfBasisFunctions(); f1++) {
+                        for (size_t f2 = 0; f2 < shell2.numberOfBasisFunctions(); f2++) {
+                            const auto value = buffer->value(i, f1, 0, f2, 0);
+                            components[i](bf1_index + f1, bf2_index + f2) = value;
+                            components[i](bf2_index + f2, bf1_index + f1) = value;
+                        }
+                    }
+                }
+            }
+        }
+
+        return components;
+    }
+
+
     /*
      *  PUBLIC METHODS - LIBINT2 INTEGRALS
      */
@@ -293,12 +483,54 @@ public:
         auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
 
 
-        // Calculate the integrals using the engine
-        const auto integrals = IntegralCalculator::calculate(engine, left_shell_set, right_shell_set);
+        // Calculate the integrals using the engine, over the shell pairs that are cached in the scalar bases
+        const auto integrals = IntegralCalculator::calculate(engine, left_scalar_basis.shellPairs(), right_scalar_basis.shellPairs());
         return integrals[0];
     }
 
 
+    /**
+     *  Calculate the three-center integrals (P|ab) over the Coulomb repulsion operator, between an auxiliary scalar basis and pairs of basis functions of a scalar basis, using Libint2.
+     * 
+     *  @param fq_two_op                            the first-quantized Coulomb repulsion operator
+     *  @param auxiliary_scalar_basis               the auxiliary scalar basis, whose basis functions should appear to the left of the operator
+     *  @param scalar_basis                         the scalar basis, whose pairs of basis functions should appear to the right of the operator
+     * 
+     *  @return the three-center integrals, where the element (P, a, b) represents (P|ab)
+     */
+    static Tensor<double, 3> calculateLibintThreeCenterIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& auxiliary_scalar_basis, const ScalarBasis<GTOShell>& scalar_basis) {
+
+        const auto auxiliary_shell_set = auxiliary_scalar_basis.shellSet();
+        const auto shell_set = scalar_basis.shellSet();
+
+        // Construct the libint engine
+        const auto max_nprim = std::max(auxiliary_shell_set.maximumNumberOfPrimitives(), shell_set.maximumNumberOfPrimitives());
+        const auto max_l = std::max(auxiliary_shell_set.maximumAngularMomentum(), shell_set.maximumAngularMomentum());
+        auto engine = IntegralEngine::Libint(fq_two_op, max_nprim, max_l);
+
+        return IntegralCalculator::calculateThreeCenter(engine, auxiliary_shell_set, shell_set)[0];
+    }
+
+
+    /**
+     *  Calculate the two-center integrals (P|Q) over the Coulomb repulsion operator, i.e. the Coulomb metric of an auxiliary scalar basis, using Libint2.
+     * 
+     *  @param fq_two_op                            the first-quantized Coulomb repulsion operator
+     *  @param auxiliary_scalar_basis               the auxiliary scalar basis
+     * 
+     *  @return the two-center integrals, where the element (P, Q) represents (P|Q)
+     */
+    static SquareMatrix<double> calculateLibintTwoCenterIntegrals(const CoulombRepulsionOperator& fq_two_op, const ScalarBasis<GTOShell>& auxiliary_scalar_basis) {
+
+        const auto auxiliary_shell_set = auxiliary_scalar_basis.shellSet();
+
+        // Construct the libint engine
+        auto engine = IntegralEngine::Libint(fq_two_op, auxiliary_shell_set.maximumNumberOfPrimitives(), auxiliary_shell_set.maximumAngularMomentum());
+
+        return IntegralCalculator::calculateTwoCenter(engine, auxiliary_shell_set)[0];
+    }
+
+
     /*
      *  PUBLIC METHODS - LIBCINT INTEGRALS
      *  Note that the Libcint integrals should only be used for Cartesian ShellSets
@@ -362,7 +594,8 @@ public:
         const auto shell_set = scalar_basis.shellSet();
 
         auto engine = IntegralEngine::Libcint(fq_op, shell_set);
-        const auto integrals = IntegralCalculator::calculate(engine, shell_set, shell_set);
+        const auto& shell_pairs = scalar_basis.shellPairs();
+        const auto integrals = IntegralCalculator::calculate(engine, shell_pairs, shell_pairs);
         return integrals[0];
     }
 };
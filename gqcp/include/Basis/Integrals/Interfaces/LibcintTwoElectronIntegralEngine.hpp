@@ -92,12 +92,58 @@ public:
         shell_indices[2] = static_cast<int>(findElementIndex(this->shell_set.asVector(), shell3));
         shell_indices[3] = static_cast<int>(findElementIndex(this->shell_set.asVector(), shell4));
 
+        return this->calculateFromShellIndices(shell_indices, shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions());
+    }
+
+
+    /**
+     *  @param bra_shell_pairs          the shell pair list that contains the bra shell pair
+     *  @param bra_index                the index of the bra shell pair (i.e. the first and second shell) in its shell pair list
+     *  @param ket_shell_pairs          the shell pair list that contains the ket shell pair
+     *  @param ket_index                the index of the ket shell pair (i.e. the third and fourth shell) in its shell pair list
+     * 
+     *  This method is not marked const to allow the Engine's internals to be changed
+     * 
+     *  @note The shell pair lists should have been constructed from the same shell set as this engine. The shell indices are then taken directly from the shell pairs, instead of being searched for in the shell set.
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const ShellPairList<Shell>& bra_shell_pairs, const size_t bra_index, const ShellPairList<Shell>& ket_shell_pairs, const size_t ket_index) override {
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+        if ((bra_shell_pairs.numberOfShells() != this->shell_set.numberOfShells()) || (ket_shell_pairs.numberOfShells() != this->shell_set.numberOfShells())) {
+            throw std::invalid_argument("LibcintTwoElectronIntegralEngine::calculate(const ShellPairList<Shell>&, const size_t, const ShellPairList<Shell>&, const size_t): The shell pair lists should be constructed from the same shell set as this engine.");
+        }
+
+        int shell_indices[4];
+        shell_indices[0] = static_cast<int>(bra.first_shell_index);
+        shell_indices[1] = static_cast<int>(bra.second_shell_index);
+        shell_indices[2] = static_cast<int>(ket.first_shell_index);
+        shell_indices[3] = static_cast<int>(ket.second_shell_index);
+
+        return this->calculateFromShellIndices(shell_indices,
+                               bra_shell_pairs.shell(bra.first_shell_index).numberOfBasisFunctions(), bra_shell_pairs.shell(bra.second_shell_index).numberOfBasisFunctions(),
+                               ket_shell_pairs.shell(ket.first_shell_index).numberOfBasisFunctions(), ket_shell_pairs.shell(ket.second_shell_index).numberOfBasisFunctions());
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  @param shell_indices        the indices of the four shells in the RawContainer
+     *  @param nbf1                 the number of basis functions in the first shell
+     *  @param nbf2                 the number of basis functions in the second shell
+     *  @param nbf3                 the number of basis functions in the third shell
+     *  @param nbf4                 the number of basis functions in the fourth shell
+     * 
+     *  @return a buffer containing the integrals over the four given shells
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculateFromShellIndices(int shell_indices[4], const size_t nbf1, const size_t nbf2, const size_t nbf3, const size_t nbf4) {
 
         // Pre-allocate a raw buffer, because libcint functions expect a data pointer
-        const size_t nbf1 = shell1.numberOfBasisFunctions();
-        const size_t nbf2 = shell2.numberOfBasisFunctions();
-        const size_t nbf3 = shell3.numberOfBasisFunctions();
-        const size_t nbf4 = shell4.numberOfBasisFunctions();
         double libcint_buffer[N * nbf1 * nbf2 * nbf3 * nbf4];
 
 
@@ -22,6 +22,9 @@
 #include "Basis/Integrals/Interfaces/LibintTwoElectronIntegralBuffer.hpp"
 #include "Basis/ScalarBasis/GTOShell.hpp"
 
+#include <cmath>
+#include <vector>
+
 
 namespace GQCP {
 
@@ -39,8 +42,28 @@ public:
 
 
 private:
+    /**
+     *  The libint2 data that corresponds to a GQCP shell pair list: the interfaced shells and the libint2 shell pair data.
+     */
+    struct LibintShellPairData {
+    public:
+        // The data token of the shell pair list that this data corresponds to. A token of zero means that no data has been prepared yet.
+        size_t shell_pairs_token = 0;
+
+        // The interfaced libint2 shells, in the order of the shell pair list's shells.
+        std::vector<libint2::Shell> shells;
+
+        // The libint2 shell pair data, in the order of the shell pair list's shell pairs.
+        std::vector<libint2::ShellPair> pairs;
+    };
+
+
     libint2::Engine libint2_engine;
 
+    // The libint2 data for the bra and ket shell pair lists that were last used, such that it is not re-created for every shell quartet.
+    LibintShellPairData bra_data;
+    LibintShellPairData ket_data;
+
 
 public:
     /*
@@ -79,6 +102,73 @@ public:
         this->libint2_engine.compute(libint_shell1, libint_shell2, libint_shell3, libint_shell4);
         return std::make_shared<LibintTwoElectronIntegralBuffer<N>>(libint2_buffer, shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions());
     }
+
+
+    /**
+     *  @param bra_shell_pairs          the shell pair list that contains the bra shell pair
+     *  @param bra_index                the index of the bra shell pair (i.e. the first and second shell) in its shell pair list
+     *  @param ket_shell_pairs          the shell pair list that contains the ket shell pair
+     *  @param ket_index                the index of the ket shell pair (i.e. the third and fourth shell) in its shell pair list
+     * 
+     *  This method is not marked const to allow the Engine's internals to be changed
+     * 
+     *  @note The libint2 shells and the libint2 shell pair data (i.e. the precomputed primitive pair data that libint2 uses) are only created once per shell pair list, which is recognized by its data token.
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const ShellPairList<GTOShell>& bra_shell_pairs, const size_t bra_index, const ShellPairList<GTOShell>& ket_shell_pairs, const size_t ket_index) override {
+
+        this->prepareShellPairData(bra_shell_pairs, this->bra_data);
+        this->prepareShellPairData(ket_shell_pairs, this->ket_data);
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+        const auto& libint_shell1 = this->bra_data.shells[bra.first_shell_index];
+        const auto& libint_shell2 = this->bra_data.shells[bra.second_shell_index];
+        const auto& libint_shell3 = this->ket_data.shells[ket.first_shell_index];
+        const auto& libint_shell4 = this->ket_data.shells[ket.second_shell_index];
+
+        const auto& libint2_buffer = this->libint2_engine.results();
+        this->libint2_engine.compute2<libint2::Operator::coulomb, libint2::BraKet::xx_xx, 0>(libint_shell1, libint_shell2, libint_shell3, libint_shell4,
+                                                                                            &this->bra_data.pairs[bra_index], &this->ket_data.pairs[ket_index]);
+
+        return std::make_shared<LibintTwoElectronIntegralBuffer<N>>(libint2_buffer,
+                                                                    bra_shell_pairs.shell(bra.first_shell_index).numberOfBasisFunctions(), bra_shell_pairs.shell(bra.second_shell_index).numberOfBasisFunctions(),
+                                                                    ket_shell_pairs.shell(ket.first_shell_index).numberOfBasisFunctions(), ket_shell_pairs.shell(ket.second_shell_index).numberOfBasisFunctions());
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Make sure that the given libint2 data corresponds to the given shell pair list, creating the interfaced shells and the libint2 shell pair data if necessary.
+     * 
+     *  @param shell_pairs          the shell pair list
+     *  @param data                 the libint2 data that should correspond to the shell pair list
+     */
+    void prepareShellPairData(const ShellPairList<GTOShell>& shell_pairs, LibintShellPairData& data) const {
+
+        if (data.shell_pairs_token == shell_pairs.dataToken()) {
+            return;  // The data has already been prepared.
+        }
+
+        data.shell_pairs_token = shell_pairs.dataToken();
+
+        data.shells.clear();
+        data.shells.reserve(shell_pairs.numberOfShells());
+        for (size_t shell_index = 0; shell_index < shell_pairs.numberOfShells(); shell_index++) {
+            data.shells.push_back(LibintInterfacer::get().interface(shell_pairs.shell(shell_index)));
+        }
+
+        const auto ln_precision = std::log(this->libint2_engine.precision());
+        data.pairs.clear();
+        data.pairs.reserve(shell_pairs.numberOfShellPairs());
+        for (const auto& pair : shell_pairs.shellPairs()) {
+            data.pairs.emplace_back(data.shells[pair.first_shell_index], data.shells[pair.second_shell_index], ln_precision);
+        }
+    }
 };
 
 
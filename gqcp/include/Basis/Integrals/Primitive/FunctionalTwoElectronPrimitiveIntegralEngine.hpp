@@ -45,6 +45,9 @@ public:
     // The scalar representation of one of the primitive integrals.
     using IntegralScalar = _IntegralScalar;
 
+    // If this engine can calculate integrals from the Gaussian product data of the primitive pairs inside a `ShellPairList`. A custom function needs the primitives themselves.
+    static constexpr bool SupportsPrimitivePairData = false;
+
 
 private:
     // A user-supplied custom function that can calculate primitive integrals over four Cartesian GTOs.
@@ -20,6 +20,8 @@
 
 #include "Mathematical/Representation/Matrix.hpp"
 
+#include <vector>
+
 
 namespace GQCP {
 
@@ -38,6 +40,12 @@ private:
     // The nuclear center.
     Vector<double, 3> C;
 
+    // The maximum order n for which the base case values are precomputed.
+    size_t maximum_order;
+
+    // The precomputed base case values (-2p)^n F_n(p R_PC^2), for n = 0, ..., `maximum_order`.
+    std::vector<double> base_values;
+
 
 public:
     /*
@@ -51,6 +59,16 @@ public:
      */
     HermiteCoulombIntegral(const double p, const Vector<double, 3>& P, const Vector<double, 3>& C);
 
+    /**
+     *  @param p                    The exponent of the Hermite Gaussian.
+     *  @param P                    The center of the Hermite Gaussian.
+     *  @param C                    The nuclear center.
+     *  @param maximum_order        The maximum order n for which the base case R^n_{000} should be precomputed. This should be t + u + v for the highest-degree integral R^0_{tuv} that will be requested.
+     *
+     *  @note All base case values are calculated at once through the tabulated Boys function, so that the recursion does not have to evaluate the Boys function in every one of its leaves.
+     */
+    HermiteCoulombIntegral(const double p, const Vector<double, 3>& P, const Vector<double, 3>& C, const size_t maximum_order);
+
 
     /*
      *  MARK: Hermite Coulomb integral implementation
@@ -21,12 +21,15 @@
 #include "Basis/Integrals/Primitive/DoubleLondonHermiteCoulombIntegral.hpp"
 #include "Basis/Integrals/Primitive/HermiteCoulombIntegral.hpp"
 #include "Basis/Integrals/Primitive/McMurchieDavidsonCoefficient.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
 #include "Basis/ScalarBasis/GTOShell.hpp"
 #include "Operator/FirstQuantized/CoulombRepulsionOperator.hpp"
 
 #include <boost/math/constants/constants.hpp>
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 
 namespace GQCP {
@@ -50,6 +53,18 @@ public:
     // The scalar representation of a nuclear attraction integral.
     using IntegralScalar = product_t<CoulombRepulsionOperator::Scalar, typename Primitive::OutputType>;
 
+    // If this engine can calculate integrals from the Gaussian product data of the primitive pairs inside a `ShellPairList`.
+    static constexpr bool SupportsPrimitivePairData = std::is_same<_Shell, GTOShell>::value;
+
+
+private:
+    // The McMurchie-Davidson coefficients of the current bra and ket primitive pair, for the x-, y- and z-direction. They are kept as members to avoid re-allocating them for every primitive quartet.
+    std::array<std::vector<double>, 3> bra_coefficients;
+    std::array<std::vector<double>, 3> ket_coefficients;
+
+    // The tabulated Hermite Coulomb integrals R^0_{tuv} of the current primitive quartet.
+    std::vector<double> hermite_coulomb_integrals;
+
 
 public:
     /*
@@ -126,7 +141,8 @@ public:
         const Vector<double, 3> P {E_x.centerOfMass(), E_y.centerOfMass(), E_z.centerOfMass()};
         const Vector<double, 3> Q {E_x_.centerOfMass(), E_y_.centerOfMass(), E_z_.centerOfMass()};
 
-        const HermiteCoulombIntegral R {alpha, P, Q};
+        const auto maximum_order = static_cast<size_t>(i + j + k + l + m + n + i_ + j_ + k_ + l_ + m_ + n_);
+        const HermiteCoulombIntegral R {alpha, P, Q, maximum_order};
 
 
         // Calculate the Coulomb repulsion integrals over the primitives.
@@ -152,6 +168,139 @@ public:
     }
 
 
+    /*
+     *  MARK: Primitive pair integrals
+     */
+
+    /**
+     *  Add the contributions of one bra and one ket primitive pair to the Coulomb repulsion integrals over all the basis functions of a shell quartet. The Gaussian product data of both primitive pairs is read from the structure-of-arrays data of the shell pair lists, and the Hermite Coulomb integrals are calculated only once for all the basis function quartets.
+     * 
+     *  @param bra_shell_pairs          The shell pair list that contains the bra shell pair.
+     *  @param bra_index                The index of the bra shell pair in its shell pair list.
+     *  @param p12                      The index of the bra primitive pair inside the primitive pair data of the bra shell pair list.
+     *  @param ket_shell_pairs          The shell pair list that contains the ket shell pair.
+     *  @param ket_index                The index of the ket shell pair in its shell pair list.
+     *  @param p34                      The index of the ket primitive pair inside the primitive pair data of the ket shell pair list.
+     *  @param integrals                The integrals over all the basis function quartets of the shell quartet, in which the basis functions of the fourth shell run fastest.
+     */
+    template <typename Z = Shell>
+    enable_if_t<std::is_same<Z, GTOShell>::value> addPrimitivePairContributions(const ShellPairList<GTOShell>& bra_shell_pairs, const size_t bra_index, const size_t p12, const ShellPairList<GTOShell>& ket_shell_pairs, const size_t ket_index, const size_t p34, std::vector<IntegralScalar>& integrals) {
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+        const auto& shell1 = bra_shell_pairs.shell(bra.first_shell_index);
+        const auto& shell2 = bra_shell_pairs.shell(bra.second_shell_index);
+        const auto& shell3 = ket_shell_pairs.shell(ket.first_shell_index);
+        const auto& shell4 = ket_shell_pairs.shell(ket.second_shell_index);
+
+        const auto l1 = shell1.angularMomentum();
+        const auto l2 = shell2.angularMomentum();
+        const auto l3 = shell3.angularMomentum();
+        const auto l4 = shell4.angularMomentum();
+
+
+        // Read the Gaussian product data of the bra and ket primitive pairs.
+        const double p = bra_shell_pairs.exponentSums()[p12];
+        const double q = ket_shell_pairs.exponentSums()[p34];
+
+        const Vector<double, 3> P {bra_shell_pairs.productCenters(CartesianDirection::x)[p12], bra_shell_pairs.productCenters(CartesianDirection::y)[p12], bra_shell_pairs.productCenters(CartesianDirection::z)[p12]};
+        const Vector<double, 3> Q {ket_shell_pairs.productCenters(CartesianDirection::x)[p34], ket_shell_pairs.productCenters(CartesianDirection::y)[p34], ket_shell_pairs.productCenters(CartesianDirection::z)[p34]};
+
+        const double prefactor = 2 * std::pow(boost::math::constants::pi<double>(), 2.5) / (p * q * std::sqrt(p + q)) *
+                                 bra_shell_pairs.gaussianPrefactors()[p12] * ket_shell_pairs.gaussianPrefactors()[p34] *
+                                 bra_shell_pairs.contractionCoefficients()[p12] * ket_shell_pairs.contractionCoefficients()[p34];
+
+
+        // Prepare the McMurchie-Davidson coefficients. Their base case E^{00}_0 is absorbed in the Gaussian prefactors K_AB and K_CD.
+        const auto& A = shell1.nucleus().position();
+        const auto& B = shell2.nucleus().position();
+        const auto& C = shell3.nucleus().position();
+        const auto& D = shell4.nucleus().position();
+
+        for (size_t direction = 0; direction < 3; direction++) {
+            PrimitiveCoulombRepulsionIntegralEngine<Shell>::calculateMcMurchieDavidsonCoefficients(l1, l2, p, P(direction) - A(direction), P(direction) - B(direction), this->bra_coefficients[direction]);
+            PrimitiveCoulombRepulsionIntegralEngine<Shell>::calculateMcMurchieDavidsonCoefficients(l3, l4, q, Q(direction) - C(direction), Q(direction) - D(direction), this->ket_coefficients[direction]);
+        }
+
+
+        // Tabulate the Hermite Coulomb integrals R^0_{tuv} with t + u + v <= L, which are shared by all the basis function quartets.
+        const auto L = l1 + l2 + l3 + l4;
+        const auto dimension = L + 1;
+        const HermiteCoulombIntegral R {p * q / (p + q), P, Q, L};
+
+        this->hermite_coulomb_integrals.assign(dimension * dimension * dimension, 0.0);
+        for (size_t t = 0; t <= L; t++) {
+            for (size_t u = 0; u + t <= L; u++) {
+                for (size_t v = 0; v + u + t <= L; v++) {
+                    this->hermite_coulomb_integrals[(t * dimension + u) * dimension + v] = R(0, static_cast<int>(t), static_cast<int>(u), static_cast<int>(v));
+                }
+            }
+        }
+
+
+        // Contract the McMurchie-Davidson coefficients with the Hermite Coulomb integrals, for every basis function quartet.
+        const auto& E_x = this->bra_coefficients[CartesianDirection::x];
+        const auto& E_y = this->bra_coefficients[CartesianDirection::y];
+        const auto& E_z = this->bra_coefficients[CartesianDirection::z];
+
+        const auto& E_x_ = this->ket_coefficients[CartesianDirection::x];
+        const auto& E_y_ = this->ket_coefficients[CartesianDirection::y];
+        const auto& E_z_ = this->ket_coefficients[CartesianDirection::z];
+
+        const auto bra_element = [l2, l1](const size_t i, const size_t j, const size_t t) { return (i * (l2 + 1) + j) * (l1 + l2 + 1) + t; };
+        const auto ket_element = [l4, l3](const size_t i, const size_t j, const size_t t) { return (i * (l4 + 1) + j) * (l3 + l4 + 1) + t; };
+
+        size_t index = 0;
+        for (const auto& exponents1 : bra_shell_pairs.cartesianExponents(bra.first_shell_index)) {
+            const auto i = exponents1.value(CartesianDirection::x);
+            const auto k = exponents1.value(CartesianDirection::y);
+            const auto m = exponents1.value(CartesianDirection::z);
+
+            for (const auto& exponents2 : bra_shell_pairs.cartesianExponents(bra.second_shell_index)) {
+                const auto j = exponents2.value(CartesianDirection::x);
+                const auto l = exponents2.value(CartesianDirection::y);
+                const auto n = exponents2.value(CartesianDirection::z);
+
+                for (const auto& exponents3 : ket_shell_pairs.cartesianExponents(ket.first_shell_index)) {
+                    const auto i_ = exponents3.value(CartesianDirection::x);
+                    const auto k_ = exponents3.value(CartesianDirection::y);
+                    const auto m_ = exponents3.value(CartesianDirection::z);
+
+                    for (const auto& exponents4 : ket_shell_pairs.cartesianExponents(ket.second_shell_index)) {
+                        const auto j_ = exponents4.value(CartesianDirection::x);
+                        const auto l_ = exponents4.value(CartesianDirection::y);
+                        const auto n_ = exponents4.value(CartesianDirection::z);
+
+                        double integral {};
+                        for (size_t t = 0; t <= i + j; t++) {
+                            for (size_t u = 0; u <= k + l; u++) {
+                                for (size_t v = 0; v <= m + n; v++) {
+                                    const double E_bra = E_x[bra_element(i, j, t)] * E_y[bra_element(k, l, u)] * E_z[bra_element(m, n, v)];
+
+                                    for (size_t tau = 0; tau <= i_ + j_; tau++) {
+                                        for (size_t mu = 0; mu <= k_ + l_; mu++) {
+                                            for (size_t nu = 0; nu <= m_ + n_; nu++) {
+                                                const double sign = ((tau + mu + nu) % 2 == 0) ? 1.0 : -1.0;
+                                                const double E_ket = E_x_[ket_element(i_, j_, tau)] * E_y_[ket_element(k_, l_, mu)] * E_z_[ket_element(m_, n_, nu)];
+
+                                                integral += E_bra * sign * E_ket * this->hermite_coulomb_integrals[((t + tau) * dimension + (u + mu)) * dimension + (v + nu)];
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        integrals[index] += prefactor * integral;
+                        index++;
+                    }
+                }
+            }
+        }
+    }
+
+
     /*
      *  MARK: CartesianGTO integrals
      */
@@ -255,6 +404,63 @@ public:
                std::exp(-k1.squaredNorm() / (4 * p)) * std::exp(-k2.squaredNorm() / (4 * q)) *
                integral;
     }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  Calculate the McMurchie-Davidson coefficients E^{ij}_t / E^{00}_0 along one Cartesian direction, for all i <= l1 and j <= l2, through their recurrence relations.
+     * 
+     *  @param l1               The maximum Cartesian exponent of the first primitive.
+     *  @param l2               The maximum Cartesian exponent of the second primitive.
+     *  @param p                The total exponent of the Gaussian overlap distribution.
+     *  @param X_PA             The component of the distance between the center of the Gaussian overlap distribution and the center of the first primitive.
+     *  @param X_PB             The component of the distance between the center of the Gaussian overlap distribution and the center of the second primitive.
+     *  @param E                The McMurchie-Davidson coefficients, in which E^{ij}_t / E^{00}_0 is stored at the index (i (l2 + 1) + j) (l1 + l2 + 1) + t.
+     */
+    static void calculateMcMurchieDavidsonCoefficients(const size_t l1, const size_t l2, const double p, const double X_PA, const double X_PB, std::vector<double>& E) {
+
+        const auto T = l1 + l2 + 1;
+        const auto element = [l2, T](const size_t i, const size_t j, const size_t t) { return (i * (l2 + 1) + j) * T + t; };
+        const double one_over_2p = 1.0 / (2 * p);
+
+        // The coefficients with t > i + j vanish, so they are left at zero.
+        E.assign((l1 + 1) * (l2 + 1) * T, 0.0);
+        E[element(0, 0, 0)] = 1.0;
+
+        // Do the recurrence for E^{i+1, 0}_t.
+        for (size_t i = 1; i <= l1; i++) {
+            for (size_t t = 0; t <= i; t++) {
+                double value = X_PA * E[element(i - 1, 0, t)];
+                if (t > 0) {
+                    value += one_over_2p * E[element(i - 1, 0, t - 1)];
+                }
+                if (t + 1 <= i - 1) {
+                    value += (t + 1) * E[element(i - 1, 0, t + 1)];
+                }
+                E[element(i, 0, t)] = value;
+            }
+        }
+
+        // Do the recurrence for E^{i, j+1}_t.
+        for (size_t i = 0; i <= l1; i++) {
+            for (size_t j = 1; j <= l2; j++) {
+                for (size_t t = 0; t <= i + j; t++) {
+                    double value = X_PB * E[element(i, j - 1, t)];
+                    if (t > 0) {
+                        value += one_over_2p * E[element(i, j - 1, t - 1)];
+                    }
+                    if (t + 1 <= i + j - 1) {
+                        value += (t + 1) * E[element(i, j - 1, t + 1)];
+                    }
+                    E[element(i, j, t)] = value;
+                }
+            }
+        }
+    }
 };
 
 
@@ -119,7 +119,7 @@ public:
             double integral {0.0};
 
             const auto& C = nucleus.position();
-            const HermiteCoulombIntegral R {p, P, C};
+            const HermiteCoulombIntegral R {p, P, C, static_cast<size_t>(i + j + k + l + m + n)};
 
             for (int t = 0; t <= i + j; t++) {
                 for (int u = 0; u <= k + l; u++) {
@@ -0,0 +1,395 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Basis/ScalarBasis/LondonGTOShell.hpp"
+#include "Basis/ScalarBasis/ShellSet.hpp"
+#include "Mathematical/Functions/CartesianDirection.hpp"
+#include "Mathematical/Functions/CartesianExponents.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A description of one (significant) pair of shells inside a `ShellPairList`.
+ */
+struct ShellPair {
+public:
+    // The index of the first shell of this pair inside the shell set.
+    size_t first_shell_index;
+
+    // The index of the second shell of this pair inside the shell set.
+    size_t second_shell_index;
+
+    // The total basis function index of the first basis function of the first shell.
+    size_t first_basis_function_index;
+
+    // The total basis function index of the first basis function of the second shell.
+    size_t second_basis_function_index;
+
+    // The index of the first significant primitive pair of this shell pair inside the primitive pair data.
+    size_t primitive_pair_begin;
+
+    // The index one past the last significant primitive pair of this shell pair inside the primitive pair data.
+    size_t primitive_pair_end;
+
+    // The Schwarz bound max_{mu in a, nu in b} |(mu nu|mu nu)|^{1/2} for this shell pair. It is infinite as long as it has not been calculated.
+    double schwarz_bound;
+
+
+public:
+    /**
+     *  @return The number of significant primitive pairs in this shell pair.
+     */
+    size_t numberOfPrimitivePairs() const { return this->primitive_pair_end - this->primitive_pair_begin; }
+};
+
+
+/**
+ *  A list of the significant pairs of shells in a shell set, together with their significant primitive pairs.
+ *
+ *  The list is supposed to be constructed once per scalar basis (see `ScalarBasis::shellPairs()`), after which it can be shared by every two-electron integral engine. The Gaussian product data of the primitive pairs is stored in a structure-of-arrays layout, contiguously per shell pair, such that the primitive loops inside one shell pair only run over the significant primitive pairs and read contiguous memory.
+ *
+ *  @tparam _Shell          The type of shell that this shell pair list contains.
+ */
+template <typename _Shell>
+class ShellPairList {
+public:
+    // The type of shell that this shell pair list contains.
+    using Shell = _Shell;
+
+    // The type of basis functions that the shells contain.
+    using BasisFunction = typename Shell::BasisFunction;
+
+
+private:
+    // The shells of the shell set over which the pairs have been constructed.
+    std::vector<Shell> shells;
+
+    // The total basis function index of the first basis function of every shell.
+    std::vector<size_t> basis_function_indices;
+
+    // The basis functions of every shell, which are constructed only once.
+    std::vector<std::vector<BasisFunction>> shell_basis_functions;
+
+    // The Cartesian exponents of the basis functions of every shell, in the order of the shell's basis functions.
+    std::vector<std::vector<CartesianExponents>> shell_cartesian_exponents;
+
+    // The significant shell pairs, for all ordered shell pairs (a, b).
+    std::vector<ShellPair> pairs;
+
+    // The index of the first and second primitive (i.e. inside the contraction of their shell) of every significant primitive pair. These are only needed by engines that calculate integrals over the primitive functions themselves.
+    std::vector<size_t> first_primitive_indices;
+    std::vector<size_t> second_primitive_indices;
+
+    // The total exponents p = alpha + beta of the Gaussian overlap distributions.
+    std::vector<double> exponent_sums;
+
+    // The x-, y- and z-components of the centers P = (alpha A + beta B) / p of the Gaussian overlap distributions.
+    std::array<std::vector<double>, 3> product_centers;
+
+    // The Gaussian prefactors K_AB = exp(-alpha beta / p |A - B|^2).
+    std::vector<double> gaussian_prefactors;
+
+    // The products of the contraction coefficients d_a d_b.
+    std::vector<double> coefficient_products;
+
+    // The threshold below which primitive pairs are considered to be negligible.
+    double threshold;
+
+    // A token that identifies the shell pair data of this list, such that engines can recognize the lists for which they have cached data.
+    size_t data_token;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct the list of all significant shell pairs in the given shell set, together with their significant primitive pairs.
+     *
+     *  @param shell_set            The shell set whose shell pairs should be constructed.
+     *  @param threshold            The threshold below which a primitive pair is considered to be negligible, i.e. if |d_a d_b| K_AB < threshold. Shell pairs that do not contain any significant primitive pairs are left out of the list.
+     */
+    ShellPairList(const ShellSet<Shell>& shell_set, const double threshold = 1.0e-15) :
+        shells {shell_set.asVector()},
+        threshold {threshold},
+        data_token {ShellPairList<Shell>::nextToken()} {
+
+        const auto number_of_shells = this->shells.size();
+
+        // Prepare the per-shell data.
+        this->basis_function_indices.reserve(number_of_shells);
+        this->shell_basis_functions.reserve(number_of_shells);
+        this->shell_cartesian_exponents.reserve(number_of_shells);
+        size_t bf_index = 0;
+        for (const auto& shell : this->shells) {
+            this->basis_function_indices.push_back(bf_index);
+            this->shell_basis_functions.push_back(shell.basisFunctions());
+            this->shell_cartesian_exponents.push_back(ShellPairList<Shell>::gtoShellOf(shell).generateCartesianExponents());
+            bf_index += shell.numberOfBasisFunctions();
+        }
+
+
+        // Determine the significant primitive pairs, for every ordered shell pair.
+        for (size_t a = 0; a < number_of_shells; a++) {
+            const auto& shell_a = ShellPairList<Shell>::gtoShellOf(this->shells[a]);
+            const auto& A = shell_a.nucleus().position();
+
+            for (size_t b = 0; b < number_of_shells; b++) {
+                const auto& shell_b = ShellPairList<Shell>::gtoShellOf(this->shells[b]);
+                const auto& B = shell_b.nucleus().position();
+                const double AB2 = (A - B).squaredNorm();
+
+                const auto primitive_pair_begin = this->coefficient_products.size();
+                for (size_t i = 0; i < shell_a.contractionSize(); i++) {
+                    const auto alpha = shell_a.gaussianExponents()[i];
+                    const auto d_a = shell_a.contractionCoefficients()[i];
+
+                    for (size_t j = 0; j < shell_b.contractionSize(); j++) {
+                        const auto beta = shell_b.gaussianExponents()[j];
+                        const auto d_b = shell_b.contractionCoefficients()[j];
+
+                        const double p = alpha + beta;
+                        const double K_AB = std::exp(-alpha * beta / p * AB2);
+
+                        // Skip primitive pairs whose Gaussian product is negligible.
+                        if (std::abs(d_a * d_b) * K_AB < threshold) {
+                            continue;
+                        }
+
+                        this->first_primitive_indices.push_back(i);
+                        this->second_primitive_indices.push_back(j);
+                        this->exponent_sums.push_back(p);
+                        for (size_t direction = 0; direction < 3; direction++) {
+                            this->product_centers[direction].push_back((alpha * A(direction) + beta * B(direction)) / p);
+                        }
+                        this->gaussian_prefactors.push_back(K_AB);
+                        this->coefficient_products.push_back(d_a * d_b);
+                    }
+                }
+                const auto primitive_pair_end = this->coefficient_products.size();
+
+                // Only keep shell pairs that have significant primitive pairs.
+                if (primitive_pair_end == primitive_pair_begin) {
+                    continue;
+                }
+
+                this->pairs.push_back(ShellPair {a, b, this->basis_function_indices[a], this->basis_function_indices[b], primitive_pair_begin, primitive_pair_end, std::numeric_limits<double>::infinity()});
+            }
+        }
+    }
+
+
+    /*
+     *  MARK: Shells
+     */
+
+    /**
+     *  @return The number of shells over which the pairs have been constructed.
+     */
+    size_t numberOfShells() const { return this->shells.size(); }
+
+    /**
+     *  @param shell_index          The index of a shell.
+     *
+     *  @return The shell at the given index.
+     */
+    const Shell& shell(const size_t shell_index) const { return this->shells[shell_index]; }
+
+    /**
+     *  @param shell_index          The index of a shell.
+     *
+     *  @return The basis functions of the shell at the given index.
+     */
+    const std::vector<BasisFunction>& basisFunctions(const size_t shell_index) const { return this->shell_basis_functions[shell_index]; }
+
+    /**
+     *  @param shell_index          The index of a shell.
+     *
+     *  @return The total basis function index of the first basis function of the shell at the given index.
+     */
+    size_t basisFunctionIndex(const size_t shell_index) const { return this->basis_function_indices[shell_index]; }
+
+    /**
+     *  @param shell_index          The index of a shell.
+     *
+     *  @return The Cartesian exponents of the basis functions of the shell at the given index, in the order of its basis functions.
+     */
+    const std::vector<CartesianExponents>& cartesianExponents(const size_t shell_index) const { return this->shell_cartesian_exponents[shell_index]; }
+
+
+    /*
+     *  MARK: Shell pairs
+     */
+
+    /**
+     *  @return The number of significant shell pairs.
+     */
+    size_t numberOfShellPairs() const { return this->pairs.size(); }
+
+    /**
+     *  @param pair_index           The index of a shell pair.
+     *
+     *  @return The shell pair at the given index.
+     */
+    const ShellPair& shellPair(const size_t pair_index) const { return this->pairs[pair_index]; }
+
+    /**
+     *  @return All the significant shell pairs.
+     */
+    const std::vector<ShellPair>& shellPairs() const { return this->pairs; }
+
+    /**
+     *  @return The threshold below which primitive pairs are considered to be negligible.
+     */
+    double primitiveThreshold() const { return this->threshold; }
+
+    /**
+     *  @return A token that identifies the shell pair data of this list. Different shell pair lists have different tokens, while copies share the token of the list they have been copied from.
+     */
+    size_t dataToken() const { return this->data_token; }
+
+
+    /*
+     *  MARK: Primitive pair data
+     */
+
+    /**
+     *  @return The number of significant primitive pairs, over all shell pairs.
+     */
+    size_t numberOfPrimitivePairs() const { return this->coefficient_products.size(); }
+
+    /**
+     *  @return The index (inside its shell's contraction) of the first primitive of every primitive pair.
+     */
+    const std::vector<size_t>& firstPrimitiveIndices() const { return this->first_primitive_indices; }
+
+    /**
+     *  @return The index (inside its shell's contraction) of the second primitive of every primitive pair.
+     */
+    const std::vector<size_t>& secondPrimitiveIndices() const { return this->second_primitive_indices; }
+
+    /**
+     *  @return The total exponent p = alpha + beta of the Gaussian overlap distribution of every primitive pair.
+     */
+    const std::vector<double>& exponentSums() const { return this->exponent_sums; }
+
+    /**
+     *  @param direction            A Cartesian direction.
+     *
+     *  @return The component along the given direction of the center P = (alpha A + beta B) / p of the Gaussian overlap distribution of every primitive pair.
+     */
+    const std::vector<double>& productCenters(const CartesianDirection direction) const { return this->product_centers[direction]; }
+
+    /**
+     *  @return The Gaussian prefactor K_AB = exp(-alpha beta / p |A - B|^2) of every primitive pair.
+     */
+    const std::vector<double>& gaussianPrefactors() const { return this->gaussian_prefactors; }
+
+    /**
+     *  @return The product of the contraction coefficients d_a d_b of every primitive pair.
+     */
+    const std::vector<double>& contractionCoefficients() const { return this->coefficient_products; }
+
+
+    /*
+     *  MARK: Screening
+     */
+
+    /**
+     *  @return If the Schwarz bounds of the shell pairs have been calculated.
+     */
+    bool hasSchwarzBounds() const {
+
+        return std::none_of(this->pairs.begin(), this->pairs.end(), [](const ShellPair& pair) { return std::isinf(pair.schwarz_bound); });
+    }
+
+
+    /**
+     *  Calculate the Schwarz bound max_{mu in a, nu in b} |(mu nu|mu nu)|^{1/2} of every shell pair, using the given two-electron integral engine.
+     *
+     *  @param engine           The engine that can calculate two-electron integrals over shells. Any backend (in-house, Libint, Libcint) can be used.
+     *
+     *  @tparam Engine          The type of the two-electron integral engine.
+     */
+    template <typename Engine>
+    void calculateSchwarzBounds(Engine& engine) {
+
+        for (auto& pair : this->pairs) {
+            const auto& shell_a = this->shells[pair.first_shell_index];
+            const auto& shell_b = this->shells[pair.second_shell_index];
+
+            const auto buffer = engine.calculate(shell_a, shell_b, shell_a, shell_b);
+
+            double maximum = 0.0;
+            for (size_t f1 = 0; f1 < shell_a.numberOfBasisFunctions(); f1++) {
+                for (size_t f2 = 0; f2 < shell_b.numberOfBasisFunctions(); f2++) {
+                    for (size_t i = 0; i < Engine::N; i++) {
+                        maximum = std::max(maximum, static_cast<double>(std::abs(buffer->value(i, f1, f2, f1, f2))));
+                    }
+                }
+            }
+
+            pair.schwarz_bound = std::sqrt(maximum);
+        }
+    }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @param shell        A GTO shell.
+     *
+     *  @return The given shell.
+     */
+    static const GTOShell& gtoShellOf(const GTOShell& shell) { return shell; }
+
+    /**
+     *  @param shell        A London GTO shell.
+     *
+     *  @return The GTO shell that underlies the given London GTO shell.
+     */
+    static const GTOShell& gtoShellOf(const LondonGTOShell& shell) { return shell.gtoShell(); }
+
+    /**
+     *  @return A new token, different from the tokens of all the shell pair lists that have been constructed before.
+     */
+    static size_t nextToken() {
+
+        static std::atomic<size_t> counter {0};
+        return ++counter;
+    }
+};
+
+
+}  // namespace GQCP
@@ -20,6 +20,7 @@
 #include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
 #include "Basis/Integrals/TwoElectronIntegralBuffer.hpp"
 #include "Basis/ScalarBasis/GTOShell.hpp"
+#include "Utilities/type_traits.hpp"
 
 
 namespace GQCP {
@@ -141,6 +142,145 @@ public:
 
         return std::make_shared<TwoElectronIntegralBuffer<IntegralScalar, N>>(shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions(), integrals);
     }
+
+
+    /**
+     *  Calculate all the two-electron integrals over the shells of the given bra and ket shell pairs.
+     * 
+     *  @param bra_shell_pairs          The shell pair list that contains the bra shell pair.
+     *  @param bra_index                The index of the bra shell pair (i.e. the first and second shell) in its shell pair list.
+     *  @param ket_shell_pairs          The shell pair list that contains the ket shell pair.
+     *  @param ket_index                The index of the ket shell pair (i.e. the third and fourth shell) in its shell pair list.
+     * 
+     *  @note This method is not marked const to allow the Engine's internals to be changed.
+     * 
+     *  @return A buffer containing the calculated integrals.
+     * 
+     *  @note The primitive loops only run over the contiguously stored significant primitive pairs of the bra and ket. If the primitive engine supports it, the integrals are calculated directly from the Gaussian product data of the primitive pairs, and otherwise from the primitives of the basis functions that have been constructed once in the shell pair lists.
+     */
+    std::shared_ptr<BaseTwoElectronIntegralBuffer<IntegralScalar, N>> calculate(const ShellPairList<Shell>& bra_shell_pairs, const size_t bra_index, const ShellPairList<Shell>& ket_shell_pairs, const size_t ket_index) override {
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+        const auto& shell1 = bra_shell_pairs.shell(bra.first_shell_index);
+        const auto& shell2 = bra_shell_pairs.shell(bra.second_shell_index);
+        const auto& shell3 = ket_shell_pairs.shell(ket.first_shell_index);
+        const auto& shell4 = ket_shell_pairs.shell(ket.second_shell_index);
+
+        std::array<std::vector<IntegralScalar>, N> integrals;  // A "buffer" that stores the calculated integrals.
+        for (size_t i = 0; i < N; i++) {                       // Loop over all components of the operator.
+            this->primitive_engine.prepareStateForComponent(i);
+            integrals[i] = this->calculateOverPrimitivePairs(bra_shell_pairs, bra_index, ket_shell_pairs, ket_index);
+        }
+
+        return std::make_shared<TwoElectronIntegralBuffer<IntegralScalar, N>>(shell1.numberOfBasisFunctions(), shell2.numberOfBasisFunctions(), shell3.numberOfBasisFunctions(), shell4.numberOfBasisFunctions(), integrals);
+    }
+
+
+private:
+    /*
+     *  MARK: Primitive pair loops
+     */
+
+    /**
+     *  Calculate the integrals over the shells of the given bra and ket shell pairs for the current component of the operator, directly from the Gaussian product data of the primitive pairs.
+     * 
+     *  @param bra_shell_pairs          The shell pair list that contains the bra shell pair.
+     *  @param bra_index                The index of the bra shell pair in its shell pair list.
+     *  @param ket_shell_pairs          The shell pair list that contains the ket shell pair.
+     *  @param ket_index                The index of the ket shell pair in its shell pair list.
+     * 
+     *  @return The integrals over all the basis function quartets of the shell quartet, in which the basis functions of the fourth shell run fastest.
+     */
+    template <typename Z = PrimitiveIntegralEngine>
+    enable_if_t<Z::SupportsPrimitivePairData, std::vector<IntegralScalar>> calculateOverPrimitivePairs(const ShellPairList<Shell>& bra_shell_pairs, const size_t bra_index, const ShellPairList<Shell>& ket_shell_pairs, const size_t ket_index) {
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+        const auto number_of_integrals = bra_shell_pairs.shell(bra.first_shell_index).numberOfBasisFunctions() * bra_shell_pairs.shell(bra.second_shell_index).numberOfBasisFunctions() *
+                                         ket_shell_pairs.shell(ket.first_shell_index).numberOfBasisFunctions() * ket_shell_pairs.shell(ket.second_shell_index).numberOfBasisFunctions();
+
+        std::vector<IntegralScalar> integrals(number_of_integrals, IntegralScalar {});
+        for (size_t p12 = bra.primitive_pair_begin; p12 < bra.primitive_pair_end; p12++) {
+            for (size_t p34 = ket.primitive_pair_begin; p34 < ket.primitive_pair_end; p34++) {
+                this->primitive_engine.addPrimitivePairContributions(bra_shell_pairs, bra_index, p12, ket_shell_pairs, ket_index, p34, integrals);
+            }
+        }
+
+        return integrals;
+    }
+
+
+    /**
+     *  Calculate the integrals over the shells of the given bra and ket shell pairs for the current component of the operator, from the primitives of the basis functions that have been constructed once in the shell pair lists.
+     * 
+     *  @param bra_shell_pairs          The shell pair list that contains the bra shell pair.
+     *  @param bra_index                The index of the bra shell pair in its shell pair list.
+     *  @param ket_shell_pairs          The shell pair list that contains the ket shell pair.
+     *  @param ket_index                The index of the ket shell pair in its shell pair list.
+     * 
+     *  @return The integrals over all the basis function quartets of the shell quartet, in which the basis functions of the fourth shell run fastest.
+     */
+    template <typename Z = PrimitiveIntegralEngine>
+    enable_if_t<!Z::SupportsPrimitivePairData, std::vector<IntegralScalar>> calculateOverPrimitivePairs(const ShellPairList<Shell>& bra_shell_pairs, const size_t bra_index, const ShellPairList<Shell>& ket_shell_pairs, const size_t ket_index) {
+
+        const auto& bra = bra_shell_pairs.shellPair(bra_index);
+        const auto& ket = ket_shell_pairs.shellPair(ket_index);
+
+        const auto& basis_functions1 = bra_shell_pairs.basisFunctions(bra.first_shell_index);
+        const auto& basis_functions2 = bra_shell_pairs.basisFunctions(bra.second_shell_index);
+        const auto& basis_functions3 = ket_shell_pairs.basisFunctions(ket.first_shell_index);
+        const auto& basis_functions4 = ket_shell_pairs.basisFunctions(ket.second_shell_index);
+
+        // Prepare the primitive pair data.
+        const auto& bra_primitive_indices1 = bra_shell_pairs.firstPrimitiveIndices();
+        const auto& bra_primitive_indices2 = bra_shell_pairs.secondPrimitiveIndices();
+        const auto& bra_coefficients = bra_shell_pairs.contractionCoefficients();
+
+        const auto& ket_primitive_indices1 = ket_shell_pairs.firstPrimitiveIndices();
+        const auto& ket_primitive_indices2 = ket_shell_pairs.secondPrimitiveIndices();
+        const auto& ket_coefficients = ket_shell_pairs.contractionCoefficients();
+
+        std::vector<IntegralScalar> integrals;
+        integrals.reserve(basis_functions1.size() * basis_functions2.size() * basis_functions3.size() * basis_functions4.size());
+
+        for (const auto& bf1 : basis_functions1) {
+            const auto& primitives1 = bf1.functions();
+
+            for (const auto& bf2 : basis_functions2) {
+                const auto& primitives2 = bf2.functions();
+
+                for (const auto& bf3 : basis_functions3) {
+                    const auto& primitives3 = bf3.functions();
+
+                    for (const auto& bf4 : basis_functions4) {
+                        const auto& primitives4 = bf4.functions();
+
+                        IntegralScalar integral {};
+                        for (size_t p12 = bra.primitive_pair_begin; p12 < bra.primitive_pair_end; p12++) {
+                            const auto& primitive1 = primitives1[bra_primitive_indices1[p12]];
+                            const auto& primitive2 = primitives2[bra_primitive_indices2[p12]];
+                            const auto& d12 = bra_coefficients[p12];
+
+                            for (size_t p34 = ket.primitive_pair_begin; p34 < ket.primitive_pair_end; p34++) {
+                                const auto& primitive3 = primitives3[ket_primitive_indices1[p34]];
+                                const auto& primitive4 = primitives4[ket_primitive_indices2[p34]];
+                                const auto& d34 = ket_coefficients[p34];
+
+                                const auto primitive_integral = this->primitive_engine.calculate(primitive1, primitive2, primitive3, primitive4);
+                                integral += d12 * d34 * primitive_integral;
+                            }
+                        }
+                        integrals.push_back(integral);
+                    }
+                }
+            }
+        }
+
+        return integrals;
+    }
 };
 
 
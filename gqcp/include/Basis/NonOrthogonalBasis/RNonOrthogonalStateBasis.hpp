@@ -286,6 +286,9 @@ public:
         // Since the matrix is always squared, we only need one parameter to define its dimensions.
         Matrix evaluated_operator = Matrix::Zero(this->numberOfBasisStates());
 
+        // The contractions are performed for every pair of basis states, so they are set up only once.
+        static constexpr ContractionPlan<2, 2, 0> trace_plan {"uv, vu ->"};
+
         // Secondly, we map the operator parameters to a tensor representation.
         // This will be necessary to perform the correct contractions.
         Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>> operator_tensor_map {f_op.parameters().data(), f_op.parameters().rows(), f_op.parameters().cols()};
@@ -310,7 +313,7 @@ public:
                     const auto weighted_co_density = lowdin_pairing_basis.weightedCoDensity();
 
                     // Perform the contraction.
-                    Tensor<Scalar, 0> matrix_element = std::pow(reduced_overlap, 2) * operator_parameters_tensor.template einsum<2>("uv, vu ->", weighted_co_density.matrix());
+                    Tensor<Scalar, 0> matrix_element = std::pow(reduced_overlap, 2) * operator_parameters_tensor.einsum(trace_plan, weighted_co_density.matrix());
                     evaluated_operator(i, j) += 2.0 * matrix_element(0);
                 }
                 // In the restricted case, if there is a zero overlap value present, this zero ebbs on in both the alpha and beta channel, thus resulting in two zeros in total.
@@ -369,6 +372,12 @@ public:
         // Since the matrix is always squared, we only need one parameter to define its dimensions.
         Matrix evaluated_operator = Matrix::Zero(this->numberOfBasisStates());
 
+        // The contractions are performed for every pair of basis states, so they are set up only once.
+        static constexpr ContractionPlan<4, 2, 2> direct_plan {"utvs, tu -> vs"};
+        static constexpr ContractionPlan<2, 2, 0> direct_trace_plan {"vs, sv ->"};
+        static constexpr ContractionPlan<4, 2, 2> exchange_plan {"utvs, su -> tv"};
+        static constexpr ContractionPlan<2, 2, 0> exchange_trace_plan {"tv, tv ->"};
+
         // Loop over all basis states and calculate each matrix element using the generalized Slater-Condon rules.
         for (size_t i = 0; i < this->numberOfBasisStates(); i++) {
             for (size_t j = 0; j < this->numberOfBasisStates(); j++) {
@@ -389,11 +398,11 @@ public:
 
                     // Perform the contractions. We need to perform two contractions (one for the direct component, one for the exchange component).
                     // In order to perserve readability of the contractions, and keep the exact link with the theory, we split each contraction in two.
-                    Tensor<Scalar, 2> intermediate_contraction_1 = g_op.parameters().template einsum<2>("utvs, tu -> vs", weighted_co_density.matrix());
-                    Tensor<Scalar, 0> direct_element = intermediate_contraction_1.template einsum<2>("vs, sv ->", weighted_co_density.matrix());
+                    Tensor<Scalar, 2> intermediate_contraction_1 = g_op.parameters().einsum(direct_plan, weighted_co_density.matrix());
+                    Tensor<Scalar, 0> direct_element = intermediate_contraction_1.einsum(direct_trace_plan, weighted_co_density.matrix());
 
-                    Tensor<Scalar, 2> intermediate_contraction_2 = g_op.parameters().template einsum<2>("utvs, su -> tv", weighted_co_density.matrix());
-                    Tensor<Scalar, 0> exchange_element = intermediate_contraction_2.template einsum<2>("tv, tv ->", weighted_co_density.matrix());
+                    Tensor<Scalar, 2> intermediate_contraction_2 = g_op.parameters().einsum(exchange_plan, weighted_co_density.matrix());
+                    Tensor<Scalar, 0> exchange_element = intermediate_contraction_2.einsum(exchange_trace_plan, weighted_co_density.matrix());
 
                     evaluated_operator(i, j) += std::pow(reduced_overlap, 2) * (2.0 * direct_element(0) - exchange_element(0));
                 }
@@ -411,8 +420,8 @@ public:
 
                     // Perform the contractions. We need to perform two contractions (one for the direct component, one for the exchange component).
                     // In order to perserve readability of the contractions, and keep the exact link with the theory, we split each contraction in two.
-                    Tensor<Scalar, 2> intermediate_contraction = g_op.parameters().template einsum<2>("utvs, tu -> vs", co_density.matrix());
-                    Tensor<Scalar, 0> direct_element = intermediate_contraction.template einsum<2>("vs, sv ->", co_density.matrix());
+                    Tensor<Scalar, 2> intermediate_contraction = g_op.parameters().einsum(direct_plan, co_density.matrix());
+                    Tensor<Scalar, 0> direct_element = intermediate_contraction.einsum(direct_trace_plan, co_density.matrix());
 
                     evaluated_operator(i, j) += std::pow(reduced_overlap, 2) * direct_element(0);
                 }
@@ -296,6 +296,9 @@ public:
         // Since the matrix is always squared, we only need one parameter to define its dimensions.
         Matrix evaluated_operator = Matrix::Zero(this->numberOfBasisStates());
 
+        // The contractions are performed for every pair of basis states, so they are set up only once.
+        static constexpr ContractionPlan<2, 2, 0> trace_plan {"uv, vu ->"};
+
         // Secondly, we map the operator parameters to a tensor representation.
         // This will be necessary to perform the correct contractions.
         Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>> operator_tensor_map_alpha {f_op.alpha().parameters().data(), f_op.alpha().parameters().rows(), f_op.alpha().parameters().cols()};
@@ -324,8 +327,8 @@ public:
                     const auto weighted_co_density_beta = lowdin_pairing_basis.weightedCoDensity().beta();
 
                     // Perform the contraction.
-                    Tensor<Scalar, 0> matrix_element_alpha = operator_parameters_tensor_alpha.template einsum<2>("uv, vu ->", weighted_co_density_alpha.matrix());
-                    Tensor<Scalar, 0> matrix_element_beta = operator_parameters_tensor_beta.template einsum<2>("uv, vu ->", weighted_co_density_beta.matrix());
+                    Tensor<Scalar, 0> matrix_element_alpha = operator_parameters_tensor_alpha.einsum(trace_plan, weighted_co_density_alpha.matrix());
+                    Tensor<Scalar, 0> matrix_element_beta = operator_parameters_tensor_beta.einsum(trace_plan, weighted_co_density_beta.matrix());
 
                     evaluated_operator(i, j) += reduced_overlap * (matrix_element_alpha(0) + matrix_element_beta(0));
                 }
@@ -345,10 +348,10 @@ public:
 
                     // Perform the contraction.
                     if (zero_spin == Spin::alpha) {
-                        Tensor<Scalar, 0> matrix_element = operator_parameters_tensor_alpha.template einsum<2>("uv, vu ->", co_density.matrix());
+                        Tensor<Scalar, 0> matrix_element = operator_parameters_tensor_alpha.einsum(trace_plan, co_density.matrix());
                         evaluated_operator(i, j) += reduced_overlap * matrix_element(0);
                     } else {
-                        Tensor<Scalar, 0> matrix_element = operator_parameters_tensor_beta.template einsum<2>("uv, vu ->", co_density.matrix());
+                        Tensor<Scalar, 0> matrix_element = operator_parameters_tensor_beta.einsum(trace_plan, co_density.matrix());
                         evaluated_operator(i, j) += reduced_overlap * matrix_element(0);
                     }
                 }
@@ -408,6 +411,16 @@ public:
         // Since the matrix is always squared, we only need one parameter to define its dimensions.
         Matrix evaluated_operator = Matrix::Zero(this->numberOfBasisStates());
 
+        // The contractions are performed for every pair of basis states, so they are set up only once.
+        static constexpr ContractionPlan<4, 2, 2> direct_plan {"utvs, tu -> vs"};
+        static constexpr ContractionPlan<2, 2, 0> direct_trace_plan {"vs, sv ->"};
+        static constexpr ContractionPlan<4, 2, 2> exchange_plan {"utvs, su -> tv"};
+        static constexpr ContractionPlan<2, 2, 0> exchange_trace_plan {"tv, tv ->"};
+        static constexpr ContractionPlan<4, 2, 2> one_zero_direct_plan {"utvs, sv -> ut"};
+        static constexpr ContractionPlan<2, 2, 0> one_zero_direct_trace_plan {"ut, tu ->"};
+        static constexpr ContractionPlan<4, 2, 2> one_zero_exchange_plan {"utvs, tv -> us"};
+        static constexpr ContractionPlan<2, 2, 0> one_zero_exchange_trace_plan {"us, su ->"};
+
         // Loop over all basis states and calculate each matrix element using the generalized Slater-Condon rules.
         for (size_t i = 0; i < this->numberOfBasisStates(); i++) {
             for (size_t j = 0; j < this->numberOfBasisStates(); j++) {
@@ -427,8 +440,8 @@ public:
 
                     // Perform the contractions. We need to perform two contractions (one for the direct component, one for the exchange component).
                     // In order to perserve readability of the contractions, and keep the exact link with the theory, we split each contraction in two.
-                    Matrix intermediate_direct_contraction_1 = g_op.alphaAlpha().parameters().template einsum<2>("utvs, tu -> vs", weighted_co_density.alpha().matrix()).asMatrix();
-                    Matrix intermediate_direct_contraction_2 = g_op.betaBeta().parameters().template einsum<2>("utvs, tu -> vs", weighted_co_density.beta().matrix()).asMatrix();
+                    Matrix intermediate_direct_contraction_1 = g_op.alphaAlpha().parameters().einsum(direct_plan, weighted_co_density.alpha().matrix()).asMatrix();
+                    Matrix intermediate_direct_contraction_2 = g_op.betaBeta().parameters().einsum(direct_plan, weighted_co_density.beta().matrix()).asMatrix();
 
                     // The complete first direct contraction can the be written as follows.
                     Matrix direct_alpha_beta = intermediate_direct_contraction_1 + intermediate_direct_contraction_2;
@@ -438,17 +451,17 @@ public:
                     Tensor<Scalar, 2> direct_alpha_beta_tensor = Tensor<Scalar, 2>(tensor_map);
 
                     // We can now calculate the alpha and beta contributions with the next set of contractions.
-                    Tensor<Scalar, 0> direct_element_a = direct_alpha_beta_tensor.template einsum<2>("vs, sv ->", weighted_co_density.alpha().matrix());
-                    Tensor<Scalar, 0> direct_element_b = direct_alpha_beta_tensor.template einsum<2>("vs, sv ->", weighted_co_density.beta().matrix());
+                    Tensor<Scalar, 0> direct_element_a = direct_alpha_beta_tensor.einsum(direct_trace_plan, weighted_co_density.alpha().matrix());
+                    Tensor<Scalar, 0> direct_element_b = direct_alpha_beta_tensor.einsum(direct_trace_plan, weighted_co_density.beta().matrix());
 
                     const auto direct_element = direct_element_a(0) + direct_element_b(0);
 
                     // Next, we calculate the exchange elements.
-                    Tensor<Scalar, 2> intermediate_exchange_contraction_1 = g_op.alphaAlpha().parameters().template einsum<2>("utvs, su -> tv", weighted_co_density.alpha().matrix());
-                    Tensor<Scalar, 0> exchange_element_a = intermediate_exchange_contraction_1.template einsum<2>("tv, tv ->", weighted_co_density.alpha().matrix());
+                    Tensor<Scalar, 2> intermediate_exchange_contraction_1 = g_op.alphaAlpha().parameters().einsum(exchange_plan, weighted_co_density.alpha().matrix());
+                    Tensor<Scalar, 0> exchange_element_a = intermediate_exchange_contraction_1.einsum(exchange_trace_plan, weighted_co_density.alpha().matrix());
 
-                    Tensor<Scalar, 2> intermediate_exchange_contraction_2 = g_op.betaBeta().parameters().template einsum<2>("utvs, su -> tv", weighted_co_density.beta().matrix());
-                    Tensor<Scalar, 0> exchange_element_b = intermediate_exchange_contraction_2.template einsum<2>("tv, tv ->", weighted_co_density.beta().matrix());
+                    Tensor<Scalar, 2> intermediate_exchange_contraction_2 = g_op.betaBeta().parameters().einsum(exchange_plan, weighted_co_density.beta().matrix());
+                    Tensor<Scalar, 0> exchange_element_b = intermediate_exchange_contraction_2.einsum(exchange_trace_plan, weighted_co_density.beta().matrix());
 
                     // We can now add the total contrinution to the corresponding metrix element.
                     evaluated_operator(i, j) += 0.5 * reduced_overlap * (direct_element - exchange_element_a(0) - exchange_element_b(0));
@@ -470,8 +483,8 @@ public:
                     // Perform the contractions. We need to perform two contractions (one for the direct component, one for the exchange component).
                     // In order to perserve readability of the contractions, and keep the exact link with the theory, we split each contraction in two.
                     // Since we first have to contract with the weighted co-density matrix, the contractions look a little bit different.
-                    Matrix intermediate_direct_contraction_1 = g_op.alphaAlpha().parameters().template einsum<2>("utvs, sv -> ut", weighted_co_density.alpha().matrix()).asMatrix();
-                    Matrix intermediate_direct_contraction_2 = g_op.betaBeta().parameters().template einsum<2>("utvs, sv -> ut", weighted_co_density.beta().matrix()).asMatrix();
+                    Matrix intermediate_direct_contraction_1 = g_op.alphaAlpha().parameters().einsum(one_zero_direct_plan, weighted_co_density.alpha().matrix()).asMatrix();
+                    Matrix intermediate_direct_contraction_2 = g_op.betaBeta().parameters().einsum(one_zero_direct_plan, weighted_co_density.beta().matrix()).asMatrix();
 
                     // The complete first direct contraction can the be written as follows.
                     Matrix direct_alpha_beta = intermediate_direct_contraction_1 + intermediate_direct_contraction_2;
@@ -481,11 +494,11 @@ public:
                     Tensor<Scalar, 2> direct_alpha_beta_tensor = Tensor<Scalar, 2>(tensor_map);
 
                     // We can now calculate the next contraction of the equation.
-                    GQCP::Tensor<Scalar, 0> direct_element = direct_alpha_beta_tensor.template einsum<2>("ut, tu ->", co_density.matrix());
+                    GQCP::Tensor<Scalar, 0> direct_element = direct_alpha_beta_tensor.einsum(one_zero_direct_trace_plan, co_density.matrix());
 
                     // We calculate the exchange contractions analogously.
-                    Tensor<Scalar, 2> intermediate_exchange_contraction = g_op.pureComponent(zero_spin).parameters().template einsum<2>("utvs, tv -> us", weighted_co_density.component(zero_spin).matrix());
-                    Tensor<Scalar, 0> exchange_element = intermediate_exchange_contraction.template einsum<2>("us, su ->", co_density.matrix());
+                    Tensor<Scalar, 2> intermediate_exchange_contraction = g_op.pureComponent(zero_spin).parameters().einsum(one_zero_exchange_plan, weighted_co_density.component(zero_spin).matrix());
+                    Tensor<Scalar, 0> exchange_element = intermediate_exchange_contraction.einsum(one_zero_exchange_trace_plan, co_density.matrix());
 
                     evaluated_operator(i, j) += (reduced_overlap * (direct_element(0) - exchange_element(0)));
                 }
@@ -507,17 +520,17 @@ public:
 
                     // Perform the contractions. We need to perform two contractions (one for the direct component, one for the exchange component).
                     // In order to perserve readability of the contractions, and keep the exact link with the theory, we split each contraction in two.
-                    Tensor<Scalar, 2> direct_contraction = g_op.pureComponent(zero_overlap_spin_1).parameters().template einsum<2>("utvs, tu -> vs", co_density_1.component(zero_overlap_spin_1).matrix());
+                    Tensor<Scalar, 2> direct_contraction = g_op.pureComponent(zero_overlap_spin_1).parameters().einsum(direct_plan, co_density_1.component(zero_overlap_spin_1).matrix());
 
                     // We can now calculate the next contraction of the equation.
-                    Tensor<Scalar, 0> direct_element = direct_contraction.template einsum<2>("vs, sv ->", active_co_density.matrix());
+                    Tensor<Scalar, 0> direct_element = direct_contraction.einsum(direct_trace_plan, active_co_density.matrix());
 
                     // We calculate the exchange contractions analogously.
                     Scalar exchange_element;
 
                     if (zero_overlap_spin_1 == zero_overlap_spin_2) {
-                        Tensor<Scalar, 2> intermediate_exchange_contraction = g_op.pureComponent(zero_overlap_spin_1).parameters().template einsum<2>("utvs, su -> tv", co_density_1.component(zero_overlap_spin_1).matrix());
-                        Tensor<Scalar, 0> exchange_element_tensor = intermediate_exchange_contraction.template einsum<2>("tv, tv ->", active_co_density.matrix());
+                        Tensor<Scalar, 2> intermediate_exchange_contraction = g_op.pureComponent(zero_overlap_spin_1).parameters().einsum(exchange_plan, co_density_1.component(zero_overlap_spin_1).matrix());
+                        Tensor<Scalar, 0> exchange_element_tensor = intermediate_exchange_contraction.einsum(exchange_trace_plan, active_co_density.matrix());
                         exchange_element = exchange_element_tensor(0);
 
                         // Calculate the evaluated operator element.
@@ -80,6 +80,20 @@ public:
     GTOShell(const size_t l, const Nucleus& nucleus, const std::vector<double>& gaussian_exponents, const std::vector<double>& contraction_coefficients, const bool pure = true, const bool are_embedded_normalization_factors_of_primitives = false, const bool is_normalized = false);
 
 
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a unit shell, i.e. an s-type shell that consists of a single primitive with a Gaussian exponent of zero and a contraction coefficient of one, representing the constant function 1.
+     * 
+     *  @return A unit shell.
+     * 
+     *  @note Placing a unit shell in a shell quartet reduces four-center integrals to three- or two-center integrals, e.g. (P 1|a b) = (P|a b).
+     */
+    static GTOShell Unit();
+
+
     /*
      *  MARK: Shell characteristics
      */
@@ -99,6 +113,11 @@ public:
      */
     bool isPure() const { return this->pure; }
 
+    /**
+     *  @return If this shell is a unit shell, i.e. an s-type shell with a single primitive with a Gaussian exponent of zero.
+     */
+    bool isUnit() const { return (this->l == 0) && (this->gaussian_exponents.size() == 1) && (this->gaussian_exponents[0] == 0.0); }
+
     /**
      *  @return The nucleus on which this shell is centered.
      */
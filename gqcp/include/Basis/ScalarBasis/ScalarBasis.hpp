@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Integrals/ShellPairList.hpp"
 #include "Basis/ScalarBasis/GTOBasisSet.hpp"
 #include "Basis/ScalarBasis/GTOShell.hpp"
 #include "Basis/ScalarBasis/LondonGTOShell.hpp"
@@ -26,7 +27,9 @@
 #include "Molecule/NuclearFramework.hpp"
 #include "Utilities/type_traits.hpp"
 
+#include <atomic>
 #include <functional>
+#include <memory>
 
 
 namespace GQCP {
@@ -53,6 +56,9 @@ private:
     // A collection of shells that represents this scalar basis.
     ShellSet<Shell> shell_set;
 
+    // The significant shell pairs of this scalar basis. They are constructed when they are first requested, and are shared by all copies of this scalar basis.
+    mutable std::shared_ptr<const ShellPairList<Shell>> shell_pairs;
+
 
 public:
     /*
@@ -140,6 +146,32 @@ public:
     const ShellSet<Shell>& shellSet() const { return this->shell_set; }
 
 
+    /*
+     *  MARK: Shell pairs
+     */
+
+    /**
+     *  @return The list of the significant shell pairs of this scalar basis, which can be shared by all two-electron integral engines. It is constructed only once, when it is first requested.
+     */
+    const ShellPairList<Shell>& shellPairs() const {
+
+        auto shell_pairs = std::atomic_load(&this->shell_pairs);
+        if (!shell_pairs) {
+
+            // If another thread has stored its list in the meantime, use that one instead, so that the returned list is never replaced.
+            std::shared_ptr<const ShellPairList<Shell>> expected;
+            const auto constructed_shell_pairs = std::make_shared<const ShellPairList<Shell>>(this->shell_set);
+            if (std::atomic_compare_exchange_strong(&this->shell_pairs, &expected, constructed_shell_pairs)) {
+                shell_pairs = constructed_shell_pairs;
+            } else {
+                shell_pairs = expected;
+            }
+        }
+
+        return *shell_pairs;
+    }
+
+
     /*
      *  MARK: Basis functions
      */
@@ -687,7 +687,7 @@ public:
 
         // 1. Calculate the Coulomb integrals in the underlying scalar bases.
         auto coulomb_engine = GQCP::IntegralEngine::InHouse<GQCP::LondonGTOShell>(CoulombRepulsionOperator());
-        const auto g = GQCP::IntegralCalculator::calculate(coulomb_engine, this->scalarBases().alpha().shellSet(), this->scalarBases().alpha().shellSet())[0];
+        const auto g = GQCP::IntegralCalculator::calculate(coulomb_engine, this->scalarBases().alpha().shellPairs(), this->scalarBases().alpha().shellPairs())[0];
 
 
         // 2. Place the calculated integrals as 'blocks' in the larger representation.
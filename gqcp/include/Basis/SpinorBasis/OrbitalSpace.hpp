@@ -139,6 +139,76 @@ public:
     }
 
 
+    /**
+     *  Extract the dense representation of the slice of a matrix whose rows and columns belong to the given occupation types.
+     * 
+     *  @tparam Scalar                      the scalar type of the elements of the matrix
+     * 
+     *  @param M                            the full matrix
+     *  @param row_type                     the spinor occupation type for the rows
+     *  @param column_type                  the spinor occupation type for the columns
+     * 
+     *  @return the dense representation of the slice, whose rows and columns are ordered like the indices of the given occupation types
+     * 
+     *  @note The occupied-virtual block f_{ia} of a Fock matrix can be extracted through
+     *      orbital_space.denseSliceOf(f, OccupationType::k_occupied, OccupationType::k_virtual)
+     */
+    template <typename Scalar>
+    MatrixX<Scalar> denseSliceOf(const MatrixX<Scalar>& M, const OccupationType row_type, const OccupationType column_type) const {
+
+        const auto& row_indices = this->indices(row_type);
+        const auto& column_indices = this->indices(column_type);
+
+        MatrixX<Scalar> M_slice {row_indices.size(), column_indices.size()};
+        for (size_t q = 0; q < column_indices.size(); q++) {
+            for (size_t p = 0; p < row_indices.size(); p++) {
+                M_slice(p, q) = M(row_indices[p], column_indices[q]);
+            }
+        }
+
+        return M_slice;
+    }
+
+
+    /**
+     *  Extract the dense representation of the slice of a rank-four tensor whose axes belong to the given occupation types.
+     * 
+     *  @tparam Scalar                      the scalar type of the elements of the tensor
+     * 
+     *  @param T                            the full tensor
+     *  @param axis1_type                   the spinor occupation type for the first tensor axis
+     *  @param axis2_type                   the spinor occupation type for the second tensor axis
+     *  @param axis3_type                   the spinor occupation type for the third tensor axis
+     *  @param axis4_type                   the spinor occupation type for the fourth tensor axis
+     * 
+     *  @return the dense representation of the slice, whose axes are ordered like the indices of the given occupation types
+     * 
+     *  @note The occupied-occupied-virtual-virtual block <ij||ab> of the antisymmetrized two-electron integrals can be extracted through
+     *      orbital_space.denseSliceOf(V_A, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual)
+     */
+    template <typename Scalar>
+    Tensor<Scalar, 4> denseSliceOf(const Tensor<Scalar, 4>& T, const OccupationType axis1_type, const OccupationType axis2_type, const OccupationType axis3_type, const OccupationType axis4_type) const {
+
+        const auto& axis1_indices = this->indices(axis1_type);
+        const auto& axis2_indices = this->indices(axis2_type);
+        const auto& axis3_indices = this->indices(axis3_type);
+        const auto& axis4_indices = this->indices(axis4_type);
+
+        Tensor<Scalar, 4> T_slice {static_cast<long>(axis1_indices.size()), static_cast<long>(axis2_indices.size()), static_cast<long>(axis3_indices.size()), static_cast<long>(axis4_indices.size())};
+        for (size_t s = 0; s < axis4_indices.size(); s++) {
+            for (size_t r = 0; r < axis3_indices.size(); r++) {
+                for (size_t q = 0; q < axis2_indices.size(); q++) {
+                    for (size_t p = 0; p < axis1_indices.size(); p++) {  // The first index changes most rapidly in column-major storage.
+                        T_slice(p, q, r, s) = T(axis1_indices[p], axis2_indices[q], axis3_indices[r], axis4_indices[s]);
+                    }
+                }
+            }
+        }
+
+        return T_slice;
+    }
+
+
     /**
      *  @return a textual description of this orbital space
      */
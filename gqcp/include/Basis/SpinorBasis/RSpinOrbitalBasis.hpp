@@ -424,7 +424,7 @@ public:
 
 
         auto coulomb_engine = GQCP::IntegralEngine::InHouse<GQCP::LondonGTOShell>(CoulombRepulsionOperator());
-        const auto g_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->scalarBasis().shellSet(), this->scalarBasis().shellSet())[0];  // In AO basis.
+        const auto g_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->scalarBasis().shellPairs(), this->scalarBasis().shellPairs())[0];  // In AO basis.
 
         auto g = SquareRankFourTensor<ResultScalar>::Zero(g_par.dimension(0));
 
@@ -471,10 +471,10 @@ public:
         // Determine the matrix representation of the four spin-components of the second-quantized Coulomb operator.
         auto coulomb_engine = GQCP::IntegralEngine::InHouse<GQCP::LondonGTOShell>(CoulombRepulsionOperator());
 
-        const auto g_aa_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->alpha().scalarBasis().shellSet(), this->alpha().scalarBasis().shellSet())[0];  // In AO basis, 'par' for 'parameters'.
-        const auto g_ab_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->alpha().scalarBasis().shellSet(), this->beta().scalarBasis().shellSet())[0];   // In AO basis, 'par' for 'parameters'.
-        const auto g_ba_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->beta().scalarBasis().shellSet(), this->alpha().scalarBasis().shellSet())[0];   // In AO basis, 'par' for 'parameters'.
-        const auto g_bb_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->beta().scalarBasis().shellSet(), this->beta().scalarBasis().shellSet())[0];    // In AO basis, 'par' for 'parameters'.
+        const auto g_aa_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->alpha().scalarBasis().shellPairs(), this->alpha().scalarBasis().shellPairs())[0];  // In AO basis, 'par' for 'parameters'.
+        const auto g_ab_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->alpha().scalarBasis().shellPairs(), this->beta().scalarBasis().shellPairs())[0];   // In AO basis, 'par' for 'parameters'.
+        const auto g_ba_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->beta().scalarBasis().shellPairs(), this->alpha().scalarBasis().shellPairs())[0];   // In AO basis, 'par' for 'parameters'.
+        const auto g_bb_par = GQCP::IntegralCalculator::calculate(coulomb_engine, this->beta().scalarBasis().shellPairs(), this->beta().scalarBasis().shellPairs())[0];    // In AO basis, 'par' for 'parameters'.
 
 
         auto g_aa = SquareRankFourTensor<ResultScalar>::Zero(g_aa_par.dimension(0));
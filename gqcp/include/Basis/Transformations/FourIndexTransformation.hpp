@@ -0,0 +1,234 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Four-index transformations
+ *
+ *  The transformations in this file are performed as a sequence of quarter transformations, every one of which is written as (a batch of) matrix-matrix multiplications on (reinterpreted) column-major storage. Since GQCP is compiled with EIGEN_USE_MKL_ALL, these products are carried out by (multithreaded) MKL GEMMs. Every quarter transformation writes into one of two buffers that are reused, which avoids allocating a new rank-four temporary for every contraction.
+ */
+
+
+/**
+ *  Half-transform the first two axes of a rank-four tensor, i.e. calculate
+ *      X(P Q m) = sum_{t u} C1^*(t P) C2(u Q) G(t u m),
+ *  in which m is the compound index of the last two axes.
+ *
+ *  @tparam Scalar                  The scalar type of the elements.
+ *
+ *  @param G                        The column-major storage of the tensor, of dimensions (K1, K2, M).
+ *  @param K1                       The dimension of the first axis.
+ *  @param K2                       The dimension of the second axis.
+ *  @param M                        The product of the dimensions of the last two axes.
+ *  @param C1                       The transformation matrix for the first axis, of dimensions (K1, n1).
+ *  @param C2                       The transformation matrix for the second axis, of dimensions (K2, n2).
+ *  @param intermediate             A buffer that can hold at least n1 * K2 * M elements.
+ *  @param X                        A buffer that can hold at least n1 * n2 * M elements, in which the half-transformed tensor is written.
+ *
+ *  @note Since G is only read during the first quarter transformation, X may share its storage with G, but not with the intermediate buffer.
+ */
+template <typename Scalar>
+void halfTransformFirstTwoAxes(const Scalar* G, const size_t K1, const size_t K2, const size_t M, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2, Scalar* intermediate, Scalar* X) {
+
+    using EigenMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+    const auto n1 = static_cast<size_t>(C1.cols());
+    const auto n2 = static_cast<size_t>(C2.cols());
+
+    // The first quarter transformation is one GEMM: G is reinterpreted as a (K1, K2 * M)-matrix.
+    const Eigen::Map<const EigenMatrix> G_matrix {G, static_cast<Eigen::Index>(K1), static_cast<Eigen::Index>(K2 * M)};
+    Eigen::Map<EigenMatrix> A {intermediate, static_cast<Eigen::Index>(n1), static_cast<Eigen::Index>(K2 * M)};
+    A.noalias() = C1.adjoint() * G_matrix;
+
+    // The second quarter transformation is a batch of GEMMs, one for every (n1, K2)-block that belongs to a compound index m.
+    for (size_t m = 0; m < M; m++) {
+        const Eigen::Map<const EigenMatrix> A_m {intermediate + m * n1 * K2, static_cast<Eigen::Index>(n1), static_cast<Eigen::Index>(K2)};
+        Eigen::Map<EigenMatrix> X_m {X + m * n1 * n2, static_cast<Eigen::Index>(n1), static_cast<Eigen::Index>(n2)};
+        X_m.noalias() = A_m * C2;
+    }
+}
+
+
+/**
+ *  Swap the first two and the last two axes of a rank-four tensor, i.e. calculate the transpose of its (rows, columns) supermatrix.
+ *
+ *  @tparam Scalar                  The scalar type of the elements.
+ *
+ *  @param G                        The column-major storage of the supermatrix.
+ *  @param rows                     The product of the dimensions of the first two axes.
+ *  @param cols                     The product of the dimensions of the last two axes.
+ *  @param G_transpose              A buffer that can hold at least rows * cols elements, in which the transpose is written.
+ */
+template <typename Scalar>
+void transposeSupermatrix(const Scalar* G, const size_t rows, const size_t cols, Scalar* G_transpose) {
+
+    using EigenMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+    const Eigen::Map<const EigenMatrix> G_matrix {G, static_cast<Eigen::Index>(rows), static_cast<Eigen::Index>(cols)};
+    Eigen::Map<EigenMatrix> G_transpose_matrix {G_transpose, static_cast<Eigen::Index>(cols), static_cast<Eigen::Index>(rows)};
+    G_transpose_matrix.noalias() = G_matrix.transpose();
+}
+
+
+/**
+ *  Transform every axis of a rank-four tensor with its own transformation matrix, i.e. calculate
+ *      g'(P Q R S) = sum_{t u v w} C1^*(t P) C2(u Q) C3^*(v R) C4(w S) g(t u v w).
+ *
+ *  The bra pair is half-transformed first, after which the supermatrix is transposed and the ket pair is half-transformed in the same way. All four quarter transformations are matrix-matrix multiplications, and only two intermediate buffers are used.
+ *
+ *  @tparam Scalar                  The scalar type of the elements.
+ *
+ *  @param g                        The rank-four tensor.
+ *  @param C1                       The transformation matrix for the first axis.
+ *  @param C2                       The transformation matrix for the second axis.
+ *  @param C3                       The transformation matrix for the third axis.
+ *  @param C4                       The transformation matrix for the fourth axis.
+ *
+ *  @return The transformed rank-four tensor, of dimensions (C1.cols(), C2.cols(), C3.cols(), C4.cols()).
+ */
+template <typename Scalar>
+Tensor<Scalar, 4> fourIndexTransformed(const Tensor<Scalar, 4>& g, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2, const MatrixX<Scalar>& C3, const MatrixX<Scalar>& C4) {
+
+    const auto K1 = static_cast<size_t>(g.dimension(0));
+    const auto K2 = static_cast<size_t>(g.dimension(1));
+    const auto K3 = static_cast<size_t>(g.dimension(2));
+    const auto K4 = static_cast<size_t>(g.dimension(3));
+
+    if ((static_cast<size_t>(C1.rows()) != K1) || (static_cast<size_t>(C2.rows()) != K2) || (static_cast<size_t>(C3.rows()) != K3) || (static_cast<size_t>(C4.rows()) != K4)) {
+        throw std::invalid_argument("fourIndexTransformed(const Tensor<Scalar, 4>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&): The dimensions of the transformation matrices are incompatible with the given tensor.");
+    }
+
+    const auto n1 = static_cast<size_t>(C1.cols());
+    const auto n2 = static_cast<size_t>(C2.cols());
+    const auto n3 = static_cast<size_t>(C3.cols());
+    const auto n4 = static_cast<size_t>(C4.cols());
+
+
+    // Prepare two buffers that are large enough for every intermediate.
+    const auto bra = n1 * n2;
+    const auto size_1 = std::max({n1 * K2 * K3 * K4, K3 * K4 * bra, n3 * n4 * bra});
+    const auto size_2 = std::max(bra * K3 * K4, n3 * K4 * bra);
+    std::vector<Scalar> buffer_1(size_1);
+    std::vector<Scalar> buffer_2(size_2);
+
+    // X(P Q v w) = sum_{t u} C1^*(t P) C2(u Q) g(t u v w), stored in the second buffer.
+    halfTransformFirstTwoAxes(g.data(), K1, K2, K3 * K4, C1, C2, buffer_1.data(), buffer_2.data());
+
+    // Y(v w P Q) = X(P Q v w), stored in the first buffer.
+    transposeSupermatrix(buffer_2.data(), bra, K3 * K4, buffer_1.data());
+
+    // Z(R S P Q) = sum_{v w} C3^*(v R) C4(w S) Y(v w P Q). Since Y is no longer needed after the first quarter transformation, Z can overwrite it in the first buffer.
+    halfTransformFirstTwoAxes(buffer_1.data(), K3, K4, bra, C3, C4, buffer_2.data(), buffer_1.data());
+
+    // g'(P Q R S) = Z(R S P Q).
+    Tensor<Scalar, 4> g_transformed {static_cast<Eigen::Index>(n1), static_cast<Eigen::Index>(n2), static_cast<Eigen::Index>(n3), static_cast<Eigen::Index>(n4)};
+    transposeSupermatrix(buffer_1.data(), n3 * n4, bra, g_transformed.data());
+
+    return g_transformed;
+}
+
+
+/**
+ *  Transform only the first two axes of a rank-four tensor, i.e. calculate
+ *      g'(P Q v w) = sum_{t u} C1^*(t P) C2(u Q) g(t u v w).
+ *
+ *  @tparam Scalar                  The scalar type of the elements.
+ *
+ *  @param g                        The rank-four tensor.
+ *  @param C1                       The transformation matrix for the first axis.
+ *  @param C2                       The transformation matrix for the second axis.
+ *
+ *  @return The transformed rank-four tensor, of dimensions (C1.cols(), C2.cols(), g.dimension(2), g.dimension(3)).
+ */
+template <typename Scalar>
+Tensor<Scalar, 4> firstPairTransformed(const Tensor<Scalar, 4>& g, const MatrixX<Scalar>& C1, const MatrixX<Scalar>& C2) {
+
+    const auto K1 = static_cast<size_t>(g.dimension(0));
+    const auto K2 = static_cast<size_t>(g.dimension(1));
+    const auto K3 = static_cast<size_t>(g.dimension(2));
+    const auto K4 = static_cast<size_t>(g.dimension(3));
+
+    if ((static_cast<size_t>(C1.rows()) != K1) || (static_cast<size_t>(C2.rows()) != K2)) {
+        throw std::invalid_argument("firstPairTransformed(const Tensor<Scalar, 4>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&): The dimensions of the transformation matrices are incompatible with the given tensor.");
+    }
+
+    const auto n1 = static_cast<size_t>(C1.cols());
+    const auto n2 = static_cast<size_t>(C2.cols());
+
+    std::vector<Scalar> buffer(n1 * K2 * K3 * K4);
+    Tensor<Scalar, 4> g_transformed {static_cast<Eigen::Index>(n1), static_cast<Eigen::Index>(n2), static_cast<Eigen::Index>(K3), static_cast<Eigen::Index>(K4)};
+    halfTransformFirstTwoAxes(g.data(), K1, K2, K3 * K4, C1, C2, buffer.data(), g_transformed.data());
+
+    return g_transformed;
+}
+
+
+/**
+ *  Transform only the last two axes of a rank-four tensor, i.e. calculate
+ *      g'(t u R S) = sum_{v w} C3^*(v R) C4(w S) g(t u v w).
+ *
+ *  @tparam Scalar                  The scalar type of the elements.
+ *
+ *  @param g                        The rank-four tensor.
+ *  @param C3                       The transformation matrix for the third axis.
+ *  @param C4                       The transformation matrix for the fourth axis.
+ *
+ *  @return The transformed rank-four tensor, of dimensions (g.dimension(0), g.dimension(1), C3.cols(), C4.cols()).
+ */
+template <typename Scalar>
+Tensor<Scalar, 4> secondPairTransformed(const Tensor<Scalar, 4>& g, const MatrixX<Scalar>& C3, const MatrixX<Scalar>& C4) {
+
+    const auto K1 = static_cast<size_t>(g.dimension(0));
+    const auto K2 = static_cast<size_t>(g.dimension(1));
+    const auto K3 = static_cast<size_t>(g.dimension(2));
+    const auto K4 = static_cast<size_t>(g.dimension(3));
+
+    if ((static_cast<size_t>(C3.rows()) != K3) || (static_cast<size_t>(C4.rows()) != K4)) {
+        throw std::invalid_argument("secondPairTransformed(const Tensor<Scalar, 4>&, const MatrixX<Scalar>&, const MatrixX<Scalar>&): The dimensions of the transformation matrices are incompatible with the given tensor.");
+    }
+
+    const auto n3 = static_cast<size_t>(C3.cols());
+    const auto n4 = static_cast<size_t>(C4.cols());
+    const auto bra = K1 * K2;
+
+    // Transpose the supermatrix, half-transform the (now leading) ket pair and transpose back.
+    std::vector<Scalar> buffer_1(std::max(K3 * K4 * bra, n3 * n4 * bra));
+    std::vector<Scalar> buffer_2(n3 * K4 * bra);
+    transposeSupermatrix(g.data(), bra, K3 * K4, buffer_1.data());
+    halfTransformFirstTwoAxes(buffer_1.data(), K3, K4, bra, C3, C4, buffer_2.data(), buffer_1.data());
+
+    Tensor<Scalar, 4> g_transformed {static_cast<Eigen::Index>(K1), static_cast<Eigen::Index>(K2), static_cast<Eigen::Index>(n3), static_cast<Eigen::Index>(n4)};
+    transposeSupermatrix(buffer_1.data(), n3 * n4, bra, g_transformed.data());
+
+    return g_transformed;
+}
+
+
+}  // namespace GQCP
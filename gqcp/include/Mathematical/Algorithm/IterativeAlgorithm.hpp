@@ -43,6 +43,7 @@ public:
 private:
     size_t maximum_number_of_iterations;
     size_t iteration = 0;  // the number of iterations that have been performed
+    size_t peak_scratch_bytes = 0;  // the peak scratch memory of a single iteration, as reported by the environment's `IterationArena`
 
     StepCollection<Environment> steps;  // the collection of algorithm steps that is performed in-between convergence checks
     std::shared_ptr<ConvergenceCriterion<Environment>> convergence_criterion;
@@ -109,6 +110,11 @@ public:
      */
     size_t numberOfIterations() const { return this->iteration; }
 
+    /**
+     *  @return the largest number of bytes of scratch memory that a single iteration has used from the environment's `IterationArena`, as measured at the end of the last call to `perform`; 0 for environments without an `arena` member
+     */
+    size_t peakScratchBytes() const { return this->peak_scratch_bytes; }
+
 
     /**
      *  Perform the iteration steps until convergence is achieved
@@ -123,13 +129,18 @@ public:
             //      - the convergence check, which checks if the iterations may stop
             //      - the iteration cycle, i.e. what happens in-between the convergence checks
             if (this->convergence_criterion->isFulfilled(environment)) {
+                this->peak_scratch_bytes = IterativeAlgorithm<Environment>::arenaPeakBytes(environment, 0);
                 return;  // exit the loop and function early
             }
 
+            // Release the scratch memory of the previous iteration, so that it can be re-used.
+            IterativeAlgorithm<Environment>::resetArena(environment, 0);
+
             this->steps.execute(environment);
         }
 
         // Since we will exit the function early if convergence is achieved, the algorithm is considered non-converging if the loop is done.
+        this->peak_scratch_bytes = IterativeAlgorithm<Environment>::arenaPeakBytes(environment, 0);
         throw std::runtime_error("IterativeAlgorithm<Environment>::perform(Environment&): The algorithm didn't find a solution within the maximum number of iterations.");
     }
 
@@ -150,6 +161,41 @@ public:
      */
     template <typename Z = Step<Environment>>
     enable_if_t<std::is_same<Environment, typename Z::Environment>::value, void> replace(const Z& step, const size_t index) { this->steps.replace(step, index); }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Release the scratch memory that the steps of the previous iteration have allocated from the environment's `IterationArena`. This overload is chosen for environments that have an `arena` member.
+     *
+     *  @param environment                          the environment that this algorithm is associated to
+     */
+    template <typename E>
+    static auto resetArena(E& environment, int) -> decltype(environment.arena.reset(), void()) { environment.arena.reset(); }
+
+    /**
+     *  Environments without an `arena` member have no scratch memory to release.
+     */
+    template <typename E>
+    static void resetArena(E&, long) {}
+
+
+    /**
+     *  @param environment                          the environment that this algorithm is associated to
+     *
+     *  @return the peak scratch memory of a single iteration, as reported by the environment's `IterationArena`. This overload is chosen for environments that have an `arena` member.
+     */
+    template <typename E>
+    static auto arenaPeakBytes(const E& environment, int) -> decltype(environment.arena.peakBytes()) { return environment.arena.peakBytes(); }
+
+    /**
+     *  Environments without an `arena` member don't use any scratch memory.
+     */
+    template <typename E>
+    static size_t arenaPeakBytes(const E&, long) { return 0; }
 };
 
 
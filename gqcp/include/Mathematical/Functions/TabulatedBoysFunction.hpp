@@ -0,0 +1,142 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+
+#include <cstddef>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A fast implementation of the real-valued Boys function F_n(x), based on a pretabulated grid and Taylor interpolation.
+ *
+ *  For arguments x < `maximum_tabulated_argument`, the highest requested order F_N(x) is interpolated through a 7-term Taylor expansion around the nearest grid point, after which all lower orders are obtained through the (stable) downward recursion
+ *      F_n(x) = (2x F_{n+1}(x) + exp(-x)) / (2n + 1).
+ *  For larger arguments, F_0(x) is calculated exactly through the error function and the higher orders are obtained through the (then stable) upward recursion.
+ *
+ *  The grid spacing is 0.05, so the interpolation error is bounded by 0.025^7 / 7! < 2e-15. Since both recursions are used in their stable direction, the absolute accuracy of every returned value is better than 1e-14.
+ */
+class TabulatedBoysFunction {
+public:
+    // The spacing between two consecutive grid points.
+    static constexpr double grid_spacing = 0.05;
+
+    // The number of terms in the Taylor interpolation.
+    static constexpr size_t number_of_taylor_terms = 7;
+
+    // The argument above which the upward recursion is used instead of the tabulated values.
+    static constexpr double maximum_tabulated_argument = 40.0;
+
+
+private:
+    // The maximum order of the Boys function that can be evaluated.
+    size_t maximum_order;
+
+    // The number of orders that are stored for every grid point, i.e. including the orders that are only needed for the Taylor interpolation.
+    size_t number_of_tabulated_orders;
+
+    // The pretabulated values F_n(x_k), stored grid point-major: the value F_n(x_k) is found at `k * number_of_tabulated_orders + n`. This makes sure that a single interpolation only touches contiguous memory.
+    std::vector<double> table;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct the tabulated Boys function by pretabulating the Boys function values on the interpolation grid.
+     *
+     *  @param maximum_order            The maximum order of the Boys function that should be able to be evaluated. Since the upward recursion is only stable for orders smaller than the argument, this order should not exceed 36.
+     *
+     *  @note The default maximum order suffices for Coulomb repulsion integrals over shells up to i-functions.
+     */
+    TabulatedBoysFunction(const size_t maximum_order = 32);
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  @return The tabulated Boys function with the default maximum order that is shared throughout the library. Its table is only constructed once, upon its first use.
+     */
+    static const TabulatedBoysFunction& Default();
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The maximum order of the Boys function that can be evaluated.
+     */
+    size_t maximumOrder() const { return this->maximum_order; }
+
+
+    /*
+     *  MARK: Function evaluation
+     */
+
+    /**
+     *  Calculate the value for the real-valued Boys function F_n(x).
+     *
+     *  @param n        The degree of the Boys function.
+     *  @param x        The non-negative argument for the Boys function.
+     *
+     *  @return The value F_n(x).
+     */
+    double operator()(const size_t n, const double x) const;
+
+    /**
+     *  Calculate all the values F_0(x), F_1(x), ..., F_N(x) at once.
+     *
+     *  @param N            The maximum degree of the Boys function.
+     *  @param x            The non-negative argument for the Boys function.
+     *  @param values       A pointer to a contiguous array of (at least) N + 1 elements, to which the values are written.
+     */
+    void valuesUpTo(const size_t N, const double x, double* values) const;
+
+    /**
+     *  Calculate all the values F_0(x), F_1(x), ..., F_N(x) at once.
+     *
+     *  @param N            The maximum degree of the Boys function.
+     *  @param x            The non-negative argument for the Boys function.
+     *
+     *  @return A vector containing the values F_0(x), F_1(x), ..., F_N(x).
+     */
+    VectorX<double> valuesUpTo(const size_t N, const double x) const;
+
+    /**
+     *  Calculate all the values F_0(x_i), F_1(x_i), ..., F_N(x_i) for a batch of arguments.
+     *
+     *  @param N            The maximum degree of the Boys function.
+     *  @param x            The batch of non-negative arguments for the Boys function.
+     *
+     *  @return A (number of arguments x N+1)-matrix, in which the element (i, n) represents F_n(x_i). Since the matrix is column-major, the values of one order are contiguous over all the arguments, which is the SIMD-friendly layout for subsequent recursions.
+     */
+    MatrixX<double> valuesUpTo(const size_t N, const VectorX<double>& x) const;
+};
+
+
+}  // namespace GQCP
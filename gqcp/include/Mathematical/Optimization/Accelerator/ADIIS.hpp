@@ -0,0 +1,276 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  An accelerator that finds the convex combination of previous Fock matrices that minimizes the augmented Roothaan-Hall (ARH) energy function, i.e. the ADIIS method of Hu and Yang (J. Chem. Phys. 132, 054109 (2010)).
+ *
+ *  It is meant to be blended with DIIS in the early iterations of an SCF procedure, where DIIS may extrapolate too far. The blending follows Garza and Scuseria (J. Chem. Phys. 137, 054110 (2012)): ADIIS is used alone if the largest element of the current error vector exceeds an upper threshold, DIIS is used alone if it lies below a lower threshold, and the coefficients are interpolated in-between.
+ *
+ *  The accelerator is incremental: it caches the traces tr(D_i F_j) of the density matrices and Fock matrices in its subspace, so that every call to `update` only calculates the traces that involve the newest iterate.
+ *
+ *  @tparam _Scalar             the scalar type of the density matrix and Fock matrix elements
+ */
+template <typename _Scalar>
+class ADIIS {
+public:
+    using Scalar = _Scalar;
+
+
+private:
+    // The maximum number of iterates that are kept in the subspace.
+    size_t maximum_subspace_dimension;
+
+    // The (real parts of the) traces tr(D_i F_j) of the density matrices and Fock matrices in the subspace, from the oldest to the most recent one. Its dimension is the current subspace dimension.
+    SquareMatrix<double> density_fock_traces;
+
+    // Above this error, only the ADIIS coefficients are used.
+    double upper_threshold;
+
+    // Below this error, only the DIIS coefficients are used.
+    double lower_threshold;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param maximum_subspace_dimension       the maximum number of iterates that are kept in the subspace
+     *  @param upper_threshold                  above this error, only the ADIIS coefficients are used
+     *  @param lower_threshold                  below this error, only the DIIS coefficients are used
+     *
+     *  @note Finding the ADIIS coefficients scales exponentially with the subspace dimension, which is harmless for the usual subspaces of up to about ten iterates.
+     */
+    ADIIS(const size_t maximum_subspace_dimension = 6, const double upper_threshold = 1.0e-01, const double lower_threshold = 1.0e-04) :
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        density_fock_traces {SquareMatrix<double>::Zero(0)},
+        upper_threshold {upper_threshold},
+        lower_threshold {lower_threshold} {
+
+        if (maximum_subspace_dimension == 0) {
+            throw std::invalid_argument("ADIIS(const size_t, const double, const double): The maximum subspace dimension should be at least 1.");
+        }
+
+        if (lower_threshold > upper_threshold) {
+            throw std::invalid_argument("ADIIS(const size_t, const double, const double): The lower threshold cannot be larger than the upper threshold.");
+        }
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Blend the given DIIS coefficients with the ADIIS coefficients of the current subspace.
+     *
+     *  @param diis_coefficients            the DIIS coefficients for the same subspace
+     *  @param error                        the size of the most recent error, i.e. the largest absolute element of the most recent error vector
+     *
+     *  @return the blended expansion coefficients of the iterates in the subspace
+     */
+    template <typename Z>
+    VectorX<Z> blend(const VectorX<Z>& diis_coefficients, const double error) const {
+
+        if (static_cast<size_t>(diis_coefficients.size()) != this->subspaceDimension()) {
+            throw std::invalid_argument("ADIIS::blend(const VectorX<Z>&, const double): The DIIS coefficients do not belong to a subspace of the same dimension.");
+        }
+
+        const auto weight = this->weight(error);
+        if (weight == 0.0) {
+            return diis_coefficients;  // Avoid solving the ADIIS problem if it isn't needed.
+        }
+
+        const VectorX<Z> adiis_coefficients = this->coefficients().template cast<Z>();
+        return weight * adiis_coefficients + (1.0 - weight) * diis_coefficients;
+    }
+
+
+    /**
+     *  @return the convex expansion coefficients of the iterates in the subspace that minimize the ARH energy function
+     */
+    VectorX<double> coefficients() const {
+
+        const auto n = this->subspaceDimension();
+        if (n == 0) {
+            throw std::logic_error("ADIIS::coefficients(): The subspace is empty. Call `update` first.");
+        }
+
+        // The ARH energy function, relative to the most recent iterate, reads f(c) = g^T c + 1/2 c^T H c, with g_i = tr((D_i - D_n) F_n) and H_ij = tr((D_i - D_n) (F_j - F_n)).
+        const auto& T = this->density_fock_traces;
+        const auto last = n - 1;
+
+        VectorX<double> g = VectorX<double>::Zero(n);
+        SquareMatrix<double> H = SquareMatrix<double>::Zero(n);
+        for (size_t i = 0; i < n; i++) {
+            g(i) = T(i, last) - T(last, last);
+            for (size_t j = 0; j < n; j++) {
+                H(i, j) = T(i, j) - T(i, last) - T(last, j) + T(last, last);
+            }
+        }
+        H = 0.5 * (H + H.transpose()).eval();  // Only the symmetric part contributes to the quadratic form.
+
+
+        // The minimum on the simplex {c_i >= 0, sum_i c_i = 1} is the stationary point of the energy function on one of the faces of the simplex. Since the subspace is small, we can visit all faces.
+        VectorX<double> best_coefficients = VectorX<double>::Zero(n);
+        best_coefficients(last) = 1.0;  // The most recent iterate itself.
+        double best_value = 0.0;        // f(e_n) = 0.
+
+        for (size_t face = 1; face < (size_t {1} << n); face++) {
+
+            // Collect the vertices of the current face.
+            std::vector<size_t> vertices;
+            for (size_t i = 0; i < n; i++) {
+                if (face & (size_t {1} << i)) {
+                    vertices.push_back(i);
+                }
+            }
+            const auto m = vertices.size();
+
+            // Solve the KKT equations for the stationary point on the face: [H_ff 1; 1^T 0] [c_f; lambda] = [-g_f; 1].
+            Eigen::MatrixXd K = Eigen::MatrixXd::Zero(m + 1, m + 1);
+            Eigen::VectorXd rhs = Eigen::VectorXd::Zero(m + 1);
+            for (size_t a = 0; a < m; a++) {
+                for (size_t b = 0; b < m; b++) {
+                    K(a, b) = H(vertices[a], vertices[b]);
+                }
+                K(a, m) = 1.0;
+                K(m, a) = 1.0;
+                rhs(a) = -g(vertices[a]);
+            }
+            rhs(m) = 1.0;
+
+            const Eigen::FullPivLU<Eigen::MatrixXd> lu {K};
+            if (!lu.isInvertible()) {
+                continue;  // The stationary points of a degenerate face are covered by its boundary.
+            }
+            const Eigen::VectorXd solution = lu.solve(rhs);
+
+            // Only stationary points inside the simplex are candidates.
+            VectorX<double> c = VectorX<double>::Zero(n);
+            bool is_feasible = true;
+            for (size_t a = 0; a < m; a++) {
+                if (solution(a) < -1.0e-12) {
+                    is_feasible = false;
+                    break;
+                }
+                c(vertices[a]) = std::max(solution(a), 0.0);
+            }
+            if (!is_feasible) {
+                continue;
+            }
+            c /= c.sum();
+
+            const double value = g.dot(c) + 0.5 * c.dot(H * c);
+            if (value < best_value) {
+                best_value = value;
+                best_coefficients = c;
+            }
+        }
+
+        return best_coefficients;
+    }
+
+
+    /**
+     *  Empty the subspace.
+     */
+    void reset() { this->density_fock_traces = SquareMatrix<double>::Zero(0); }
+
+
+    /**
+     *  @return the number of iterates in the subspace
+     */
+    size_t subspaceDimension() const { return this->density_fock_traces.dimension(); }
+
+
+    /**
+     *  Add the most recent iterate of an iteration history to the subspace. Only the traces that involve the new density matrix or the new Fock matrix are calculated; if the subspace is full, the oldest iterate is discarded.
+     *
+     *  @param density_matrices             the iteration history of the density matrices, from the oldest to the most recent one
+     *  @param fock_matrices                the iteration history of the Fock matrices, from the oldest to the most recent one. Its most recent element should be the Fock matrix that belongs to the most recent density matrix.
+     *  @param trace                        a function that calculates tr(D F) for a density matrix D and a Fock matrix F
+     *
+     *  @note Every new iterate should be added exactly once. Histories that contain a single iterate start a new subspace.
+     */
+    template <typename DensityMatrices, typename FockMatrices, typename Trace>
+    void update(const DensityMatrices& density_matrices, const FockMatrices& fock_matrices, const Trace& trace) {
+
+        const auto history_size = static_cast<size_t>(std::min(density_matrices.size(), fock_matrices.size()));
+        if (history_size == 0) {
+            throw std::invalid_argument("ADIIS::update(const DensityMatrices&, const FockMatrices&, const Trace&): The given iteration histories are empty.");
+        }
+
+        // Determine the new subspace dimension, and keep the traces of the previous iterates that remain in the subspace.
+        const auto n = std::min({this->maximum_subspace_dimension, this->subspaceDimension() + 1, history_size});
+        const auto n_kept = n - 1;
+
+        SquareMatrix<double> density_fock_traces = SquareMatrix<double>::Zero(n);
+        density_fock_traces.topLeftCorner(n_kept, n_kept) = this->density_fock_traces.bottomRightCorner(n_kept, n_kept);
+
+        // Calculate the traces of the new density matrix with all Fock matrices in the subspace, and of all density matrices with the new Fock matrix.
+        const auto& D_new = *(density_matrices.end() - 1);
+        const auto& F_new = *(fock_matrices.end() - 1);
+
+        auto D_it = density_matrices.end() - n;
+        auto F_it = fock_matrices.end() - n;
+        for (size_t i = 0; i < n; i++, ++D_it, ++F_it) {
+            density_fock_traces(n - 1, i) = std::real(trace(D_new, *F_it));
+            density_fock_traces(i, n - 1) = std::real(trace(*D_it, F_new));
+        }
+
+        this->density_fock_traces = density_fock_traces;
+    }
+
+
+    /**
+     *  @param error                        the size of the most recent error, i.e. the largest absolute element of the most recent error vector
+     *
+     *  @return the weight of the ADIIS coefficients in the blended coefficients
+     */
+    double weight(const double error) const {
+
+        if (error >= this->upper_threshold) {
+            return 1.0;
+        } else if (error < this->lower_threshold) {
+            return 0.0;
+        } else {
+            return error / this->upper_threshold;
+        }
+    }
+};
+
+
+}  // namespace GQCP
@@ -21,7 +21,10 @@
 #include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
 #include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 
@@ -31,6 +34,8 @@ namespace GQCP {
 /**
  *  An accelerator that uses a direct inversion of the iterative subspace (DIIS) on a subject to produce an accelerated subject.
  * 
+ *  Next to the stateless `accelerate(subjects, errors)`, this accelerator can also be used incrementally: it then caches the overlaps of the error vectors in its subspace, so that every call to `update` only calculates the overlaps of the newest error vector, and `accelerate(subjects)` reads the subjects in place from the caller's iteration history.
+ * 
  *  @tparam _Scalar             the scalar type that is used to represent an element of a DIIS error vector
  */
 template <typename _Scalar>
@@ -38,7 +43,110 @@ class DIIS {
 public:
     using Scalar = _Scalar;
 
+
+private:
+    // The maximum number of error vectors that are kept in the incremental subspace.
+    size_t maximum_subspace_dimension;
+
+    // The overlaps of the error vectors in the incremental subspace, from the oldest to the most recent one. Its dimension is the current subspace dimension.
+    SquareMatrix<Scalar> error_overlaps;
+
+
 public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param maximum_subspace_dimension       the maximum number of error vectors that are kept in the incremental subspace
+     */
+    DIIS(const size_t maximum_subspace_dimension = 6) :
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        error_overlaps {SquareMatrix<Scalar>::Zero(0)} {
+
+        if (maximum_subspace_dimension == 0) {
+            throw std::invalid_argument("DIIS(const size_t): The maximum subspace dimension should be at least 1.");
+        }
+    }
+
+
+    /*
+     *  STATIC PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate the linear combination of the most recent subjects in an iteration history.
+     * 
+     *  @param subjects             the iteration history of the subjects, from the oldest to the most recent one
+     *  @param coefficients         the expansion coefficients of the most recent subjects
+     *  @param projection           a function that selects the part of a subject that should be combined
+     * 
+     *  @return the linear combination of the `coefficients.size()` most recent subjects
+     */
+    template <typename Subjects, typename Projection>
+    static auto linearCombination(const Subjects& subjects, const VectorX<Scalar>& coefficients, const Projection& projection) -> typename std::decay<decltype(projection(*subjects.begin()))>::type {
+
+        const auto n = static_cast<size_t>(coefficients.size());
+        if ((n == 0) || (n > static_cast<size_t>(subjects.size()))) {
+            throw std::invalid_argument("DIIS::linearCombination(const Subjects&, const VectorX<Scalar>&, const Projection&): The number of coefficients should be between 1 and the number of subjects.");
+        }
+
+        auto it = subjects.end() - n;
+
+        // Defaultly initializing may cause problems: the default constructor for a Matrix is a 0x0-matrix.
+        typename std::decay<decltype(projection(*subjects.begin()))>::type combination = coefficients(0) * projection(*it);
+        for (size_t i = 1; i < n; i++) {
+            ++it;
+            combination += coefficients(i) * projection(*it);
+        }
+        return combination;
+    }
+
+
+    /**
+     *  Calculate the linear combination of the most recent subjects in an iteration history.
+     * 
+     *  @param subjects             the iteration history of the subjects, from the oldest to the most recent one
+     *  @param coefficients         the expansion coefficients of the most recent subjects
+     * 
+     *  @return the linear combination of the `coefficients.size()` most recent subjects
+     */
+    template <typename Subjects>
+    static typename Subjects::value_type linearCombination(const Subjects& subjects, const VectorX<Scalar>& coefficients) {
+        return DIIS<Scalar>::linearCombination(subjects, coefficients, [](const typename Subjects::value_type& subject) -> const typename Subjects::value_type& { return subject; });
+    }
+
+
+    /**
+     *  Solve the DIIS linear equations for a given matrix of error overlaps.
+     * 
+     *  @param error_overlaps       the overlaps of the error vectors
+     * 
+     *  @return the coefficients that minimize the error measure
+     */
+    static VectorX<Scalar> solve(const SquareMatrix<Scalar>& error_overlaps) {
+
+        const auto n = error_overlaps.dimension();
+
+        // Initialize the augmented B matrix
+        SquareMatrix<Scalar> B = -1 * SquareMatrix<Scalar>::Ones(n + 1, n + 1);  // +1 for the Lagrange multiplier
+        B(n, n) = 0;
+        B.topLeftCorner(n, n) = error_overlaps;
+
+        // Initialize the RHS of the system of equations
+        VectorX<Scalar> b = VectorX<Scalar>::Zero(n + 1);  // +1 for the multiplier
+        b(n) = -1;                                         // the last entry of b is accessed through n: dimension of b is n+1 - 1 because of computers
+
+
+        // Solve the DIIS linear equations [B x = b]
+        auto environment = LinearEquationEnvironment<Scalar>(B, b);
+        auto solver = LinearEquationSolver<Scalar>::HouseholderQR();
+        solver.perform(environment);
+
+        return environment.x.col(0).head(n);  // Drop the Lagrange multiplier.
+    }
+
+
     /*
      *  PUBLIC METHODS
      */
@@ -71,29 +179,119 @@ public:
 
         const auto n = errors.size();
 
-        // Initialize and calculate the augmented B matrix
-        SquareMatrix<Scalar> B = -1 * SquareMatrix<Scalar>::Ones(n + 1, n + 1);  // +1 for the Lagrange multiplier
-        B(n, n) = 0;
+        // Calculate the overlaps of the error vectors.
+        SquareMatrix<Scalar> error_overlaps = SquareMatrix<Scalar>::Zero(n);
         for (size_t i = 0; i < n; i++) {
             const auto& error_i = errors[i];
 
             for (size_t j = 0; j < n; j++) {
                 const auto& error_j = errors[j];
-                B(i, j) = error_i.dot(error_j);
+                error_overlaps(i, j) = error_i.dot(error_j);
             }
         }
 
-        // Initialize the RHS of the system of equations
-        VectorX<Scalar> b = VectorX<Scalar>::Zero(n + 1);  // +1 for the multiplier
-        b(n) = -1;                                         // the last entry of b is accessed through n: dimension of b is n+1 - 1 because of computers
+        return DIIS<Scalar>::solve(error_overlaps);
+    }
 
 
-        // Solve the DIIS linear equations [B x = b]
-        auto environment = LinearEquationEnvironment<Scalar>(B, b);
-        auto solver = LinearEquationSolver<Scalar>::HouseholderQR();
-        solver.perform(environment);
+    /*
+     *  PUBLIC METHODS - INCREMENTAL DIIS
+     */
+
+    /**
+     *  @return the coefficients that minimize the error measure of the error vectors in the incremental subspace
+     */
+    VectorX<Scalar> coefficients() const {
+
+        if (this->subspaceDimension() == 0) {
+            throw std::logic_error("DIIS::coefficients(): The incremental subspace is empty. Call `update` first.");
+        }
+
+        return DIIS<Scalar>::solve(this->error_overlaps);
+    }
+
+
+    /**
+     *  Calculate the DIIS-accelerated subject from the incremental subspace.
+     * 
+     *  @param subjects             the iteration history of the subjects, from the oldest to the most recent one. Its most recent elements should correspond to the error vectors in the incremental subspace.
+     *  @param projection           a function that selects the part of a subject that should be accelerated
+     * 
+     *  @return the DIIS-accelerated subject
+     */
+    template <typename Subjects, typename Projection>
+    auto accelerate(const Subjects& subjects, const Projection& projection) const -> decltype(DIIS<Scalar>::linearCombination(subjects, VectorX<Scalar>(), projection)) {
+        return DIIS<Scalar>::linearCombination(subjects, this->coefficients(), projection);
+    }
+
+
+    /**
+     *  Calculate the DIIS-accelerated subject from the incremental subspace.
+     * 
+     *  @param subjects             the iteration history of the subjects, from the oldest to the most recent one. Its most recent elements should correspond to the error vectors in the incremental subspace.
+     * 
+     *  @return the DIIS-accelerated subject
+     */
+    template <typename Subjects>
+    typename Subjects::value_type accelerate(const Subjects& subjects) const {
+        return DIIS<Scalar>::linearCombination(subjects, this->coefficients());
+    }
+
+
+    /**
+     *  Empty the incremental subspace.
+     */
+    void reset() { this->error_overlaps = SquareMatrix<Scalar>::Zero(0); }
+
+
+    /**
+     *  @return the number of error vectors in the incremental subspace
+     */
+    size_t subspaceDimension() const { return this->error_overlaps.dimension(); }
+
+
+    /**
+     *  Add the most recent error vector of an iteration history to the incremental subspace. Only the overlaps of the new error vector with the previous ones are calculated; if the subspace is full, the oldest error vector is discarded.
+     * 
+     *  @param errors               the iteration history of the error vectors, from the oldest to the most recent one. Every new error vector should be added exactly once. A history that contains a single error vector starts a new subspace.
+     *  @param projection           a function that selects the error vector from an element of the history
+     */
+    template <typename Errors, typename Projection>
+    void update(const Errors& errors, const Projection& projection) {
+
+        const auto history_size = static_cast<size_t>(errors.size());
+        if (history_size == 0) {
+            throw std::invalid_argument("DIIS::update(const Errors&, const Projection&): The given iteration history contains no error vectors.");
+        }
+
+        // Determine the new subspace dimension, and keep the overlaps of the previous error vectors that remain in the subspace.
+        const auto n = std::min({this->maximum_subspace_dimension, this->subspaceDimension() + 1, history_size});
+        const auto n_kept = n - 1;
 
-        return environment.x;
+        SquareMatrix<Scalar> error_overlaps = SquareMatrix<Scalar>::Zero(n);
+        error_overlaps.topLeftCorner(n_kept, n_kept) = this->error_overlaps.bottomRightCorner(n_kept, n_kept);
+
+        // Calculate the overlaps of the new error vector with the kept ones and with itself.
+        const auto& new_error = projection(*(errors.end() - 1));
+        auto it = errors.end() - n;
+        for (size_t i = 0; i < n; i++, ++it) {
+            const auto overlap = projection(*it).dot(new_error);
+            error_overlaps(i, n - 1) = overlap;
+            error_overlaps(n - 1, i) = Eigen::numext::conj(overlap);
+        }
+
+        this->error_overlaps = error_overlaps;
+    }
+
+
+    /**
+     *  Add the most recent error vector of an iteration history to the incremental subspace. Only the overlaps of the new error vector with the previous ones are calculated; if the subspace is full, the oldest error vector is discarded.
+     * 
+     *  @param errors               the iteration history of the error vectors, from the oldest to the most recent one. Every new error vector should be added exactly once. A history that contains a single error vector starts a new subspace.
+     */
+    template <typename Errors>
+    void update(const Errors& errors) {
+        this->update(errors, [](const VectorX<Scalar>& error) -> const VectorX<Scalar>& { return error; });
     }
 };
 
@@ -34,8 +34,9 @@ namespace GQCP {
  * 
  *  @tparam _Iterate            the type of the iterative variables
  *  @tparam _Environment        the type of the calculation environment
+ *  @tparam _Iterates           the type of the container in which the environment stores its iterates
  */
-template <typename _Iterate, typename _Environment>
+template <typename _Iterate, typename _Environment, typename _Iterates = std::deque<_Iterate>>
 class ConsecutiveIteratesNormConvergence:
     public ConvergenceCriterion<_Environment> {
 
@@ -43,6 +44,7 @@ public:
     using Iterate = _Iterate;
     using Scalar = typename Iterate::Scalar;
     using Environment = _Environment;
+    using Iterates = _Iterates;
     static_assert(std::is_same<Scalar, typename Environment::Scalar>::value, "The scalar types of the iterate and environment must match.");
 
 
@@ -51,7 +53,7 @@ private:
 
     std::string iterate_description;  // the description of the the iterates that are compared
 
-    std::function<std::deque<Iterate>(const Environment&)> extractor;  // a function that can extract the correct iterates from the environment, as it's not mandatory to check convergence on the variables, but any iterate (whose .norm() can be calculated) can in principle be used
+    std::function<const Iterates&(const Environment&)> extractor;  // a function that can extract (a reference to) the correct iterates from the environment, as it's not mandatory to check convergence on the variables, but any iterate (whose .norm() can be calculated) can in principle be used
 
 
 public:
@@ -61,11 +63,11 @@ public:
 
     /**
      *  @param threshold                    the threshold that is used in comparing the iterates
-     *  @param extractor                    a function that can extract the correct iterates from the environment. The default is to check the environment on a property called 'variables'
+     *  @param extractor                    a function that can extract the correct iterates from the environment. It should return a reference to the iterates that are stored in the environment, so that they are not copied in every iteration. The default is to check the environment on a property called 'variables'
      *  @param iterate_description          the description of the the iterates that are compared
      */
     ConsecutiveIteratesNormConvergence(
-        const double threshold = 1.0e-08, const std::function<std::deque<Iterate>(const Environment&)> extractor = [](const Environment& environment) { return environment.variables; }, const std::string& iterate_description = "a general iterate") :
+        const double threshold = 1.0e-08, const std::function<const Iterates&(const Environment&)> extractor = [](const Environment& environment) -> const Iterates& { return environment.variables; }, const std::string& iterate_description = "a general iterate") :
         m_threshold {threshold},
         extractor {extractor},
         iterate_description {iterate_description} {}
@@ -90,7 +92,7 @@ public:
      */
     bool isFulfilled(Environment& environment) override {
 
-        const auto iterates = this->extractor(environment);
+        const auto& iterates = this->extractor(environment);
 
         if (iterates.size() < 2) {
             return false;  // we can't calculate convergence
@@ -99,7 +101,7 @@ public:
         // Get the two most recent density matrices and compare the norm of their difference
         const auto second_to_last_it = iterates.end() - 2;  // 'it' for 'iterator'
         const auto& previous = *second_to_last_it;          // Dereference the iterator.
-        const auto current = iterates.back();
+        const auto& current = iterates.back();
 
         return (std::real((current - previous).norm()) <= this->m_threshold);
     }
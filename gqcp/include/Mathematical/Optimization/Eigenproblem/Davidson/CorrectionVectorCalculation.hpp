@@ -84,7 +84,8 @@ public:
         environment.Delta = MatrixX<double>::Zero(dim, this->number_of_requested_eigenpairs);
         for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
 
-            VectorX<double> denominator = diagonal - VectorX<double>::Constant(dim, Lambda(column_index));
+            auto denominator = environment.arena.vector<double>(dim);
+            denominator = diagonal.array() - Lambda(column_index);
 
             // If the denominator is large enough, the correction vector is the residual vector dividided by the denominator.
             // If it isn't, the correction vector is the residual vector divided by the threshold.
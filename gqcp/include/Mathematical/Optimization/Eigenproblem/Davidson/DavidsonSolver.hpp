@@ -27,9 +27,13 @@
 #include "Mathematical/Optimization/Eigenproblem/Davidson/ResidualVectorConvergence.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceMatrixCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceMatrixDiagonalization.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/SubspacePrecisionUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 
+#include <limits>
+#include <stdexcept>
+
 
 namespace GQCP {
 namespace EigenproblemSolver {
@@ -66,5 +70,36 @@ IterativeAlgorithm<EigenproblemEnvironment<double>> Davidson(const size_t number
 }
 
 
+/**
+ *  @param number_of_requested_eigenpairs       the number of solutions the Davidson solver should find
+ *  @param maximum_subspace_dimension           the maximum dimension of the subspace before collapsing
+ *  @param convergence_threshold                the threshold that is used in determining the norm on the residuals, which determines convergence
+ *  @param correction_threshold                 the threshold used in solving the (approximated) residue correction equation
+ *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+ *  @param inclusion_threshold                  the threshold on the norm used for determining if a new projected correction vector should be added to the subspace
+ *  @param switch_threshold                     the threshold on the norm of the residuals below which the subspace vectors are stored in double precision. It should be larger than the convergence threshold and well above single-precision round-off.
+ *  @param maximum_number_of_single_precision_iterations        the maximum number of iterations that may be performed with single-precision subspace vectors, after which they are stored in double precision even if the residuals haven't dropped below the switch threshold
+ * 
+ *  @return an iterative algorithm that can find the lowest n eigenvectors of a matrix using Davidson's algorithm, in which the subspace vectors and their matrix-vector products are stored in single precision (while the subspace matrix and the residual vectors are accumulated in double precision) until the norms of the residuals drop below the switch threshold, stagnate, or the maximum number of single-precision iterations is reached
+ */
+IterativeAlgorithm<EigenproblemEnvironment<double>> MixedPrecisionDavidson(const size_t number_of_requested_eigenpairs = 1, const size_t maximum_subspace_dimension = 15, const double convergence_threshold = 1.0e-08, double correction_threshold = 1.0e-12, const size_t maximum_number_of_iterations = 128, const double inclusion_threshold = 1.0e-03, const double switch_threshold = 1.0e-04, const size_t maximum_number_of_single_precision_iterations = 32) {
+
+    if (switch_threshold <= convergence_threshold) {
+        throw std::invalid_argument("EigenproblemSolver::MixedPrecisionDavidson(const size_t, const size_t, const double, double, const size_t, const double, const double, const size_t): The switch threshold should be larger than the convergence threshold, since the residuals cannot be converged with single-precision subspace vectors.");
+    }
+
+    // The residual norms of single-precision iterations level off at a multiple of the single-precision machine epsilon, so a smaller switch threshold would never be reached.
+    if (switch_threshold < 100 * std::numeric_limits<float>::epsilon()) {
+        throw std::invalid_argument("EigenproblemSolver::MixedPrecisionDavidson(const size_t, const size_t, const double, double, const size_t, const double, const double, const size_t): The switch threshold should be well above the single-precision round-off, i.e. at least 100 times the single-precision machine epsilon.");
+    }
+
+    // Start from a regular Davidson solver, and let it determine the precision of the subspace at the start of every iteration.
+    auto davidson_solver = EigenproblemSolver::Davidson(number_of_requested_eigenpairs, maximum_subspace_dimension, convergence_threshold, correction_threshold, maximum_number_of_iterations, inclusion_threshold);
+    davidson_solver.insert(SubspacePrecisionUpdate(switch_threshold, maximum_number_of_single_precision_iterations), 0);
+
+    return davidson_solver;
+}
+
+
 }  // namespace EigenproblemSolver
 }  // namespace GQCP
@@ -51,8 +51,23 @@ public:
      */
     void execute(EigenproblemEnvironment<double>& environment) override {
 
+        // During the single-precision iterations of a mixed-precision algorithm, the linear combinations of the subspace vectors are accumulated in double precision.
+        if (environment.isSubspaceSinglePrecision()) {
+            const auto& V = environment.V_single;
+            const auto& Z = environment.Z;
+
+            environment.X = MatrixX<double>::Zero(V.rows(), Z.cols());
+            for (Eigen::Index j = 0; j < V.cols(); j++) {
+                for (Eigen::Index column_index = 0; column_index < Z.cols(); column_index++) {
+                    environment.X.col(column_index) += Z(j, column_index) * V.col(j).cast<double>();
+                }
+            }
+            environment.eigenvectors = environment.X;
+            return;
+        }
+
         // X contains the new guesses for the eigenvectors, V is the subspace and Z are the eigenvectors of the subspace matrix.
-        environment.X = environment.V * environment.Z;  // X is a linear combination of the current subspace vectors
+        environment.X.noalias() = environment.V * environment.Z;  // X is a linear combination of the current subspace vectors
         environment.eigenvectors = environment.X;
     }
 };
@@ -53,13 +53,38 @@ public:
      */
     void execute(EigenproblemEnvironment<double>& environment) override {
 
+        const auto& matvec = environment.matrix_vector_product_function;
+
+        // During the single-precision iterations of a mixed-precision algorithm, the subspace is stored in V_single and VA_single instead of in V and VA.
+        if (environment.isSubspaceSinglePrecision()) {
+            MatrixVectorProductCalculation::calculateMissingProducts(environment.V_single, environment.VA_single, matvec);
+            return;
+        }
+
         const auto& V = environment.V;  // the subspace of guess vectors
 
         assert((V.transpose() * V).isApprox(MatrixX<double>::Identity(V.cols(), V.cols()), 1.0e-08));  // make sure that the subspace vectors are orthonormal
 
+        MatrixVectorProductCalculation::calculateMissingProducts(V, environment.VA, matvec);
+    }
 
-        auto& VA = environment.VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
-        const auto& matvec = environment.matrix_vector_product_function;
+
+private:
+    /*
+     *  PRIVATE STATIC METHODS
+     */
+
+    /**
+     *  Calculate the matrix-vector products for the (new) guess vectors in V and place them in VA.
+     * 
+     *  @tparam StorageScalar           the scalar type in which the subspace vectors are stored
+     * 
+     *  @param V                        the subspace of guess vectors
+     *  @param VA                       VA = A * V (implicitly calculated through the matrix-vector product)
+     *  @param matvec                   the (double-precision) matrix-vector product
+     */
+    template <typename StorageScalar>
+    static void calculateMissingProducts(const MatrixX<StorageScalar>& V, MatrixX<StorageScalar>& VA, const VectorFunction<double>& matvec) {
 
         // Check how many vectors there currently are in V and in VA: only calculate the expensive matrix-vector product for 'new' vectors.
         // If there is no difference, no matrix-vector products should be calculated.
@@ -74,7 +99,7 @@ public:
         const auto difference = vectors_in_V - vectors_in_VA;
 
         if (difference != 0) {
-            VA.conservativeResize(Eigen::NoChange, VA.cols() + difference);  // accounts for both expansion and shrinking
+            VA.conservativeResize(V.rows(), VA.cols() + difference);  // accounts for both expansion and shrinking
 
             // Calculate the only the necessary matrix-vector products; find the start_index that accounts for both expansion and shrinking
             size_t start_index = 0;
@@ -82,8 +107,9 @@ public:
                 start_index = vectors_in_VA - 1;  // -1 because of computers
             }
 
+            // The matrix-vector product itself is always calculated in double precision.
             for (size_t column_index = start_index; column_index < vectors_in_V; column_index++) {
-                VA.col(column_index) = matvec(V.col(column_index));
+                VA.col(column_index) = matvec(V.col(column_index).template cast<double>()).template cast<StorageScalar>();
             }
         }
     }
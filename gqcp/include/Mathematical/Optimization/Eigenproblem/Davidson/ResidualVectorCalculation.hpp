@@ -75,8 +75,25 @@ public:
 
         // Calculate the residual vectors: r_i = VA * z_i - Lambda * x_i
         environment.R = MatrixX<double>::Zero(dim, this->number_of_requested_eigenpairs);
+
+        // During the single-precision iterations of a mixed-precision algorithm, the residual vectors are accumulated in double precision.
+        if (environment.isSubspaceSinglePrecision()) {
+            const auto& VA_single = environment.VA_single;
+
+            for (Eigen::Index j = 0; j < VA_single.cols(); j++) {
+                for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
+                    environment.R.col(column_index) += Z(j, column_index) * VA_single.col(j).cast<double>();
+                }
+            }
+            for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
+                environment.R.col(column_index) -= Lambda(column_index) * X.col(column_index);
+            }
+            return;
+        }
+
         for (size_t column_index = 0; column_index < this->number_of_requested_eigenpairs; column_index++) {
-            environment.R.col(column_index) = VA * Z.col(column_index) - Lambda(column_index) * X.col(column_index);
+            environment.R.col(column_index).noalias() = VA * Z.col(column_index);
+            environment.R.col(column_index) -= Lambda(column_index) * X.col(column_index);
         }
     }
 };
@@ -53,10 +53,24 @@ public:
      */
     void execute(EigenproblemEnvironment<double>& environment) override {
 
+        // During the single-precision iterations of a mixed-precision algorithm, the elements of the subspace matrix are accumulated in double precision.
+        if (environment.isSubspaceSinglePrecision()) {
+            const auto& V = environment.V_single;
+            const auto& VA = environment.VA_single;
+
+            environment.S = SquareMatrix<double>::Zero(V.cols());
+            for (Eigen::Index i = 0; i < V.cols(); i++) {
+                for (Eigen::Index j = 0; j < VA.cols(); j++) {
+                    environment.S(i, j) = V.col(i).cast<double>().dot(VA.col(j).cast<double>());
+                }
+            }
+            return;
+        }
+
         const auto& V = environment.V;    // the subspace of guess vectors
         const auto& VA = environment.VA;  // VA = A * V (implicitly calculated through the matrix-vector product)
 
-        environment.S = V.transpose() * VA;  // the "subspace matrix": the projection of the matrix A onto the subspace spanned by the vectors in V
+        environment.S.noalias() = V.transpose() * VA;  // the "subspace matrix": the projection of the matrix A onto the subspace spanned by the vectors in V
     }
 };
 
@@ -0,0 +1,155 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
+
+#include <algorithm>
+#include <limits>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that determines the precision in which the subspace vectors of a mixed-precision Davidson algorithm are stored.
+ *
+ *  Before the first iteration, the subspace is moved to single precision. Once the norms of all residual vectors drop below a switch threshold, the subspace is collapsed onto the current guesses for the eigenvectors and their correction vectors, which are stored in double precision from then on.
+ *
+ *  Since the single-precision subspace vectors limit the attainable residual norms (relative to the norm of the matrix), the switch is also made when the residual norms stagnate, or after a maximum number of single-precision iterations.
+ */
+class SubspacePrecisionUpdate:
+    public Step<EigenproblemEnvironment<double>> {
+
+private:
+    double switch_threshold;  // the threshold on the norm of the residual vectors below which the subspace vectors are stored in double precision
+    size_t maximum_number_of_single_precision_iterations;  // the maximum number of iterations that may be performed with single-precision subspace vectors
+    size_t maximum_number_of_stagnated_iterations;         // the number of consecutive single-precision iterations without a significant decrease of the residual norms after which the subspace vectors are stored in double precision
+
+    size_t number_of_single_precision_iterations = 0;  // the number of iterations that have been performed with single-precision subspace vectors
+    size_t number_of_stagnated_iterations = 0;         // the number of consecutive single-precision iterations that did not significantly decrease the residual norms
+    double lowest_residual_norm = std::numeric_limits<double>::max();  // the lowest (maximum) residual norm that has been encountered with single-precision subspace vectors
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param switch_threshold                                     the threshold on the norm of the residual vectors below which the subspace vectors are stored in double precision
+     *  @param maximum_number_of_single_precision_iterations        the maximum number of iterations that may be performed with single-precision subspace vectors
+     *  @param maximum_number_of_stagnated_iterations               the number of consecutive single-precision iterations without a significant decrease of the residual norms after which the subspace vectors are stored in double precision
+     */
+    SubspacePrecisionUpdate(const double switch_threshold = 1.0e-04, const size_t maximum_number_of_single_precision_iterations = 32, const size_t maximum_number_of_stagnated_iterations = 3) :
+        switch_threshold {switch_threshold},
+        maximum_number_of_single_precision_iterations {maximum_number_of_single_precision_iterations},
+        maximum_number_of_stagnated_iterations {maximum_number_of_stagnated_iterations} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Store the subspace vectors in single precision until the norms of all residual vectors drop below a switch threshold (or stagnate), after which the subspace is collapsed and stored in double precision.";
+    }
+
+
+    /**
+     *  Store the subspace vectors in single precision until the norms of all residual vectors drop below a switch threshold (or stagnate), after which the subspace is collapsed and stored in double precision.
+     *
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(EigenproblemEnvironment<double>& environment) override {
+
+        // Before the first iteration, there are no residual vectors yet: move the initial guess vectors to single precision.
+        if (!environment.isSubspaceSinglePrecision() && (environment.R.cols() == 0)) {
+            const auto dim = environment.V.rows();
+
+            environment.V_single = environment.V.cast<float>();
+            environment.VA_single = MatrixX<float>::Zero(dim, 0);
+            environment.V = MatrixX<double>::Zero(dim, 0);
+            environment.VA = MatrixX<double>::Zero(dim, 0);
+
+            this->number_of_single_precision_iterations = 0;
+            this->number_of_stagnated_iterations = 0;
+            this->lowest_residual_norm = std::numeric_limits<double>::max();
+            return;
+        }
+
+        if (!environment.isSubspaceSinglePrecision() || !this->isDoublePrecisionRequired(environment.R.colwise().norm().maxCoeff())) {
+            return;
+        }
+
+
+        // Collapse the subspace onto the current guesses for the eigenvectors and their correction vectors, and orthonormalize them in double precision.
+        const auto& X = environment.X;
+        const auto& Delta = environment.Delta;
+
+        Eigen::MatrixXd B {X.rows(), X.cols() + Delta.cols()};
+        B << X, Delta;
+
+        const auto number_of_subspace_vectors = std::min(B.rows(), B.cols());
+        const Eigen::HouseholderQR<Eigen::MatrixXd> qr {B};
+        environment.V = qr.householderQ() * Eigen::MatrixXd::Identity(B.rows(), number_of_subspace_vectors);
+
+        // All matrix-vector products should be recalculated in double precision, so the single-precision subspace is released.
+        environment.VA = MatrixX<double>::Zero(B.rows(), 0);
+        environment.V_single = MatrixX<float>::Zero(B.rows(), 0);
+        environment.VA_single = MatrixX<float>::Zero(B.rows(), 0);
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Keep track of the residual norms of the single-precision iterations.
+     *
+     *  @param residual_norm            the largest norm of the residual vectors of the previous iteration
+     *
+     *  @return if the residual norm has dropped below the switch threshold, if it has stagnated, or if the maximum number of single-precision iterations has been reached
+     */
+    bool isDoublePrecisionRequired(const double residual_norm) {
+
+        this->number_of_single_precision_iterations++;
+
+        // Only a decrease of at least 10% counts as progress.
+        if (residual_norm < 0.9 * this->lowest_residual_norm) {
+            this->lowest_residual_norm = residual_norm;
+            this->number_of_stagnated_iterations = 0;
+        } else {
+            this->number_of_stagnated_iterations++;
+        }
+
+        return (residual_norm <= this->switch_threshold) ||
+               (this->number_of_stagnated_iterations >= this->maximum_number_of_stagnated_iterations) ||
+               (this->number_of_single_precision_iterations >= this->maximum_number_of_single_precision_iterations);
+    }
+};
+
+
+}  // namespace GQCP
@@ -70,6 +70,11 @@ public:
      */
     void execute(EigenproblemEnvironment<double>& environment) override {
 
+        if (environment.isSubspaceSinglePrecision()) {
+            this->updateSinglePrecision(environment);
+            return;
+        }
+
         auto& V = environment.V;
         const auto& Delta = environment.Delta;
 
@@ -81,8 +86,13 @@ public:
 
         // Update the current subspace V with new vectors: add the normalized orthogonal projection of the correction vectors if their norm is large enough.
         // Note that we can't add more than one vector simultaneously, as the inclusion of one vector changes the subspace, which in turn changes its orthogonal complement.
+        auto v = environment.arena.vector<double>(V.rows());
         for (size_t column_index = 0; column_index < Delta.cols(); column_index++) {
-            VectorX<double> v = Delta.col(column_index) - V * (V.transpose() * Delta.col(column_index));  // project the correction vector on the orthogonal complement of V
+            auto overlaps = environment.arena.vector<double>(V.cols());
+            overlaps.noalias() = V.transpose() * Delta.col(column_index);
+
+            v = Delta.col(column_index);
+            v.noalias() -= V * overlaps;  // project the correction vector on the orthogonal complement of V
             const double norm = v.norm();
             v.normalize();
 
@@ -92,6 +102,52 @@ public:
             }
         }
     }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Update the single-precision subspace V_single, which is used during the single-precision iterations of a mixed-precision algorithm. The projections of the correction vectors are accumulated in double precision, and only the new subspace vectors themselves are stored in single precision.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void updateSinglePrecision(EigenproblemEnvironment<double>& environment) const {
+
+        auto& V = environment.V_single;
+        const auto& Delta = environment.Delta;
+
+        // If the subspace will potentially become too large, collapse it in advance.
+        if (V.cols() + Delta.cols() > this->maximum_subspace_dimension) {
+            V = environment.X.cast<float>();
+        }
+
+        auto v = environment.arena.vector<double>(V.rows());
+        for (size_t column_index = 0; column_index < Delta.cols(); column_index++) {
+
+            // Since the single-precision subspace vectors are only orthonormal up to single-precision round-off, which a single projection amplifies for nearly linearly dependent correction vectors, the projection on the orthogonal complement of V is performed twice.
+            v = Delta.col(column_index);
+            double norm = 0.0;
+            for (size_t pass = 0; pass < 2; pass++) {
+                for (size_t j = 0; j < V.cols(); j++) {
+                    const auto V_j = V.col(j).cast<double>();
+                    v -= V_j.dot(v) * V_j;
+                }
+
+                if (pass == 0) {
+                    norm = v.norm();
+                }
+            }
+            v.normalize();
+
+            if (norm > this->threshold) {
+                V.conservativeResize(Eigen::NoChange, V.cols() + 1);
+                V.col(V.cols() - 1) = v.cast<float>();
+            }
+        }
+    }
 };
 
 
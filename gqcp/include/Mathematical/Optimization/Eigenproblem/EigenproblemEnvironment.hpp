@@ -21,6 +21,11 @@
 #include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Utilities/IterationArena.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 
 namespace GQCP {
@@ -78,6 +83,12 @@ public:
     // Contains the new guesses for the eigenvectors (as a linear combination of the current subspace V).
     MatrixX<Scalar> X;
 
+    // The subspace of guess vectors in single precision, which replaces V during the single-precision iterations of a mixed-precision iterative diagonalization algorithm.
+    MatrixX<float> V_single;
+
+    // VA = A * V in single precision, which replaces VA during the single-precision iterations of a mixed-precision iterative diagonalization algorithm.
+    MatrixX<float> VA_single;
+
 
     // The residual vectors.
     MatrixX<Scalar> R;
@@ -86,6 +97,10 @@ public:
     MatrixX<Scalar> Delta;
 
 
+    // Scratch memory for the intermediates of a single iteration, which is released at the start of every iteration.
+    IterationArena arena;
+
+
 public:
     /*
      *  MARK: Constructors
@@ -129,6 +144,33 @@ public:
      */
     static EigenproblemEnvironment Iterative(const VectorFunction<Scalar>& matrix_vector_product_function, const VectorX<Scalar>& diagonal, const MatrixX<Scalar>& V) { return EigenproblemEnvironment(matrix_vector_product_function, diagonal, V); }
 
+    /**
+     *  @param matrix_vector_product            A vector function that returns the matrix-vector product (i.e. the matrix-vector product representation of the matrix).
+     *  @param diagonal                         The diagonal of the matrix whose eigenvalue problem should be solved.
+     *  @param number_of_guess_vectors          The number of initial guess vectors. They are chosen as the unit vectors that correspond to the lowest diagonal elements.
+     *
+     *  @return An environment that can be used to solve the eigenvalue problem for the matrix that is represented by the given matrix-vector product.
+     */
+    static EigenproblemEnvironment Iterative(const VectorFunction<Scalar>& matrix_vector_product_function, const VectorX<Scalar>& diagonal, const size_t number_of_guess_vectors) {
+
+        const auto dimension = static_cast<size_t>(diagonal.size());
+        if ((number_of_guess_vectors == 0) || (number_of_guess_vectors > dimension)) {
+            throw std::invalid_argument("EigenproblemEnvironment::Iterative(const VectorFunction<Scalar>&, const VectorX<Scalar>&, const size_t): The number of guess vectors should be between 1 and the dimension of the eigenvalue problem.");
+        }
+
+        // Sort the indices of the diagonal elements by their (real) value.
+        std::vector<size_t> indices(dimension);
+        std::iota(indices.begin(), indices.end(), 0);
+        std::stable_sort(indices.begin(), indices.end(), [&diagonal](const size_t i, const size_t j) { return std::real(diagonal(i)) < std::real(diagonal(j)); });
+
+        MatrixX<Scalar> V = MatrixX<Scalar>::Zero(dimension, number_of_guess_vectors);
+        for (size_t n = 0; n < number_of_guess_vectors; n++) {
+            V(indices[n], n) = 1.0;
+        }
+
+        return EigenproblemEnvironment(matrix_vector_product_function, diagonal, V);
+    }
+
     /**
      *  @param A                                The matrix whose eigenvalue problem should be solved.
      *  @param V                                A matrix of initial guess vectors (each column of the matrix is an initial guess vector).
@@ -146,6 +188,12 @@ public:
      *  MARK: Access
      */
 
+    /**
+     *  @return If the subspace of guess vectors is currently stored in single precision, i.e. in V_single instead of V.
+     */
+    bool isSubspaceSinglePrecision() const { return this->V_single.cols() > 0; }
+
+
     /**
      *  @param number_of_requested_eigenpairs               The number of eigenpairs to retrieve.
      * 
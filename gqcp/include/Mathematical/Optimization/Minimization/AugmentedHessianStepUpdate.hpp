@@ -0,0 +1,364 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Minimization/MinimizationEnvironment.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace GQCP {
+namespace Minimization {
+
+
+/**
+ *  An iteration step that produces updated variables according to an augmented Hessian (AH) step that is restricted to a trust region, in the spirit of the trust-region augmented Hessian (TRAH) method of Helmich-Paris (J. Chem. Phys. 154, 164104 (2021)).
+ * 
+ *  The step is the level-shifted Newton step s = -(H - mu)^{-1} g that is found from the lowest eigenpair (mu, (c_0, c)) of the augmented Hessian [[0, alpha g^T], [alpha g, H]], as s = c / (alpha c_0). The scaling parameter alpha >= 1 is chosen such that the norm of the step does not exceed the trust radius.
+ * 
+ *  The eigenvalue problem is solved with a Davidson-like procedure that only requires products of the Hessian with vectors, so the Hessian is never constructed if the environment provides a Hessian-vector product function. Since the first subspace vector is the gradient itself, the subspace problems for different values of alpha can be set up from the same products.
+ * 
+ *  @tparam _Scalar             the scalar type that is used to represent the variables of the scalar function
+ *  @tparam _Environment        the type of the calculation environment
+ */
+template <typename _Scalar, typename _Environment>
+class AugmentedHessianStepUpdate:
+    public Step<_Environment> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = _Environment;
+    static_assert(std::is_same<Scalar, typename Environment::Scalar>::value, "The scalar type must match that of the environment");
+    static_assert(std::is_base_of<MinimizationEnvironment<Scalar>, Environment>::value, "The environment type must derive from MinimizationEnvironment.");
+    static_assert(std::is_same<Scalar, double>::value, "The augmented Hessian step is only implemented for real-valued variables.");
+
+
+private:
+    double trust_radius;                        // the maximum norm of a step
+    double maximum_trust_radius;                // the trust radius is never enlarged beyond this value
+    size_t maximum_number_of_micro_iterations;  // the maximum number of Hessian-vector products that may be calculated for one step
+
+    double predicted_change;                  // the change of the function value that the quadratic model predicts for the most recent step
+    double step_norm;                         // the norm of the most recent step
+    size_t number_of_hessian_vector_products;  // the number of Hessian-vector products that were calculated for the most recent step
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param trust_radius                             the (initial) maximum norm of a step
+     *  @param maximum_trust_radius                     the trust radius is never enlarged beyond this value
+     *  @param maximum_number_of_micro_iterations       the maximum number of Hessian-vector products that may be calculated for one step
+     */
+    AugmentedHessianStepUpdate(const double trust_radius = 0.5, const double maximum_trust_radius = 1.0, const size_t maximum_number_of_micro_iterations = 32) :
+        trust_radius {trust_radius},
+        maximum_trust_radius {maximum_trust_radius},
+        maximum_number_of_micro_iterations {maximum_number_of_micro_iterations},
+        predicted_change {0.0},
+        step_norm {0.0},
+        number_of_hessian_vector_products {0} {
+
+        if ((trust_radius <= 0.0) || (trust_radius > maximum_trust_radius)) {
+            throw std::invalid_argument("AugmentedHessianStepUpdate(const double, const double, const size_t): The trust radius should be positive and should not exceed the maximum trust radius.");
+        }
+
+        if (maximum_number_of_micro_iterations == 0) {
+            throw std::invalid_argument("AugmentedHessianStepUpdate(const double, const double, const size_t): The maximum number of micro-iterations should be at least 1.");
+        }
+    }
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Calculate a new iteration of the variables through an augmented Hessian step in a trust region and add them to the environment.";
+    }
+
+
+    /**
+     *  Calculate a new iteration of the variables through an augmented Hessian step in a trust region and add them to the environment.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(Environment& environment) override {
+
+        const VectorX<double> x = environment.variables.back();
+        const VectorX<double> g = environment.gradient_function(x);
+
+        // Prefer the matrix-free Hessian-vector products. Otherwise, construct the Hessian once and multiply with it.
+        VectorFunction<double> matvec;
+        VectorX<double> diagonal;
+        if (environment.hessian_vector_product_function) {
+            const auto& hessian_vector_product_function = environment.hessian_vector_product_function;
+            matvec = [&hessian_vector_product_function, &x](const VectorX<double>& v) { return hessian_vector_product_function(x, v); };
+            diagonal = environment.hessian_diagonal_function ? environment.hessian_diagonal_function(x) : VectorX<double>::Ones(x.size());
+        } else {
+            const SquareMatrix<double> H = environment.hessian_function(x);
+            matvec = [H](const VectorX<double>& v) { return VectorX<double> {H * v}; };
+            diagonal = environment.hessian_diagonal_function ? environment.hessian_diagonal_function(x) : VectorX<double> {H.diagonal()};
+        }
+
+        const auto step = this->calculateStep(g, matvec, diagonal);
+        environment.variables.push_back(x + step);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  Calculate the augmented Hessian step for the given gradient and Hessian, restricted to the current trust radius.
+     * 
+     *  @param g                        the gradient
+     *  @param matvec                   a function that calculates the product of the Hessian with a given vector
+     *  @param diagonal                 (an approximation to) the diagonal of the Hessian, which is used as a preconditioner
+     * 
+     *  @return the augmented Hessian step
+     */
+    VectorX<double> calculateStep(const VectorX<double>& g, const VectorFunction<double>& matvec, const VectorX<double>& diagonal) {
+
+        const auto dimension = static_cast<size_t>(g.size());
+        const double g_norm = g.norm();
+
+        this->predicted_change = 0.0;
+        this->step_norm = 0.0;
+        this->number_of_hessian_vector_products = 0;
+        if ((dimension == 0) || (g_norm < 1.0e-14)) {
+            return VectorX<double>::Zero(dimension);  // We are at a stationary point.
+        }
+
+        // The micro-iterations stop if the residual of the step is sufficiently small compared to the gradient, which retains the quadratic convergence of the Newton method.
+        const double residual_threshold = std::min(0.1, g_norm) * g_norm;
+        const auto maximum_subspace_dimension = std::min(dimension, this->maximum_number_of_micro_iterations);
+
+
+        // The orthonormal subspace vectors V and their products with the Hessian HV. The first subspace vector is the normalized gradient, so that the gradient is exactly representable in the subspace.
+        MatrixX<double> V = MatrixX<double>::Zero(dimension, maximum_subspace_dimension);
+        MatrixX<double> HV = MatrixX<double>::Zero(dimension, maximum_subspace_dimension);
+        V.col(0) = g / g_norm;
+
+        VectorX<double> step = VectorX<double>::Zero(dimension);
+        VectorX<double> H_step = VectorX<double>::Zero(dimension);
+        size_t m = 0;  // The current subspace dimension.
+        while (m < maximum_subspace_dimension) {
+
+            // Expand the subspace with the product of the Hessian with the newest subspace vector.
+            HV.col(m) = matvec(V.col(m));
+            m++;
+            this->number_of_hessian_vector_products++;
+
+            const MatrixX<double> projected_hessian = V.leftCols(m).transpose() * HV.leftCols(m);
+            const SquareMatrix<double> subspace_hessian = 0.5 * (projected_hessian + projected_hessian.transpose());
+            const VectorX<double> subspace_gradient = V.leftCols(m).transpose() * g;
+
+            // Solve the subspace problem, and find the eigenvalue of the augmented Hessian that belongs to the restricted step.
+            double mu = 0.0;
+            VectorX<double> c = VectorX<double>::Zero(m);  // The step, expressed in the subspace.
+            this->solveSubspaceProblem(subspace_hessian, subspace_gradient, mu, c);
+
+            step = V.leftCols(m) * c;
+            H_step = HV.leftCols(m) * c;
+
+            // The residual of the augmented Hessian eigenvalue problem, scaled to the step: r = (H - mu) s + g.
+            const VectorX<double> residual = H_step - mu * step + g;
+            if (residual.norm() < residual_threshold) {
+                break;
+            }
+
+            if (m == maximum_subspace_dimension) {
+                break;
+            }
+
+            // Calculate a preconditioned correction vector, and orthonormalize it against the current subspace (twice, for numerical stability).
+            VectorX<double> correction {dimension};
+            for (size_t k = 0; k < dimension; k++) {
+                double denominator = diagonal(k) - mu;
+                if (std::abs(denominator) < 1.0e-04) {
+                    denominator = (denominator < 0.0) ? -1.0e-04 : 1.0e-04;
+                }
+                correction(k) = -residual(k) / denominator;
+            }
+
+            for (size_t iteration = 0; iteration < 2; iteration++) {
+                correction -= V.leftCols(m) * (V.leftCols(m).transpose() * correction);
+            }
+
+            const double correction_norm = correction.norm();
+            if (correction_norm < 1.0e-10) {
+                break;  // The subspace cannot be expanded any further.
+            }
+            V.col(m) = correction / correction_norm;
+        }
+
+        this->step_norm = step.norm();
+        this->predicted_change = g.dot(step) + 0.5 * step.dot(H_step);
+
+        return step;
+    }
+
+
+    /**
+     *  @return the number of Hessian-vector products that were calculated for the most recent step
+     */
+    size_t numberOfHessianVectorProducts() const { return this->number_of_hessian_vector_products; }
+
+    /**
+     *  @return the change of the function value that the quadratic model predicts for the most recent step
+     */
+    double predictedChange() const { return this->predicted_change; }
+
+    /**
+     *  @param trust_radius                 the new maximum norm of a step
+     */
+    void setTrustRadius(const double trust_radius) { this->trust_radius = std::min(trust_radius, this->maximum_trust_radius); }
+
+    /**
+     *  @return the norm of the most recent step
+     */
+    double stepNorm() const { return this->step_norm; }
+
+    /**
+     *  @return the maximum norm of a step
+     */
+    double trustRadius() const { return this->trust_radius; }
+
+
+    /**
+     *  Compare the actual change of the function value for the most recent step with the change that the quadratic model predicted, and adapt the trust radius accordingly.
+     * 
+     *  @param actual_change                the actual change of the function value for the most recent step
+     * 
+     *  @return if the most recent step should be accepted, i.e. if it did not raise the function value
+     */
+    bool updateTrustRadius(const double actual_change) {
+
+        // Changes that are this small are dominated by numerical noise, and are always accepted.
+        const double noise_threshold = 1.0e-10;
+        if ((std::abs(actual_change) < noise_threshold) || (std::abs(this->predicted_change) < noise_threshold)) {
+            return true;
+        }
+
+        const double ratio = actual_change / this->predicted_change;
+        if (ratio < 0.0) {
+            // The function value was raised, so the step is rejected and the next step is taken in a smaller region.
+            this->trust_radius = 0.5 * this->step_norm;
+            return false;
+        }
+
+        if (ratio < 0.25) {
+            this->trust_radius = 0.7 * std::min(this->trust_radius, this->step_norm);
+        } else if ((ratio > 0.75) && (this->step_norm > 0.99 * this->trust_radius)) {
+            this->trust_radius = std::min(1.2 * this->trust_radius, this->maximum_trust_radius);
+        }
+
+        return true;
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Solve the augmented Hessian eigenvalue problem in the subspace, choosing the scaling parameter alpha such that the step lies in the trust region.
+     * 
+     *  @param subspace_hessian         the projection of the Hessian onto the subspace
+     *  @param subspace_gradient        the projection of the gradient onto the subspace
+     *  @param mu                       the eigenvalue of the augmented Hessian that belongs to the step (output)
+     *  @param c                        the step, expressed in the subspace (output)
+     */
+    void solveSubspaceProblem(const SquareMatrix<double>& subspace_hessian, const VectorX<double>& subspace_gradient, double& mu, VectorX<double>& c) const {
+
+        const auto m = subspace_gradient.size();
+
+        // For a given alpha, the lowest eigenvector (c_0, c) of the subspace augmented Hessian yields the step c / (alpha c_0).
+        const auto solve_for = [&subspace_hessian, &subspace_gradient, m, &mu, &c](const double alpha) {
+            Eigen::MatrixXd augmented_hessian = Eigen::MatrixXd::Zero(m + 1, m + 1);
+            augmented_hessian.block(1, 1, m, m) = subspace_hessian;
+            augmented_hessian.block(1, 0, m, 1) = alpha * subspace_gradient;
+            augmented_hessian.block(0, 1, 1, m) = alpha * subspace_gradient.transpose();
+
+            const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {augmented_hessian};
+            const Eigen::VectorXd eigenvector = eigensolver.eigenvectors().col(0);
+
+            mu = eigensolver.eigenvalues()(0);
+            double alpha_c_0 = alpha * eigenvector(0);
+            if (std::abs(alpha_c_0) < 1.0e-12) {
+                alpha_c_0 = (alpha_c_0 < 0.0) ? -1.0e-12 : 1.0e-12;  // The gradient is (nearly) orthogonal to the lowest eigenvector, which should be resolved by the trust region.
+            }
+            c = eigenvector.tail(m) / alpha_c_0;
+
+            return c.norm();
+        };
+
+
+        // The augmented Hessian step (alpha = 1) is taken if it lies in the trust region.
+        if (solve_for(1.0) <= this->trust_radius) {
+            return;
+        }
+
+        // Otherwise, increasing alpha shortens the step: find an upper bound for alpha, and bisect (on a logarithmic scale) until the step lies on the boundary of the trust region.
+        double alpha_lower = 1.0;
+        double alpha_upper = 2.0;
+        while ((solve_for(alpha_upper) > this->trust_radius) && (alpha_upper < 1.0e+08)) {
+            alpha_lower = alpha_upper;
+            alpha_upper *= 2.0;
+        }
+
+        for (size_t iteration = 0; iteration < 50; iteration++) {
+            const double alpha = std::sqrt(alpha_lower * alpha_upper);
+            const double norm = solve_for(alpha);
+
+            if ((norm <= this->trust_radius) && (norm > 0.999 * this->trust_radius)) {
+                return;
+            }
+
+            if (norm > this->trust_radius) {
+                alpha_lower = alpha;
+            } else {
+                alpha_upper = alpha;
+            }
+        }
+
+        solve_for(alpha_upper);  // Make sure the step lies inside the trust region.
+    }
+};
+
+
+}  // namespace Minimization
+}  // namespace GQCP
@@ -21,6 +21,8 @@
 #include "Mathematical/Optimization/OptimizationEnvironment.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 
+#include <functional>
+
 
 namespace GQCP {
 
@@ -37,11 +39,17 @@ class MinimizationEnvironment:
 public:
     using Scalar = _Scalar;
 
+    // The type of a callable function that produces the product of the Hessian, evaluated at the given variables (the first argument), with a given vector (the second argument).
+    using HessianVectorProductFunction = std::function<VectorX<Scalar>(const VectorX<Scalar>&, const VectorX<Scalar>&)>;
+
 
 public:
     VectorFunction<Scalar> gradient_function;  // a callable function that produces the gradient of the scalar function, evaluated at the given variables
     MatrixFunction<Scalar> hessian_function;   // a callable function that produces the Hessian of the scalar function, evaluated at the given variables
 
+    HessianVectorProductFunction hessian_vector_product_function;  // if set, matrix-free steps use this function instead of constructing the Hessian
+    VectorFunction<Scalar> hessian_diagonal_function;              // if set, matrix-free steps use this (approximate) diagonal of the Hessian, evaluated at the given variables, as a preconditioner
+
     std::deque<double> function_values;  // values for the evaluated scalar function (often a sort of 'cost' function)
 
 
@@ -61,6 +69,21 @@ public:
         OptimizationEnvironment<VectorX<_Scalar>>(initial_guess),
         gradient_function {gradient_function},
         hessian_function {hessian_function} {}
+
+
+    /**
+     *  Initialize the optimization environment with an initial guess, for a scalar function whose Hessian is only available through its products with vectors
+     * 
+     *  @param initial_guess                        the initial guess for the variables
+     *  @param gradient_function                    a callable function that produces the gradient of the scalar function, evaluated at the given variables
+     *  @param hessian_vector_product_function      a callable function that produces the product of the Hessian, evaluated at the given variables, with a given vector
+     *  @param hessian_diagonal_function            a callable function that produces (an approximation to) the diagonal of the Hessian, evaluated at the given variables
+     */
+    MinimizationEnvironment(const VectorX<_Scalar>& initial_guess, const VectorFunction<Scalar>& gradient_function, const HessianVectorProductFunction& hessian_vector_product_function, const VectorFunction<Scalar>& hessian_diagonal_function) :
+        OptimizationEnvironment<VectorX<_Scalar>>(initial_guess),
+        gradient_function {gradient_function},
+        hessian_vector_product_function {hessian_vector_product_function},
+        hessian_diagonal_function {hessian_diagonal_function} {}
 };
 
 
@@ -20,6 +20,7 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "Mathematical/Optimization/Minimization/AugmentedHessianStepUpdate.hpp"
 #include "Mathematical/Optimization/Minimization/MinimizationEnvironment.hpp"
 #include "Mathematical/Optimization/Minimization/NewtonStepUpdate.hpp"
 #include "Mathematical/Optimization/OptimizationEnvironment.hpp"
@@ -44,6 +45,26 @@ public:
      * STATIC PUBLIC METHODS
      */
 
+    /**
+     *  @param trust_radius                         the maximum norm of a step
+     *  @param threshold                            the threshold that is used in comparing two consecutive iterations of variables
+     *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+     * 
+     *  @return an augmented Hessian minimizer with a fixed trust radius that uses the norm of the difference of two consecutive iterations of variables as a convergence criterion. If the environment provides a Hessian-vector product function, the Hessian is never constructed.
+     */
+    static IterativeAlgorithm<MinimizationEnvironment<Scalar>> AugmentedHessian(const double trust_radius = 0.5, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' an augmented Hessian minimizer
+        StepCollection<MinimizationEnvironment<Scalar>> augmented_hessian_cycle {};
+        augmented_hessian_cycle.add(GQCP::Minimization::AugmentedHessianStepUpdate<Scalar, MinimizationEnvironment<Scalar>>(trust_radius, trust_radius));
+
+        // Create a convergence criterion on the norm of subsequent iterations of variables
+        const ConsecutiveIteratesNormConvergence<VectorX<Scalar>, MinimizationEnvironment<Scalar>> convergence_criterion {threshold};
+
+        return IterativeAlgorithm<MinimizationEnvironment<Scalar>>(augmented_hessian_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @param threshold                            the threshold that is used in comparing the density matrices
      *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
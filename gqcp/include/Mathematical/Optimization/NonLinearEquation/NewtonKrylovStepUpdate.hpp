@@ -0,0 +1,191 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/NonLinearEquation/NonLinearEquationEnvironment.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+
+#include <Eigen/Jacobi>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+
+namespace GQCP {
+namespace NonLinearEquation {
+
+
+/**
+ *  An iteration step that produces updated variables according to an inexact Newton step, in which the Newton equations are solved by GMRES.
+ *
+ *  GMRES only requires products of the Jacobian with vectors. If the environment provides a matrix-free Jacobian-vector product, the Jacobian is never constructed. Otherwise, the Jacobian is constructed once per step and only used for these products.
+ *
+ *  @tparam _Scalar             the scalar type that is used to represent the variables of the system of equations
+ *  @tparam _Environment        the type of the calculation environment
+ */
+template <typename _Scalar, typename _Environment>
+class NewtonKrylovStepUpdate:
+    public Step<_Environment> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = _Environment;
+
+    static_assert(std::is_same<Scalar, typename Environment::Scalar>::value, "The scalar type must match that of the environment");
+    static_assert(std::is_base_of<NonLinearEquationEnvironment<Scalar>, Environment>::value, "The environment type must derive from NonLinearEquationEnvironment.");
+
+
+private:
+    double relative_tolerance;        // the tolerance on the norm of the residual of the Newton equations, relative to the norm of the vector field
+    size_t maximum_krylov_dimension;  // the maximum dimension of the Krylov subspace in which the Newton step is searched for
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param relative_tolerance               the tolerance on the norm of the residual of the Newton equations, relative to the norm of the vector field
+     *  @param maximum_krylov_dimension         the maximum dimension of the Krylov subspace in which the Newton step is searched for
+     */
+    NewtonKrylovStepUpdate(const double relative_tolerance = 1.0e-06, const size_t maximum_krylov_dimension = 64) :
+        relative_tolerance {relative_tolerance},
+        maximum_krylov_dimension {maximum_krylov_dimension} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Calculate a new iteration of the variables, solving the Newton equations by GMRES, and add them to the environment.";
+    }
+
+
+    /**
+     *  Calculate a new iteration of the variables, solving the Newton equations by GMRES, and add them to the environment.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(Environment& environment) override {
+
+        const auto& x = environment.variables.back();
+
+        // Set up the product of the Jacobian at x with a vector.
+        std::function<VectorX<Scalar>(const VectorX<Scalar>&)> J_product;
+        if (environment.J_product) {
+            J_product = [&environment, &x](const VectorX<Scalar>& y) { return environment.J_product(x, y); };
+        } else {
+            const MatrixX<Scalar> J_matrix = environment.J(x);
+            J_product = [J_matrix](const VectorX<Scalar>& y) { return VectorX<Scalar>(J_matrix * y); };
+        }
+
+
+        // Solve [J dx = -f] by GMRES, starting from dx = 0.
+        const VectorX<Scalar> b = -environment.f(x);
+        const auto dx = this->gmres(J_product, b);
+
+        environment.variables.push_back(x + dx);
+    }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Approximately solve a linear system of equations Ax=b by the GMRES algorithm, starting from a zero initial guess.
+     *
+     *  The Krylov subspace is orthonormalized by the modified Gram-Schmidt process and the upper Hessenberg least-squares problem is solved progressively through Givens rotations. If the relative residual does not drop below the tolerance within the maximum dimension of the Krylov subspace, the best approximation in that subspace is returned.
+     *
+     *  @param A                the product of the matrix A with a vector
+     *  @param b                the right-hand side of the linear system of equations
+     *
+     *  @return the (approximate) solution x
+     */
+    VectorX<Scalar> gmres(const std::function<VectorX<Scalar>(const VectorX<Scalar>&)>& A, const VectorX<Scalar>& b) const {
+
+        const auto dim = static_cast<size_t>(b.size());
+        const double beta = b.norm();
+        if (beta == 0.0) {
+            return VectorX<Scalar>::Zero(dim);
+        }
+
+        const auto m = std::min(this->maximum_krylov_dimension, dim);
+
+        MatrixX<Scalar> V = MatrixX<Scalar>::Zero(dim, m + 1);  // the orthonormal basis of the Krylov subspace
+        MatrixX<Scalar> H = MatrixX<Scalar>::Zero(m + 1, m);    // the (rotated) upper Hessenberg matrix
+        VectorX<Scalar> e = VectorX<Scalar>::Zero(m + 1);       // the (rotated) right-hand side of the least-squares problem
+        std::vector<Eigen::JacobiRotation<Scalar>> rotations(m);
+
+        V.col(0) = b / beta;
+        e(0) = beta;
+
+        size_t k = 0;  // the current dimension of the Krylov subspace
+        while (k < m) {
+
+            // Expand the Krylov subspace.
+            VectorX<Scalar> w = A(V.col(k));
+            for (size_t j = 0; j <= k; j++) {
+                H(j, k) = V.col(j).dot(w);
+                w -= H(j, k) * V.col(j);
+            }
+            const double w_norm = w.norm();
+            H(k + 1, k) = w_norm;
+
+
+            // Bring the new column of the Hessenberg matrix to upper triangular form, and update the right-hand side accordingly.
+            for (size_t j = 0; j < k; j++) {
+                H.col(k).applyOnTheLeft(j, j + 1, rotations[j].adjoint());
+            }
+            rotations[k].makeGivens(H(k, k), H(k + 1, k));
+            H.col(k).applyOnTheLeft(k, k + 1, rotations[k].adjoint());
+            e.applyOnTheLeft(k, k + 1, rotations[k].adjoint());
+
+            k++;
+
+            // The norm of the residual is the magnitude of the last element of the rotated right-hand side. If the Krylov subspace has become invariant, the solution is exact.
+            if ((std::abs(e(k)) < this->relative_tolerance * beta) || (w_norm < 1.0e-14 * beta)) {
+                break;
+            }
+
+            if (k < m) {
+                V.col(k) = w / w_norm;
+            }
+        }
+
+
+        // Solve the triangular least-squares problem and express the solution in the original basis.
+        const VectorX<Scalar> y = H.topLeftCorner(k, k).template triangularView<Eigen::Upper>().solve(e.head(k));
+        return V.leftCols(k) * y;
+    }
+};
+
+
+}  // namespace NonLinearEquation
+}  // namespace GQCP
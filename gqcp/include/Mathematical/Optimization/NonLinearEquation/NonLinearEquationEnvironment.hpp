@@ -41,6 +41,7 @@ public:
 public:
     VectorFunction<Scalar> f;  // a callable function that produces a vector function that represents the system of equations at the given variables
     MatrixFunction<Scalar> J;  // a callable function that produces a matrix that represents the Jacobian of the system of equations at the given variables
+    JacobianVectorProductFunction<Scalar> J_product;  // a callable function that produces the product of the Jacobian of the system of equations at the given variables with a given vector, without constructing the Jacobian; it may be empty
 
 
 public:
@@ -59,6 +60,20 @@ public:
         OptimizationEnvironment<VectorX<_Scalar>>(initial_guess),
         f {f},
         J {J} {}
+
+
+    /**
+     *  Initialize the optimization environment with an initial guess, providing a matrix-free product of the Jacobian with a vector as well
+     * 
+     *  @param initial_guess                the initial guess for the variables
+     *  @param f                            a callable function that produces a vector function that represents the system of equations at the given variables
+     *  @param J                            a callable function that produces a matrix that represents the Jacobian of the system of equations at the given variables
+     *  @param J_product                    a callable function that produces the product of the Jacobian of the system of equations at the given variables (its first argument) with a given vector (its second argument)
+     */
+    NonLinearEquationEnvironment(const VectorX<_Scalar>& initial_guess, const VectorFunction<Scalar>& f, const MatrixFunction<Scalar>& J, const JacobianVectorProductFunction<Scalar>& J_product) :
+        NonLinearEquationEnvironment(initial_guess, f, J) {
+        this->J_product = J_product;
+    }
 };
 
 
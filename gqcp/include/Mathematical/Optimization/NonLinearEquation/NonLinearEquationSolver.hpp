@@ -20,6 +20,7 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "Mathematical/Optimization/NonLinearEquation/NewtonKrylovStepUpdate.hpp"
 #include "Mathematical/Optimization/NonLinearEquation/NewtonStepUpdate.hpp"
 #include "Mathematical/Optimization/NonLinearEquation/NonLinearEquationEnvironment.hpp"
 #include "Mathematical/Optimization/OptimizationEnvironment.hpp"
@@ -65,6 +66,27 @@ public:
 
         return IterativeAlgorithm<NonLinearEquationEnvironment<Scalar>>(newton_cycle, convergence_criterion, maximum_number_of_iterations);
     }
+
+
+    /**
+     *  @param threshold                            the threshold that is used in comparing the iterates
+     *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+     *  @param relative_tolerance                   the tolerance on the norm of the residual of the Newton equations, relative to the norm of the vector field
+     *  @param maximum_krylov_dimension             the maximum dimension of the Krylov subspace in which the Newton step is searched for
+     * 
+     *  @return a Newton-Krylov non-linear system of equations solver, which solves the Newton equations by GMRES (using the matrix-free Jacobian-vector product of the environment, if it is provided) and uses the norm of the difference of two consecutive iterations of variables as a convergence criterion
+     */
+    static IterativeAlgorithm<NonLinearEquationEnvironment<Scalar>> NewtonKrylov(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const double relative_tolerance = 1.0e-06, const size_t maximum_krylov_dimension = 64) {
+
+        // Create the iteration cycle that effectively 'defines' a Newton-Krylov system of equations solver: it uses an inexact Newton-step based update of the variables
+        StepCollection<NonLinearEquationEnvironment<Scalar>> newton_krylov_cycle {};
+        newton_krylov_cycle.add(GQCP::NonLinearEquation::NewtonKrylovStepUpdate<Scalar, NonLinearEquationEnvironment<Scalar>>(relative_tolerance, maximum_krylov_dimension));
+
+        // Create a convergence criterion on the norm of subsequent iterations of variables
+        const ConsecutiveIteratesNormConvergence<VectorX<Scalar>, NonLinearEquationEnvironment<Scalar>> convergence_criterion {threshold};
+
+        return IterativeAlgorithm<NonLinearEquationEnvironment<Scalar>>(newton_krylov_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
@@ -0,0 +1,632 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <stdexcept>
+#include <string>
+
+
+namespace GQCP {
+
+
+template <typename _Scalar, int _Rank>
+class Tensor;
+
+
+/**
+ *  A plan for the contraction of two tensors, which is specified through a NumPy 'einsum'-like string such as "imae,mbej->ijab".
+ *
+ *  All the work that only depends on the labels is done once, at construction: the labels are parsed and matched, and it is decided how both tensors can be viewed as matrices with the least number of permutations (shuffles) of their axes. Since the constructors are `constexpr`, a plan that is created from a string literal can be parsed at compile time and reused for every contraction, e.g.
+ *
+ *      static constexpr ContractionPlan<4, 4, 4> plan {"imae,mbej->ijab"};
+ *      const auto result = plan.contract(t2, W);
+ *
+ *  At contraction time, the plan chooses between a single matrix-matrix product (which Eigen delegates to MKL's GEMM if GQCP is configured to use it) and Eigen's tensor contraction module. The matrix-matrix product is used, unless one of the tensors would have to be permuted into a copy and the contraction is too cheap to earn back the cost of that copy.
+ *
+ *  @tparam _LHSRank            The rank of the tensor on the left-hand side of the contraction.
+ *  @tparam _RHSRank            The rank of the tensor on the right-hand side of the contraction.
+ *  @tparam _ResultRank         The rank of the resulting tensor.
+ */
+template <int _LHSRank, int _RHSRank, int _ResultRank>
+class ContractionPlan {
+public:
+    // The rank of the tensor on the left-hand side of the contraction.
+    static constexpr int LHSRank = _LHSRank;
+
+    // The rank of the tensor on the right-hand side of the contraction.
+    static constexpr int RHSRank = _RHSRank;
+
+    // The rank of the resulting tensor.
+    static constexpr int ResultRank = _ResultRank;
+
+    // The number of axes that are contracted over.
+    static constexpr int N = (LHSRank + RHSRank - ResultRank) / 2;
+
+    static_assert((LHSRank + RHSRank - ResultRank) % 2 == 0, "The ranks of the tensors are incompatible with a pairwise contraction.");
+    static_assert((N >= 0) && (N <= LHSRank) && (N <= RHSRank), "The ranks of the tensors are incompatible with a pairwise contraction.");
+
+    // If a tensor has to be permuted into a copy, a matrix-matrix product is only used if it performs at least this number of multiply-adds per copied element.
+    static constexpr Eigen::Index MultiplyAddsPerCopiedElement = 16;
+
+
+private:
+    // The ways in which a tensor can be viewed as a matrix in the matrix-matrix product.
+    enum class Layout {
+        FreeContracted,  // The surviving axes come first: the (column-major) tensor is a (free, contracted) matrix.
+        ContractedFree,  // The contracted axes come first: the (column-major) tensor is a (contracted, free) matrix.
+        Shuffled         // The tensor has to be permuted into a (free, contracted) copy for the left-hand side, or a (contracted, free) copy for the right-hand side.
+    };
+
+
+    // The labels of the axes. All the arrays in this class have one extra element, because arrays of size zero are not allowed.
+    char lhs_labels[LHSRank + 1] {};
+    char rhs_labels[RHSRank + 1] {};
+    char output_labels[ResultRank + 1] {};
+
+    // The axes of both tensors that survive the contraction, in increasing order.
+    int lhs_free_axes[LHSRank + 1] {};
+    int rhs_free_axes[RHSRank + 1] {};
+    int number_of_lhs_free_axes = 0;
+    int number_of_rhs_free_axes = 0;
+
+    // The pairs of axes that are contracted over, in the order in which they make up the inner dimension of the matrix-matrix product.
+    int lhs_contracted_axes[N + 1] {};
+    int rhs_contracted_axes[N + 1] {};
+
+    // The ways in which the tensors are viewed as matrices.
+    Layout lhs_layout = Layout::Shuffled;
+    Layout rhs_layout = Layout::Shuffled;
+
+    // If true, the matrix-matrix product is calculated as B^T A^T, such that the axes of the intermediate result are (rhs free, lhs free) instead of (lhs free, rhs free).
+    bool swap_result = false;
+
+    // For every axis of the result, the axis of the intermediate result of the matrix-matrix product (or of Eigen's contraction, whose axes are always (lhs free, rhs free)) that it corresponds to.
+    int output_shuffle[ResultRank + 1] {};
+    bool output_needs_shuffle = false;
+    int eigen_output_shuffle[ResultRank + 1] {};
+    bool eigen_output_needs_shuffle = false;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Parse a contraction string.
+     *
+     *  @param contraction_string       The string that specifies the contraction, e.g. "ijkl,jk->il". Any spaces are discarded, and the arrow may be omitted for a contraction over all axes.
+     */
+    explicit constexpr ContractionPlan(const char* contraction_string) {
+
+        int segment = 0;  // 0: lhs labels, 1: rhs labels, 2: output labels
+        int lengths[3] = {0, 0, 0};
+
+        for (const char* c = contraction_string; *c != '\0'; c++) {
+            if (*c == ' ') {
+                continue;
+            }
+
+            if (*c == ',') {
+                if (segment != 0) {
+                    throw std::invalid_argument("ContractionPlan(const char*): The contraction string should contain exactly one comma, before the arrow.");
+                }
+                segment = 1;
+                continue;
+            }
+
+            if (*c == '-') {
+                if ((segment != 1) || (*(c + 1) != '>')) {
+                    throw std::invalid_argument("ContractionPlan(const char*): The contraction string should contain exactly one arrow '->', after the comma.");
+                }
+                segment = 2;
+                c++;
+                continue;
+            }
+
+            const int ranks[3] = {LHSRank, RHSRank, ResultRank};
+            if (lengths[segment] >= ranks[segment]) {
+                throw std::invalid_argument("ContractionPlan(const char*): The number of labels does not match the rank of the corresponding tensor.");
+            }
+
+            char* const labels[3] = {this->lhs_labels, this->rhs_labels, this->output_labels};
+            labels[segment][lengths[segment]] = *c;
+            lengths[segment]++;
+        }
+
+        if ((segment == 0) || (lengths[0] != LHSRank) || (lengths[1] != RHSRank) || (lengths[2] != ResultRank)) {
+            throw std::invalid_argument("ContractionPlan(const char*): The number of labels does not match the rank of the corresponding tensor.");
+        }
+
+        this->analyze();
+    }
+
+
+    /**
+     *  Create a plan from the labels of both tensors and of the result.
+     *
+     *  @param lhs_labels               The labels for the axes of the tensor on the left-hand side of the contraction.
+     *  @param rhs_labels               The labels for the axes of the tensor on the right-hand side of the contraction.
+     *  @param output_labels            The labels for the axes of the resulting tensor. Every label that appears in both `lhs_labels` and `rhs_labels` is contracted over, and every other label should appear in `output_labels`.
+     */
+    constexpr ContractionPlan(const char* lhs_labels, const char* rhs_labels, const char* output_labels) {
+
+        ContractionPlan::copyLabels(lhs_labels, LHSRank, this->lhs_labels);
+        ContractionPlan::copyLabels(rhs_labels, RHSRank, this->rhs_labels);
+        ContractionPlan::copyLabels(output_labels, ResultRank, this->output_labels);
+
+        this->analyze();
+    }
+
+
+    /**
+     *  Create a plan from the labels of both tensors and of the result.
+     *
+     *  @param lhs_labels               The labels for the axes of the tensor on the left-hand side of the contraction.
+     *  @param rhs_labels               The labels for the axes of the tensor on the right-hand side of the contraction.
+     *  @param output_labels            The labels for the axes of the resulting tensor.
+     */
+    ContractionPlan(const std::string& lhs_labels, const std::string& rhs_labels, const std::string& output_labels) :
+        ContractionPlan(lhs_labels.c_str(), rhs_labels.c_str(), output_labels.c_str()) {}
+
+
+    /**
+     *  Parse a contraction string.
+     *
+     *  @param contraction_string       The string that specifies the contraction, e.g. "ijkl,jk->il".
+     */
+    explicit ContractionPlan(const std::string& contraction_string) :
+        ContractionPlan(contraction_string.c_str()) {}
+
+
+    /*
+     *  MARK: Contractions
+     */
+
+    /**
+     *  Contract two tensors according to this plan.
+     *
+     *  @param lhs              The left-hand side of the contraction.
+     *  @param rhs              The right-hand side of the contraction.
+     *
+     *  @return The result of the tensor contraction.
+     */
+    template <typename Scalar>
+    Tensor<Scalar, ResultRank> contract(const Tensor<Scalar, LHSRank>& lhs, const Tensor<Scalar, RHSRank>& rhs) const {
+
+        const Eigen::TensorMap<const Eigen::Tensor<Scalar, LHSRank>> lhs_map {lhs.data(), lhs.dimensions()};
+        const Eigen::TensorMap<const Eigen::Tensor<Scalar, RHSRank>> rhs_map {rhs.data(), rhs.dimensions()};
+
+        return this->contractMaps(lhs_map, rhs_map);
+    }
+
+
+    /**
+     *  Contract a tensor with a matrix according to this plan, without copying the matrix into a tensor.
+     *
+     *  @param lhs              The left-hand side of the contraction.
+     *  @param rhs              The right-hand side of the contraction, which is viewed as a rank-two tensor.
+     *
+     *  @return The result of the tensor contraction.
+     */
+    template <typename Scalar, int Z = RHSRank>
+    enable_if_t<Z == 2, Tensor<Scalar, ResultRank>> contract(const Tensor<Scalar, LHSRank>& lhs, const MatrixX<Scalar>& rhs) const {
+
+        const Eigen::TensorMap<const Eigen::Tensor<Scalar, LHSRank>> lhs_map {lhs.data(), lhs.dimensions()};
+        const Eigen::TensorMap<const Eigen::Tensor<Scalar, 2>> rhs_map {rhs.data(), rhs.rows(), rhs.cols()};
+
+        return this->contractMaps(lhs_map, rhs_map);
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The number of tensors that have to be permuted into a copy before the matrix-matrix product can be performed.
+     */
+    constexpr int numberOfShuffledOperands() const { return static_cast<int>(this->lhs_layout == Layout::Shuffled) + static_cast<int>(this->rhs_layout == Layout::Shuffled); }
+
+    /**
+     *  @return If the intermediate result of the matrix-matrix product has to be permuted to obtain the requested axes.
+     */
+    constexpr bool needsOutputShuffle() const { return this->output_needs_shuffle; }
+
+
+private:
+    /*
+     *  MARK: Parsing
+     */
+
+    /**
+     *  Copy labels into one of the label arrays of this plan.
+     *
+     *  @param source           The null-terminated labels.
+     *  @param rank             The expected number of labels.
+     *  @param target           The array that the labels are copied to.
+     */
+    static constexpr void copyLabels(const char* source, const int rank, char* target) {
+
+        int length = 0;
+        for (const char* c = source; *c != '\0'; c++) {
+            if (length >= rank) {
+                throw std::invalid_argument("ContractionPlan::copyLabels(const char*, const int, char*): The number of labels does not match the rank of the corresponding tensor.");
+            }
+            target[length] = *c;
+            length++;
+        }
+
+        if (length != rank) {
+            throw std::invalid_argument("ContractionPlan::copyLabels(const char*, const int, char*): The number of labels does not match the rank of the corresponding tensor.");
+        }
+    }
+
+
+    /**
+     *  @param labels           An array of labels.
+     *  @param length           The number of labels.
+     *  @param label            The label that is looked for.
+     *
+     *  @return The position of the label in the array, or -1 if it isn't found.
+     */
+    static constexpr int find(const char* labels, const int length, const char label) {
+
+        for (int i = 0; i < length; i++) {
+            if (labels[i] == label) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+
+    /**
+     *  @param axes             An array of axes.
+     *  @param length           The number of axes.
+     *  @param first            The first axis of the consecutive range.
+     *
+     *  @return If the axes are first, first + 1, ..., first + length - 1.
+     */
+    static constexpr bool areConsecutive(const int* axes, const int length, const int first) {
+
+        for (int i = 0; i < length; i++) {
+            if (axes[i] != first + i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    /**
+     *  Match the labels, and decide how both tensors are viewed as matrices and how the intermediate result is permuted into the requested result.
+     */
+    constexpr void analyze() {
+
+        // Split the axes into the ones that are contracted over (in the order of the left-hand side) and the ones that survive the contraction.
+        int number_of_contracted_axes = 0;
+        for (int i = 0; i < LHSRank; i++) {
+            if (ContractionPlan::find(this->lhs_labels, i, this->lhs_labels[i]) != -1) {
+                throw std::invalid_argument("ContractionPlan::analyze(): A label may only appear once for every tensor.");
+            }
+
+            const auto match = ContractionPlan::find(this->rhs_labels, RHSRank, this->lhs_labels[i]);
+            if (match == -1) {
+                this->lhs_free_axes[this->number_of_lhs_free_axes] = i;
+                this->number_of_lhs_free_axes++;
+            } else {
+                if (number_of_contracted_axes >= N) {
+                    throw std::invalid_argument("ContractionPlan::analyze(): The output labels do not match the labels that survive the contraction.");
+                }
+                this->lhs_contracted_axes[number_of_contracted_axes] = i;
+                this->rhs_contracted_axes[number_of_contracted_axes] = match;
+                number_of_contracted_axes++;
+            }
+        }
+
+        for (int j = 0; j < RHSRank; j++) {
+            if (ContractionPlan::find(this->rhs_labels, j, this->rhs_labels[j]) != -1) {
+                throw std::invalid_argument("ContractionPlan::analyze(): A label may only appear once for every tensor.");
+            }
+
+            if (ContractionPlan::find(this->lhs_labels, LHSRank, this->rhs_labels[j]) == -1) {
+                this->rhs_free_axes[this->number_of_rhs_free_axes] = j;
+                this->number_of_rhs_free_axes++;
+            }
+        }
+
+        if (number_of_contracted_axes != N) {
+            throw std::invalid_argument("ContractionPlan::analyze(): The output labels do not match the labels that survive the contraction.");
+        }
+
+
+        // The contracted axes may be ordered like they appear in the left-hand side, or like they appear in the right-hand side. Choose the order for which the least number of tensors has to be permuted.
+        int lhs_order_contracted_axes[N + 1] {};
+        int rhs_order_contracted_axes[N + 1] {};
+        for (int k = 0; k < N; k++) {
+            lhs_order_contracted_axes[k] = this->lhs_contracted_axes[k];
+            rhs_order_contracted_axes[k] = this->rhs_contracted_axes[k];
+        }
+
+        // Sort the pairs by their right-hand side axis (insertion sort, since there are only a few axes).
+        int sorted_lhs_axes[N + 1] {};
+        int sorted_rhs_axes[N + 1] {};
+        for (int k = 0; k < N; k++) {
+            int position = k;
+            while ((position > 0) && (sorted_rhs_axes[position - 1] > rhs_order_contracted_axes[k])) {
+                sorted_lhs_axes[position] = sorted_lhs_axes[position - 1];
+                sorted_rhs_axes[position] = sorted_rhs_axes[position - 1];
+                position--;
+            }
+            sorted_lhs_axes[position] = lhs_order_contracted_axes[k];
+            sorted_rhs_axes[position] = rhs_order_contracted_axes[k];
+        }
+
+        const auto lhs_layout_in_lhs_order = this->lhsLayout(lhs_order_contracted_axes);
+        const auto rhs_layout_in_lhs_order = this->rhsLayout(rhs_order_contracted_axes);
+        const auto lhs_layout_in_rhs_order = this->lhsLayout(sorted_lhs_axes);
+        const auto rhs_layout_in_rhs_order = this->rhsLayout(sorted_rhs_axes);
+
+        const auto shuffles_in_lhs_order = static_cast<int>(lhs_layout_in_lhs_order == Layout::Shuffled) + static_cast<int>(rhs_layout_in_lhs_order == Layout::Shuffled);
+        const auto shuffles_in_rhs_order = static_cast<int>(lhs_layout_in_rhs_order == Layout::Shuffled) + static_cast<int>(rhs_layout_in_rhs_order == Layout::Shuffled);
+
+        if (shuffles_in_rhs_order < shuffles_in_lhs_order) {
+            for (int k = 0; k < N; k++) {
+                this->lhs_contracted_axes[k] = sorted_lhs_axes[k];
+                this->rhs_contracted_axes[k] = sorted_rhs_axes[k];
+            }
+            this->lhs_layout = lhs_layout_in_rhs_order;
+            this->rhs_layout = rhs_layout_in_rhs_order;
+        } else {
+            this->lhs_layout = lhs_layout_in_lhs_order;
+            this->rhs_layout = rhs_layout_in_lhs_order;
+        }
+
+
+        // The intermediate result of the matrix-matrix product has (lhs free, rhs free) axes, or (rhs free, lhs free) axes if the product is transposed. Choose the one that matches the requested output, if any.
+        char lhs_free_labels_first[ResultRank + 1] {};  // (lhs free, rhs free)
+        char rhs_free_labels_first[ResultRank + 1] {};  // (rhs free, lhs free)
+        for (int i = 0; i < this->number_of_lhs_free_axes; i++) {
+            lhs_free_labels_first[i] = this->lhs_labels[this->lhs_free_axes[i]];
+            rhs_free_labels_first[this->number_of_rhs_free_axes + i] = this->lhs_labels[this->lhs_free_axes[i]];
+        }
+        for (int j = 0; j < this->number_of_rhs_free_axes; j++) {
+            lhs_free_labels_first[this->number_of_lhs_free_axes + j] = this->rhs_labels[this->rhs_free_axes[j]];
+            rhs_free_labels_first[j] = this->rhs_labels[this->rhs_free_axes[j]];
+        }
+
+        bool matches_lhs_free_first = true;
+        bool matches_rhs_free_first = true;
+        for (int k = 0; k < ResultRank; k++) {
+            const auto position = ContractionPlan::find(lhs_free_labels_first, ResultRank, this->output_labels[k]);
+            if ((position == -1) || (ContractionPlan::find(this->output_labels, k, this->output_labels[k]) != -1)) {
+                throw std::invalid_argument("ContractionPlan::analyze(): The output labels do not match the labels that survive the contraction.");
+            }
+
+            this->eigen_output_shuffle[k] = position;
+            this->output_shuffle[k] = position;
+
+            matches_lhs_free_first = matches_lhs_free_first && (position == k);
+            matches_rhs_free_first = matches_rhs_free_first && (rhs_free_labels_first[k] == this->output_labels[k]);
+        }
+
+        this->eigen_output_needs_shuffle = !matches_lhs_free_first;
+        if (matches_lhs_free_first) {
+            this->swap_result = false;
+            this->output_needs_shuffle = false;
+        } else if (matches_rhs_free_first) {
+            this->swap_result = true;
+            this->output_needs_shuffle = false;
+        } else {
+            this->swap_result = false;
+            this->output_needs_shuffle = true;
+        }
+    }
+
+
+    /**
+     *  @param contracted_axes      The contracted axes of the left-hand side, in the order of the inner dimension.
+     *
+     *  @return How the left-hand side can be viewed as a matrix, given an order of the contracted axes.
+     */
+    constexpr Layout lhsLayout(const int* contracted_axes) const {
+
+        if (ContractionPlan::areConsecutive(this->lhs_free_axes, this->number_of_lhs_free_axes, 0) && ContractionPlan::areConsecutive(contracted_axes, N, this->number_of_lhs_free_axes)) {
+            return Layout::FreeContracted;
+        }
+        if (ContractionPlan::areConsecutive(contracted_axes, N, 0) && ContractionPlan::areConsecutive(this->lhs_free_axes, this->number_of_lhs_free_axes, N)) {
+            return Layout::ContractedFree;
+        }
+        return Layout::Shuffled;
+    }
+
+
+    /**
+     *  @param contracted_axes      The contracted axes of the right-hand side, in the order of the inner dimension.
+     *
+     *  @return How the right-hand side can be viewed as a matrix, given an order of the contracted axes.
+     */
+    constexpr Layout rhsLayout(const int* contracted_axes) const {
+
+        if (ContractionPlan::areConsecutive(contracted_axes, N, 0) && ContractionPlan::areConsecutive(this->rhs_free_axes, this->number_of_rhs_free_axes, N)) {
+            return Layout::ContractedFree;
+        }
+        if (ContractionPlan::areConsecutive(this->rhs_free_axes, this->number_of_rhs_free_axes, 0) && ContractionPlan::areConsecutive(contracted_axes, N, this->number_of_rhs_free_axes)) {
+            return Layout::FreeContracted;
+        }
+        return Layout::Shuffled;
+    }
+
+
+    /*
+     *  MARK: Contractions
+     */
+
+    /**
+     *  Contract two tensors according to this plan.
+     *
+     *  @param lhs              A view on the left-hand side of the contraction.
+     *  @param rhs              A view on the right-hand side of the contraction.
+     *
+     *  @return The result of the tensor contraction.
+     */
+    template <typename Scalar>
+    Tensor<Scalar, ResultRank> contractMaps(const Eigen::TensorMap<const Eigen::Tensor<Scalar, LHSRank>>& lhs, const Eigen::TensorMap<const Eigen::Tensor<Scalar, RHSRank>>& rhs) const {
+
+        using MatrixType = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+        // Determine the dimensions of the matrix-matrix product.
+        Eigen::Index rows = 1;
+        for (int i = 0; i < this->number_of_lhs_free_axes; i++) {
+            rows *= lhs.dimension(this->lhs_free_axes[i]);
+        }
+
+        Eigen::Index inner_dimension = 1;
+        for (int k = 0; k < N; k++) {
+            const auto dimension = lhs.dimension(this->lhs_contracted_axes[k]);
+            if (dimension != rhs.dimension(this->rhs_contracted_axes[k])) {
+                throw std::invalid_argument("ContractionPlan::contract(const Tensor<Scalar, LHSRank>&, const Tensor<Scalar, RHSRank>&): The dimensions of the axes that are contracted over do not match.");
+            }
+            inner_dimension *= dimension;
+        }
+
+        Eigen::Index cols = 1;
+        for (int j = 0; j < this->number_of_rhs_free_axes; j++) {
+            cols *= rhs.dimension(this->rhs_free_axes[j]);
+        }
+
+
+        // If copies would be required for a cheap contraction, let Eigen's tensor contraction module handle the permutations instead.
+        const Eigen::Index copied_elements = ((this->lhs_layout == Layout::Shuffled) ? lhs.size() : 0) + ((this->rhs_layout == Layout::Shuffled) ? rhs.size() : 0);
+        if ((N > 0) && (copied_elements > 0) && (rows * inner_dimension * cols < MultiplyAddsPerCopiedElement * copied_elements)) {
+            Eigen::array<Eigen::IndexPair<Eigen::Index>, N> contraction_pairs {};
+            for (int k = 0; k < N; k++) {
+                contraction_pairs[k] = Eigen::IndexPair<Eigen::Index>(this->lhs_contracted_axes[k], this->rhs_contracted_axes[k]);
+            }
+
+            if (!this->eigen_output_needs_shuffle) {
+                return Tensor<Scalar, ResultRank>(lhs.contract(rhs, contraction_pairs));
+            }
+            return Tensor<Scalar, ResultRank>(lhs.contract(rhs, contraction_pairs).shuffle(ContractionPlan::asEigenArray<ResultRank>(this->eigen_output_shuffle)));
+        }
+
+
+        // Permute the tensors that can't be viewed as a matrix: the left-hand side to (free, contracted) and the right-hand side to (contracted, free).
+        Eigen::Tensor<Scalar, LHSRank> lhs_shuffled;
+        const Scalar* lhs_data = lhs.data();
+        if (this->lhs_layout == Layout::Shuffled) {
+            int lhs_shuffle[LHSRank + 1] {};
+            for (int i = 0; i < this->number_of_lhs_free_axes; i++) {
+                lhs_shuffle[i] = this->lhs_free_axes[i];
+            }
+            for (int k = 0; k < N; k++) {
+                lhs_shuffle[this->number_of_lhs_free_axes + k] = this->lhs_contracted_axes[k];
+            }
+
+            lhs_shuffled = lhs.shuffle(ContractionPlan::asEigenArray<LHSRank>(lhs_shuffle));
+            lhs_data = lhs_shuffled.data();
+        }
+
+        Eigen::Tensor<Scalar, RHSRank> rhs_shuffled;
+        const Scalar* rhs_data = rhs.data();
+        if (this->rhs_layout == Layout::Shuffled) {
+            int rhs_shuffle[RHSRank + 1] {};
+            for (int k = 0; k < N; k++) {
+                rhs_shuffle[k] = this->rhs_contracted_axes[k];
+            }
+            for (int j = 0; j < this->number_of_rhs_free_axes; j++) {
+                rhs_shuffle[N + j] = this->rhs_free_axes[j];
+            }
+
+            rhs_shuffled = rhs.shuffle(ContractionPlan::asEigenArray<RHSRank>(rhs_shuffle));
+            rhs_data = rhs_shuffled.data();
+        }
+
+
+        // Set up the intermediate result, whose axes are (lhs free, rhs free), or (rhs free, lhs free) if the product is transposed.
+        Eigen::array<Eigen::Index, ResultRank> intermediate_dimensions {};
+        const auto lhs_offset = this->swap_result ? this->number_of_rhs_free_axes : 0;
+        const auto rhs_offset = this->swap_result ? 0 : this->number_of_lhs_free_axes;
+        for (int i = 0; i < this->number_of_lhs_free_axes; i++) {
+            intermediate_dimensions[lhs_offset + i] = lhs.dimension(this->lhs_free_axes[i]);
+        }
+        for (int j = 0; j < this->number_of_rhs_free_axes; j++) {
+            intermediate_dimensions[rhs_offset + j] = rhs.dimension(this->rhs_free_axes[j]);
+        }
+        Tensor<Scalar, ResultRank> intermediate {intermediate_dimensions};
+
+
+        // Perform the contraction as one matrix-matrix product, viewing the tensors as (possibly transposed) matrices.
+        const auto multiply = [this, &intermediate, rows, cols](const auto& A, const auto& B) {
+            if (this->swap_result) {
+                Eigen::Map<MatrixType> C {intermediate.data(), cols, rows};
+                C.noalias() = B.transpose() * A.transpose();
+            } else {
+                Eigen::Map<MatrixType> C {intermediate.data(), rows, cols};
+                C.noalias() = A * B;
+            }
+        };
+
+        const bool lhs_is_transposed = (this->lhs_layout == Layout::ContractedFree);
+        const bool rhs_is_transposed = (this->rhs_layout == Layout::FreeContracted);
+        const Eigen::Map<const MatrixType> A {lhs_data, lhs_is_transposed ? inner_dimension : rows, lhs_is_transposed ? rows : inner_dimension};
+        const Eigen::Map<const MatrixType> B {rhs_data, rhs_is_transposed ? cols : inner_dimension, rhs_is_transposed ? inner_dimension : cols};
+
+        if (lhs_is_transposed && rhs_is_transposed) {
+            multiply(A.transpose(), B.transpose());
+        } else if (lhs_is_transposed) {
+            multiply(A.transpose(), B);
+        } else if (rhs_is_transposed) {
+            multiply(A, B.transpose());
+        } else {
+            multiply(A, B);
+        }
+
+
+        // Permute the axes of the intermediate result to the requested ones.
+        if (!this->output_needs_shuffle) {
+            return intermediate;
+        }
+        return Tensor<Scalar, ResultRank>(intermediate.shuffle(ContractionPlan::asEigenArray<ResultRank>(this->output_shuffle)));
+    }
+
+
+    /**
+     *  @param axes             An array of axes.
+     *
+     *  @return The first `Rank` axes, as an array that can be used in Eigen's tensor operations.
+     */
+    template <int Rank>
+    static Eigen::array<Eigen::Index, Rank> asEigenArray(const int* axes) {
+
+        Eigen::array<Eigen::Index, Rank> result {};
+        for (int i = 0; i < Rank; i++) {
+            result[i] = axes[i];
+        }
+        return result;
+    }
+};
+
+
+}  // namespace GQCP
@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Mathematical/Representation/ImplicitSliceIndexMap.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 
 #include <map>
@@ -32,6 +33,8 @@ namespace GQCP {
  * 
  *  If the full matrix is unnecessary to know, and only a certain slice of the matrix is of interest, this class implements operator() that can be used with the row and column indices of the full matrix.
  * 
+ *  The row and column indices are converted in constant time: for contiguous index ranges, an offset is subtracted, and for other index sets, a flat lookup table is used.
+ * 
  *  @tparam _Scalar             the scalar representation of one element of the encapsulating matrix
  */
 template <typename _Scalar>
@@ -44,6 +47,9 @@ private:
     std::map<size_t, size_t> rows_implicit_to_dense;  // maps the row indices of the implicit matrix to the row indices of the dense representation of the slice
     std::map<size_t, size_t> cols_implicit_to_dense;  // maps the column indices of the implicit matrix to the column indices of the dense representation of the slice
 
+    ImplicitSliceIndexMap row_index_map;     // the constant-time equivalent of rows_implicit_to_dense
+    ImplicitSliceIndexMap column_index_map;  // the constant-time equivalent of cols_implicit_to_dense
+
     MatrixX<Scalar> M;  // the dense representation of the slice
 
 
@@ -62,6 +68,8 @@ public:
     ImplicitMatrixSlice(const std::map<size_t, size_t>& rows_implicit_to_dense, const std::map<size_t, size_t>& cols_implicit_to_dense, const MatrixX<Scalar>& M) :
         rows_implicit_to_dense {rows_implicit_to_dense},
         cols_implicit_to_dense {cols_implicit_to_dense},
+        row_index_map {rows_implicit_to_dense},
+        column_index_map {cols_implicit_to_dense},
         M {M} {
 
         // Check if the maps are consistent with the dense representation of the slice.
@@ -242,11 +250,26 @@ public:
      */
     const MatrixX<Scalar>& asMatrix() const { return this->M; }
 
+    /**
+     *  @return this as a writable matrix, i.e. a column-major view with a leading dimension equal to its number of rows that can be handed to BLAS-like routines
+     * 
+     *  @note The dimensions of the returned matrix should not be changed.
+     */
+    MatrixX<Scalar>& asMatrix() { return this->M; }
+
     /**
      *  @return this as a (column-major) vector
      */
     VectorX<Scalar> asVector() const { return this->M.pairWiseReduced(); }
 
+    /**
+     *  @tparam NewScalar           the scalar type that the elements should be converted to
+     * 
+     *  @return a copy of this slice in which the elements are converted to the given scalar type
+     */
+    template <typename NewScalar>
+    ImplicitMatrixSlice<NewScalar> cast() const { return ImplicitMatrixSlice<NewScalar>(this->rows_implicit_to_dense, this->cols_implicit_to_dense, this->M.template cast<NewScalar>()); }
+
     /**
      *  @return the map between the column indices of the implicit matrix and the column indices of the dense representation of the slice
      */
@@ -259,7 +282,7 @@ public:
      * 
      *  @return the column index the dense representation of this slice.
      */
-    size_t denseIndexOfColumn(const size_t col) const { return this->cols_implicit_to_dense.at(col); }
+    size_t denseIndexOfColumn(const size_t col) const { return this->column_index_map(col); }
 
     /**
      *  Convert an implicit row index to the row index in the dense representation of this slice.
@@ -268,7 +291,7 @@ public:
      * 
      *  @return the row index the dense representation of this slice.
      */
-    size_t denseIndexOfRow(const size_t row) const { return this->rows_implicit_to_dense.at(row); }
+    size_t denseIndexOfRow(const size_t row) const { return this->row_index_map(row); }
 
     /**
      *  @return the map between the row indices of the implicit matrix and the row indices of the dense representation of the slice
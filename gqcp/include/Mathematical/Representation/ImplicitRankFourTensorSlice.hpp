@@ -18,9 +18,11 @@
 #pragma once
 
 
+#include "Mathematical/Representation/ImplicitSliceIndexMap.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Mathematical/Representation/Tensor.hpp"
 
+#include <array>
 #include <map>
 #include <numeric>
 #include <vector>
@@ -33,6 +35,8 @@ namespace GQCP {
  *  A slice of a rank-four tensor that only exists implicitly.
  * 
  *  If the full tensor is unnecessary to know, and only a certain slice of the tensor is of interest, this class implements operator() that can be used with the indices of the full tensor.
+ * 
+ *  The indices are converted in constant time: for contiguous index ranges, an offset is subtracted, and for other index sets, a flat lookup table is used.
  */
 template <typename _Scalar>
 class ImplicitRankFourTensorSlice {
@@ -43,6 +47,8 @@ public:
 private:
     std::vector<std::map<size_t, size_t>> indices_implicit_to_dense;  // an array of maps, mapping the implicit tensor indices to these of the dense representation
 
+    std::vector<ImplicitSliceIndexMap> index_maps;  // the constant-time equivalents of the maps in indices_implicit_to_dense
+
     Tensor<Scalar, 4> T;  // the dense representation of the slice
 
 
@@ -68,6 +74,11 @@ public:
                 throw std::invalid_argument("ImplicitRankFourTensorSlice(const std::vector<std::map<size_t, size_t>>&, const Tensor<Scalar, 4>&): The given dense representation of the slice has an incompatible dimension for axis number " + std::to_string(axis_index) + ".");
             }
         }
+
+        this->index_maps.reserve(4);
+        for (size_t axis_index = 0; axis_index < 4; axis_index++) {
+            this->index_maps.emplace_back(this->indices_implicit_to_dense[axis_index]);
+        }
     }
 
 
@@ -272,13 +283,42 @@ public:
     /**
      *  @return this as a (column-major) matrix
      */
-    MatrixX<Scalar> asMatrix() const { return this->T.pairWiseReduced(); }
+    MatrixX<Scalar> asMatrix() const { return this->matrixView(); }
 
     /**
      *  @return this as a tensor
      */
     const Tensor<Scalar, 4>& asTensor() const { return this->T; }
 
+    /**
+     *  @return this as a writable tensor
+     * 
+     *  @note The dimensions of the returned tensor should not be changed.
+     */
+    Tensor<Scalar, 4>& asTensor() { return this->T; }
+
+    /**
+     *  @tparam NewScalar           the scalar type that the elements should be converted to
+     * 
+     *  @return a copy of this slice in which the elements are converted to the given scalar type
+     */
+    template <typename NewScalar>
+    ImplicitRankFourTensorSlice<NewScalar> cast() const {
+
+        Tensor<NewScalar, 4> T_cast = this->T.template cast<NewScalar>();
+        return ImplicitRankFourTensorSlice<NewScalar>(this->indices_implicit_to_dense, T_cast);
+    }
+
+    /**
+     *  @return a read-only pointer to the (column-major) elements of the dense representation of this slice
+     */
+    const Scalar* data() const { return this->T.data(); }
+
+    /**
+     *  @return a writable pointer to the (column-major) elements of the dense representation of this slice
+     */
+    Scalar* data() { return this->T.data(); }
+
     /**
      *  Convert an implicit axis index to the axis index in the dense representation of this slice.
      * 
@@ -289,12 +329,39 @@ public:
      *  @return the index of the dense representation of this slice for the given axis
      */
     template <size_t Axis>
-    size_t denseIndexOf(const size_t index) const { return this->indices_implicit_to_dense[Axis].at(index); }
+    size_t denseIndexOf(const size_t index) const { return this->index_maps[Axis](index); }
 
     /**
      *  @return an array of maps, mapping the implicit tensor indices to these of the dense representation
      */
     const std::vector<std::map<size_t, size_t>>& indexMaps() const { return this->indices_implicit_to_dense; }
+
+    /**
+     *  @return a read-only view on the dense representation of this slice as a (column-major) matrix, in which the first two indices form the row index and the last two indices form the column index. It has the same elements as `asMatrix()`, but no copy is made.
+     */
+    Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> matrixView() const {
+
+        const auto dimensions = this->T.dimensions();
+        return Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(this->T.data(), dimensions[0] * dimensions[1], dimensions[2] * dimensions[3]);
+    }
+
+    /**
+     *  @return a writable view on the dense representation of this slice as a (column-major) matrix, in which the first two indices form the row index and the last two indices form the column index
+     */
+    Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> matrixView() {
+
+        const auto dimensions = this->T.dimensions();
+        return Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(this->T.data(), dimensions[0] * dimensions[1], dimensions[2] * dimensions[3]);
+    }
+
+    /**
+     *  @return the strides (in number of elements) of the four axes of the dense representation of this slice, which is stored in column-major order
+     */
+    std::array<size_t, 4> strides() const {
+
+        const auto dimensions = this->T.dimensions();
+        return {1, static_cast<size_t>(dimensions[0]), static_cast<size_t>(dimensions[0] * dimensions[1]), static_cast<size_t>(dimensions[0] * dimensions[1] * dimensions[2])};
+    }
 };
 
 
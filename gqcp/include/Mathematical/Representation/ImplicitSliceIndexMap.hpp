@@ -0,0 +1,141 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A map between the indices of one axis of an implicit (encapsulating) matrix or tensor and the indices of the corresponding axis of a dense representation of a slice, that can be evaluated in constant time.
+ *
+ *  If the implicit indices form a contiguous range that is mapped in order, a dense index is found by subtracting an offset. Otherwise, the dense indices are looked up in a flat array that spans the range of the implicit indices.
+ */
+class ImplicitSliceIndexMap {
+private:
+    // The smallest implicit index.
+    size_t m_offset;
+
+    // The number of indices in the slice.
+    size_t m_size;
+
+    // If the implicit indices form a contiguous range that is mapped in order onto the dense indices.
+    bool is_contiguous;
+
+    // For a non-contiguous map, the dense index that belongs to the implicit index `offset + i` is stored at position i.
+    std::vector<size_t> lookup;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param implicit_to_dense            The map between the implicit indices and the dense indices.
+     */
+    ImplicitSliceIndexMap(const std::map<size_t, size_t>& implicit_to_dense) :
+        m_offset {implicit_to_dense.empty() ? 0 : implicit_to_dense.begin()->first},
+        m_size {implicit_to_dense.size()},
+        is_contiguous {true} {
+
+        // Since the keys of a map are sorted, the map is contiguous if and only if every implicit index follows its predecessor, and is mapped onto its position.
+        size_t position = 0;
+        for (const auto& pair : implicit_to_dense) {
+            if ((pair.first != this->m_offset + position) || (pair.second != position)) {
+                this->is_contiguous = false;
+                break;
+            }
+            position++;
+        }
+
+        if (!this->is_contiguous) {
+            const auto range = implicit_to_dense.rbegin()->first - this->m_offset + 1;
+
+            this->lookup = std::vector<size_t>(range, ImplicitSliceIndexMap::absent());
+            for (const auto& pair : implicit_to_dense) {
+                this->lookup[pair.first - this->m_offset] = pair.second;
+            }
+        }
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param index                The implicit index.
+     *
+     *  @return The dense index that corresponds to the given implicit index.
+     */
+    size_t operator()(const size_t index) const {
+
+        // Indices below the offset wrap around to large values, so that one comparison suffices.
+        const auto shifted_index = index - this->m_offset;
+
+        if (this->is_contiguous) {
+            if (shifted_index >= this->m_size) {
+                throw std::out_of_range("ImplicitSliceIndexMap::operator()(const size_t): The index " + std::to_string(index) + " is not part of the slice.");
+            }
+            return shifted_index;
+        }
+
+        if ((shifted_index >= this->lookup.size()) || (this->lookup[shifted_index] == ImplicitSliceIndexMap::absent())) {
+            throw std::out_of_range("ImplicitSliceIndexMap::operator()(const size_t): The index " + std::to_string(index) + " is not part of the slice.");
+        }
+        return this->lookup[shifted_index];
+    }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return If the implicit indices form a contiguous range that is mapped in order onto the dense indices, i.e. if a dense index is found by subtracting the offset.
+     */
+    bool isContiguous() const { return this->is_contiguous; }
+
+    /**
+     *  @return The smallest implicit index.
+     */
+    size_t offset() const { return this->m_offset; }
+
+    /**
+     *  @return The number of indices in the slice.
+     */
+    size_t size() const { return this->m_size; }
+
+
+private:
+    /**
+     *  @return The value in the lookup table that signals an implicit index that isn't part of the slice.
+     */
+    static size_t absent() { return std::numeric_limits<size_t>::max(); }
+};
+
+
+}  // namespace GQCP
@@ -68,6 +68,22 @@ public:
     using Eigen::Matrix<Scalar, Rows, Cols>::Matrix;  // inherit base constructors
 
 
+    /*
+     *  OPERATORS
+     */
+
+    /**
+     *  Assign an Eigen expression to this matrix, without creating a temporary matrix first. If the dimensions already match, no memory is allocated.
+     *
+     *  @param other        the expression that should be assigned
+     */
+    template <typename OtherDerived>
+    Matrix& operator=(const Eigen::MatrixBase<OtherDerived>& other) {
+        this->Base::operator=(other);
+        return *this;
+    }
+
+
     /*
      *  NAMED CONSTRUCTORS
      */
@@ -487,5 +503,8 @@ using VectorFunction = std::function<VectorX<Scalar>(const VectorX<Scalar>&)>;
 template <typename Scalar>
 using MatrixFunction = std::function<MatrixX<Scalar>(const VectorX<Scalar>&)>;
 
+template <typename Scalar>
+using JacobianVectorProductFunction = std::function<VectorX<Scalar>(const VectorX<Scalar>&, const VectorX<Scalar>&)>;
+
 
 }  // namespace GQCP
@@ -0,0 +1,510 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/SquareMatrix.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A square rank-four tensor with the eight-fold permutational symmetry of real two-electron integrals in chemist's notation, i.e.
+ *      g(p q r s) = g(q p r s) = g(p q s r) = g(r s p q) = ...
+ *
+ *  Only the elements g(p q r s) with p >= q, r >= s and pq >= rs are stored, in which pq = p (p + 1) / 2 + q is the compound pair index. This reduces the memory requirements from K^4 to approximately K^4 / 8. The unique elements are stored as the lower triangle (in row-major order) of the symmetric pair matrix g(pq, rs), so that the element g(pq, rs) is found at offset pq (pq + 1) / 2 + rs.
+ *
+ *  @tparam _Scalar      The scalar type of the elements. Only real scalars are supported, since complex two-electron integrals only have a four-fold symmetry.
+ */
+template <typename _Scalar>
+class PackedSquareRankFourTensor {
+public:
+    // The scalar type of the elements.
+    using Scalar = _Scalar;
+
+    // The type of 'this'.
+    using Self = PackedSquareRankFourTensor<Scalar>;
+
+
+private:
+    // The dimension of each of the axes of the (unpacked) tensor.
+    size_t dim;
+
+    // The unique elements, stored as the lower triangle of the symmetric pair matrix.
+    VectorX<Scalar> elements;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct a zero-initialized packed tensor.
+     *
+     *  @param dim          The dimension of each of the axes of the (unpacked) tensor.
+     */
+    PackedSquareRankFourTensor(const size_t dim = 0) :
+        dim {dim},
+        elements {VectorX<Scalar>::Zero(Self::numberOfElements(dim))} {}
+
+
+    /**
+     *  Construct a packed tensor from its packed elements. The dimension is deduced from the number of elements.
+     *
+     *  @tparam ExpDerived      The type of the Eigen expression (normally generated by the compiler).
+     *
+     *  @param expression       An Eigen expression for the packed elements.
+     */
+    template <typename ExpDerived>
+    PackedSquareRankFourTensor(const Eigen::MatrixBase<ExpDerived>& expression) :
+        dim {0},
+        elements {expression} {
+
+        const auto number_of_elements = static_cast<size_t>(this->elements.size());
+        while (Self::numberOfElements(this->dim) < number_of_elements) {
+            this->dim++;
+        }
+
+        if (Self::numberOfElements(this->dim) != number_of_elements) {
+            throw std::invalid_argument("PackedSquareRankFourTensor(const Eigen::MatrixBase<ExpDerived>&): The given number of elements does not correspond to a packed square rank-four tensor.");
+        }
+    }
+
+
+    /**
+     *  Pack a square rank-four tensor. Only the elements g(p q r s) with p >= q, r >= s and pq >= rs are read, so the given tensor is assumed to have the eight-fold permutational symmetry.
+     *
+     *  @param tensor           The unpacked tensor.
+     */
+    PackedSquareRankFourTensor(const SquareRankFourTensor<Scalar>& tensor) :
+        PackedSquareRankFourTensor(tensor.dimension()) {
+
+        const auto K = this->dimension();
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q <= p; q++) {
+                for (size_t r = 0; r <= p; r++) {
+                    for (size_t s = 0; s <= ((r == p) ? q : r); s++) {  // Ensure pq >= rs.
+                        this->operator()(p, q, r, s) = tensor(p, q, r, s);
+                    }
+                }
+            }
+        }
+    }
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Create a zero-initialized `PackedSquareRankFourTensor`.
+     *
+     *  @param dim          The dimension of each of the tensor's axes.
+     *
+     *  @return A zero `PackedSquareRankFourTensor`.
+     */
+    static Self Zero(const size_t dim) { return Self {dim}; }
+
+
+    /**
+     *  Create a random-initialized `PackedSquareRankFourTensor`, with values uniformly distributed between [-1,1].
+     *
+     *  @param dim          The dimension of each of the tensor's axes.
+     *
+     *  @return A random `PackedSquareRankFourTensor`.
+     */
+    static Self Random(const size_t dim) {
+
+        Self result {dim};
+        result.elements = VectorX<Scalar>::Random(Self::numberOfElements(dim));
+        return result;
+    }
+
+
+    /*
+     *  MARK: Packing
+     */
+
+    /**
+     *  @param p            An orbital index.
+     *  @param q            An orbital index.
+     *
+     *  @return The compound index of the (unordered) pair of orbital indices.
+     */
+    static size_t pairIndex(const size_t p, const size_t q) {
+
+        const auto max = std::max(p, q);
+        const auto min = std::min(p, q);
+        return max * (max + 1) / 2 + min;
+    }
+
+
+    /**
+     *  @param dim          The dimension of each of the axes of the (unpacked) tensor.
+     *
+     *  @return The number of (unordered) pairs of orbital indices.
+     */
+    static size_t numberOfPairs(const size_t dim) { return dim * (dim + 1) / 2; }
+
+
+    /**
+     *  @param dim          The dimension of each of the axes of the (unpacked) tensor.
+     *
+     *  @return The number of unique elements of a packed tensor with the given dimension.
+     */
+    static size_t numberOfElements(const size_t dim) {
+
+        const auto number_of_pairs = Self::numberOfPairs(dim);
+        return number_of_pairs * (number_of_pairs + 1) / 2;
+    }
+
+
+    /**
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *  @param r            The third index.
+     *  @param s            The fourth index.
+     *
+     *  @return The offset of the element g(p q r s) in the packed storage.
+     */
+    static size_t packedIndex(const size_t p, const size_t q, const size_t r, const size_t s) { return Self::pairIndex(Self::pairIndex(p, q), Self::pairIndex(r, s)); }
+
+
+    /**
+     *  @return The unpacked tensor, which contains all K^4 elements.
+     */
+    SquareRankFourTensor<Scalar> unpacked() const {
+
+        const auto K = this->dimension();
+        SquareRankFourTensor<Scalar> tensor {K};
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q < K; q++) {
+                for (size_t r = 0; r < K; r++) {
+                    for (size_t s = 0; s < K; s++) {
+                        tensor(p, q, r, s) = this->operator()(p, q, r, s);
+                    }
+                }
+            }
+        }
+
+        return tensor;
+    }
+
+
+    /**
+     *  @return The symmetric pair matrix g(pq, rs), in which the compound pair indices are given by `pairIndex`.
+     */
+    MatrixX<Scalar> pairMatrix() const {
+
+        const auto number_of_pairs = Self::numberOfPairs(this->dimension());
+        MatrixX<Scalar> G {number_of_pairs, number_of_pairs};
+        for (size_t pq = 0; pq < number_of_pairs; pq++) {
+            for (size_t rs = 0; rs <= pq; rs++) {
+                G(pq, rs) = G(rs, pq) = this->elements(Self::pairIndex(pq, rs));
+            }
+        }
+
+        return G;
+    }
+
+
+    /**
+     *  Pack a symmetric pair matrix g(pq, rs). Only its lower triangle is read.
+     *
+     *  @param G                The symmetric pair matrix.
+     *
+     *  @return The packed tensor that corresponds to the given pair matrix.
+     */
+    static Self FromPairMatrix(const MatrixX<Scalar>& G) {
+
+        const auto number_of_pairs = static_cast<size_t>(G.rows());
+        VectorX<Scalar> elements {number_of_pairs * (number_of_pairs + 1) / 2};
+        for (size_t pq = 0; pq < number_of_pairs; pq++) {
+            for (size_t rs = 0; rs <= pq; rs++) {
+                elements(Self::pairIndex(pq, rs)) = G(pq, rs);
+            }
+        }
+
+        return Self {elements};
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The dimension of each of the axes of the (unpacked) tensor.
+     */
+    size_t dimension() const { return this->dim; }
+
+    /**
+     *  @return A read-only reference to the packed elements.
+     */
+    const VectorX<Scalar>& Eigen() const { return this->elements; }
+
+    /**
+     *  @return A writable reference to the packed elements.
+     */
+    VectorX<Scalar>& Eigen() { return this->elements; }
+
+    /**
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *  @param r            The third index.
+     *  @param s            The fourth index.
+     *
+     *  @return A read-only reference to the element g(p q r s).
+     */
+    const Scalar& operator()(const size_t p, const size_t q, const size_t r, const size_t s) const { return this->elements(Self::packedIndex(p, q, r, s)); }
+
+    /**
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *  @param r            The third index.
+     *  @param s            The fourth index.
+     *
+     *  @return A writable reference to the element g(p q r s), which is shared with all its permutationally equivalent elements.
+     */
+    Scalar& operator()(const size_t p, const size_t q, const size_t r, const size_t s) { return this->elements(Self::packedIndex(p, q, r, s)); }
+
+
+    /*
+     *  MARK: Contractions
+     */
+
+    /**
+     *  Calculate the direct (Coulomb) contractions
+     *      J(p q) = sum_{r s} g(p q r s) D(r s)
+     *  and the exchange contractions
+     *      K(p s) = sum_{q r} g(p q r s) D(r q)
+     *  for a set of matrices D, in a single pass over the unique elements. This fuses the equivalents of `einsum<2>("ijkl,kl->ij", D)` and `einsum<2>("ijkl,kj->il", D)`.
+     *
+     *  @param densities        The matrices D to contract with.
+     *
+     *  @return A pair containing the direct contractions and the exchange contractions, in the order of the given matrices.
+     */
+    std::pair<std::vector<SquareMatrix<Scalar>>, std::vector<SquareMatrix<Scalar>>> contractDirectAndExchange(const std::vector<SquareMatrix<Scalar>>& densities) const {
+
+        const auto K = this->dimension();
+        const auto number_of_pairs = Self::numberOfPairs(K);
+        const auto number_of_densities = densities.size();
+        for (const auto& D : densities) {
+            if (D.dimension() != K) {
+                throw std::invalid_argument("PackedSquareRankFourTensor::contractDirectAndExchange(const std::vector<SquareMatrix<Scalar>>&): The dimensions of the given matrices are not compatible with this tensor.");
+            }
+        }
+
+        // Since g(p q r s) = g(p q s r), only the symmetric part of D contributes to the direct contraction: collect D(r s) + D(s r) for every pair rs. J(pq) = sum_rs g(pq, rs) D(rs) is then a product of the symmetric pair matrix and a vector.
+        std::vector<VectorX<Scalar>> D_pairs(number_of_densities, VectorX<Scalar> {number_of_pairs});
+        std::vector<VectorX<Scalar>> J_pairs(number_of_densities, VectorX<Scalar>::Zero(number_of_pairs));
+        for (size_t n = 0; n < number_of_densities; n++) {
+            const auto& D = densities[n];
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < r; s++) {
+                    D_pairs[n](Self::pairIndex(r, s)) = D(r, s) + D(s, r);
+                }
+                D_pairs[n](Self::pairIndex(r, r)) = D(r, r);
+            }
+        }
+
+        std::vector<SquareMatrix<Scalar>> K_matrices(number_of_densities, SquareMatrix<Scalar>::Zero(K));
+
+        size_t offset = 0;
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q <= p; q++) {
+                const auto pq = Self::pairIndex(p, q);
+
+                for (size_t r = 0; r <= p; r++) {
+                    for (size_t s = 0; s <= ((r == p) ? q : r); s++) {  // Ensure pq >= rs.
+                        const auto rs = Self::pairIndex(r, s);
+                        const auto g_pqrs = this->elements(offset++);
+
+                        // Visiting all eight permutations of (p q r s) counts the element g(p q r s) as many times as there are coinciding permutations, which is compensated for by a factor 1/2 for every coincidence.
+                        Scalar g_weighted = g_pqrs;
+                        if (p == q) {
+                            g_weighted *= 0.5;
+                        }
+                        if (r == s) {
+                            g_weighted *= 0.5;
+                        }
+                        if (pq == rs) {
+                            g_weighted *= 0.5;
+                        }
+
+                        for (size_t n = 0; n < number_of_densities; n++) {
+                            J_pairs[n](pq) += g_pqrs * D_pairs[n](rs);
+                            if (pq != rs) {
+                                J_pairs[n](rs) += g_pqrs * D_pairs[n](pq);
+                            }
+
+                            // For every permutation (a b c d), K(a d) += g(a b c d) D(c b).
+                            const auto& D = densities[n];
+                            auto& K_matrix = K_matrices[n];
+                            K_matrix(p, s) += g_weighted * D(r, q);
+                            K_matrix(q, s) += g_weighted * D(r, p);
+                            K_matrix(p, r) += g_weighted * D(s, q);
+                            K_matrix(q, r) += g_weighted * D(s, p);
+                            K_matrix(r, q) += g_weighted * D(p, s);
+                            K_matrix(s, q) += g_weighted * D(p, r);
+                            K_matrix(r, p) += g_weighted * D(q, s);
+                            K_matrix(s, p) += g_weighted * D(q, r);
+                        }
+                    }
+                }
+            }
+        }
+
+        std::vector<SquareMatrix<Scalar>> J_matrices(number_of_densities, SquareMatrix<Scalar> {K});
+        for (size_t n = 0; n < number_of_densities; n++) {
+            for (size_t p = 0; p < K; p++) {
+                for (size_t q = 0; q <= p; q++) {
+                    J_matrices[n](p, q) = J_matrices[n](q, p) = J_pairs[n](Self::pairIndex(p, q));
+                }
+            }
+        }
+
+        return {J_matrices, K_matrices};
+    }
+
+
+    /**
+     *  @param D            The matrix to contract with.
+     *
+     *  @return The direct (Coulomb) contraction J(p q) = sum_{r s} g(p q r s) D(r s), i.e. the equivalent of `einsum<2>("ijkl,kl->ij", D)`.
+     */
+    SquareMatrix<Scalar> contractDirect(const SquareMatrix<Scalar>& D) const { return this->contractDirectAndExchange({D}).first[0]; }
+
+    /**
+     *  @param D            The matrix to contract with.
+     *
+     *  @return The exchange contraction K(p s) = sum_{q r} g(p q r s) D(r q), i.e. the equivalent of `einsum<2>("ijkl,kj->il", D)`.
+     */
+    SquareMatrix<Scalar> contractExchange(const SquareMatrix<Scalar>& D) const { return this->contractDirectAndExchange({D}).second[0]; }
+
+
+    /*
+     *  MARK: Basis transformations
+     */
+
+    /**
+     *  Apply a basis transformation to every axis, i.e. calculate
+     *      g'(P Q R S) = T(p P) T(q Q) T(r R) T(s S) g(p q r s).
+     *
+     *  Every column of the pair matrix g(pq, rs) is a symmetric matrix in the indices (p q) that transforms as T^T M T. Transforming all columns, transposing and transforming all columns again yields the transformed pair matrix, so that the full K^4 tensor is never formed.
+     *
+     *  @param T            The (square) transformation matrix.
+     *
+     *  @return The basis-transformed packed tensor.
+     */
+    Self transformed(const SquareMatrix<Scalar>& T) const {
+
+        if (T.dimension() != this->dimension()) {
+            throw std::invalid_argument("PackedSquareRankFourTensor::transformed(const SquareMatrix<Scalar>&): The dimension of the transformation matrix is not compatible with this tensor.");
+        }
+
+        return this->pairTransformed([&T](const SquareMatrix<Scalar>& M) { return SquareMatrix<Scalar> {T.transpose() * M * T}; });
+    }
+
+
+    /**
+     *  Apply the same transformation to the two pairs of indices, by transforming every symmetric matrix M(p q) that corresponds to one column of the pair matrix.
+     *
+     *  @param transformation       A function that transforms a symmetric K-by-K matrix into another symmetric K-by-K matrix.
+     *
+     *  @return The transformed packed tensor.
+     */
+    template <typename Transformation>
+    Self pairTransformed(const Transformation& transformation) const {
+
+        const auto K = this->dimension();
+        MatrixX<Scalar> G = this->pairMatrix();
+
+        SquareMatrix<Scalar> M {K};
+        for (size_t half = 0; half < 2; half++) {
+            for (size_t rs = 0; rs < static_cast<size_t>(G.cols()); rs++) {
+
+                // Unpack the column into a symmetric matrix, transform it and pack it again.
+                for (size_t p = 0; p < K; p++) {
+                    for (size_t q = 0; q <= p; q++) {
+                        M(p, q) = M(q, p) = G(Self::pairIndex(p, q), rs);
+                    }
+                }
+
+                M = transformation(M);
+
+                for (size_t p = 0; p < K; p++) {
+                    for (size_t q = 0; q <= p; q++) {
+                        G(Self::pairIndex(p, q), rs) = M(p, q);
+                    }
+                }
+            }
+
+            G.transposeInPlace();
+        }
+
+        return Self::FromPairMatrix(G);
+    }
+
+
+    /*
+     *  MARK: Operations
+     */
+
+    /**
+     *  @param a            The scalar.
+     *
+     *  @return This tensor, multiplied by the given scalar.
+     */
+    Self operator*(const Scalar& a) const { return Self {VectorX<Scalar> {this->elements * a}}; }
+
+    /**
+     *  @param a            The scalar.
+     *  @param tensor       The tensor.
+     *
+     *  @return The tensor, multiplied by the given scalar.
+     */
+    friend Self operator*(const Scalar& a, const Self& tensor) { return tensor * a; }
+
+    /**
+     *  @param other        The other packed tensor.
+     *  @param tolerance    The tolerance for the comparison of the elements.
+     *
+     *  @return If this tensor is approximately equal to the other one.
+     */
+    bool isApprox(const Self& other, const double tolerance = 1.0e-12) const {
+
+        if (this->dimension() != other.dimension()) {
+            return false;
+        }
+
+        return this->elements.isApprox(other.elements, tolerance);
+    }
+};
+
+
+}  // namespace GQCP
@@ -22,6 +22,8 @@
 #include "Mathematical/Representation/Tensor.hpp"
 
 #include <iostream>
+#include <utility>
+#include <vector>
 
 
 namespace GQCP {
@@ -208,6 +210,41 @@ public:
      */
     size_t dimension() const { return this->dimension(0); }  // all tensor dimensions are equal because of the constructor
 
+
+    /**
+     *  Access a two-dimensional slice of this tensor as a (strided) matrix, without copying any elements. For example, `matrixSlice(0, 3, i, j)` is the matrix M(p s) = T(p i j s).
+     *
+     *  @param row_axis             The axis (0, 1, 2 or 3) that determines the rows of the matrix slice.
+     *  @param column_axis          The axis (0, 1, 2 or 3) that determines the columns of the matrix slice.
+     *  @param index1               The fixed index for the first one of the two remaining axes.
+     *  @param index2               The fixed index for the second one of the two remaining axes.
+     *
+     *  @return A read-only view on the matrix slice.
+     */
+    Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>> matrixSlice(const size_t row_axis, const size_t column_axis, const size_t index1, const size_t index2) const {
+
+        if ((row_axis > 3) || (column_axis > 3) || (row_axis == column_axis)) {
+            throw std::invalid_argument("SquareRankFourTensor::matrixSlice(const size_t, const size_t, const size_t, const size_t): The given axes are invalid.");
+        }
+
+        // In column-major storage, the stride of an axis is K^axis.
+        const auto K = static_cast<Eigen::Index>(this->dimension());
+        const Eigen::Index strides[4] = {1, K, K * K, K * K * K};
+
+        // Find the offset of the first element of the slice, given the fixed indices of the remaining axes.
+        Eigen::Index offset = 0;
+        const size_t fixed_indices[2] = {index1, index2};
+        size_t fixed_index_counter = 0;
+        for (size_t axis = 0; axis < 4; axis++) {
+            if ((axis != row_axis) && (axis != column_axis)) {
+                offset += static_cast<Eigen::Index>(fixed_indices[fixed_index_counter]) * strides[axis];
+                fixed_index_counter++;
+            }
+        }
+
+        return {this->data() + offset, K, K, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(strides[column_axis], strides[row_axis])};
+    }
+
     /**
      *  @return the pair-wise reduction of this square rank-4 tensor, i.e. the tensor analog of a strict "lower triangle" as a matrix in column major form
      *
@@ -244,6 +281,136 @@ public:
 
         return M;
     }
+
+
+    /**
+     *  In-place apply a Jacobi rotation to one of the axes of this tensor. Only the slices that are related to the indices p and q of that axis are changed: they are replaced by the linear combinations
+     *      T'(.. p ..) = J(p p) T(.. p ..) + J(q p) T(.. q ..)
+     *      T'(.. q ..) = J(p q) T(.. p ..) + J(q q) T(.. q ..),
+     *  in which J is the matrix representation of the Jacobi rotation. Since only two slices are touched, this costs O(K^3) instead of the O(K^5) of a general transformation of one axis.
+     *
+     *  @param p                    The index of the first rotated orbital.
+     *  @param q                    The index of the second rotated orbital.
+     *  @param jacobi_rotation      The Jacobi rotation, with the same convention as `Eigen::MatrixBase::applyOnTheRight`.
+     *  @param axis                 The axis (0, 1, 2 or 3) that should be rotated.
+     */
+    void applyJacobiRotation(const size_t p, const size_t q, const Eigen::JacobiRotation<double>& jacobi_rotation, const size_t axis) {
+
+        if (axis > 3) {
+            throw std::invalid_argument("SquareRankFourTensor::applyJacobiRotation(const size_t, const size_t, const Eigen::JacobiRotation<double>&, const size_t): The axis should be 0, 1, 2 or 3.");
+        }
+
+        // Find the four non-trivial elements of the Jacobi rotation matrix by rotating a 2x2 identity matrix.
+        Eigen::Matrix2d J = Eigen::Matrix2d::Identity();
+        J.applyOnTheRight(0, 1, jacobi_rotation);
+
+        // In column-major storage, the element (i, j, k, l) is found at offset i + K j + K^2 k + K^3 l. For the given axis, the slices p and q are therefore found by running over all the faster-changing indices (the 'inner' offset) and all the slower-changing indices (the 'outer' offset).
+        const auto K = this->dimension();
+        size_t stride = 1;
+        for (size_t a = 0; a < axis; a++) {
+            stride *= K;
+        }
+        const auto number_of_outer = (K * K * K) / stride;
+
+        Scalar* data = this->data();
+        for (size_t outer = 0; outer < number_of_outer; outer++) {
+            Scalar* slice_p = data + outer * stride * K + p * stride;
+            Scalar* slice_q = data + outer * stride * K + q * stride;
+
+            for (size_t inner = 0; inner < stride; inner++) {
+                const Scalar x = slice_p[inner];
+                const Scalar y = slice_q[inner];
+
+                slice_p[inner] = J(0, 0) * x + J(1, 0) * y;
+                slice_q[inner] = J(0, 1) * x + J(1, 1) * y;
+            }
+        }
+    }
+
+
+    /**
+     *  Calculate the direct (Coulomb) contractions
+     *      J(p q) = sum_{r s} T(p q r s) D(r s)
+     *  and the exchange contractions
+     *      K(p s) = sum_{q r} T(p q r s) D(r q)
+     *  for a set of matrices D, in a single pass over this tensor. This fuses the contractions `einsum<2>("ijkl,kl->ij", D)` and `einsum<2>("ijkl,kj->il", D)`, without shuffling this tensor into intermediates.
+     *
+     *  @param densities        The matrices D to contract with.
+     *
+     *  @return A pair containing the direct contractions and the exchange contractions, in the order of the given matrices.
+     */
+    std::pair<std::vector<SquareMatrix<Scalar>>, std::vector<SquareMatrix<Scalar>>> contractDirectAndExchange(const std::vector<SquareMatrix<Scalar>>& densities) const {
+
+        const auto K = this->dimension();
+        for (const auto& D : densities) {
+            if (D.dimension() != K) {
+                throw std::invalid_argument("SquareRankFourTensor::contractDirectAndExchange(const std::vector<SquareMatrix<Scalar>>&): The dimensions of the given matrices are not compatible with this tensor.");
+            }
+        }
+
+        std::vector<SquareMatrix<Scalar>> J_matrices(densities.size(), SquareMatrix<Scalar>::Zero(K));
+        std::vector<SquareMatrix<Scalar>> K_matrices(densities.size(), SquareMatrix<Scalar>::Zero(K));
+
+        // In column-major storage, the block T(. . r s) is a contiguous K-by-K matrix A_rs, which is read once and contributes as
+        //      J += D(r s) A_rs,
+        //      K(., s) += A_rs D(r, .)^T.
+        const auto K_index = static_cast<Eigen::Index>(K);
+        for (size_t s = 0; s < K; s++) {
+            for (size_t r = 0; r < K; r++) {
+                const Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> A_rs {this->data() + K * K * (r + K * s), K_index, K_index};
+
+                for (size_t n = 0; n < densities.size(); n++) {
+                    const auto& D = densities[n];
+
+                    J_matrices[n].noalias() += D(r, s) * A_rs;
+                    K_matrices[n].col(s).noalias() += A_rs * D.row(r).transpose();
+                }
+            }
+        }
+
+        return {J_matrices, K_matrices};
+    }
+
+
+    /**
+     *  @param D            The matrix to contract with.
+     *
+     *  @return The direct (Coulomb) contraction J(p q) = sum_{r s} T(p q r s) D(r s), i.e. the equivalent of `einsum<2>("ijkl,kl->ij", D)`.
+     */
+    SquareMatrix<Scalar> contractDirect(const SquareMatrix<Scalar>& D) const {
+
+        // J(p q) is a matrix-vector product of the K^2-by-K^2 supermatrix T(pq, rs) with the vectorized D.
+        const auto K = this->dimension();
+        const auto K2 = static_cast<Eigen::Index>(K * K);
+        const Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> T_supermatrix {this->data(), K2, K2};
+        const Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> D_vector {D.data(), K2};
+
+        const VectorX<Scalar> J_vector = T_supermatrix * D_vector;
+        return SquareMatrix<Scalar> {Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(J_vector.data(), K, K)};
+    }
+
+
+    /**
+     *  @param D            The matrix to contract with.
+     *
+     *  @return The exchange contraction K(p s) = sum_{q r} T(p q r s) D(r q), i.e. the equivalent of `einsum<2>("ijkl,kj->il", D)`.
+     */
+    SquareMatrix<Scalar> contractExchange(const SquareMatrix<Scalar>& D) const {
+
+        // Every column K(., s) is a matrix-vector product of the contiguous K-by-K^2 slice T(. . . s) with the vectorized D^T.
+        const auto K = this->dimension();
+        const auto K_index = static_cast<Eigen::Index>(K);
+        const SquareMatrix<Scalar> D_transpose = D.transpose();
+        const Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> D_transpose_vector {D_transpose.data(), K_index * K_index};
+
+        SquareMatrix<Scalar> K_matrix {K};
+        for (size_t s = 0; s < K; s++) {
+            const Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>> T_s {this->data() + K * K * K * s, K_index, K_index * K_index};
+            K_matrix.col(s).noalias() = T_s * D_transpose_vector;
+        }
+
+        return K_matrix;
+    }
 };
 
 }  // namespace GQCP
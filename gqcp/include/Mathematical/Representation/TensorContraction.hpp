@@ -0,0 +1,76 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/ContractionPlan.hpp"
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+
+#include <string>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Conversions
+ */
+
+/**
+ *  @param M            A matrix.
+ *
+ *  @return The given matrix as a rank-two tensor.
+ */
+template <typename Scalar>
+Tensor<Scalar, 2> asRankTwoTensor(const MatrixX<Scalar>& M) {
+
+    return Tensor<Scalar, 2>(Eigen::TensorMap<const Eigen::Tensor<const Scalar, 2>>(M.data(), M.rows(), M.cols()));
+}
+
+
+/*
+ *  MARK: Contractions
+ */
+
+/**
+ *  Contract two tensors, using a NumPy 'einsum'-like API, by reducing the contraction to one matrix-matrix product.
+ *
+ *  The axes of both tensors are permuted such that the axes that are contracted over are adjacent, after which both tensors can be viewed as matrices whose product is the (permuted) result of the contraction. The matrix-matrix product is delegated to Eigen, which calls the (multithreaded) BLAS routines of MKL if GQCP is configured to use it. See `ContractionPlan` for how permutations are avoided, and for setting up a contraction once if it is performed repeatedly.
+ *
+ *  @tparam ResultRank          The rank of the resulting tensor.
+ *
+ *  @param lhs                  The left-hand side of the contraction.
+ *  @param lhs_labels           The labels for the axes of the tensor on the left-hand side of the contraction.
+ *  @param rhs                  The right-hand side of the contraction.
+ *  @param rhs_labels           The labels for the axes of the tensor on the right-hand side of the contraction.
+ *  @param output_labels        The labels for the axes of the resulting tensor. Every label that appears in both `lhs_labels` and `rhs_labels` is contracted over, and every other label should appear in `output_labels`.
+ *
+ *  @example contractThroughMatrixProduct<4>(t2, "imae", W3, "mbej", "ijab") calculates sum_{me} t2(i,m,a,e) W3(m,b,e,j).
+ *
+ *  @return The result of the tensor contraction.
+ */
+template <int ResultRank, typename Scalar, int LHSRank, int RHSRank>
+Tensor<Scalar, ResultRank> contractThroughMatrixProduct(const Tensor<Scalar, LHSRank>& lhs, const std::string& lhs_labels, const Tensor<Scalar, RHSRank>& rhs, const std::string& rhs_labels, const std::string& output_labels) {
+
+    const ContractionPlan<LHSRank, RHSRank, ResultRank> plan {lhs_labels, rhs_labels, output_labels};
+    return plan.contract(lhs, rhs);
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,348 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Integrals/DensityFittingFactors.hpp"
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "DensityMatrix/Orbital1DM.hpp"
+#include "DensityMatrix/Orbital2DM.hpp"
+#include "Mathematical/Representation/DenseVectorizer.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+#include "Mathematical/Representation/StorageArray.hpp"
+#include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
+#include "QuantumChemical/spinor_tags.hpp"
+
+
+namespace GQCP {
+
+
+// Forward declaration, since the traits below have to be known before `BasisTransformable` and `JacobiRotatable` are instantiated as base classes of a non-template class.
+class CholeskyRSQTwoElectronOperator;
+
+
+/*
+ *  MARK: Operator traits
+ */
+
+/**
+ *  A type that provides compile-time information (traits) on `CholeskyRSQTwoElectronOperator` that is otherwise not accessible through a public class alias.
+ */
+template <>
+struct OperatorTraits<CholeskyRSQTwoElectronOperator> {
+
+    // A type that corresponds to the scalar version of the associated two-electron operator type.
+    using ScalarOperator = CholeskyRSQTwoElectronOperator;
+
+    // The type of one-electron operator that is naturally related to a restricted two-electron operator.
+    using SQOneElectronOperator = ScalarRSQOneElectronOperator<double>;
+
+    // The type of transformation that is naturally associated to a `CholeskyRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+
+    // The type of density matrix that is naturally associated to a restricted two-electron operator.
+    using OneDM = Orbital1DM<double>;
+
+    // The type of density matrix that is naturally associated to a restricted two-electron operator.
+    using TwoDM = Orbital2DM<double>;
+};
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ */
+template <>
+struct BasisTransformableTraits<CholeskyRSQTwoElectronOperator> {
+
+    // The type of transformation that is naturally associated to a `CholeskyRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+};
+
+
+/*
+ *  MARK: JacobiRotatableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `JacobiRotatable`.
+ */
+template <>
+struct JacobiRotatableTraits<CholeskyRSQTwoElectronOperator> {
+
+    // The type of Jacobi rotation for which the Jacobi rotation should be defined.
+    using JacobiRotationType = JacobiRotation;
+};
+
+
+/*
+ *  MARK: CholeskyRSQTwoElectronOperator implementation
+ */
+
+/**
+ *  A restricted, real-valued (scalar) two-electron operator whose parameters are represented through Cholesky vectors L^J, i.e.
+ *      g(p q r s) = sum_J L^J(p q) L^J(r s).
+ *
+ *  Storing only the Cholesky vectors reduces the memory requirements from K^4 to K^2 times the number of Cholesky vectors, which is typically only a small multiple of K. Basis transformations, Jacobi rotations and the contractions with density matrices are performed vector per vector, without ever forming g(p q r s). If necessary, the full two-electron integrals can be reconstructed on demand through `parameters()`.
+ *
+ *  This operator can be used as a drop-in replacement for `ScalarRSQTwoElectronOperator<double>` inside an `SQHamiltonian`, see `CholeskyRSQHamiltonian`.
+ *
+ *  @note Since every Cholesky vector contributes positively, negating this operator (and hence subtracting it) is not supported.
+ */
+class CholeskyRSQTwoElectronOperator:
+    public BasisTransformable<CholeskyRSQTwoElectronOperator>,
+    public JacobiRotatable<CholeskyRSQTwoElectronOperator> {
+public:
+    // The scalar type used for a single parameter/matrix element.
+    using Scalar = double;
+
+    // The type of the vectorizer that relates a one-dimensional storage of tensors to the tensor structure of this two-electron operator: a Cholesky-decomposed operator is always scalar-like.
+    using Vectorizer = ScalarVectorizer;
+
+    // The spinor tag corresponding to a `CholeskyRSQTwoElectronOperator`.
+    using SpinorTag = RestrictedSpinOrbitalTag;
+
+    // The type of 'this'.
+    using Self = CholeskyRSQTwoElectronOperator;
+
+    // The type of transformation that is naturally associated to a `CholeskyRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+
+
+private:
+    // The Cholesky vectors, where every factor represents one vector L^J(p q).
+    DensityFittingFactors cholesky_vectors;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param cholesky_vectors             The Cholesky vectors (or any other symmetric three-index factorization, such as density fitting factors) of the two-electron integrals. Its factors should be square.
+     */
+    CholeskyRSQTwoElectronOperator(const DensityFittingFactors& cholesky_vectors);
+
+    /**
+     *  The default constructor, which creates an operator of dimension zero.
+     */
+    CholeskyRSQTwoElectronOperator();
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Decompose a dense two-electron operator through a pivoted Cholesky decomposition.
+     *
+     *  @param g_op                         The dense two-electron operator, expressed in chemist's notation.
+     *  @param threshold                    The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+     *
+     *  @return The Cholesky-decomposed two-electron operator.
+     */
+    static CholeskyRSQTwoElectronOperator FromDense(const ScalarRSQTwoElectronOperator<double>& g_op, const double threshold = 1.0e-08);
+
+    /**
+     *  Decompose the Coulomb repulsion integrals over a scalar basis, calculating only their diagonal and the pivot columns through Libint2.
+     *
+     *  @param scalar_basis                 The scalar basis over whose basis functions the two-electron integrals should be decomposed.
+     *  @param threshold                    The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+     *
+     *  @return The Cholesky-decomposed Coulomb repulsion operator, expressed in the scalar basis.
+     */
+    static CholeskyRSQTwoElectronOperator Libint(const ScalarBasis<GTOShell>& scalar_basis, const double threshold = 1.0e-08);
+
+    /**
+     *  @param dim                          The number of orbitals.
+     *
+     *  @return A two-electron operator without any Cholesky vectors, i.e. a zero operator.
+     */
+    static CholeskyRSQTwoElectronOperator Zero(const size_t dim);
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The Cholesky vectors of this two-electron operator.
+     */
+    const DensityFittingFactors& choleskyVectors() const { return this->cholesky_vectors; }
+
+    /**
+     *  @return The number of Cholesky vectors.
+     */
+    size_t numberOfCholeskyVectors() const { return this->cholesky_vectors.numberOfFactors(); }
+
+    /**
+     *  @return The number of orbitals this two-electron operator is expressed in.
+     */
+    size_t numberOfOrbitals() const { return this->cholesky_vectors.numberOfRows(); }
+
+    /**
+     *  @return The number of components of this operator, which is always one.
+     */
+    size_t numberOfComponents() const { return 1; }
+
+    /**
+     *  @param p            The first index.
+     *  @param q            The second index.
+     *  @param r            The third index.
+     *  @param s            The fourth index.
+     *
+     *  @return The reconstructed two-electron integral g(p q r s).
+     */
+    double operator()(const size_t p, const size_t q, const size_t r, const size_t s) const;
+
+    /**
+     *  @return The reconstructed two-electron integrals g(p q r s), in chemist's notation.
+     *
+     *  @note This requires O(K^4) memory and should therefore only be used when the full set of integrals is really necessary.
+     */
+    SquareRankFourTensor<double> parameters() const;
+
+    /**
+     *  @return The dense two-electron operator with the reconstructed two-electron integrals.
+     */
+    ScalarRSQTwoElectronOperator<double> dense() const { return ScalarRSQTwoElectronOperator<double> {this->parameters()}; }
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the expectation value of this two-electron operator, given a two-electron density matrix. (This includes the prefactor 1/2.)
+     *
+     *  @param d            The 2-DM (that represents the wave function).
+     *
+     *  @return The expectation value of this two-electron operator, with the given 2-DM.
+     */
+    StorageArray<double, ScalarVectorizer> calculateExpectationValue(const Orbital2DM<double>& d) const;
+
+    /**
+     *  Calculate the Fockian matrix of this two-electron operator.
+     *
+     *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+     *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+     *
+     *  @return The Fockian matrix.
+     */
+    StorageArray<SquareMatrix<double>, ScalarVectorizer> calculateFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const;
+
+    /**
+     *  Calculate the super-Fockian matrix of this two-electron operator.
+     *
+     *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+     *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+     *
+     *  @return The super-Fockian matrix.
+     *
+     *  @note Since the super-Fockian matrix is a rank-four tensor itself, it is calculated from the reconstructed two-electron integrals.
+     */
+    StorageArray<SquareRankFourTensor<double>, ScalarVectorizer> calculateSuperFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const;
+
+    /**
+     *  Calculate the direct (Coulomb) matrix J(p q) = sum_{r s} g(p q r s) D(r s).
+     *
+     *  @param D            The 1-DM.
+     *
+     *  @return The direct matrix.
+     */
+    SquareMatrix<double> calculateDirectMatrix(const Orbital1DM<double>& D) const;
+
+    /**
+     *  Calculate the exchange matrix K(p s) = sum_{q r} g(p q r s) D(r q).
+     *
+     *  @param D            The 1-DM.
+     *
+     *  @return The exchange matrix.
+     */
+    SquareMatrix<double> calculateExchangeMatrix(const Orbital1DM<double>& D) const;
+
+    /**
+     *  @return The one-electron operator that is the difference between this two-electron operator (E_PQRS) and a product of one-electron operators (E_PQ E_RS).
+     */
+    ScalarRSQOneElectronOperator<double> effectiveOneElectronPartition() const;
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the resulting two-electron operator. Every Cholesky vector transforms as a one-electron operator, so this costs O(K^3) per Cholesky vector.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed two-electron operator.
+     */
+    CholeskyRSQTwoElectronOperator transformed(const RTransformation<double>& T) const override;
+
+    // Allow the `rotate` method from `BasisTransformable`, since there's also a `rotate` from `JacobiRotatable`.
+    using BasisTransformable<CholeskyRSQTwoElectronOperator>::rotate;
+
+    // Allow the `rotated` method from `BasisTransformable`, since there's also a `rotated` from `JacobiRotatable`.
+    using BasisTransformable<CholeskyRSQTwoElectronOperator>::rotated;
+
+
+    /*
+     *  MARK: Conforming to `JacobiRotatable`
+     */
+
+    /**
+     *  Apply the Jacobi rotation and return the result. Since a Jacobi rotation only mixes two rows and two columns of every Cholesky vector, this costs O(K) per Cholesky vector.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @return The Jacobi-rotated two-electron operator.
+     */
+    CholeskyRSQTwoElectronOperator rotated(const JacobiRotation& jacobi_rotation) const override;
+
+    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
+    using JacobiRotatable<CholeskyRSQTwoElectronOperator>::rotate;
+
+
+    /*
+     *  MARK: Operations
+     */
+
+    /**
+     *  Addition-assignment, which appends the Cholesky vectors of the other operator.
+     */
+    CholeskyRSQTwoElectronOperator& operator+=(const CholeskyRSQTwoElectronOperator& rhs);
+
+    /**
+     *  Addition, canonically implemented using addition-assignment.
+     */
+    friend CholeskyRSQTwoElectronOperator operator+(CholeskyRSQTwoElectronOperator lhs, const CholeskyRSQTwoElectronOperator& rhs) {
+        lhs += rhs;
+        return lhs;
+    }
+};
+
+
+}  // namespace GQCP
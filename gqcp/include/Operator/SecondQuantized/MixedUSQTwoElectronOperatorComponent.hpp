@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Transformations/FourIndexTransformation.hpp"
 #include "Basis/Transformations/UTransformationComponent.hpp"
 #include "DensityMatrix/MixedSpinResolved2DMComponent.hpp"
 #include "DensityMatrix/SpinResolved1DMComponent.hpp"
@@ -112,13 +113,7 @@ public:
      */
     Self transformed(const UTransformationComponent<Scalar>& T, const Spin sigma) const {
 
-        // Since we're only getting T as a matrix, we should convert it to an appropriate tensor to perform contractions.
-        // Although not a necessity for the einsum implementation, it makes it a lot easier to follow the formulas.
-        const GQCP::Tensor<Scalar, 2> T_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(T.matrix().data(), T.matrix().rows(), T.matrix().cols());
-
-        // We calculate the conjugate as a tensor as well.
-        const GQCP::Tensor<Scalar, 2> T_conjugate = T_tensor.conjugate();
-
+        const MatrixX<Scalar>& T_matrix = T.matrix();
 
         // Depending on the given spin-component, we should either transform the first two, or the second two axes.
         const auto& parameters = this->allParameters();
@@ -127,16 +122,12 @@ public:
         for (size_t i = 0; i < this->numberOfComponents(); i++) {
             switch (sigma) {
             case Spin::alpha: {
-                const auto temp = T_tensor.template einsum<1>("UQ,TUVW->TQVW", parameters[i]);
-                const auto transformed = T_conjugate.template einsum<1>("TP,TQVW->PQVW", temp);
-                result[i] = transformed;
+                result[i] = firstPairTransformed(parameters[i], T_matrix, T_matrix);
                 break;
             }
 
             case Spin::beta: {
-                const auto temp = parameters[i].template einsum<1>("PQVW, WS->PQVS", T_tensor);
-                const auto transformed = temp.template einsum<1>("PQVS, VR->PQRS", T_conjugate);
-                result[i] = transformed;
+                result[i] = secondPairTransformed(parameters[i], T_matrix, T_matrix);
                 break;
             }
             }
@@ -173,8 +164,9 @@ public:
      */
     Self rotated(const JacobiRotation& jacobi_rotation, const Spin sigma) const {
 
-        const auto J = UTransformationComponent<Scalar>::FromJacobi(jacobi_rotation, this->numberOfOrbitals());
-        return this->transformed(J, sigma);
+        auto result = *this;
+        result.rotate(jacobi_rotation, sigma);
+        return result;
     }
 
 
@@ -188,8 +180,16 @@ public:
      */
     void rotate(const JacobiRotation& jacobi_rotation, const Spin sigma) {
 
-        auto result = this->rotated(jacobi_rotation, sigma);
-        *this = result;
+        const auto p = jacobi_rotation.p();
+        const auto q = jacobi_rotation.q();
+        const auto jacobi_rotation_eigen = jacobi_rotation.Eigen();
+
+        // Only the slices related to p and q of the first two (alpha) or the second two (beta) axes have to be updated.
+        const size_t first_axis = (sigma == Spin::alpha) ? 0 : 2;
+        for (auto& g : this->allParameters()) {
+            g.applyJacobiRotation(p, q, jacobi_rotation_eigen, first_axis);
+            g.applyJacobiRotation(p, q, jacobi_rotation_eigen, first_axis + 1);
+        }
     }
 };
 
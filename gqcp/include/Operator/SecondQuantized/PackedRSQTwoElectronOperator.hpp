@@ -0,0 +1,275 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "DensityMatrix/Orbital1DM.hpp"
+#include "DensityMatrix/Orbital2DM.hpp"
+#include "Mathematical/Representation/DenseVectorizer.hpp"
+#include "Mathematical/Representation/PackedSquareRankFourTensor.hpp"
+#include "Mathematical/Representation/StorageArray.hpp"
+#include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
+#include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
+#include "Operator/SecondQuantized/SQOperatorStorage.hpp"
+#include "QuantumChemical/spinor_tags.hpp"
+
+
+namespace GQCP {
+
+
+// Forward declaration, since the traits below have to be known before `SQOperatorStorage`, `BasisTransformable` and `JacobiRotatable` are instantiated as base classes of a non-template class.
+class PackedRSQTwoElectronOperator;
+
+
+/*
+ *  MARK: Operator traits
+ */
+
+/**
+ *  A type that provides compile-time information (traits) on `PackedRSQTwoElectronOperator` that is otherwise not accessible through a public class alias.
+ */
+template <>
+struct OperatorTraits<PackedRSQTwoElectronOperator> {
+
+    // The scalar type used for a single parameter/matrix element.
+    using Scalar = double;
+
+    // The type of the vectorizer that relates a one-dimensional storage of tensors to the tensor structure of this two-electron operator.
+    using Vectorizer = ScalarVectorizer;
+
+    // The type of the final derived operator, enabling CRTP and compile-time polymorphism.
+    using DerivedOperator = PackedRSQTwoElectronOperator;
+
+    // A type that corresponds to the scalar version of the associated two-electron operator type.
+    using ScalarOperator = PackedRSQTwoElectronOperator;
+
+    // The type of one-electron operator that is naturally related to a restricted two-electron operator.
+    using SQOneElectronOperator = ScalarRSQOneElectronOperator<double>;
+
+    // The type of transformation that is naturally associated to a `PackedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+
+    // The type of density matrix that is naturally associated to a restricted two-electron operator.
+    using OneDM = Orbital1DM<double>;
+
+    // The type of density matrix that is naturally associated to a restricted two-electron operator.
+    using TwoDM = Orbital2DM<double>;
+};
+
+
+/*
+ *  MARK: BasisTransformableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `BasisTransformable`.
+ */
+template <>
+struct BasisTransformableTraits<PackedRSQTwoElectronOperator> {
+
+    // The type of transformation that is naturally associated to a `PackedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+};
+
+
+/*
+ *  MARK: JacobiRotatableTraits
+ */
+
+/**
+ *  A type that provides compile-time information related to the abstract interface `JacobiRotatable`.
+ */
+template <>
+struct JacobiRotatableTraits<PackedRSQTwoElectronOperator> {
+
+    // The type of Jacobi rotation for which the Jacobi rotation should be defined.
+    using JacobiRotationType = JacobiRotation;
+};
+
+
+/*
+ *  MARK: PackedRSQTwoElectronOperator implementation
+ */
+
+/**
+ *  A restricted, real-valued (scalar) two-electron operator whose parameters, expressed in chemist's notation, are stored using their eight-fold permutational symmetry, see `PackedSquareRankFourTensor`. This reduces the memory requirements of the two-electron integrals by a factor of approximately eight.
+ *
+ *  The parameters can be accessed through `parameters()(p, q, r, s)`, just like for `ScalarRSQTwoElectronOperator<double>`. Together with the contractions with density matrices below, this allows this operator to be used as a drop-in replacement for `ScalarRSQTwoElectronOperator<double>` inside an `SQHamiltonian`, see `PackedRSQHamiltonian`.
+ */
+class PackedRSQTwoElectronOperator:
+    public SQOperatorStorage<PackedSquareRankFourTensor<double>, ScalarVectorizer, PackedRSQTwoElectronOperator>,
+    public BasisTransformable<PackedRSQTwoElectronOperator>,
+    public JacobiRotatable<PackedRSQTwoElectronOperator> {
+public:
+    // The scalar type used for a single parameter/matrix element.
+    using Scalar = double;
+
+    // The type of the vectorizer that relates a one-dimensional storage of tensors to the tensor structure of this two-electron operator: a packed operator is always scalar-like.
+    using Vectorizer = ScalarVectorizer;
+
+    // The spinor tag corresponding to a `PackedRSQTwoElectronOperator`.
+    using SpinorTag = RestrictedSpinOrbitalTag;
+
+    // The type of 'this'.
+    using Self = PackedRSQTwoElectronOperator;
+
+    // The type of transformation that is naturally associated to a `PackedRSQTwoElectronOperator`.
+    using Transformation = RTransformation<double>;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    // Inherit `SQOperatorStorage`'s constructors.
+    using SQOperatorStorage<PackedSquareRankFourTensor<double>, ScalarVectorizer, PackedRSQTwoElectronOperator>::SQOperatorStorage;
+
+
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  Pack a dense two-electron operator.
+     *
+     *  @param g_op                         The dense two-electron operator, expressed in chemist's notation.
+     *
+     *  @return The packed two-electron operator.
+     */
+    static PackedRSQTwoElectronOperator FromDense(const ScalarRSQTwoElectronOperator<double>& g_op);
+
+    /**
+     *  @param g                            The packed two-electron integrals, expressed in chemist's notation.
+     *
+     *  @return The two-electron operator with the given packed two-electron integrals.
+     */
+    static PackedRSQTwoElectronOperator FromPacked(const PackedSquareRankFourTensor<double>& g) { return PackedRSQTwoElectronOperator {g}; }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The dense two-electron operator with the unpacked two-electron integrals.
+     */
+    ScalarRSQTwoElectronOperator<double> dense() const { return ScalarRSQTwoElectronOperator<double> {this->parameters().unpacked()}; }
+
+
+    /*
+     *  MARK: Calculations
+     */
+
+    /**
+     *  Calculate the expectation value of this two-electron operator, given a two-electron density matrix. (This includes the prefactor 1/2.)
+     *
+     *  @param d            The 2-DM (that represents the wave function).
+     *
+     *  @return The expectation value of this two-electron operator, with the given 2-DM.
+     */
+    StorageArray<double, ScalarVectorizer> calculateExpectationValue(const Orbital2DM<double>& d) const;
+
+    /**
+     *  Calculate the Fockian matrix of this two-electron operator.
+     *
+     *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+     *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+     *
+     *  @return The Fockian matrix.
+     */
+    StorageArray<SquareMatrix<double>, ScalarVectorizer> calculateFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const;
+
+    /**
+     *  Calculate the super-Fockian matrix of this two-electron operator.
+     *
+     *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+     *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+     *
+     *  @return The super-Fockian matrix.
+     *
+     *  @note Since the super-Fockian matrix is a rank-four tensor itself, it is calculated from the unpacked two-electron integrals.
+     */
+    StorageArray<SquareRankFourTensor<double>, ScalarVectorizer> calculateSuperFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const;
+
+    /**
+     *  Calculate the direct (Coulomb) matrix J(p q) = sum_{r s} g(p q r s) D(r s).
+     *
+     *  @param D            The 1-DM.
+     *
+     *  @return The direct matrix.
+     */
+    SquareMatrix<double> calculateDirectMatrix(const Orbital1DM<double>& D) const;
+
+    /**
+     *  Calculate the exchange matrix K(p s) = sum_{q r} g(p q r s) D(r q).
+     *
+     *  @param D            The 1-DM.
+     *
+     *  @return The exchange matrix.
+     */
+    SquareMatrix<double> calculateExchangeMatrix(const Orbital1DM<double>& D) const;
+
+    /**
+     *  @return The one-electron operator that is the difference between this two-electron operator (E_PQRS) and a product of one-electron operators (E_PQ E_RS).
+     */
+    ScalarRSQOneElectronOperator<double> effectiveOneElectronPartition() const;
+
+
+    /*
+     *  MARK: Conforming to `BasisTransformable`
+     */
+
+    /**
+     *  Apply the basis transformation and return the resulting two-electron operator. The transformation is performed on the pair matrix g(pq, rs), so the full K^4 tensor is never formed.
+     *
+     *  @param T            The basis transformation.
+     *
+     *  @return The basis-transformed two-electron operator.
+     */
+    PackedRSQTwoElectronOperator transformed(const RTransformation<double>& T) const override;
+
+    // Allow the `rotate` method from `BasisTransformable`, since there's also a `rotate` from `JacobiRotatable`.
+    using BasisTransformable<PackedRSQTwoElectronOperator>::rotate;
+
+    // Allow the `rotated` method from `BasisTransformable`, since there's also a `rotated` from `JacobiRotatable`.
+    using BasisTransformable<PackedRSQTwoElectronOperator>::rotated;
+
+
+    /*
+     *  MARK: Conforming to `JacobiRotatable`
+     */
+
+    /**
+     *  Apply the Jacobi rotation and return the result. Since a Jacobi rotation only mixes two rows and two columns of every column of the pair matrix, this costs O(K^4), which is dominated by the unpacking of the pair matrix.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     *
+     *  @return The Jacobi-rotated two-electron operator.
+     */
+    PackedRSQTwoElectronOperator rotated(const JacobiRotation& jacobi_rotation) const override;
+
+    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
+    using JacobiRotatable<PackedRSQTwoElectronOperator>::rotate;
+};
+
+
+}  // namespace GQCP
@@ -22,6 +22,7 @@
 #include "DensityMatrix/Orbital1DM.hpp"
 #include "DensityMatrix/Orbital2DM.hpp"
 #include "Mathematical/Representation/DenseVectorizer.hpp"
+#include "Mathematical/Representation/PackedSquareRankFourTensor.hpp"
 #include "Operator/SecondQuantized/MixedUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/PureUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
@@ -61,6 +62,23 @@ public:
     using SimpleSQTwoElectronOperator<_Scalar, _Vectorizer, RSQTwoElectronOperator<_Scalar, _Vectorizer>>::SimpleSQTwoElectronOperator;
 
 
+    /*
+     *  MARK: Named constructors
+     */
+
+    /**
+     *  @param g            The packed two-electron integrals, expressed in chemist's notation.
+     *
+     *  @return The two-electron operator with the unpacked two-electron integrals.
+     *
+     *  @note This method is only enabled for real, scalar two-electron operators.
+     */
+    template <typename Z1 = Scalar, typename Z2 = Vectorizer>
+    static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, ScalarVectorizer>::value, RSQTwoElectronOperator<Scalar, Vectorizer>> FromPacked(const PackedSquareRankFourTensor<double>& g) {
+        return RSQTwoElectronOperator<Scalar, Vectorizer> {g.unpacked()};
+    }
+
+
     /*
      *  MARK: Conversions to spin components
      */
@@ -21,9 +21,11 @@
 #include "Basis/SpinorBasis/OrbitalSpace.hpp"
 #include "Basis/Transformations/BasisTransformable.hpp"
 #include "Basis/Transformations/JacobiRotatable.hpp"
+#include "Operator/SecondQuantized/CholeskyRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/ModelHamiltonian/HubbardHamiltonian.hpp"
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/USQOneElectronOperator.hpp"
@@ -111,6 +113,8 @@ public:
      * 
      *  @param h_contributions      The contributions to the total one-electron interaction operator.
      *  @param g_contributions      The contributions to the total two-electron interaction operator.
+     *
+     *  @note If no two-electron contributions are given, the total two-electron operator is left empty (i.e. of dimension zero).
      */
     SQHamiltonian(const std::vector<ScalarSQOneElectronOperator>& h_contributions, const std::vector<ScalarSQTwoElectronOperator>& g_contributions) :
         h_contributions {h_contributions},
@@ -133,9 +137,9 @@ public:
         }
 
 
-        // Calculate the total one- and two-electron operators.
+        // Calculate the total one- and two-electron operators. If there are no two-electron contributions, no two-electron integrals are stored at all, which is what direct methods (that recalculate them on the fly) need.
         this->h = std::accumulate(h_contributions.begin(), h_contributions.end(), ScalarSQOneElectronOperator::Zero(dim));
-        this->g = std::accumulate(g_contributions.begin(), g_contributions.end(), ScalarSQTwoElectronOperator::Zero(dim));
+        this->g = g_contributions.empty() ? ScalarSQTwoElectronOperator::Zero(0) : std::accumulate(g_contributions.begin(), g_contributions.end(), ScalarSQTwoElectronOperator::Zero(dim));
     }
 
 
@@ -217,6 +221,7 @@ public:
      *  @return The Hamiltonian corresponding to the contents of an FCIDUMP file.
      *
      *  @note This named constructor is only available in the real case.
+     *  @note The two-electron integrals are read into a `PackedSquareRankFourTensor`, so that a `PackedRSQHamiltonian` can be read in without ever storing all K^4 integrals.
      */
     template <typename Z1 = Scalar, typename Z2 = SpinorTag>
     static enable_if_t<std::is_same<Z1, double>::value && std::is_same<Z2, RestrictedSpinOrbitalTag>::value, SQHamiltonian<ScalarSQOneElectronOperator, ScalarSQTwoElectronOperator>> FromFCIDUMP(const std::string& fcidump_filename) {
@@ -247,8 +252,7 @@ public:
 
 
         SquareMatrix<double> h_core = SquareMatrix<double>::Zero(K);
-        SquareRankFourTensor<double> g {K};
-        g.setZero();
+        PackedSquareRankFourTensor<double> g {K};  // Zero-initialized. Only the unique integrals are stored while reading.
 
         //  Skip 3 lines
         for (size_t counter = 0; counter < 3; counter++) {
@@ -289,22 +293,12 @@ public:
                 size_t q = a - 1;
                 size_t r = j - 1;
                 size_t s = b - 1;
-                g(p, q, r, s) = x;
-
-                // Apply the permutational symmetries for real orbitals
-                g(p, q, s, r) = x;
-                g(q, p, r, s) = x;
-                g(q, p, s, r) = x;
-
-                g(r, s, p, q) = x;
-                g(s, r, p, q) = x;
-                g(r, s, q, p) = x;
-                g(s, r, q, p) = x;
+                g(p, q, r, s) = x;  // The packed storage shares this element with all its permutationally equivalent elements for real orbitals.
             }
         }  // while loop
 
 
-        return SQHamiltonian(ScalarSQOneElectronOperator(h_core), ScalarSQTwoElectronOperator(g));
+        return SQHamiltonian(ScalarSQOneElectronOperator(h_core), ScalarSQTwoElectronOperator::FromPacked(g));
     }
 
 
@@ -567,26 +561,32 @@ public:
     Self rotated(const JacobiRotationType& jacobi_rotation) const override {
 
         auto result = *this;
+        result.rotate(jacobi_rotation);
+        return result;
+    }
+
+
+    /**
+     *  In-place apply the Jacobi rotation. The contributions and the total operators are rotated in place, so that no copy of the (two-electron) integrals is made.
+     * 
+     *  @param jacobi_rotation          The Jacobi rotation.
+     */
+    void rotate(const JacobiRotationType& jacobi_rotation) {
 
         // Transform the one and two-electron contributions.
-        for (auto& h : result.coreContributions()) {
+        for (auto& h : this->coreContributions()) {
             h.rotate(jacobi_rotation);
         }
 
-        for (auto& g : result.twoElectronContributions()) {
+        for (auto& g : this->twoElectronContributions()) {
             g.rotate(jacobi_rotation);
         }
 
         // Transform the total one- and two-electron interactions.
-        result.core().rotate(jacobi_rotation);
-        result.twoElectron().rotate(jacobi_rotation);
-
-        return result;
+        this->core().rotate(jacobi_rotation);
+        this->twoElectron().rotate(jacobi_rotation);
     }
 
-    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
-    using JacobiRotatable<Self>::rotate;
-
 
     /*
      *  MARK: Operations related to one-electron operators
@@ -766,4 +766,11 @@ template <typename Scalar>
 using GSQHamiltonian = SQHamiltonian<ScalarGSQOneElectronOperator<Scalar>, ScalarGSQTwoElectronOperator<Scalar>>;
 
 
+// A real-valued `SQHamiltonian` related to restricted spin-orbitals, whose two-electron integrals are represented by Cholesky vectors. See `CholeskyRSQTwoElectronOperator`.
+using CholeskyRSQHamiltonian = SQHamiltonian<ScalarRSQOneElectronOperator<double>, CholeskyRSQTwoElectronOperator>;
+
+// A real-valued `SQHamiltonian` related to restricted spin-orbitals, whose two-electron integrals are stored using their eight-fold permutational symmetry. See `PackedRSQTwoElectronOperator`.
+using PackedRSQHamiltonian = SQHamiltonian<ScalarRSQOneElectronOperator<double>, PackedRSQTwoElectronOperator>;
+
+
 }  // namespace GQCP
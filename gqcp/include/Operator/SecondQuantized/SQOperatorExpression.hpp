@@ -0,0 +1,472 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Mathematical/Representation/StorageArray.hpp"
+#include "Utilities/CRTP.hpp"
+
+#include <functional>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: SQOperatorExpressionTraits
+ */
+
+/**
+ *  A type that provides compile-time information on expressions of second-quantized operators.
+ *
+ *  @tparam Expression          The type of the expression.
+ */
+template <typename Expression>
+struct SQOperatorExpressionTraits {};
+
+
+/*
+ *  MARK: SQOperatorExpression
+ */
+
+/**
+ *  A lazily evaluated linear combination of second-quantized operators, i.e. an expression template for the vector space arithmetic of operators that derive from `SQOperatorStorage`.
+ *
+ *  An expression only refers to its operands. Evaluating it, by converting it to an operator or by adding it to an existing operator, calculates all the parameters in a single pass over the storage of the operands, without any intermediate matrices or tensors. Expressions are started from an operator through `SQOperatorStorage::lazy()`, e.g.
+ *
+ *      const ScalarRSQTwoElectronOperator<double> g = a * g1.lazy() + b * g2 - g3;
+ *
+ *  Like Eigen's expressions, an expression should be evaluated while its operands are still alive, so it should not be stored using `auto`.
+ *
+ *  @tparam _Derived            The type of the expression that derives from this class, enabling CRTP and compile-time polymorphism.
+ */
+template <typename _Derived>
+class SQOperatorExpression:
+    public CRTP<_Derived> {
+public:
+    // The type of the expression that derives from this class, enabling CRTP and compile-time polymorphism.
+    using Derived = _Derived;
+
+    // The type of the operator that this expression evaluates to.
+    using FinalOperator = typename SQOperatorExpressionTraits<Derived>::FinalOperator;
+
+    // The scalar type used for a single parameter/matrix element/integral: real or complex.
+    using Scalar = typename FinalOperator::Scalar;
+
+    // The type used to represent the set of parameters/matrix elements/integrals for one component of the operator.
+    using MatrixRepresentation = typename FinalOperator::MatrixRepresentation;
+
+    // The type of the vectorizer that relates a one-dimensional storage of matrix representations to the tensor structure of the operator.
+    using Vectorizer = typename FinalOperator::Vectorizer;
+
+
+public:
+    /*
+     *  MARK: Evaluation
+     */
+
+    /**
+     *  @return The operator that this expression represents.
+     */
+    FinalOperator eval() const {
+
+        const auto& expression = this->derived();
+
+        // Start from parameters that don't hold any elements, so that every component is allocated once and written once.
+        FinalOperator result {StorageArray<MatrixRepresentation, Vectorizer> {expression.vectorizer()}};
+        for (size_t i = 0; i < expression.numberOfComponents(); i++) {
+            auto& parameters = result.allParameters()[i];
+            parameters = MatrixRepresentation(expression.numberOfOrbitals());
+
+            Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> storage {parameters.Eigen().data(), static_cast<Eigen::Index>(parameters.Eigen().size())};
+            storage = expression.flattenedComponent(i);
+        }
+
+        return result;
+    }
+
+
+    /**
+     *  @return The operator that this expression represents.
+     */
+    operator FinalOperator() const { return this->eval(); }
+};
+
+
+/*
+ *  MARK: SQOperatorReference
+ */
+
+/**
+ *  An expression that refers to a second-quantized operator.
+ *
+ *  @tparam _Operator           The type of the second-quantized operator.
+ */
+template <typename _Operator>
+class SQOperatorReference:
+    public SQOperatorExpression<SQOperatorReference<_Operator>> {
+public:
+    // The type of the second-quantized operator.
+    using Operator = _Operator;
+
+    // The scalar type used for a single parameter/matrix element/integral: real or complex.
+    using Scalar = typename Operator::Scalar;
+
+    // The type of the vectorizer that relates a one-dimensional storage of matrix representations to the tensor structure of the operator.
+    using Vectorizer = typename Operator::Vectorizer;
+
+
+private:
+    // The operator that is referred to.
+    const Operator& op;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param op           The operator that is referred to.
+     */
+    SQOperatorReference(const Operator& op) :
+        op {op} {}
+
+
+    /*
+     *  MARK: Expression interface
+     */
+
+    /**
+     *  @param i            The index of a component.
+     *
+     *  @return A view on the parameters of the given component, as one contiguous vector.
+     */
+    Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> flattenedComponent(const size_t i) const {
+
+        const auto& parameters = this->op.allParameters()[i].Eigen();
+        return Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>(parameters.data(), static_cast<Eigen::Index>(parameters.size()));
+    }
+
+    /**
+     *  @return The number of components of the operator.
+     */
+    size_t numberOfComponents() const { return this->op.numberOfComponents(); }
+
+    /**
+     *  @return The number of orbitals the operator is expressed in.
+     */
+    size_t numberOfOrbitals() const { return this->op.numberOfOrbitals(); }
+
+    /**
+     *  @return The vectorizer of the operator.
+     */
+    const Vectorizer& vectorizer() const { return this->op.vectorizer(); }
+};
+
+
+/**
+ *  A type that provides compile-time information on `SQOperatorReference`.
+ */
+template <typename Operator>
+struct SQOperatorExpressionTraits<SQOperatorReference<Operator>> {
+
+    // The type of the operator that the expression evaluates to.
+    using FinalOperator = Operator;
+};
+
+
+/*
+ *  MARK: ScaledSQOperatorExpression
+ */
+
+/**
+ *  An expression that represents the scalar multiplication of another expression.
+ *
+ *  @tparam _Expression         The type of the expression that is multiplied.
+ */
+template <typename _Expression>
+class ScaledSQOperatorExpression:
+    public SQOperatorExpression<ScaledSQOperatorExpression<_Expression>> {
+public:
+    // The type of the expression that is multiplied.
+    using Expression = _Expression;
+
+    // The scalar type used for a single parameter/matrix element/integral: real or complex.
+    using Scalar = typename SQOperatorExpression<Expression>::Scalar;
+
+    // The type of the vectorizer that relates a one-dimensional storage of matrix representations to the tensor structure of the operator.
+    using Vectorizer = typename SQOperatorExpression<Expression>::Vectorizer;
+
+
+private:
+    // The scalar with which the expression is multiplied.
+    Scalar a;
+
+    // The expression that is multiplied.
+    Expression expression;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param a                The scalar with which the expression is multiplied.
+     *  @param expression       The expression that is multiplied.
+     */
+    ScaledSQOperatorExpression(const Scalar& a, const Expression& expression) :
+        a {a},
+        expression {expression} {}
+
+
+    /*
+     *  MARK: Expression interface
+     */
+
+    /**
+     *  @param i            The index of a component.
+     *
+     *  @return An Eigen expression for the parameters of the given component, as one contiguous vector.
+     */
+    auto flattenedComponent(const size_t i) const { return this->a * this->expression.flattenedComponent(i); }
+
+    /**
+     *  @return The number of components of the operator that this expression represents.
+     */
+    size_t numberOfComponents() const { return this->expression.numberOfComponents(); }
+
+    /**
+     *  @return The number of orbitals the operator that this expression represents is expressed in.
+     */
+    size_t numberOfOrbitals() const { return this->expression.numberOfOrbitals(); }
+
+    /**
+     *  @return The vectorizer of the operator that this expression represents.
+     */
+    const Vectorizer& vectorizer() const { return this->expression.vectorizer(); }
+};
+
+
+/**
+ *  A type that provides compile-time information on `ScaledSQOperatorExpression`.
+ */
+template <typename Expression>
+struct SQOperatorExpressionTraits<ScaledSQOperatorExpression<Expression>> {
+
+    // The type of the operator that the expression evaluates to.
+    using FinalOperator = typename SQOperatorExpressionTraits<Expression>::FinalOperator;
+};
+
+
+/*
+ *  MARK: SQOperatorBinaryExpression
+ */
+
+/**
+ *  An expression that represents the addition or subtraction of two other expressions.
+ *
+ *  @tparam _LHSExpression      The type of the expression on the left-hand side.
+ *  @tparam _RHSExpression      The type of the expression on the right-hand side.
+ *  @tparam _BinaryOperation    The element-wise operation, i.e. std::plus<> or std::minus<>.
+ */
+template <typename _LHSExpression, typename _RHSExpression, typename _BinaryOperation>
+class SQOperatorBinaryExpression:
+    public SQOperatorExpression<SQOperatorBinaryExpression<_LHSExpression, _RHSExpression, _BinaryOperation>> {
+public:
+    // The type of the expression on the left-hand side.
+    using LHSExpression = _LHSExpression;
+
+    // The type of the expression on the right-hand side.
+    using RHSExpression = _RHSExpression;
+
+    // The element-wise operation, i.e. std::plus<> or std::minus<>.
+    using BinaryOperation = _BinaryOperation;
+
+    // The type of the vectorizer that relates a one-dimensional storage of matrix representations to the tensor structure of the operator.
+    using Vectorizer = typename SQOperatorExpression<LHSExpression>::Vectorizer;
+
+    static_assert(std::is_same<typename SQOperatorExpression<LHSExpression>::FinalOperator, typename SQOperatorExpression<RHSExpression>::FinalOperator>::value, "Only operators of the same type can be combined.");
+
+
+private:
+    // The expression on the left-hand side.
+    LHSExpression lhs;
+
+    // The expression on the right-hand side.
+    RHSExpression rhs;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param lhs              The expression on the left-hand side.
+     *  @param rhs              The expression on the right-hand side.
+     */
+    SQOperatorBinaryExpression(const LHSExpression& lhs, const RHSExpression& rhs) :
+        lhs {lhs},
+        rhs {rhs} {
+
+        if ((lhs.numberOfComponents() != rhs.numberOfComponents()) || (lhs.numberOfOrbitals() != rhs.numberOfOrbitals())) {
+            throw std::invalid_argument("SQOperatorBinaryExpression(const LHSExpression&, const RHSExpression&): The operators should have the same number of components and be expressed in the same number of orbitals.");
+        }
+    }
+
+
+    /*
+     *  MARK: Expression interface
+     */
+
+    /**
+     *  @param i            The index of a component.
+     *
+     *  @return An Eigen expression for the parameters of the given component, as one contiguous vector.
+     */
+    auto flattenedComponent(const size_t i) const { return BinaryOperation {}(this->lhs.flattenedComponent(i), this->rhs.flattenedComponent(i)); }
+
+    /**
+     *  @return The number of components of the operator that this expression represents.
+     */
+    size_t numberOfComponents() const { return this->lhs.numberOfComponents(); }
+
+    /**
+     *  @return The number of orbitals the operator that this expression represents is expressed in.
+     */
+    size_t numberOfOrbitals() const { return this->lhs.numberOfOrbitals(); }
+
+    /**
+     *  @return The vectorizer of the operator that this expression represents.
+     */
+    const Vectorizer& vectorizer() const { return this->lhs.vectorizer(); }
+};
+
+
+/**
+ *  A type that provides compile-time information on `SQOperatorBinaryExpression`.
+ */
+template <typename LHSExpression, typename RHSExpression, typename BinaryOperation>
+struct SQOperatorExpressionTraits<SQOperatorBinaryExpression<LHSExpression, RHSExpression, BinaryOperation>> {
+
+    // The type of the operator that the expression evaluates to.
+    using FinalOperator = typename SQOperatorExpressionTraits<LHSExpression>::FinalOperator;
+};
+
+
+/*
+ *  MARK: Operators
+ */
+
+/**
+ *  Addition of two expressions.
+ */
+template <typename LHSExpression, typename RHSExpression>
+SQOperatorBinaryExpression<LHSExpression, RHSExpression, std::plus<>> operator+(const SQOperatorExpression<LHSExpression>& lhs, const SQOperatorExpression<RHSExpression>& rhs) {
+    return {lhs.derived(), rhs.derived()};
+}
+
+
+/**
+ *  Subtraction of two expressions.
+ */
+template <typename LHSExpression, typename RHSExpression>
+SQOperatorBinaryExpression<LHSExpression, RHSExpression, std::minus<>> operator-(const SQOperatorExpression<LHSExpression>& lhs, const SQOperatorExpression<RHSExpression>& rhs) {
+    return {lhs.derived(), rhs.derived()};
+}
+
+
+/**
+ *  Addition of an expression and an operator.
+ */
+template <typename Expression>
+SQOperatorBinaryExpression<Expression, SQOperatorReference<typename SQOperatorExpression<Expression>::FinalOperator>, std::plus<>> operator+(const SQOperatorExpression<Expression>& lhs, const typename SQOperatorExpression<Expression>::FinalOperator& rhs) {
+    return {lhs.derived(), rhs};
+}
+
+
+/**
+ *  Addition of an operator and an expression.
+ */
+template <typename Expression>
+SQOperatorBinaryExpression<SQOperatorReference<typename SQOperatorExpression<Expression>::FinalOperator>, Expression, std::plus<>> operator+(const typename SQOperatorExpression<Expression>::FinalOperator& lhs, const SQOperatorExpression<Expression>& rhs) {
+    return {lhs, rhs.derived()};
+}
+
+
+/**
+ *  Subtraction of an operator from an expression.
+ */
+template <typename Expression>
+SQOperatorBinaryExpression<Expression, SQOperatorReference<typename SQOperatorExpression<Expression>::FinalOperator>, std::minus<>> operator-(const SQOperatorExpression<Expression>& lhs, const typename SQOperatorExpression<Expression>::FinalOperator& rhs) {
+    return {lhs.derived(), rhs};
+}
+
+
+/**
+ *  Subtraction of an expression from an operator.
+ */
+template <typename Expression>
+SQOperatorBinaryExpression<SQOperatorReference<typename SQOperatorExpression<Expression>::FinalOperator>, Expression, std::minus<>> operator-(const typename SQOperatorExpression<Expression>::FinalOperator& lhs, const SQOperatorExpression<Expression>& rhs) {
+    return {lhs, rhs.derived()};
+}
+
+
+/**
+ *  Scalar multiplication of an expression.
+ */
+template <typename Expression>
+ScaledSQOperatorExpression<Expression> operator*(const typename SQOperatorExpression<Expression>::Scalar& a, const SQOperatorExpression<Expression>& expression) {
+    return {a, expression.derived()};
+}
+
+
+/**
+ *  The commutative version of the previous scalar multiplication.
+ */
+template <typename Expression>
+ScaledSQOperatorExpression<Expression> operator*(const SQOperatorExpression<Expression>& expression, const typename SQOperatorExpression<Expression>::Scalar& a) {
+    return {a, expression.derived()};
+}
+
+
+/**
+ *  Scalar division of an expression.
+ */
+template <typename Expression>
+ScaledSQOperatorExpression<Expression> operator/(const SQOperatorExpression<Expression>& expression, const typename SQOperatorExpression<Expression>::Scalar& a) {
+    using Scalar = typename SQOperatorExpression<Expression>::Scalar;
+    return {Scalar {1} / a, expression.derived()};
+}
+
+
+/**
+ *  Negation of an expression.
+ */
+template <typename Expression>
+ScaledSQOperatorExpression<Expression> operator-(const SQOperatorExpression<Expression>& expression) {
+    using Scalar = typename SQOperatorExpression<Expression>::Scalar;
+    return {Scalar {-1}, expression.derived()};
+}
+
+
+}  // namespace GQCP
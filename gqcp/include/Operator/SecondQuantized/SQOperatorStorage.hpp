@@ -19,9 +19,10 @@
 
 
 #include "Mathematical/Functions/VectorSpaceArithmetic.hpp"
+#include "Operator/SecondQuantized/SQOperatorExpression.hpp"
 #include "Operator/SecondQuantized/SQOperatorStorageBase.hpp"
 
-#include <algorithm>
+#include <stdexcept>
 
 
 namespace GQCP {
@@ -79,26 +80,71 @@ public:
      *  Addition-assignment.
      */
     FinalOperator& operator+=(const FinalOperator& rhs) override {
+        return *this += rhs.lazy();
+    }
 
-        // Use the STL to implement element-wise addition.
-        std::transform(this->array.elements().begin(), this->array.elements().end(),
-                       rhs.array.elements().begin(), this->array.elements().begin(),
-                       [](const MatrixRepresentation& M_lhs, const MatrixRepresentation& M_rhs) {
-                           return M_lhs.Eigen() + M_rhs.Eigen();
-                       });
+
+    /**
+     *  Scalar multiplication-assignment.
+     */
+    FinalOperator& operator*=(const Scalar& a) override {
+
+        // Scale the parameters in-place.
+        for (size_t i = 0; i < this->numberOfComponents(); i++) {
+            this->flattenedComponent(i) *= a;
+        }
 
         return static_cast<FinalOperator&>(*this);
     }
 
 
     /**
-     *  Scalar multiplication-assignment.
+     *  Subtraction-assignment, which is implemented in-place instead of through the addition of the negated operator.
      */
-    FinalOperator& operator*=(const Scalar& a) override {
+    FinalOperator& operator-=(const FinalOperator& rhs) {
+        return *this -= rhs.lazy();
+    }
+
 
-        // Use the STL to implement element-wise scalar multiplication.
-        std::transform(this->array.elements().begin(), this->array.elements().end(),
-                       this->array.elements().begin(), [a](const MatrixRepresentation& M) { return M * a; });
+    /*
+     *  MARK: Lazy arithmetic
+     */
+
+    /**
+     *  @return An expression that refers to this operator, from which lazily evaluated linear combinations of operators can be built. See `SQOperatorExpression`.
+     */
+    SQOperatorReference<FinalOperator> lazy() const { return SQOperatorReference<FinalOperator>(static_cast<const FinalOperator&>(*this)); }
+
+
+    /**
+     *  Addition-assignment of an expression, which is evaluated in a single pass over the parameters of this operator.
+     *
+     *  @param expression           The expression that should be added to this operator.
+     */
+    template <typename Expression>
+    FinalOperator& operator+=(const SQOperatorExpression<Expression>& expression) {
+
+        this->checkCompatibility(expression.derived());
+        for (size_t i = 0; i < this->numberOfComponents(); i++) {
+            this->flattenedComponent(i) += expression.derived().flattenedComponent(i);
+        }
+
+        return static_cast<FinalOperator&>(*this);
+    }
+
+
+    /**
+     *  Subtraction-assignment of an expression, which is evaluated in a single pass over the parameters of this operator.
+     *
+     *  @param expression           The expression that should be subtracted from this operator.
+     */
+    template <typename Expression>
+    FinalOperator& operator-=(const SQOperatorExpression<Expression>& expression) {
+
+        this->checkCompatibility(expression.derived());
+        for (size_t i = 0; i < this->numberOfComponents(); i++) {
+            this->flattenedComponent(i) -= expression.derived().flattenedComponent(i);
+        }
 
         return static_cast<FinalOperator&>(*this);
     }
@@ -132,6 +178,37 @@ public:
 
         return result;
     }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @param i            The index of a component.
+     *
+     *  @return A writable view on the parameters of the given component, as one contiguous vector.
+     */
+    Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> flattenedComponent(const size_t i) {
+
+        auto& parameters = this->array.elements()[i].Eigen();
+        return Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>(parameters.data(), static_cast<Eigen::Index>(parameters.size()));
+    }
+
+
+    /**
+     *  Check if an expression can be combined with this operator.
+     *
+     *  @param expression           The expression.
+     */
+    template <typename Expression>
+    void checkCompatibility(const Expression& expression) const {
+
+        if ((expression.numberOfComponents() != this->numberOfComponents()) || (expression.numberOfOrbitals() != this->numberOfOrbitals())) {
+            throw std::invalid_argument("SQOperatorStorage::checkCompatibility(const Expression&): The operators should have the same number of components and be expressed in the same number of orbitals.");
+        }
+    }
 };
 
 
@@ -268,24 +268,31 @@ public:
      */
     DerivedOperator rotated(const JacobiRotation& jacobi_rotation) const override {
 
+        auto result = static_cast<const DerivedOperator&>(*this);
+        result.rotate(jacobi_rotation);
+        return result;
+    }
+
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     */
+    void rotate(const JacobiRotation& jacobi_rotation) {
+
         // Use Eigen's Jacobi module to apply the Jacobi rotations directly (cfr. T.adjoint() * M * T).
         const auto p = jacobi_rotation.p();
         const auto q = jacobi_rotation.q();
         const auto jacobi_rotation_eigen = jacobi_rotation.Eigen();
 
-        // Calculate the basis transformation for every component of the operator.
-        auto result = this->allParameters();
-        for (size_t i = 0; i < this->numberOfComponents(); i++) {
-            result[i].applyOnTheLeft(p, q, jacobi_rotation_eigen.adjoint());
-            result[i].applyOnTheRight(p, q, jacobi_rotation_eigen);
+        // Rotate every component of the operator.
+        for (auto& f : this->allParameters()) {
+            f.applyOnTheLeft(p, q, jacobi_rotation_eigen.adjoint());
+            f.applyOnTheRight(p, q, jacobi_rotation_eigen);
         }
-
-        return DerivedOperator {StorageArray<MatrixRepresentation, Vectorizer>(result, this->array.vectorizer())};
     }
 
-    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
-    using JacobiRotatable<DerivedOperator>::rotate;
-
 
     /*
      *  MARK: One-index transformations
@@ -18,7 +18,9 @@
 #pragma once
 
 
+#include "Basis/SpinorBasis/OrbitalSpace.hpp"
 #include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/FourIndexTransformation.hpp"
 #include "Basis/Transformations/JacobiRotatable.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Mathematical/Representation/StorageArray.hpp"
@@ -284,31 +286,15 @@ public:
      */
     DerivedOperator transformed(const Transformation& T) const override {
 
-        // Since we're only getting T as a matrix, we should convert it to an appropriate tensor to perform contractions.
-        // Although not a necessity for the einsum implementation, it makes it a lot easier to follow the formulas.
-        const GQCP::Tensor<Scalar, 2> T_tensor = Eigen::TensorMap<Eigen::Tensor<const Scalar, 2>>(T.matrix().data(), T.matrix().rows(), T.matrix().cols());
-
-        // We calculate the conjugate as a tensor as well.
-        const GQCP::Tensor<Scalar, 2> T_conjugate = T_tensor.conjugate();
+        // The four quarter transformations g'(P Q R S) = T^*(T P) T(U Q) T^*(V R) T(W S) g(T U V W) are performed as blocked matrix-matrix multiplications.
+        const MatrixX<Scalar>& T_matrix = T.matrix();
 
         // Calculate the basis transformation for every component of the operator.
         const auto& parameters = this->allParameters();
         auto result = this->allParameters();
 
         for (size_t i = 0; i < this->numberOfComponents(); i++) {
-
-            // We will have to do four single contractions
-            // g(T U V W)  T^*(V R) -> a(T U R W)
-            // a(T U R W)  T(W S) -> b(T U R S)
-            const auto temp_1 = parameters[i].template einsum<1>("TUVW,VR->TURW", T_conjugate).template einsum<1>("TURW,WS->TURS", T_tensor);
-
-            // T(U Q)  b(T U R S) -> c(T Q R S)
-            const auto temp_2 = T_tensor.template einsum<1>("UQ,TURS->TQRS", temp_1);
-
-            // T^*(T P)  c(T Q R S) -> g'(P Q R S)
-            const auto transformed_component = T_conjugate.template einsum<1>("TP,TQRS->PQRS", temp_2);
-
-            result[i] = transformed_component;
+            result[i] = fourIndexTransformed(parameters[i], T_matrix, T_matrix, T_matrix, T_matrix);
         }
 
         return DerivedOperator {StorageArray<MatrixRepresentation, Vectorizer>(result, this->array.vectorizer())};
@@ -322,6 +308,51 @@ public:
     using BasisTransformable<DerivedOperator>::rotated;
 
 
+    /*
+     *  MARK: Subspace-restricted transformations
+     */
+
+    /**
+     *  Apply the basis transformation, but only calculate the block of the resulting two-electron integrals that belongs to the given occupation types, e.g. the (i a|j b)-integrals for (k_occupied, k_virtual, k_occupied, k_virtual).
+     *
+     *  Only the columns of the transformation matrix that belong to the requested occupation types are used for every axis. Since the first quarter transformation then costs O(n1 K^4) and every next one is cheaper, the requested block is obtained at a fraction of the O(K^5) cost of the full transformation, and only n1 n2 n3 n4 integrals are stored. For the lowest cost, the axis with the fewest orbitals should be the first one.
+     *
+     *  @param T                    The basis transformation.
+     *  @param orbital_space        The orbital space that divides the transformed orbitals into occupied, active and virtual ones.
+     *  @param axis1_type           The occupation type of the first axis.
+     *  @param axis2_type           The occupation type of the second axis.
+     *  @param axis3_type           The occupation type of the third axis.
+     *  @param axis4_type           The occupation type of the fourth axis.
+     *  @param i                    The index of the component of this operator that should be transformed.
+     *
+     *  @return The requested block of the basis-transformed two-electron integrals, whose elements can be accessed through the orbital indices of the full transformed basis.
+     */
+    ImplicitRankFourTensorSlice<Scalar> transformedBlock(const Transformation& T, const OrbitalSpace& orbital_space, const OccupationType axis1_type, const OccupationType axis2_type, const OccupationType axis3_type, const OccupationType axis4_type, const size_t i = 0) const {
+
+        if (T.numberOfOrbitals() != this->numberOfOrbitals()) {
+            throw std::invalid_argument("SimpleSQTwoElectronOperator::transformedBlock(const Transformation&, const OrbitalSpace&, const OccupationType, const OccupationType, const OccupationType, const OccupationType, const size_t): The dimensions of the transformation are incompatible with this two-electron operator.");
+        }
+
+        if (orbital_space.numberOfOrbitals() != T.numberOfOrbitals()) {
+            throw std::invalid_argument("SimpleSQTwoElectronOperator::transformedBlock(const Transformation&, const OrbitalSpace&, const OccupationType, const OccupationType, const OccupationType, const OccupationType, const size_t): The orbital space is incompatible with the transformation.");
+        }
+
+        // Gather the columns of the transformation matrix that belong to every occupation type.
+        const auto columns_of = [&T, &orbital_space](const OccupationType type) {
+            const auto& indices = orbital_space.indices(type);
+
+            MatrixX<Scalar> T_block {T.matrix().rows(), static_cast<Eigen::Index>(indices.size())};
+            for (size_t column = 0; column < indices.size(); column++) {
+                T_block.col(column) = T.matrix().col(indices[column]);
+            }
+            return T_block;
+        };
+
+        const auto block = fourIndexTransformed(this->allParameters()[i], columns_of(axis1_type), columns_of(axis2_type), columns_of(axis3_type), columns_of(axis4_type));
+        return orbital_space.createRepresentableObjectFor(axis1_type, axis2_type, axis3_type, axis4_type, block);
+    }
+
+
     /*
      *  MARK: Conforming to `JacobiRotatable`
      */
@@ -335,13 +366,32 @@ public:
      */
     DerivedOperator rotated(const JacobiRotation& jacobi_rotation) const override {
 
-        // While waiting for an analogous Eigen::Tensor Jacobi module, we implement this rotation by constructing a Jacobi rotation matrix and then simply doing a rotation with it.
-        const auto J = Transformation::FromJacobi(jacobi_rotation, this->numberOfOrbitals());
-        return this->rotated(J);
+        auto result = static_cast<const DerivedOperator&>(*this);
+        result.rotate(jacobi_rotation);
+        return result;
     }
 
-    // Allow the `rotate` method from `JacobiRotatable`, since there's also a `rotate` from `BasisTransformable`.
-    using JacobiRotatable<DerivedOperator>::rotate;
+
+    /**
+     *  In-place apply the Jacobi rotation.
+     *
+     *  Since a Jacobi rotation only mixes the orbitals p and q, only the slices of the two-electron integrals that carry p or q on one of their axes are updated, which costs O(K^3) instead of the O(K^5) of a general basis transformation.
+     *
+     *  @param jacobi_rotation          The Jacobi rotation.
+     */
+    void rotate(const JacobiRotation& jacobi_rotation) {
+
+        const auto p = jacobi_rotation.p();
+        const auto q = jacobi_rotation.q();
+        const auto jacobi_rotation_eigen = jacobi_rotation.Eigen();
+
+        // Since the Jacobi rotation matrix is real, the transformation formula g'(P Q R S) = T^*(T P) T(U Q) T^*(V R) T(W S) g(T U V W) reduces to rotating every axis separately.
+        for (auto& g : this->allParameters()) {
+            for (size_t axis = 0; axis < 4; axis++) {
+                g.applyJacobiRotation(p, q, jacobi_rotation_eigen, axis);
+            }
+        }
+    }
 
 
     /*
@@ -236,6 +236,19 @@ public:
     }
 
 
+    /**
+     *  Subtraction-assignment, which is implemented in-place instead of through the addition of the negated operator.
+     */
+    Self& operator-=(const Self& rhs) {
+
+        // Subtract the alpha-components and the beta-components.
+        this->alpha() -= rhs.alpha();
+        this->beta() -= rhs.beta();
+
+        return *this;
+    }
+
+
     /**
      *  Scalar multiplication-assignment.
      */
@@ -274,6 +274,21 @@ public:
     }
 
 
+    /**
+     *  Subtraction-assignment, which is implemented in-place instead of through the addition of the negated operator.
+     */
+    Self& operator-=(const Self& rhs) {
+
+        // Subtract the spin-components.
+        this->alphaAlpha() -= rhs.alphaAlpha();
+        this->alphaBeta() -= rhs.alphaBeta();
+        this->betaAlpha() -= rhs.betaAlpha();
+        this->betaBeta() -= rhs.betaBeta();
+
+        return *this;
+    }
+
+
     /**
      *  Scalar multiplication-assignment, to be implemented in derived classes.
      */
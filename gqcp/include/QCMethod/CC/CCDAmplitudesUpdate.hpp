@@ -73,23 +73,21 @@ public:
         const auto& orbital_space = t2.orbitalSpace();
 
 
-        // Update the T2-amplitudes.
-        auto t2_updated = t2;
+        // Determine the current values for all the T2-amplitude equations at once, and use them to update the T2-amplitudes.
+        const auto f_T2 = QCModel::CCD<Scalar>::calculateT2AmplitudeEquations(f, V_A, t2, F1, F2, W1, W2, W3);
+
+        // Update the T2-amplitudes in place, in a (recycled) slot of the environment, so that no copies are allocated in a steady-state iteration.
+        environment.t2_amplitudes.push_back(t2);
+        auto& t2_updated = environment.t2_amplitudes.back();
         for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
             for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
                 for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
                     for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-
-                        // Determine the current value for the corresponding T2-amplitude equation, and use it to update the T2-amplitude.
-                        const auto f_ijab = QCModel::CCD<Scalar>::calculateT2AmplitudeEquation(i, j, a, b, f, V_A, t2, F1, F2, W1, W2, W3);
-                        t2_updated(i, j, a, b) += f_ijab / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
+                        t2_updated(i, j, a, b) += f_T2(i, j, a, b) / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
                     }
                 }
             }
         }
-
-        // Write the updated amplitudes back to the environment.
-        environment.t2_amplitudes.push_back(t2_updated);
     }
 };
 
@@ -21,8 +21,12 @@
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/CC/CCD.hpp"
 #include "QCModel/CC/CCSD.hpp"
+#include "QCModel/CC/RCCSD.hpp"
 #include "QCModel/CC/T1Amplitudes.hpp"
 #include "QCModel/CC/T2Amplitudes.hpp"
+#include "QCModel/HF/RHF.hpp"
+#include "Utilities/IterationArena.hpp"
+#include "Utilities/RingBuffer.hpp"
 
 #include <deque>
 
@@ -43,16 +47,28 @@ public:
 
 
 public:
+    // The default maximum number of iterates that are kept, which is sufficient for the default DIIS subspace dimension and for checking convergence.
+    static constexpr size_t DefaultHistoryDepth = 8;
+
     std::deque<Scalar> correlation_energies;  // The electronic correlation energies.
 
-    std::deque<T1Amplitudes<Scalar>> t1_amplitudes;
-    std::deque<T2Amplitudes<Scalar>> t2_amplitudes;
+    RingBuffer<T1Amplitudes<Scalar>> t1_amplitudes {DefaultHistoryDepth};
+    RingBuffer<T2Amplitudes<Scalar>> t2_amplitudes {DefaultHistoryDepth};
+
+    RingBuffer<VectorX<Scalar>> t1_amplitude_errors {DefaultHistoryDepth};
+    RingBuffer<VectorX<Scalar>> t2_amplitude_errors {DefaultHistoryDepth};
+
+    RingBuffer<T1Amplitudes<Scalar>> l1_amplitudes {DefaultHistoryDepth};  // The Λ1-amplitudes, which are only used in Λ-CCSD calculations.
+    RingBuffer<T2Amplitudes<Scalar>> l2_amplitudes {DefaultHistoryDepth};  // The Λ2-amplitudes, which are only used in Λ-CCSD calculations.
 
-    std::deque<VectorX<Scalar>> t1_amplitude_errors;
-    std::deque<VectorX<Scalar>> t2_amplitude_errors;
+    RingBuffer<VectorX<Scalar>> l2_amplitude_errors {DefaultHistoryDepth};
 
     SquareMatrix<Scalar> f;            // The elements of the (inactive) Fock matrix.
     SquareRankFourTensor<Scalar> V_A;  // The antisymmetrized two-electron integrals (in physicist's notation).
+    SquareRankFourTensor<Scalar> V;    // The spatial-orbital two-electron integrals (in physicist's notation), which are only used in spin-adapted closed-shell calculations.
+
+    SquareMatrix<float> f_single;            // A single-precision copy of the (inactive) Fock matrix, which is only used in the single-precision iterations of mixed-precision calculations.
+    SquareRankFourTensor<float> V_A_single;  // A single-precision copy of the antisymmetrized two-electron integrals, which is only used in the single-precision iterations of mixed-precision calculations.
 
     ImplicitMatrixSlice<Scalar> F1;  // An intermediate that represents equation (3) in Stanton1991.
     ImplicitMatrixSlice<Scalar> F2;  // An intermediate that represents equation (4) in Stanton1991.
@@ -65,6 +81,24 @@ public:
     ImplicitRankFourTensorSlice<Scalar> tau2;        // An intermediate that represents equation (10) in Stanton1991.
     ImplicitRankFourTensorSlice<Scalar> tau2_tilde;  // An intermediate that represents equation (9) in Stanton1991.
 
+    // The blocks of the similarity-transformed Hamiltonian (Table III in Gauss1995), which are only used in Λ-CCSD calculations. They are fixed during the Λ-iterations.
+    ImplicitMatrixSlice<Scalar> Hbar_oo;
+    ImplicitMatrixSlice<Scalar> Hbar_vv;
+    ImplicitMatrixSlice<Scalar> Hbar_ov;
+
+    ImplicitRankFourTensorSlice<Scalar> Hbar_oooo;
+    ImplicitRankFourTensorSlice<Scalar> Hbar_vvvv;
+    ImplicitRankFourTensorSlice<Scalar> Hbar_ovvo;
+    ImplicitRankFourTensorSlice<Scalar> Hbar_ooov;
+    ImplicitRankFourTensorSlice<Scalar> Hbar_vovv;
+    ImplicitRankFourTensorSlice<Scalar> Hbar_ovoo;
+    ImplicitRankFourTensorSlice<Scalar> Hbar_vvvo;
+
+    ImplicitMatrixSlice<Scalar> G_oo;  // The occupied-occupied three-body intermediate in Gauss1995, which depends on the Λ2-amplitudes.
+    ImplicitMatrixSlice<Scalar> G_vv;  // The virtual-virtual three-body intermediate in Gauss1995, which depends on the Λ2-amplitudes.
+
+    IterationArena arena;  // Scratch memory for the intermediates of a single iteration, which is released at the start of every iteration.
+
 
 public:
     /*
@@ -81,10 +115,12 @@ public:
      */
     CCSDEnvironment(const T1Amplitudes<Scalar>& t1_amplitudes, const T2Amplitudes<Scalar>& t2_amplitudes, const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A) :
         correlation_energies {QCModel::CCSD<Scalar>::calculateCorrelationEnergy(f, V_A, t1_amplitudes, t2_amplitudes)},  // already calculate the initial CCSD energy correction
-        t1_amplitudes {t1_amplitudes},
-        t2_amplitudes {t2_amplitudes},
         f {f},
-        V_A {V_A} {}
+        V_A {V_A} {
+
+        this->t1_amplitudes.push_back(t1_amplitudes);
+        this->t2_amplitudes.push_back(t2_amplitudes);
+    }
 
 
     /**
@@ -96,9 +132,30 @@ public:
      */
     CCSDEnvironment(const T2Amplitudes<Scalar>& t2_amplitudes, const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A) :
         correlation_energies {QCModel::CCD<Scalar>::calculateCorrelationEnergy(f, V_A, t2_amplitudes)},  // Make sure to calculate the initial CCD energy correction already.
-        t2_amplitudes {t2_amplitudes},
         f {f},
-        V_A {V_A} {}
+        V_A {V_A} {
+
+        this->t2_amplitudes.push_back(t2_amplitudes);
+    }
+
+
+    /**
+     *  Initialize an algorithmic environment for spin-adapted closed-shell calculations with given spatial-orbital T1- and T2-amplitudes.
+     * 
+     *  @param t1_amplitudes            The initial spatial-orbital T1-amplitudes.
+     *  @param t2_amplitudes            The initial (alpha-beta) spatial-orbital T2-amplitudes.
+     *  @param f                        The elements of the (inactive) spatial-orbital Fock matrix.
+     *  @param V                        The spatial-orbital two-electron integrals (in physicist's notation).
+     *  @param correlation_energy       The correlation energy that belongs to the initial amplitudes.
+     */
+    CCSDEnvironment(const T1Amplitudes<Scalar>& t1_amplitudes, const T2Amplitudes<Scalar>& t2_amplitudes, const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const Scalar correlation_energy) :
+        correlation_energies {correlation_energy},
+        f {f},
+        V {V} {
+
+        this->t1_amplitudes.push_back(t1_amplitudes);
+        this->t2_amplitudes.push_back(t2_amplitudes);
+    }
 
 
     /*
@@ -149,6 +206,60 @@ public:
 
         return CCSDEnvironment<Scalar>(t2_amplitudes, f, V_A);
     }
+
+
+    /**
+     *  Initialize a spin-adapted closed-shell CCSD algorithmic environment with initial guesses for the spatial-orbital T1- and T2-amplitudes based on perturbation theory.
+     * 
+     *  @param sq_hamiltonian               The Hamiltonian expressed in the canonical RHF spin-orbital basis.
+     *  @param rhf_parameters               The converged RHF model parameters, which determine the occupied-virtual separation.
+     * 
+     *  @return An algorithmic environment suitable for spin-adapted closed-shell CCSD calculations.
+     */
+    static CCSDEnvironment<Scalar> PerturbativeRCCSD(const RSQHamiltonian<Scalar>& sq_hamiltonian, const QCModel::RHF<Scalar>& rhf_parameters) {
+
+        if (sq_hamiltonian.numberOfOrbitals() != rhf_parameters.numberOfSpatialOrbitals()) {
+            throw std::invalid_argument("CCSDEnvironment::PerturbativeRCCSD(const RSQHamiltonian<Scalar>&, const QCModel::RHF<Scalar>&): The number of spatial orbitals of the Hamiltonian and the RHF model parameters do not match.");
+        }
+
+        // For the spin-adapted equations, we need the inactive spatial-orbital Fock matrix and the spatial-orbital two-electron integrals in physicist's notation.
+        const auto orbital_space = rhf_parameters.orbitalSpace();
+        const auto f = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+        const auto V = sq_hamiltonian.twoElectron().convertedToPhysicistsNotation().parameters();
+
+        // The spin-orbital perturbative formulas also hold for the alpha-beta amplitudes, if the non-antisymmetrized integrals are used.
+        const auto t1_amplitudes = T1Amplitudes<Scalar>::Perturbative(f, orbital_space);
+        const auto t2_amplitudes = T2Amplitudes<Scalar>::Perturbative(f, V, orbital_space);
+
+        const auto correlation_energy = QCModel::RCCSD<Scalar>::calculateCorrelationEnergy(f, V, t1_amplitudes, t2_amplitudes);
+        return CCSDEnvironment<Scalar>(t1_amplitudes, t2_amplitudes, f, V, correlation_energy);
+    }
+
+
+    /*
+     *  MARK: History
+     */
+
+    /**
+     *  @return The maximum number of iterates (T1-, T2-, Λ1- and Λ2-amplitudes and their errors) that this environment keeps.
+     */
+    size_t historyDepth() const { return this->t2_amplitudes.capacity(); }
+
+    /**
+     *  Change the maximum number of iterates (T1-, T2-, Λ1- and Λ2-amplitudes and their errors) that this environment keeps. Only the most recent iterates are retained.
+     *
+     *  @param history_depth            The maximum number of iterates that are kept. It should be at least as large as the maximum DIIS subspace dimension.
+     */
+    void setHistoryDepth(const size_t history_depth) {
+
+        this->t1_amplitudes.setCapacity(history_depth);
+        this->t2_amplitudes.setCapacity(history_depth);
+        this->t1_amplitude_errors.setCapacity(history_depth);
+        this->t2_amplitude_errors.setCapacity(history_depth);
+        this->l1_amplitudes.setCapacity(history_depth);
+        this->l2_amplitudes.setCapacity(history_depth);
+        this->l2_amplitude_errors.setCapacity(history_depth);
+    }
 };
 
 
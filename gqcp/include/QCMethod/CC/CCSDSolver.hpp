@@ -26,6 +26,10 @@
 #include "QCMethod/CC/CCSDEnergyCalculation.hpp"
 #include "QCMethod/CC/CCSDEnvironment.hpp"
 #include "QCMethod/CC/CCSDIntermediatesUpdate.hpp"
+#include "QCMethod/CC/MixedPrecisionCCSDUpdate.hpp"
+#include "Utilities/type_traits.hpp"
+
+#include <stdexcept>
 
 
 namespace GQCP {
@@ -63,20 +67,58 @@ public:
             .add(CCSDEnergyCalculation<Scalar>());
 
 
-        // Create a compound convergence criterion on the norm of subsequent T1- and T2-amplitudes, which is facilitated by the .norm() API of the T1- and T2-amplitudes.
-        using T1ConvergenceType = ConsecutiveIteratesNormConvergence<T1Amplitudes<Scalar>, CCSDEnvironment<Scalar>>;
-        const auto t1_extractor = [](const CCSDEnvironment<Scalar>& environment) { return environment.t1_amplitudes; };
-        const T1ConvergenceType t1_convergence_criterion {threshold, t1_extractor, "the T1 amplitudes"};
+        // Put together the pieces of the algorithm.
+        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(plain_ccsd_cycle, CCSDSolver<Scalar>::convergenceCriterion(threshold), maximum_number_of_iterations);
+    }
 
-        using T2ConvergenceType = ConsecutiveIteratesNormConvergence<T2Amplitudes<Scalar>, CCSDEnvironment<Scalar>>;
-        const auto t2_extractor = [](const CCSDEnvironment<Scalar>& environment) { return environment.t2_amplitudes; };
-        const T2ConvergenceType t2_convergence_criterion {threshold, t2_extractor, "the T2 amplitudes"};
 
-        const CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> convergence_criterion {t1_convergence_criterion, t2_convergence_criterion};
+    /**
+     *  @param switch_threshold                     the threshold on the norm of the change in the amplitudes below which the iterations are performed in double precision. It should be larger than the convergence threshold.
+     *  @param threshold                            the threshold that is used in comparing the amplitudes
+     *  @param maximum_number_of_iterations         the maximum number of iterations the algorithm may perform
+     * 
+     *  @return a mixed-precision CCSD solver that evaluates the CCSD intermediates and amplitude equations in single precision (accumulating the amplitudes and the energies in double precision) until the change in the amplitudes drops below the switch threshold or stagnates, and that uses the norm of the difference of consecutive amplitudes as a convergence criterion
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, IterativeAlgorithm<CCSDEnvironment<Scalar>>> MixedPrecision(const double switch_threshold = 1.0e-05, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
 
+        if (switch_threshold <= threshold) {
+            throw std::invalid_argument("CCSDSolver<Scalar>::MixedPrecision(const double, const double, const size_t): The switch threshold should be larger than the convergence threshold, since single-precision iterations cannot converge the amplitudes.");
+        }
+
+        // Create the iteration cycle that effectively 'defines' a mixed-precision CCSD solver.
+        StepCollection<CCSDEnvironment<Scalar>> mixed_precision_ccsd_cycle {};
+        mixed_precision_ccsd_cycle
+            .add(MixedPrecisionCCSDUpdate(switch_threshold))
+            .add(CCSDEnergyCalculation<Scalar>());
 
         // Put together the pieces of the algorithm.
-        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(plain_ccsd_cycle, convergence_criterion, maximum_number_of_iterations);
+        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(mixed_precision_ccsd_cycle, CCSDSolver<Scalar>::convergenceCriterion(threshold), maximum_number_of_iterations);
+    }
+
+
+private:
+    /*
+     *  PRIVATE STATIC METHODS
+     */
+
+    /**
+     *  @param threshold                            the threshold that is used in comparing the amplitudes
+     * 
+     *  @return a compound convergence criterion on the norm of subsequent T1- and T2-amplitudes
+     */
+    static CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> convergenceCriterion(const double threshold) {
+
+        // Create a compound convergence criterion on the norm of subsequent T1- and T2-amplitudes, which is facilitated by the .norm() API of the T1- and T2-amplitudes.
+        using T1ConvergenceType = ConsecutiveIteratesNormConvergence<T1Amplitudes<Scalar>, CCSDEnvironment<Scalar>, RingBuffer<T1Amplitudes<Scalar>>>;
+        const auto t1_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const RingBuffer<T1Amplitudes<Scalar>>& { return environment.t1_amplitudes; };
+        const T1ConvergenceType t1_convergence_criterion {threshold, t1_extractor, "the T1 amplitudes"};
+
+        using T2ConvergenceType = ConsecutiveIteratesNormConvergence<T2Amplitudes<Scalar>, CCSDEnvironment<Scalar>, RingBuffer<T2Amplitudes<Scalar>>>;
+        const auto t2_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const RingBuffer<T2Amplitudes<Scalar>>& { return environment.t2_amplitudes; };
+        const T2ConvergenceType t2_convergence_criterion {threshold, t2_extractor, "the T2 amplitudes"};
+
+        return CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> {t1_convergence_criterion, t2_convergence_criterion};
     }
 };
 
@@ -0,0 +1,138 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Optimization/LinearEquation/LinearEquationEnvironment.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/QCStructure.hpp"
+#include "QCModel/CC/CCSD.hpp"
+#include "QCModel/CC/LambdaCCSD.hpp"
+
+
+namespace GQCP {
+namespace QCMethod {
+
+
+/**
+ *  The Λ-CCSD quantum chemical method, which determines the Λ-amplitudes that make the CCSD Lagrangian stationary, for a converged set of T-amplitudes.
+ * 
+ *  @tparam _Scalar                 The scalar type used to represent the amplitudes.
+ */
+template <typename _Scalar>
+class LambdaCCSD {
+public:
+    using Scalar = _Scalar;
+
+public:
+    /*
+     *  MARK: Optimization
+     */
+
+    /**
+     *  Optimize the Λ-amplitudes of the CCSD Lagrangian.
+     * 
+     *  @tparam Solver              The type of the solver.
+     * 
+     *  @param solver               The solver that will try to optimize the Λ-amplitudes, see `LambdaCCSDSolver`.
+     *  @param environment          The environment, which acts as a sort of calculation space for the solver. Its most recent T1- and T2-amplitudes should be the converged CCSD amplitudes. If it doesn't contain any Λ-amplitudes yet, the T-amplitudes are used as an initial guess.
+     * 
+     *  @return A quantum chemical structure that contains the CCSD correlation energy and the Λ-CCSD model parameters.
+     */
+    template <typename Solver>
+    QCStructure<GQCP::QCModel::LambdaCCSD<Scalar>, Scalar> optimize(Solver& solver, CCSDEnvironment<Scalar>& environment) const {
+
+        const auto& f = environment.f;
+        const auto& V_A = environment.V_A;
+        const auto& t1 = environment.t1_amplitudes.back();
+        const auto& t2 = environment.t2_amplitudes.back();
+
+        // The Λ-equations are linear, with coefficients that only depend on the (converged) T-amplitudes: the blocks of the similarity-transformed Hamiltonian are calculated once, before the iterations start.
+        const auto tau2 = GQCP::QCModel::CCSD<Scalar>::calculateTau2(t1, t2);
+        environment.Hbar_ov = GQCP::QCModel::CCSD<Scalar>::calculateF3(f, V_A, t1);
+        environment.Hbar_oo = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarOO(f, V_A, t1, t2, environment.Hbar_ov);
+        environment.Hbar_vv = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarVV(f, V_A, t1, t2, environment.Hbar_ov);
+
+        environment.Hbar_oooo = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarOOOO(V_A, t1, tau2);
+        environment.Hbar_vvvv = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarVVVV(V_A, t1, tau2);
+        environment.Hbar_ovvo = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarOVVO(V_A, t1, t2);
+        environment.Hbar_ooov = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarOOOV(V_A, t1);
+        environment.Hbar_vovv = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarVOVV(V_A, t1);
+        environment.Hbar_ovoo = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarOVOO(V_A, t1, t2, tau2, environment.Hbar_ov, environment.Hbar_oooo);
+        environment.Hbar_vvvo = GQCP::QCModel::LambdaCCSD<Scalar>::calculateHbarVVVO(V_A, t1, t2, tau2, environment.Hbar_ov, environment.Hbar_vvvv);
+
+        if (environment.l1_amplitudes.empty()) {
+            environment.l1_amplitudes.push_back(t1);
+        }
+        if (environment.l2_amplitudes.empty()) {
+            environment.l2_amplitudes.push_back(t2);
+        }
+
+
+        // The Λ-CCSD method's responsibility is to try to optimize the Λ-amplitudes, given a solver and associated environment.
+        solver.perform(environment);
+
+        // To make a QCStructure, we need the electronic (correlation) energy and the T- and Λ-amplitudes. The Λ-amplitudes don't change the CCSD energy.
+        const GQCP::QCModel::LambdaCCSD<Scalar> lambda_ccsd_parameters {t1, t2, environment.l1_amplitudes.back(), environment.l2_amplitudes.back()};
+
+        return QCStructure<GQCP::QCModel::LambdaCCSD<Scalar>, Scalar>({environment.correlation_energies.back()}, {lambda_ccsd_parameters});
+    }
+
+
+    /**
+     *  Solve the orbital response (Z-vector) equations, which account for the response of the (Hartree-Fock) orbitals in the relaxed CCSD density matrices.
+     * 
+     *  @tparam LinearSolver        The type of the linear equation solver.
+     * 
+     *  @param linear_solver        The solver that will try to find the orbital response multipliers.
+     *  @param sq_hamiltonian       The Hamiltonian, expressed in the canonical Hartree-Fock spinors.
+     *  @param lambda_ccsd          The optimized Λ-CCSD model parameters.
+     * 
+     *  @return The orbital response multipliers z_ai, as a virtual-occupied object.
+     * 
+     *  @note The orbital rotations are assumed to be real.
+     */
+    template <typename LinearSolver>
+    ImplicitMatrixSlice<Scalar> calculateOrbitalResponse(LinearSolver& linear_solver, const GSQHamiltonian<Scalar>& sq_hamiltonian, const GQCP::QCModel::LambdaCCSD<Scalar>& lambda_ccsd) const {
+
+        const auto& orbital_space = lambda_ccsd.orbitalSpace();
+        const auto f = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+        const auto V_A = sq_hamiltonian.twoElectron().convertedToPhysicistsNotation().antisymmetrized().parameters();
+
+        const auto D = lambda_ccsd.calculate1DM();
+        const auto d = lambda_ccsd.calculate2DM();
+
+        const auto A = GQCP::QCModel::LambdaCCSD<Scalar>::calculateOrbitalResponseForceConstant(f, V_A, orbital_space);
+        const auto b = GQCP::QCModel::LambdaCCSD<Scalar>::calculateOrbitalResponseForce(sq_hamiltonian, D, d, orbital_space).asVector();  // column-major
+        LinearEquationEnvironment<Scalar> linear_environment {A, b};
+
+        linear_solver.perform(linear_environment);
+        const auto& z_vector = linear_environment.x;  // since b was column-major, so is this vector
+
+        const auto n_o = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_v = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const MatrixX<Scalar> z_matrix = MatrixX<Scalar>::FromColumnMajorVector(z_vector, n_v, n_o);
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_occupied, z_matrix);
+    }
+};
+
+
+}  // namespace QCMethod
+}  // namespace GQCP
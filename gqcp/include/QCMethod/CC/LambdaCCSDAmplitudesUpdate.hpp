@@ -0,0 +1,101 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCModel/CC/LambdaCCSD.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the new Λ1- and Λ2-amplitudes using an update formula from the current Λ1- and Λ2-amplitudes.
+ * 
+ *  @tparam _Scalar             the scalar type that is used the amplitudes
+ */
+template <typename _Scalar>
+class LambdaCCSDAmplitudesUpdate:
+    public Step<CCSDEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = CCSDEnvironment<Scalar>;
+
+
+public:
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Calculate the new Λ1- and Λ2-amplitudes using an update formula from the current Λ1- and Λ2-amplitudes.";
+    }
+
+
+    /**
+     *  Calculate the new Λ1- and Λ2-amplitudes using an update formula from the current Λ1- and Λ2-amplitudes.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(Environment& environment) override {
+
+        // Extract the current Λ1- and Λ2-amplitudes and intermediates.
+        const auto& f = environment.f;
+        const auto& V_A = environment.V_A;
+        const auto& l1 = environment.l1_amplitudes.back();
+        const auto& l2 = environment.l2_amplitudes.back();
+
+        const auto& orbital_space = l1.orbitalSpace();  // assume the orbital spaces are equal for the Λ1- and Λ2-amplitudes.
+
+
+        // Determine the current values for all the Λ1- and Λ2-amplitude equations at once, and use them to update the amplitudes. Since the Λ-equations are linear, the same (Jacobi) update formula as for the T-amplitudes can be used.
+        const auto f_L1 = QCModel::LambdaCCSD<Scalar>::calculateLambda1AmplitudeEquations(l1, l2, environment.Hbar_ov, environment.Hbar_oo, environment.Hbar_vv, environment.Hbar_ovvo, environment.Hbar_ooov, environment.Hbar_vovv, environment.Hbar_ovoo, environment.Hbar_vvvo, environment.G_oo, environment.G_vv);
+        const auto f_L2 = QCModel::LambdaCCSD<Scalar>::calculateLambda2AmplitudeEquations(V_A, l1, l2, environment.Hbar_ov, environment.Hbar_oo, environment.Hbar_vv, environment.Hbar_oooo, environment.Hbar_vvvv, environment.Hbar_ovvo, environment.Hbar_ooov, environment.Hbar_vovv, environment.G_oo, environment.G_vv);
+
+        // Update the Λ1-amplitudes in place, in a (recycled) slot of the environment.
+        environment.l1_amplitudes.push_back(l1);
+        auto& l1_updated = environment.l1_amplitudes.back();
+        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                l1_updated(i, a) += f_L1(i, a) / (f(i, i) - f(a, a));
+            }
+        }
+
+        // Update the Λ2-amplitudes in place, in a (recycled) slot of the environment.
+        environment.l2_amplitudes.push_back(l2);
+        auto& l2_updated = environment.l2_amplitudes.back();
+        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
+                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
+                        l2_updated(i, j, a, b) += f_L2(i, j, a, b) / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
+                    }
+                }
+            }
+        }
+    }
+};
+
+
+}  // namespace GQCP
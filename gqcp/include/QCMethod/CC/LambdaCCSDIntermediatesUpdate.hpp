@@ -0,0 +1,72 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCModel/CC/LambdaCCSD.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current three-body intermediates of the Λ-CCSD equations, as described in Gauss1995.
+ * 
+ *  @tparam _Scalar             the scalar type that is used to represent the amplitudes
+ */
+template <typename _Scalar>
+class LambdaCCSDIntermediatesUpdate:
+    public Step<CCSDEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = CCSDEnvironment<Scalar>;
+
+
+public:
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return a textual description of this algorithmic step
+     */
+    std::string description() const override {
+        return "Calculate the current three-body intermediates of the Λ-CCSD equations, as described in Gauss1995.";
+    }
+
+
+    /**
+     *  Calculate the current three-body intermediates of the Λ-CCSD equations, as described in Gauss1995. The blocks of the similarity-transformed Hamiltonian don't depend on the Λ-amplitudes, so they are not recalculated.
+     * 
+     *  @param environment              the environment that acts as a sort of calculation space
+     */
+    void execute(Environment& environment) override {
+
+        const auto& t2 = environment.t2_amplitudes.back();
+        const auto& l2 = environment.l2_amplitudes.back();
+
+        environment.G_oo = QCModel::LambdaCCSD<Scalar>::calculateGOO(t2, l2);
+        environment.G_vv = QCModel::LambdaCCSD<Scalar>::calculateGVV(t2, l2);
+    }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,128 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/CompoundConvergenceCriterion.hpp"
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
+#include "Mathematical/Algorithm/StepCollection.hpp"
+#include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/CC/LambdaCCSDAmplitudesUpdate.hpp"
+#include "QCMethod/CC/LambdaCCSDIntermediatesUpdate.hpp"
+#include "QCMethod/CC/T2DIIS.hpp"
+#include "QCMethod/CC/T2ErrorCalculation.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A factory class that can construct solvers for the Λ-CCSD equations in an easy way.
+ * 
+ *  The solvers expect an environment that contains the converged T1- and T2-amplitudes, the blocks of the similarity-transformed Hamiltonian and initial Λ1- and Λ2-amplitudes, which is what `QCMethod::LambdaCCSD::optimize` prepares.
+ * 
+ *  @tparam _Scalar             The scalar type that is used to represent the amplitudes.
+ */
+template <typename _Scalar>
+class LambdaCCSDSolver {
+public:
+    using Scalar = _Scalar;
+
+
+public:
+    /*
+     *  MARK: Factory methods
+     */
+
+    /**
+     *  Create a plain Λ-CCSD solver.
+     * 
+     *  @param threshold                            The threshold that is used in comparing the amplitudes.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A plain Λ-CCSD solver that uses the norm of the difference of consecutive amplitudes as a convergence criterion.
+     */
+    static IterativeAlgorithm<CCSDEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a plain Λ-CCSD solver.
+        StepCollection<CCSDEnvironment<Scalar>> plain_lambda_ccsd_cycle {};
+        plain_lambda_ccsd_cycle
+            .add(LambdaCCSDIntermediatesUpdate<Scalar>())
+            .add(LambdaCCSDAmplitudesUpdate<Scalar>());
+
+        // Put together the pieces of the algorithm.
+        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(plain_lambda_ccsd_cycle, LambdaCCSDSolver<Scalar>::convergenceCriterion(threshold), maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  Create a DIIS Λ-CCSD solver, which accelerates the Λ2-amplitudes.
+     * 
+     *  @param minimum_subspace_dimension           The minimum number of Λ2-amplitudes that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Λ2-amplitudes that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the amplitudes.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A DIIS Λ-CCSD solver that uses the norm of the difference of consecutive amplitudes as a convergence criterion.
+     */
+    static IterativeAlgorithm<CCSDEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // The DIIS steps operate on the Λ2-amplitudes instead of on the T2-amplitudes.
+        const auto l2_extractor = [](CCSDEnvironment<Scalar>& environment) -> RingBuffer<T2Amplitudes<Scalar>>& { return environment.l2_amplitudes; };
+        const auto l2_errors_extractor = [](CCSDEnvironment<Scalar>& environment) -> RingBuffer<VectorX<Scalar>>& { return environment.l2_amplitude_errors; };
+
+        // Create the iteration cycle that effectively 'defines' a DIIS Λ-CCSD solver.
+        StepCollection<CCSDEnvironment<Scalar>> diis_lambda_ccsd_cycle {};
+        diis_lambda_ccsd_cycle
+            .add(LambdaCCSDIntermediatesUpdate<Scalar>())
+            .add(LambdaCCSDAmplitudesUpdate<Scalar>())
+            .add(T2ErrorCalculation<Scalar>(l2_extractor, l2_errors_extractor))
+            .add(T2DIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension, l2_extractor, l2_errors_extractor));
+
+        // Put together the pieces of the algorithm.
+        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(diis_lambda_ccsd_cycle, LambdaCCSDSolver<Scalar>::convergenceCriterion(threshold), maximum_number_of_iterations);
+    }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @param threshold                            The threshold that is used in comparing the amplitudes.
+     * 
+     *  @return A compound convergence criterion on the norm of subsequent Λ1- and Λ2-amplitudes, which is facilitated by the .norm() API of the T1- and T2-amplitudes.
+     */
+    static CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> convergenceCriterion(const double threshold) {
+
+        using L1ConvergenceType = ConsecutiveIteratesNormConvergence<T1Amplitudes<Scalar>, CCSDEnvironment<Scalar>, RingBuffer<T1Amplitudes<Scalar>>>;
+        const auto l1_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const RingBuffer<T1Amplitudes<Scalar>>& { return environment.l1_amplitudes; };
+        const L1ConvergenceType l1_convergence_criterion {threshold, l1_extractor, "the Λ1 amplitudes"};
+
+        using L2ConvergenceType = ConsecutiveIteratesNormConvergence<T2Amplitudes<Scalar>, CCSDEnvironment<Scalar>, RingBuffer<T2Amplitudes<Scalar>>>;
+        const auto l2_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const RingBuffer<T2Amplitudes<Scalar>>& { return environment.l2_amplitudes; };
+        const L2ConvergenceType l2_convergence_criterion {threshold, l2_extractor, "the Λ2 amplitudes"};
+
+        return CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> {l1_convergence_criterion, l2_convergence_criterion};
+    }
+};
+
+
+}  // namespace GQCP
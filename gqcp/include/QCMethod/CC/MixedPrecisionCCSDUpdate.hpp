@@ -0,0 +1,213 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/CC/CCSDAmplitudesUpdate.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/CC/CCSDIntermediatesUpdate.hpp"
+
+#include <algorithm>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the new T1- and T2-amplitudes in mixed precision.
+ *
+ *  As long as the change in the amplitudes is larger than a switch threshold, the CCSD intermediates and amplitude equations are evaluated in single precision, using single-precision copies of the integrals and the current amplitudes. Since these contractions are bandwidth-bound, this halves the amount of memory traffic. The amplitude updates are accumulated in double precision, so that the rounding errors of the single-precision iterations do not accumulate. Once the change in the amplitudes drops below the switch threshold, the CCSD intermediates and amplitude equations are evaluated in double precision.
+ *
+ *  Since the changes in the amplitudes level off at the single-precision round-off, the switch is also made once they stop decreasing. The single-precision iteration that triggers the switch is immediately followed by a double-precision one, so that convergence is always judged on the change in the amplitudes of a double-precision iteration.
+ *
+ *  Note that the double-precision integrals are kept alongside their single-precision copies during the single-precision iterations, since they are needed after the switch. The memory footprint of the integrals therefore grows by about a factor of 1.5, instead of being halved.
+ */
+class MixedPrecisionCCSDUpdate:
+    public Step<CCSDEnvironment<double>> {
+
+public:
+    using Environment = CCSDEnvironment<double>;
+
+
+private:
+    // The threshold on the norm of the change in the T1- and T2-amplitudes below which the iterations are performed in double precision.
+    double switch_threshold;
+
+    // The steps that perform a double-precision iteration.
+    CCSDIntermediatesUpdate<double> intermediates_update;
+    CCSDAmplitudesUpdate<double> amplitudes_update;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param switch_threshold             The threshold on the norm of the change in the T1- and T2-amplitudes below which the iterations are performed in double precision.
+     */
+    MixedPrecisionCCSDUpdate(const double switch_threshold = 1.0e-05) :
+        switch_threshold {switch_threshold} {}
+
+
+    /*
+     *  MARK: Conforming to `Step`
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the new T1- and T2-amplitudes, evaluating the CCSD intermediates and amplitude equations in single precision until the change in the amplitudes drops below a switch threshold.";
+    }
+
+
+    /**
+     *  Calculate the new T1- and T2-amplitudes, evaluating the CCSD intermediates and amplitude equations in single precision until the change in the amplitudes drops below a switch threshold.
+     *
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        if (this->isDoublePrecisionRequired(environment)) {
+            this->executeInDoublePrecision(environment);
+            return;
+        }
+
+
+        // Prepare single-precision copies of the integrals (only once) and of the current amplitudes.
+        const auto& f = environment.f;
+        if (environment.V_A_single.dimension() != environment.V_A.dimension()) {
+            environment.f_single = SquareMatrix<float>(f.cast<float>());
+            environment.V_A_single = SquareRankFourTensor<float>(environment.V_A.Eigen().cast<float>());
+        }
+        const auto& f_single = environment.f_single;
+        const auto& V_A_single = environment.V_A_single;
+
+        const auto& t1 = environment.t1_amplitudes.back();
+        const auto& t2 = environment.t2_amplitudes.back();
+        const auto t1_single = t1.cast<float>();
+        const auto t2_single = t2.cast<float>();
+
+        const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces are equal for the T1- and T2-amplitudes.
+
+
+        // Calculate the CCSD intermediates and the values of the T1- and T2-amplitude equations in single precision.
+        const auto tau2 = QCModel::CCSD<float>::calculateTau2(t1_single, t2_single);
+        const auto tau2_tilde = QCModel::CCSD<float>::calculateTau2Tilde(t1_single, t2_single);
+
+        const auto F1 = QCModel::CCSD<float>::calculateF1(f_single, V_A_single, t1_single, tau2_tilde);
+        const auto F2 = QCModel::CCSD<float>::calculateF2(f_single, V_A_single, t1_single, tau2_tilde);
+        const auto F3 = QCModel::CCSD<float>::calculateF3(f_single, V_A_single, t1_single);
+
+        const auto W1 = QCModel::CCSD<float>::calculateW1(V_A_single, t1_single, tau2);
+        const auto W2 = QCModel::CCSD<float>::calculateW2(V_A_single, t1_single, tau2);
+        const auto W3 = QCModel::CCSD<float>::calculateW3(V_A_single, t1_single, t2_single);
+
+        const auto f_T1 = QCModel::CCSD<float>::calculateT1AmplitudeEquations(f_single, V_A_single, t1_single, t2_single, F1, F2, F3);
+        const auto f_T2 = QCModel::CCSD<float>::calculateT2AmplitudeEquations(f_single, V_A_single, t1_single, t2_single, tau2, F1, F2, F3, W1, W2, W3);
+
+
+        // Accumulate the updates to the T1- and T2-amplitudes in double precision, in (recycled) slots of the environment.
+        environment.t1_amplitudes.push_back(t1);
+        auto& t1_updated = environment.t1_amplitudes.back();
+        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                t1_updated(i, a) += static_cast<double>(f_T1(i, a)) / (f(i, i) - f(a, a));
+            }
+        }
+
+        environment.t2_amplitudes.push_back(t2);
+        auto& t2_updated = environment.t2_amplitudes.back();
+        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
+                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
+                        t2_updated(i, j, a, b) += static_cast<double>(f_T2(i, j, a, b)) / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
+                    }
+                }
+            }
+        }
+
+
+        // Single-precision iterations can't converge the amplitudes, so switch to double precision right away if the amplitudes have changed less than the switch threshold. Since the changes level off at the single-precision round-off, the switch is also made once they stop decreasing.
+        const auto amplitudes_change = this->calculateAmplitudesChange(environment);
+        const auto has_stagnated = (environment.t1_amplitudes.size() > 2) && (environment.t2_amplitudes.size() > 2) && (amplitudes_change >= this->calculateAmplitudesChange(environment, 1));
+        if ((amplitudes_change < this->switch_threshold) || has_stagnated) {
+            this->executeInDoublePrecision(environment);
+        }
+    }
+
+
+private:
+    /*
+     *  MARK: Precision
+     */
+
+    /**
+     *  @param environment              The environment that acts as a sort of calculation space.
+     *  @param offset                   The number of updates to look back: 0 for the most recent update of the amplitudes, 1 for the one before, etc.
+     *
+     *  @return The largest of the norms of the change in the T1- and T2-amplitudes during the requested update.
+     */
+    double calculateAmplitudesChange(const Environment& environment, const size_t offset = 0) const {
+
+        const auto& t1_amplitudes = environment.t1_amplitudes;
+        const auto& t2_amplitudes = environment.t2_amplitudes;
+
+        const auto t1_change = (t1_amplitudes[t1_amplitudes.size() - 1 - offset].asImplicitMatrixSlice().asMatrix() - t1_amplitudes[t1_amplitudes.size() - 2 - offset].asImplicitMatrixSlice().asMatrix()).norm();
+        const auto t2_change = (t2_amplitudes[t2_amplitudes.size() - 1 - offset].asImplicitRankFourTensorSlice().matrixView() - t2_amplitudes[t2_amplitudes.size() - 2 - offset].asImplicitRankFourTensorSlice().matrixView()).norm();
+
+        return std::max(t1_change, t2_change);
+    }
+
+
+    /**
+     *  Calculate the new T1- and T2-amplitudes in double precision, releasing the single-precision integrals.
+     *
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void executeInDoublePrecision(Environment& environment) {
+
+        // The single-precision integrals are no longer needed.
+        environment.f_single = SquareMatrix<float>();
+        environment.V_A_single = SquareRankFourTensor<float>();
+
+        this->intermediates_update.execute(environment);
+        this->amplitudes_update.execute(environment);
+    }
+
+
+    /**
+     *  @param environment              The environment that acts as a sort of calculation space.
+     *
+     *  @return If the switch to double precision has already been made. Since every single-precision iteration prepares the single-precision integrals, they are only absent after the first iteration if they have been released by the switch.
+     */
+    bool isDoublePrecisionRequired(const Environment& environment) const {
+
+        if ((environment.t1_amplitudes.size() < 2) || (environment.t2_amplitudes.size() < 2)) {
+            return false;  // There is no previous iteration yet.
+        }
+
+        return environment.V_A_single.dimension() == 0;
+    }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,63 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCModel/CC/CCSD.hpp"
+#include "QCModel/CC/RCCSD.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  Calculate the (T) perturbative triples correction to the CCSD energy, in a general spinor basis.
+ * 
+ *  The correction is evaluated in batches of occupied triplets i<j<k: for every triplet, the connected and disconnected triples are formed as virtual-virtual-virtual blocks through matrix-matrix products, so only O(v^3) memory per thread is needed on top of the integrals and amplitudes. The triplets are distributed over the requested number of threads.
+ *
+ *  @param sq_hamiltonian           the Hamiltonian expressed in the canonical (HF) spinor basis that was used for the CCSD calculation
+ *  @param ccsd_parameters          the converged CCSD amplitudes
+ *  @param number_of_threads        the number of threads over which the occupied triplets are distributed; 0 means as many threads as are supported by the hardware
+ *  @param verbose                  if true, the progress over the occupied triplets and the total wall time are printed to the standard output
+ *
+ *  @return the (T) energy correction
+ * 
+ *  @note The diagonal elements of the inactive Fock matrix are used as the orbital energies, which is only correct for a canonical reference.
+ */
+double calculatePerturbativeTriplesCorrection(const GSQHamiltonian<double>& sq_hamiltonian, const QCModel::CCSD<double>& ccsd_parameters, const size_t number_of_threads = 0, const bool verbose = false);
+
+
+/**
+ *  Calculate the (T) perturbative triples correction to the spin-adapted closed-shell CCSD energy.
+ * 
+ *  The correction is evaluated in batches of occupied triplets i<=j<=k: for every triplet, the spin-adapted connected and disconnected triples are formed as virtual-virtual-virtual blocks through matrix-matrix products, so only O(v^3) memory per thread is needed on top of the integrals and amplitudes. The triplets are distributed over the requested number of threads.
+ *
+ *  @param sq_hamiltonian           the Hamiltonian expressed in the canonical RHF spin-orbital basis that was used for the RCCSD calculation
+ *  @param rccsd_parameters         the converged spin-adapted closed-shell CCSD amplitudes
+ *  @param number_of_threads        the number of threads over which the occupied triplets are distributed; 0 means as many threads as are supported by the hardware
+ *  @param verbose                  if true, the progress over the occupied triplets and the total wall time are printed to the standard output
+ *
+ *  @return the (T) energy correction
+ * 
+ *  @note The diagonal elements of the inactive Fock matrix are used as the orbital energies, which is only correct for a canonical reference.
+ */
+double calculatePerturbativeTriplesCorrection(const RSQHamiltonian<double>& sq_hamiltonian, const QCModel::RCCSD<double>& rccsd_parameters, const size_t number_of_threads = 0, const bool verbose = false);
+
+
+}  // namespace GQCP
@@ -0,0 +1,102 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the new spatial-orbital T1- and T2-amplitudes of a spin-adapted closed-shell CCSD calculation, using an update formula from the current amplitudes.
+ * 
+ *  @tparam _Scalar             The scalar type that is used to represent the amplitudes.
+ */
+template <typename _Scalar>
+class RCCSDAmplitudesUpdate:
+    public Step<CCSDEnvironment<_Scalar>> {
+
+public:
+    // The scalar type that is used to represent the amplitudes.
+    using Scalar = _Scalar;
+
+    // The type of environment that this iteration step can access.
+    using Environment = CCSDEnvironment<Scalar>;
+
+
+public:
+    /*
+     *  MARK: Conforming to `Step`
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the new spatial-orbital T1- and T2-amplitudes using an update formula from the current T1- and T2-amplitudes.";
+    }
+
+
+    /**
+     *  Calculate the new spatial-orbital T1- and T2-amplitudes using an update formula from the current T1- and T2-amplitudes.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        // Extract the current T1- and T2-amplitudes.
+        const auto& f = environment.f;
+        const auto& V = environment.V;
+        const auto& t1 = environment.t1_amplitudes.back();
+        const auto& t2 = environment.t2_amplitudes.back();
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume the orbital spaces are equal for the T1- and T2-amplitudes.
+
+
+        // Determine the current values for all the T1- and T2-amplitude equations at once, and use them to update the amplitudes.
+        const auto f_T1 = QCModel::RCCSD<Scalar>::calculateT1AmplitudeEquations(f, V, t1, t2);
+        const auto f_T2 = QCModel::RCCSD<Scalar>::calculateT2AmplitudeEquations(f, V, t1, t2);
+
+        // Update the amplitudes in place, in (recycled) slots of the environment, so that no copies are allocated in a steady-state iteration.
+        environment.t1_amplitudes.push_back(t1);
+        auto& t1_updated = environment.t1_amplitudes.back();
+        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                t1_updated(i, a) += f_T1(i, a) / (f(i, i) - f(a, a));
+            }
+        }
+
+        environment.t2_amplitudes.push_back(t2);
+        auto& t2_updated = environment.t2_amplitudes.back();
+        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
+                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
+                        t2_updated(i, j, a, b) += f_T2(i, j, a, b) / (f(i, i) + f(j, j) - f(a, a) - f(b, b));
+                    }
+                }
+            }
+        }
+    }
+};
+
+
+}  // namespace GQCP
@@ -0,0 +1,71 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/Step.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that calculates the current spin-adapted closed-shell CCSD electronic correlation energy.
+ * 
+ *  @tparam _Scalar             The scalar type that is used to represent the amplitudes.
+ */
+template <typename _Scalar>
+class RCCSDEnergyCalculation:
+    public Step<CCSDEnvironment<_Scalar>> {
+
+public:
+    // The scalar type that is used to represent the amplitudes.
+    using Scalar = _Scalar;
+
+    // The type of environment that this iteration step can access.
+    using Environment = CCSDEnvironment<Scalar>;
+
+
+public:
+    /*
+     *  MARK: Conforming to `Step`
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Calculate the current spin-adapted closed-shell CCSD electronic correlation energy.";
+    }
+
+
+    /**
+     *  Calculate the current spin-adapted closed-shell CCSD electronic correlation energy.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto current_correlation_energy = QCModel::RCCSD<Scalar>::calculateCorrelationEnergy(environment.f, environment.V, environment.t1_amplitudes.back(), environment.t2_amplitudes.back());
+        environment.correlation_energies.push_back(current_correlation_energy);
+    }
+};
+
+
+}  // namespace GQCP
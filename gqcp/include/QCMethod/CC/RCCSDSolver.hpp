@@ -0,0 +1,117 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Mathematical/Algorithm/CompoundConvergenceCriterion.hpp"
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
+#include "Mathematical/Algorithm/StepCollection.hpp"
+#include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/CC/RCCSDAmplitudesUpdate.hpp"
+#include "QCMethod/CC/RCCSDEnergyCalculation.hpp"
+#include "QCMethod/CC/T2DIIS.hpp"
+#include "QCMethod/CC/T2ErrorCalculation.hpp"
+
+
+namespace GQCP {
+
+
+/**
+ *  A factory class that can construct spin-adapted closed-shell CCSD solvers in an easy way.
+ * 
+ *  @tparam _Scalar             The scalar type that is used to represent the amplitudes.
+ */
+template <typename _Scalar>
+class RCCSDSolver {
+public:
+    // The scalar type that is used to represent the amplitudes.
+    using Scalar = _Scalar;
+
+
+public:
+    /*
+     *  MARK: Factory methods
+     */
+
+    /**
+     *  Create a plain spin-adapted closed-shell CCSD solver.
+     * 
+     *  @param threshold                            The threshold that is used in comparing the amplitudes.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A plain spin-adapted closed-shell CCSD solver that uses the norm of the difference of consecutive amplitudes as a convergence criterion.
+     */
+    static IterativeAlgorithm<CCSDEnvironment<Scalar>> Plain(const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a plain spin-adapted closed-shell CCSD solver.
+        StepCollection<CCSDEnvironment<Scalar>> plain_rccsd_cycle {};
+        plain_rccsd_cycle
+            .add(RCCSDAmplitudesUpdate<Scalar>())
+            .add(RCCSDEnergyCalculation<Scalar>());
+
+        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(plain_rccsd_cycle, RCCSDSolver<Scalar>::convergenceCriterion(threshold), maximum_number_of_iterations);
+    }
+
+
+    /**
+     *  Create a DIIS spin-adapted closed-shell CCSD solver, which accelerates the T2-amplitudes.
+     * 
+     *  @param minimum_subspace_dimension           The minimum number of T2 amplitudes that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of T2 amplitudes that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the amplitudes.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A DIIS spin-adapted closed-shell CCSD solver that uses the norm of the difference of consecutive amplitudes as a convergence criterion.
+     */
+    static IterativeAlgorithm<CCSDEnvironment<Scalar>> DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a DIIS spin-adapted closed-shell CCSD solver.
+        StepCollection<CCSDEnvironment<Scalar>> diis_rccsd_cycle {};
+        diis_rccsd_cycle
+            .add(RCCSDAmplitudesUpdate<Scalar>())
+            .add(T2ErrorCalculation<Scalar>())
+            .add(T2DIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension))
+            .add(RCCSDEnergyCalculation<Scalar>());
+
+        return IterativeAlgorithm<CCSDEnvironment<Scalar>>(diis_rccsd_cycle, RCCSDSolver<Scalar>::convergenceCriterion(threshold), maximum_number_of_iterations);
+    }
+
+
+private:
+    /**
+     *  @param threshold                            The threshold that is used in comparing the amplitudes.
+     * 
+     *  @return A compound convergence criterion on the norm of the difference of consecutive T1- and T2-amplitudes.
+     */
+    static CompoundConvergenceCriterion<CCSDEnvironment<Scalar>> convergenceCriterion(const double threshold) {
+
+        using T1ConvergenceType = ConsecutiveIteratesNormConvergence<T1Amplitudes<Scalar>, CCSDEnvironment<Scalar>, RingBuffer<T1Amplitudes<Scalar>>>;
+        const auto t1_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const RingBuffer<T1Amplitudes<Scalar>>& { return environment.t1_amplitudes; };
+        const T1ConvergenceType t1_convergence_criterion {threshold, t1_extractor, "the T1 amplitudes"};
+
+        using T2ConvergenceType = ConsecutiveIteratesNormConvergence<T2Amplitudes<Scalar>, CCSDEnvironment<Scalar>, RingBuffer<T2Amplitudes<Scalar>>>;
+        const auto t2_extractor = [](const CCSDEnvironment<Scalar>& environment) -> const RingBuffer<T2Amplitudes<Scalar>>& { return environment.t2_amplitudes; };
+        const T2ConvergenceType t2_convergence_criterion {threshold, t2_extractor, "the T2 amplitudes"};
+
+        return CompoundConvergenceCriterion<CCSDEnvironment<Scalar>>(t1_convergence_criterion, t2_convergence_criterion);
+    }
+};
+
+
+}  // namespace GQCP
@@ -23,8 +23,10 @@
 #include "QCMethod/CC/CCDAmplitudesUpdate.hpp"
 #include "QCMethod/CC/CCDIntermediatesUpdate.hpp"
 #include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "Utilities/RingBuffer.hpp"
 
 #include <algorithm>
+#include <functional>
 
 
 namespace GQCP {
@@ -33,6 +35,10 @@ namespace GQCP {
 /**
  *  An iteration step that accelerates the T2 amplitudes based on a DIIS accelerator.
  * 
+ *  The accelerator is stateful: in every iteration, it only calculates the overlaps of the newest T2 amplitude error vector with the previous ones. Since the environment's most recent T2 amplitudes are overwritten by the accelerated ones, the updated (non-accelerated) T2 amplitudes that belong to the error vectors are kept in a subspace of their own.
+ * 
+ *  By default, the environment's T2-amplitudes are accelerated, but any amplitudes with the same structure (like the Λ2-amplitudes) can be selected through extractor functions.
+ * 
  *  @tparam _Scalar              The scalar type used to represent the T2 amplitudes.
  */
 template <typename _Scalar>
@@ -57,6 +63,15 @@ private:
     // The DIIS accelerator.
     DIIS<Scalar> diis;
 
+    // The updated T2 amplitudes, before acceleration, that belong to the error vectors in the subspace of the accelerator.
+    RingBuffer<T2Amplitudes<Scalar>> updated_t2_amplitudes;
+
+    // A function that extracts (a reference to) the amplitudes from the environment.
+    std::function<RingBuffer<T2Amplitudes<Scalar>>&(Environment&)> amplitudes_extractor;
+
+    // A function that extracts (a reference to) the error vectors that belong to the amplitudes from the environment.
+    std::function<RingBuffer<VectorX<Scalar>>&(Environment&)> errors_extractor;
+
 
 public:
     /*
@@ -66,10 +81,19 @@ public:
     /**
      *  @param minimum_subspace_dimension       The minimum number of T2 amplitudes that have to be in the subspace before enabling DIIS.
      *  @param maximum_subspace_dimension       The maximum number of T2 amplitues that can be handled by DIIS.
+     *  @param amplitudes_extractor             A function that extracts (a reference to) the amplitudes from the environment. The default is to use the T2-amplitudes.
+     *  @param errors_extractor                 A function that extracts (a reference to) the error vectors that belong to the amplitudes from the environment. The default is to use the T2-amplitude errors.
      */
-    T2DIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6) :
+    T2DIIS(
+        const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6,
+        const std::function<RingBuffer<T2Amplitudes<Scalar>>&(Environment&)>& amplitudes_extractor = [](Environment& environment) -> RingBuffer<T2Amplitudes<Scalar>>& { return environment.t2_amplitudes; },
+        const std::function<RingBuffer<VectorX<Scalar>>&(Environment&)>& errors_extractor = [](Environment& environment) -> RingBuffer<VectorX<Scalar>>& { return environment.t2_amplitude_errors; }) :
         minimum_subspace_dimension {minimum_subspace_dimension},
-        maximum_subspace_dimension {maximum_subspace_dimension} {}
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        diis {maximum_subspace_dimension},
+        updated_t2_amplitudes {maximum_subspace_dimension},
+        amplitudes_extractor {amplitudes_extractor},
+        errors_extractor {errors_extractor} {}
 
 
     /*
@@ -91,23 +115,29 @@ public:
      */
     void execute(Environment& environment) override {
 
+        auto& amplitudes = this->amplitudes_extractor(environment);
+        const auto& errors = this->errors_extractor(environment);
+
+        // The environment only keeps a limited number of iterations, so it should be able to provide the requested subspace.
+        if (this->maximum_subspace_dimension > errors.capacity()) {
+            throw std::invalid_argument("T2DIIS::execute(Environment&): The maximum subspace dimension cannot be larger than the history depth of the environment.");
+        }
+
+        // Add the newest T2 amplitude error vector and the corresponding updated T2 amplitudes to the subspace of the accelerator.
+        this->diis.update(errors);
+        this->updated_t2_amplitudes.push_back(amplitudes.back());
+
         // Don't do anything if the minimum number of T2 amplitude iterations isn't satisfied.
-        if (environment.t2_amplitude_errors.size() < this->minimum_subspace_dimension) {
+        if (this->diis.subspaceDimension() < this->minimum_subspace_dimension) {
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error vectors.
+        // Calculate the accelerated T2 amplitudes as a combination of the updated T2 amplitudes (rather than of the environment's T2 amplitudes, which may have been accelerated themselves), and place them in the environment by overwriting the previous T2 amplitudes.
         // TODO: Include the possibility for an x-iteration 'relaxation', i.e. not doing DIIS for x iterations long.
-        const auto n = std::min(this->maximum_subspace_dimension, environment.t2_amplitude_errors.size());
-        const std::vector<VectorX<Scalar>> error_vectors {environment.t2_amplitude_errors.end() - n, environment.t2_amplitude_errors.end()};  // The n-th last error vectors.
-        const std::vector<T2Amplitudes<Scalar>> t2_amplitudes {environment.t2_amplitudes.end() - n, environment.t2_amplitudes.end()};         // The n-th last T2 amplitudes.
-
-
-        // Calculate the accelerated T2 amplitudes and place them in the environment by overwriting the previous T2 amplitudes.
-        const auto t2_amplitudes_accelerated = this->diis.accelerate(t2_amplitudes, error_vectors);
+        const auto t2_amplitudes_accelerated = this->diis.accelerate(this->updated_t2_amplitudes);
 
-        environment.t2_amplitudes.pop_back();
-        environment.t2_amplitudes.push_back(t2_amplitudes_accelerated);
+        amplitudes.pop_back();
+        amplitudes.push_back(t2_amplitudes_accelerated);
     }
 };
 
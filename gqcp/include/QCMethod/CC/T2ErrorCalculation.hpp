@@ -21,6 +21,8 @@
 #include "Mathematical/Algorithm/Step.hpp"
 #include "QCMethod/CC/CCSDEnvironment.hpp"
 
+#include <functional>
+
 
 namespace GQCP {
 
@@ -28,6 +30,8 @@ namespace GQCP {
 /**
  *  An iteration step that calculates the current T2 amplitude error.
  * 
+ *  By default, the error is calculated for the environment's T2-amplitudes, but any amplitudes with the same structure (like the Λ2-amplitudes) can be selected through extractor functions.
+ * 
  *  @tparam _Scalar              The scalar type used to represent the T2 amplitudes.
  */
 template <typename _Scalar>
@@ -42,7 +46,30 @@ public:
     using Environment = CCSDEnvironment<Scalar>;
 
 
+private:
+    // A function that extracts (a reference to) the amplitudes from the environment.
+    std::function<RingBuffer<T2Amplitudes<Scalar>>&(Environment&)> amplitudes_extractor;
+
+    // A function that extracts (a reference to) the error vectors that belong to the amplitudes from the environment.
+    std::function<RingBuffer<VectorX<Scalar>>&(Environment&)> errors_extractor;
+
+
 public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  @param amplitudes_extractor         A function that extracts (a reference to) the amplitudes from the environment. The default is to use the T2-amplitudes.
+     *  @param errors_extractor             A function that extracts (a reference to) the error vectors that belong to the amplitudes from the environment. The default is to use the T2-amplitude errors.
+     */
+    T2ErrorCalculation(
+        const std::function<RingBuffer<T2Amplitudes<Scalar>>&(Environment&)>& amplitudes_extractor = [](Environment& environment) -> RingBuffer<T2Amplitudes<Scalar>>& { return environment.t2_amplitudes; },
+        const std::function<RingBuffer<VectorX<Scalar>>&(Environment&)>& errors_extractor = [](Environment& environment) -> RingBuffer<VectorX<Scalar>>& { return environment.t2_amplitude_errors; }) :
+        amplitudes_extractor {amplitudes_extractor},
+        errors_extractor {errors_extractor} {}
+
+
     /*
      *  MARK: Conforming to `Step`
      */
@@ -63,14 +90,18 @@ public:
     void execute(Environment& environment) override {
 
         // Read the last two T2 amplitudes iterations and calculate the error as their difference.
-        const auto second_to_last_it = environment.t2_amplitudes.end() - 2;
+        const auto& amplitudes = this->amplitudes_extractor(environment);
+        const auto second_to_last_it = amplitudes.end() - 2;
         const auto& T2_previous = *second_to_last_it;  // Dereference the iterator.
 
-        const auto& T2_current = environment.t2_amplitudes.back();
+        const auto& T2_current = amplitudes.back();
+
+        // Calculate the current T2 error vector and add it to the environment (as a vector). Since the pair-wise reduced form of the amplitudes' (column-major) matrix representation is just their storage order, the difference can be assigned into the environment's recycled error vector directly, without any temporaries.
+        const auto& t2_previous = T2_previous.asImplicitRankFourTensorSlice().asTensor();
+        const auto& t2_current = T2_current.asImplicitRankFourTensorSlice().asTensor();
 
-        // Calculate the current T2 error vector and add it to the environment (as a vector).
-        const auto t2_error = T2_current - T2_previous;
-        environment.t2_amplitude_errors.push_back(t2_error.asImplicitRankFourTensorSlice().asMatrix().pairWiseReduced());
+        using ConstVectorMap = Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>;
+        this->errors_extractor(environment).assign_back(ConstVectorMap(t2_current.data(), t2_current.size()) - ConstVectorMap(t2_previous.data(), t2_previous.size()));
     }
 };
 
@@ -18,6 +18,8 @@
 #pragma once
 
 
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
+#include "Mathematical/Optimization/NonLinearEquation/NonLinearEquationEnvironment.hpp"
 #include "QCMethod/OrbitalOptimization/JacobiOrbitalOptimizer.hpp"
 #include "QCModel/Geminals/AP1roGGeminalCoefficients.hpp"
 
@@ -41,6 +43,8 @@ private:
     double E;                     // the electronic energy
     AP1roGGeminalCoefficients G;  // the current geminal coefficients
 
+    IterativeAlgorithm<NonLinearEquationEnvironment<double>> pse_solver;  // the solver that is used to re-solve the AP1roG PSEs in every iteration
+
 
 public:
     // CONSTRUCTORS
@@ -62,6 +66,25 @@ public:
      */
     AP1roGJacobiOrbitalOptimizer(const AP1roGGeminalCoefficients& G, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128);
 
+    /**
+     *  @param N_P                              the number of electron pairs
+     *  @param K                                the number of spatial orbitals
+     *  @param pse_solver                       the solver that is used to re-solve the AP1roG PSEs in every iteration, e.g. a Newton-Krylov solver for larger systems
+     *  @param convergence_threshold            the threshold used to check for convergence
+     *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
+     *
+     *  The initial guess for the geminal coefficients is zero
+     */
+    AP1roGJacobiOrbitalOptimizer(const size_t N_P, const size_t K, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128);
+
+    /**
+     *  @param G                                the initial geminal coefficients
+     *  @param pse_solver                       the solver that is used to re-solve the AP1roG PSEs in every iteration, e.g. a Newton-Krylov solver for larger systems
+     *  @param convergence_threshold            the threshold used to check for convergence
+     *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
+     */
+    AP1roGJacobiOrbitalOptimizer(const AP1roGGeminalCoefficients& G, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double convergence_threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128);
+
 
     // PUBLIC OVERRIDDEN METHODS
 
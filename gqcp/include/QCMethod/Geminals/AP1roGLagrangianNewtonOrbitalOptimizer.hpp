@@ -18,6 +18,8 @@
 #pragma once
 
 
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
+#include "Mathematical/Optimization/NonLinearEquation/NonLinearEquationEnvironment.hpp"
 #include "Mathematical/Representation/ImplicitMatrixSlice.hpp"
 #include "QCMethod/OrbitalOptimization/QCMethodNewtonOrbitalOptimizer.hpp"
 #include "QCModel/Geminals/AP1roGGeminalCoefficients.hpp"
@@ -30,8 +32,7 @@ class AP1roGLagrangianNewtonOrbitalOptimizer: public QCMethodNewtonOrbitalOptimi
 private:
     size_t N_P;  // the number of electron pairs
 
-    double pse_convergence_threshold;         // the threshold used to check for convergence on the geminal coefficients
-    size_t pse_maximum_number_of_iterations;  // maximum number of Newton steps that may be used to achieve convergence of the PSEs
+    IterativeAlgorithm<NonLinearEquationEnvironment<double>> pse_solver;  // the solver that is used to re-solve the AP1roG PSEs in every iteration
 
     double E;                                   // the electronic energy
     AP1roGGeminalCoefficients G;                // the current geminal coefficients
@@ -64,6 +65,15 @@ public:
      */
     AP1roGLagrangianNewtonOrbitalOptimizer(const AP1roGGeminalCoefficients& G, std::shared_ptr<BaseHessianModifier> hessian_modifier, const double oo_convergence_threshold = 1.0e-08, const size_t oo_maximum_number_of_iterations = 128, const double pse_convergence_threshold = 1.0e-08, const size_t pse_maximum_number_of_iterations = 128);
 
+    /**
+     *  @param G                                        the initial geminal coefficients
+     *  @param hessian_modifier                         the modifier functor that should be used when an indefinite Hessian is encountered
+     *  @param pse_solver                               the solver that is used to re-solve the AP1roG PSEs in every iteration, e.g. a Newton-Krylov solver for larger systems
+     *  @param oo_convergence_threshold                 the threshold used to check for convergence
+     *  @param oo_maximum_number_of_iterations          the maximum number of iterations that may be used to achieve convergence
+     */
+    AP1roGLagrangianNewtonOrbitalOptimizer(const AP1roGGeminalCoefficients& G, std::shared_ptr<BaseHessianModifier> hessian_modifier, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double oo_convergence_threshold = 1.0e-08, const size_t oo_maximum_number_of_iterations = 128);
+
 
     // PUBLIC OVERRIDDEN METHODS
 
@@ -43,8 +43,9 @@ NonLinearEquationEnvironment<Scalar> AP1roG(const RSQHamiltonian<Scalar>& sq_ham
     const auto initial_guess = G_initial.asVector();  // column major
     const auto f_callable = QCModel::AP1roG::callablePSECoordinateFunctions(sq_hamiltonian, N_P);
     const auto J_callable = QCModel::AP1roG::callablePSEJacobian(sq_hamiltonian, N_P);
+    const auto J_product_callable = QCModel::AP1roG::callablePSEJacobianProduct(sq_hamiltonian, N_P);  // used by matrix-free (Newton-Krylov) solvers
 
-    return GQCP::NonLinearEquationEnvironment<Scalar>(initial_guess, f_callable, J_callable);
+    return GQCP::NonLinearEquationEnvironment<Scalar>(initial_guess, f_callable, J_callable, J_product_callable);
 }
 
 
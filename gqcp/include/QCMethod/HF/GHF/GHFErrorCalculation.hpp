@@ -65,9 +65,26 @@ public:
         const auto& S = environment.S;
         const auto& F = environment.fock_matrices.back();
 
-        // Calculate the error and write it to the environment (as a vector).
-        const auto error_matrix = QCModel::GHF<Scalar>::calculateError(F, D, S);
-        environment.error_vectors.push_back(error_matrix.pairWiseStrictReduced());
+        // Calculate the error matrix FDS - SDF in scratch memory, so that no temporaries are allocated in a steady-state iteration.
+        const auto M = S.numberOfOrbitals();
+        auto intermediate = environment.arena.template matrix<Scalar>(M, M);
+        auto error_matrix = environment.arena.template matrix<Scalar>(M, M);
+
+        intermediate.noalias() = D.matrix() * S.parameters();
+        error_matrix.noalias() = F.parameters() * intermediate;
+        intermediate.noalias() = D.matrix() * F.parameters();
+        error_matrix.noalias() -= S.parameters() * intermediate;
+
+        // Write the error to the environment, as the column-major vector of its strict lower triangle.
+        auto error_vector = environment.arena.template vector<Scalar>(M * (M - 1) / 2);
+        size_t vector_index = 0;
+        for (size_t q = 0; q < M; q++) {
+            for (size_t p = q + 1; p < M; p++) {
+                error_vector(vector_index) = error_matrix(p, q);
+                vector_index++;
+            }
+        }
+        environment.error_vectors.assign_back(error_vector);
     }
 };
 
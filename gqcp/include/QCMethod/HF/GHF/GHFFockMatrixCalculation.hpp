@@ -61,10 +61,67 @@ public:
     void execute(Environment& environment) override {
 
         const auto& P = environment.density_matrices.back();  // The most recent density matrix.
+
+        if (environment.jk_builder) {
+            environment.fock_matrices.push_back(GHFFockMatrixCalculation<Scalar>::calculateDirectFockMatrix(P, environment));
+            return;
+        }
+
         const auto F = QCModel::GHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian);
 
         environment.fock_matrices.push_back(F.parameters());
     }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Calculate the GHF Fock matrix F = H_core + G using the direct and exchange matrices of the four spin-blocks of the density matrix, as provided by the environment's JK builder.
+     * 
+     *  @param P                        The (spin-blocked) GHF density matrix in the scalar bases.
+     *  @param environment              The environment that contains the JK builder.
+     * 
+     *  @return The GHF Fock matrix expressed in the scalar basis.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, ScalarGSQOneElectronOperator<double>> calculateDirectFockMatrix(const G1DM<double>& P, Environment& environment) {
+
+        const auto K = P.numberOfOrbitals() / 2;  // The number of scalar basis functions.
+        const SquareMatrix<double> P_aa = P.matrix().topLeftCorner(K, K);
+        const SquareMatrix<double> P_bb = P.matrix().bottomRightCorner(K, K);
+        const SquareMatrix<double> P_ab = P.matrix().topRightCorner(K, K);
+        const SquareMatrix<double> P_ba = P.matrix().bottomLeftCorner(K, K);
+
+        const auto JK = environment.jk_builder->updateDirectAndExchangeMatrices({P_aa, P_bb, P_ab, P_ba});
+        const auto& J_aa = JK.first[0];
+        const auto& J_bb = JK.first[1];
+        const auto& K_aa = JK.second[0];
+        const auto& K_bb = JK.second[1];
+        const auto& K_ab = JK.second[2];
+        const auto& K_ba = JK.second[3];
+
+        // Since the two-electron integrals are spin-blocked, the direct contributions only appear in the diagonal spin-blocks. The exchange contributions of the off-diagonal density spin-blocks end up in the transposed off-diagonal spin-block.
+        SquareMatrix<double> G = SquareMatrix<double>::Zero(2 * K);
+        G.topLeftCorner(K, K) = J_aa + J_bb - K_aa;
+        G.bottomRightCorner(K, K) = J_aa + J_bb - K_bb;
+        G.topRightCorner(K, K) = -K_ba;
+        G.bottomLeftCorner(K, K) = -K_ab;
+
+        return ScalarGSQOneElectronOperator<double> {environment.sq_hamiltonian.core().parameters() + G};
+    }
+
+
+    /**
+     *  @note Direct SCF is only implemented for real-valued calculations.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, complex>::value, ScalarGSQOneElectronOperator<complex>> calculateDirectFockMatrix(const G1DM<complex>& P, Environment& environment) {
+
+        throw std::invalid_argument("GHFFockMatrixCalculation::calculateDirectFockMatrix(const G1DM<complex>&, Environment&): Direct SCF is only implemented for real-valued calculations.");
+    }
 };
 
 
@@ -19,6 +19,7 @@
 
 
 #include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Accelerator/ADIIS.hpp"
 #include "Mathematical/Optimization/Accelerator/DIIS.hpp"
 #include "QCMethod/HF/GHF/GHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
@@ -31,7 +32,9 @@ namespace GQCP {
 
 
 /**
- *  An iteration step that accelerates the Fock matrix (expressed in the scalar/AO basis) based on a DIIS accelerator.
+ *  An iteration step that accelerates the Fock matrix (expressed in the scalar/AO basis) based on a DIIS accelerator, optionally blended with ADIIS in the early iterations.
+ * 
+ *  The accelerators are stateful: in every iteration, they only calculate the overlaps that involve the newest iterate in the environment.
  * 
  *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
  */
@@ -50,6 +53,9 @@ private:
 
     DIIS<Scalar> diis;  // The DIIS accelerator.
 
+    bool use_adiis;      // If the DIIS coefficients should be blended with ADIIS coefficients while the error is large.
+    ADIIS<Scalar> adiis;  // The ADIIS accelerator.
+
 
 public:
     /*
@@ -59,10 +65,14 @@ public:
     /**
      *  @param minimum_subspace_dimension       The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
      *  @param maximum_subspace_dimension       The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param use_adiis                        If the DIIS coefficients should be blended with ADIIS coefficients while the error is large.
      */
-    GHFFockMatrixDIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6) :
+    GHFFockMatrixDIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const bool use_adiis = false) :
         minimum_subspace_dimension {minimum_subspace_dimension},
-        maximum_subspace_dimension {maximum_subspace_dimension} {}
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        diis {maximum_subspace_dimension},
+        use_adiis {use_adiis},
+        adiis {maximum_subspace_dimension} {}
 
 
     /*
@@ -84,21 +94,31 @@ public:
      */
     void execute(Environment& environment) override {
 
-        if (environment.error_vectors.size() < this->minimum_subspace_dimension) {
+        // The environment only keeps a limited number of iterations, so it should be able to provide the requested subspace.
+        if (this->maximum_subspace_dimension > environment.error_vectors.capacity()) {
+            throw std::invalid_argument("GHFFockMatrixDIIS::execute(Environment&): The maximum subspace dimension cannot be larger than the history depth of the environment.");
+        }
+
+        // Add the newest iterate to the subspaces of the accelerators.
+        this->diis.update(environment.error_vectors);
+        if (this->use_adiis) {
+            const auto trace = [](const G1DM<Scalar>& P, const ScalarGSQOneElectronOperator<Scalar>& F) { return P.matrix().transpose().cwiseProduct(F.parameters()).sum(); };
+            this->adiis.update(environment.density_matrices, environment.fock_matrices, trace);
+        }
+
+        if (this->diis.subspaceDimension() < this->minimum_subspace_dimension) {
 
-            // No acceleration is possible, so calculate the regular Fock matrix and diagonalize it.
-            GHFFockMatrixCalculation<Scalar>().execute(environment);
+            // No acceleration is possible, so diagonalize the regular Fock matrix, which has already been calculated in this iteration.
             GHFFockMatrixDiagonalization<Scalar>().execute(environment);
             return;
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices.
-        const auto n = std::min(this->maximum_subspace_dimension, environment.error_vectors.size());
-        const std::vector<VectorX<Scalar>> error_vectors {environment.error_vectors.end() - n, environment.error_vectors.end()};                       // The n-th last error vectors.
-        const std::vector<ScalarGSQOneElectronOperator<Scalar>> fock_matrices {environment.fock_matrices.end() - n, environment.fock_matrices.end()};  // The n-th last Fock matrices.
-
-        // Calculate the accelerated Fock matrix and do a diagonalization step on it.
-        const auto F_accelerated = this->diis.accelerate(fock_matrices, error_vectors);
+        // Calculate the accelerated Fock matrix directly from the most recent Fock matrices in the environment, and do a diagonalization step on it.
+        auto coefficients = this->diis.coefficients();
+        if (this->use_adiis) {
+            coefficients = this->adiis.blend(coefficients, environment.error_vectors.back().cwiseAbs().maxCoeff());
+        }
+        const auto F_accelerated = DIIS<Scalar>::linearCombination(environment.fock_matrices, coefficients);
 
         environment.fock_matrices.push_back(F_accelerated);  // The diagonalization step can only read from the environment.
         GHFFockMatrixDiagonalization<Scalar>().execute(environment);
@@ -20,6 +20,7 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/HF/GHF/GHFAugmentedHessianOrbitalRotation.hpp"
 #include "QCMethod/HF/GHF/GHFDensityMatrixCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/GHF/GHFErrorCalculation.hpp"
@@ -28,6 +29,8 @@
 #include "QCMethod/HF/GHF/GHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/GHF/GHFSCFEnvironment.hpp"
 
+#include <algorithm>
+
 
 namespace GQCP {
 
@@ -65,15 +68,44 @@ public:
             .add(GHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<G1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, RingBuffer<G1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
 
         return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(plain_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
 
 
+    /**
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A DIIS GHF SCF solver whose DIIS coefficients are blended with ADIIS coefficients while the error is large, which makes the early iterations more robust. It uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<GHFSCFEnvironment<Scalar>> ADIIS(const size_t minimum_subspace_dimension = 2, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' an ADIIS-DIIS GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<Scalar>> adiis_ghf_scf_cycle {};
+        adiis_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<Scalar>())
+            .add(GHFFockMatrixCalculation<Scalar>())
+            .add(GHFErrorCalculation<Scalar>())
+            .add(GHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension, true))  // This also calculates the next coefficient matrix.
+            .add(GHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const RingBuffer<G1DM<Scalar>>&(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<G1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, RingBuffer<G1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(adiis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
      *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
@@ -94,13 +126,42 @@ public:
             .add(GHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<G1DM<Scalar>>(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const RingBuffer<G1DM<Scalar>>&(const GHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const GHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<G1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<Scalar>, GHFSCFEnvironment<Scalar>, RingBuffer<G1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
 
         return IterativeAlgorithm<GHFSCFEnvironment<Scalar>>(diis_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
+
+    /**
+     *  @param trust_radius                         The initial trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A second-order GHF SCF solver that rotates the orbitals through augmented Hessian steps in a trust region, using matrix-free orbital Hessian-vector products. It uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     * 
+     *  @note Every macro-iteration costs one Fock build, plus one Fock build for every Hessian-vector product in the micro-iterations.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, IterativeAlgorithm<GHFSCFEnvironment<double>>> SecondOrder(const double trust_radius = 0.5, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a second-order GHF SCF solver.
+        StepCollection<GHFSCFEnvironment<double>> second_order_ghf_scf_cycle {};
+        second_order_ghf_scf_cycle
+            .add(GHFDensityMatrixCalculation<double>())
+            .add(GHFFockMatrixCalculation<double>())
+            .add(GHFAugmentedHessianOrbitalRotation<double>(trust_radius, std::max(trust_radius, 1.0)))  // This calculates the next coefficient matrix.
+            .add(GHFElectronicEnergyCalculation<double>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const GHFSCFEnvironment<double>& environment) -> const RingBuffer<G1DM<double>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<G1DM<double>, GHFSCFEnvironment<double>, RingBuffer<G1DM<double>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the GHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<GHFSCFEnvironment<double>>(second_order_ghf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
@@ -0,0 +1,240 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+
+#include "Basis/Transformations/ROrbitalRotationGenerators.hpp"
+#include "Basis/Transformations/RTransformation.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Minimization/AugmentedHessianStepUpdate.hpp"
+#include "Mathematical/Optimization/Minimization/MinimizationEnvironment.hpp"
+#include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
+#include "QCModel/HF/RHF.hpp"
+
+#include <Eigen/Dense>
+
+#include <type_traits>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that rotates the current orbitals through a second-order (augmented Hessian, trust-region) step on the RHF energy, instead of diagonalizing the Fock matrix.
+ * 
+ *  The orbital rotation generators kappa(ai) between the virtual and occupied orbitals parametrize the new coefficient matrix as C' = C exp(-kappa). The orbital Hessian is never constructed: every product of the Hessian with a trial vector only requires the two-electron part of a Fock matrix for a response density, i.e. one (possibly direct) Fock build.
+ * 
+ *  Before every step, the current orbitals are canonicalized in their occupied and virtual subspaces, so that the converged orbitals diagonalize the Fock matrix. If a step raises the energy, it is rejected and a shorter step is taken from the previous orbitals.
+ * 
+ *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: only real scalars are supported.
+ */
+template <typename _Scalar>
+class RHFAugmentedHessianOrbitalRotation:
+    public Step<RHFSCFEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = RHFSCFEnvironment<Scalar>;
+    static_assert(std::is_same<Scalar, double>::value, "The second-order RHF SCF step is only implemented for real-valued calculations.");
+
+
+private:
+    Minimization::AugmentedHessianStepUpdate<double, MinimizationEnvironment<double>> augmented_hessian_step;  // The step that solves the augmented Hessian problem in the trust region.
+    double initial_trust_radius;                                                                                // The trust radius with which every run starts.
+
+    // The orbitals (and their Fock matrix and energy) from which the most recent step was taken. If that step raised the energy, a shorter step is taken from these orbitals.
+    bool has_reference;
+    double reference_energy;
+    RTransformation<double> reference_coefficient_matrix;
+    ScalarRSQOneElectronOperator<double> reference_fock_matrix;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param trust_radius                             The initial trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     *  @param maximum_trust_radius                     The trust radius is never enlarged beyond this value.
+     *  @param maximum_number_of_micro_iterations       The maximum number of Hessian-vector products (i.e. Fock builds) that may be calculated for one step.
+     */
+    RHFAugmentedHessianOrbitalRotation(const double trust_radius = 0.5, const double maximum_trust_radius = 1.0, const size_t maximum_number_of_micro_iterations = 32) :
+        augmented_hessian_step {trust_radius, maximum_trust_radius, maximum_number_of_micro_iterations},
+        initial_trust_radius {trust_radius},
+        has_reference {false},
+        reference_energy {0.0},
+        reference_coefficient_matrix {SquareMatrix<double>::Zero(0)},
+        reference_fock_matrix {SquareMatrix<double>::Zero(0)} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Rotate the current orbitals through an augmented Hessian step in a trust region. Add the associated coefficient matrix and orbital energies to the environment.";
+    }
+
+
+    /**
+     *  Rotate the current orbitals through an augmented Hessian step in a trust region. Add the associated coefficient matrix and orbital energies to the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto& H_core = environment.sq_hamiltonian.core();
+        const auto E = QCModel::RHF<double>::calculateElectronicEnergy(environment.density_matrices.back(), H_core, environment.fock_matrices.back());
+
+        // A new run starts from its first density matrix, so the reference orbitals and the trust radius of a previous run are discarded.
+        if (environment.density_matrices.size() == 1) {
+            this->has_reference = false;
+            this->augmented_hessian_step.setTrustRadius(this->initial_trust_radius);
+        }
+
+        // Take the step from the current orbitals, unless the previous step raised the energy.
+        if (!this->has_reference || this->augmented_hessian_step.updateTrustRadius(E - this->reference_energy)) {
+            this->has_reference = true;
+            this->reference_energy = E;
+            this->reference_coefficient_matrix = environment.coefficient_matrices.back();
+            this->reference_fock_matrix = environment.fock_matrices.back();
+        }
+
+        const auto& F_AO = this->reference_fock_matrix.parameters();
+        const auto K = F_AO.dimension();
+        const auto n_occ = environment.N / 2;
+        const auto n_virt = K - n_occ;
+
+
+        // Canonicalize the orbitals in their occupied and virtual subspaces, which doesn't change the density matrix.
+        const SquareMatrix<double> F_MO_noncanonical = this->reference_coefficient_matrix.matrix().adjoint() * F_AO * this->reference_coefficient_matrix.matrix();
+
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> occupied_eigensolver {F_MO_noncanonical.topLeftCorner(n_occ, n_occ)};
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> virtual_eigensolver {F_MO_noncanonical.bottomRightCorner(n_virt, n_virt)};
+
+        SquareMatrix<double> U_canonical = SquareMatrix<double>::Zero(K);
+        U_canonical.topLeftCorner(n_occ, n_occ) = occupied_eigensolver.eigenvectors();
+        U_canonical.bottomRightCorner(n_virt, n_virt) = virtual_eigensolver.eigenvectors();
+
+        VectorX<double> orbital_energies {K};
+        orbital_energies << occupied_eigensolver.eigenvalues(), virtual_eigensolver.eigenvalues();
+
+        const SquareMatrix<double> C = this->reference_coefficient_matrix.matrix() * U_canonical;
+        const SquareMatrix<double> F = C.adjoint() * F_AO * C;  // The Fock matrix in the canonical orbitals.
+
+
+        // Set up the gradient and the matrix-free Hessian of the RHF energy with respect to the rotation generators kappa(ai), with the virtual index changing fastest.
+        const MatrixX<double> F_vo = F.block(n_occ, 0, n_virt, n_occ);
+        const VectorX<double> gradient = -4 * Eigen::Map<const Eigen::VectorXd>(F_vo.data(), F_vo.size());
+
+        const auto gradient_function = [&gradient](const VectorX<double>& x) { return gradient; };
+
+        const auto hessian_vector_product_function = [&C, &F, &environment, n_occ, n_virt](const VectorX<double>& x, const VectorX<double>& v) {
+            const Eigen::Map<const Eigen::MatrixXd> kappa {v.data(), static_cast<Eigen::Index>(n_virt), static_cast<Eigen::Index>(n_occ)};
+            const auto C_occupied = C.leftCols(n_occ);
+            const auto C_virtual = C.rightCols(n_virt);
+
+            // The first-order change of the density matrix is D_kappa = 2 (C_v kappa C_o^T + C_o kappa^T C_v^T).
+            const SquareMatrix<double> D_virtual_occupied = C_virtual * kappa * C_occupied.transpose();
+            const SquareMatrix<double> D_kappa = 2 * (D_virtual_occupied + D_virtual_occupied.transpose());
+            const auto G = RHFAugmentedHessianOrbitalRotation<double>::calculateTwoElectronFockMatrix(D_kappa, environment);
+
+            // sigma(ai) = 4 (sum_b F(ab) kappa(bi) - sum_j kappa(aj) F(ji) + G(ai)), in which G is expressed in the orbital basis.
+            MatrixX<double> sigma = F.block(n_occ, n_occ, n_virt, n_virt) * kappa - kappa * F.block(0, 0, n_occ, n_occ);
+            sigma += C_virtual.transpose() * G * C_occupied;
+            sigma *= 4;
+
+            return VectorX<double> {Eigen::Map<const Eigen::VectorXd>(sigma.data(), sigma.size())};
+        };
+
+        const auto hessian_diagonal_function = [&orbital_energies, n_occ, n_virt](const VectorX<double>& x) {
+            VectorX<double> diagonal {n_virt * n_occ};
+            for (size_t i = 0; i < n_occ; i++) {
+                for (size_t a = 0; a < n_virt; a++) {
+                    diagonal(i * n_virt + a) = 4 * (orbital_energies(n_occ + a) - orbital_energies(i));
+                }
+            }
+            return diagonal;
+        };
+
+
+        // Find the augmented Hessian step and rotate the canonical orbitals with it: C' = C exp(-kappa).
+        MinimizationEnvironment<double> minimization_environment {VectorX<double>::Zero(n_virt * n_occ), gradient_function, hessian_vector_product_function, hessian_diagonal_function};
+        this->augmented_hessian_step.execute(minimization_environment);
+        const auto& x = minimization_environment.variables.back();
+
+        SquareMatrix<double> kappa = SquareMatrix<double>::Zero(K);
+        kappa.block(n_occ, 0, n_virt, n_occ) = Eigen::Map<const Eigen::MatrixXd>(x.data(), n_virt, n_occ);
+        kappa.block(0, n_occ, n_occ, n_virt) = -kappa.block(n_occ, 0, n_virt, n_occ).transpose();
+
+        const RTransformation<double> U {ROrbitalRotationGenerators<double>(kappa)};
+
+        environment.coefficient_matrices.push_back(RTransformation<double> {C * U.matrix()});
+        environment.orbital_energies.push_back(orbital_energies);
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  @return The number of Hessian-vector products (i.e. Fock builds) that were calculated for the most recent step.
+     */
+    size_t numberOfHessianVectorProducts() const { return this->augmented_hessian_step.numberOfHessianVectorProducts(); }
+
+    /**
+     *  @return The current trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     */
+    double trustRadius() const { return this->augmented_hessian_step.trustRadius(); }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Calculate the two-electron part G = J - 0.5 K of the RHF Fock matrix for a (response) density matrix.
+     * 
+     *  @param D                        A density matrix, expressed in the scalar basis.
+     *  @param environment              The environment that contains the Hamiltonian or the JK builder.
+     * 
+     *  @return The two-electron part of the Fock matrix, expressed in the scalar basis.
+     * 
+     *  @note The JK builder is not updated, since the response densities are not part of the SCF iteration history.
+     */
+    static SquareMatrix<double> calculateTwoElectronFockMatrix(const SquareMatrix<double>& D, const Environment& environment) {
+
+        if (environment.jk_builder) {
+            const auto JK = environment.jk_builder->calculateDirectAndExchangeMatrices({D});
+            return JK.first[0] - 0.5 * JK.second[0];
+        }
+
+        const auto F = QCModel::RHF<double>::calculateScalarBasisFockMatrix(Orbital1DM<double> {D}, environment.sq_hamiltonian);
+        return F.parameters() - environment.sq_hamiltonian.core().parameters();
+    }
+};
+
+
+}  // namespace GQCP
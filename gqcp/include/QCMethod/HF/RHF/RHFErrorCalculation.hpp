@@ -65,9 +65,18 @@ public:
         const auto& S = environment.S;
         const auto& F = environment.fock_matrices.back();
 
-        // Calculate the error and write it to the environment (as a vector).
-        const auto error_matrix = QCModel::RHF<Scalar>::calculateError(F, D, S);
-        environment.error_vectors.push_back(error_matrix.pairWiseReduced());
+        // Calculate the error matrix FDS - SDF in scratch memory, so that no temporaries are allocated in a steady-state iteration.
+        const auto K = S.numberOfOrbitals();
+        auto intermediate = environment.arena.template matrix<Scalar>(K, K);
+        auto error_matrix = environment.arena.template matrix<Scalar>(K, K);
+
+        intermediate.noalias() = D.matrix() * S.parameters();
+        error_matrix.noalias() = F.parameters() * intermediate;
+        intermediate.noalias() = D.matrix() * F.parameters();
+        error_matrix.noalias() -= S.parameters() * intermediate;
+
+        // Write the error to the environment, as a column-major vector.
+        environment.error_vectors.assign_back(IterationArena::VectorMap<Scalar>(error_matrix.data(), error_matrix.size()));
     }
 };
 
@@ -60,9 +60,49 @@ public:
      */
     void execute(Environment& environment) override {
         const auto& D = environment.density_matrices.back();  // The most recent density matrix.
+
+        if (environment.jk_builder) {
+            environment.fock_matrices.push_back(RHFFockMatrixCalculation<Scalar>::calculateDirectFockMatrix(D, environment));
+            return;
+        }
+
         const auto F = QCModel::RHF<Scalar>::calculateScalarBasisFockMatrix(D, environment.sq_hamiltonian);
         environment.fock_matrices.push_back(F.parameters());
     }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Calculate the RHF Fock matrix F = H_core + J - 0.5 K using the direct and exchange matrices of the environment's JK builder.
+     * 
+     *  @param D                        The RHF density matrix in the scalar basis.
+     *  @param environment              The environment that contains the JK builder.
+     * 
+     *  @return The RHF Fock matrix expressed in the scalar basis.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, ScalarRSQOneElectronOperator<double>> calculateDirectFockMatrix(const Orbital1DM<double>& D, Environment& environment) {
+
+        const auto JK = environment.jk_builder->updateDirectAndExchangeMatrices({D.matrix()});
+        const auto& J = JK.first[0];
+        const auto& K = JK.second[0];
+
+        return ScalarRSQOneElectronOperator<double> {environment.sq_hamiltonian.core().parameters() + J - 0.5 * K};
+    }
+
+
+    /**
+     *  @note Direct SCF is only implemented for real-valued calculations.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, complex>::value, ScalarRSQOneElectronOperator<complex>> calculateDirectFockMatrix(const Orbital1DM<complex>& D, Environment& environment) {
+
+        throw std::invalid_argument("RHFFockMatrixCalculation::calculateDirectFockMatrix(const Orbital1DM<complex>&, Environment&): Direct SCF is only implemented for real-valued calculations.");
+    }
 };
 
 
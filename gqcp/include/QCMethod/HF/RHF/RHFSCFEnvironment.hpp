@@ -18,17 +18,21 @@
 #pragma once
 
 
+#include "Basis/Integrals/BaseJKBuilder.hpp"
 #include "Basis/Transformations/RTransformation.hpp"
 #include "DensityMatrix/Orbital1DM.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "Utilities/aliases.hpp"
+#include "Utilities/IterationArena.hpp"
+#include "Utilities/RingBuffer.hpp"
 #include "Utilities/complex.hpp"
 
 #include <Eigen/Dense>
 
 #include <deque>
+#include <memory>
 
 
 namespace GQCP {
@@ -48,21 +52,28 @@ public:
 
 
 public:
+    // The default maximum number of iterates that are kept, which is sufficient for the default DIIS subspace dimension and for checking convergence.
+    static constexpr size_t DefaultHistoryDepth = 8;
+
     size_t N;  // The total number of electrons.
 
     std::deque<Scalar> electronic_energies;
 
-    std::deque<VectorX<Scalar>> orbital_energies;
+    RingBuffer<VectorX<Scalar>> orbital_energies {DefaultHistoryDepth};
 
     ScalarRSQOneElectronOperator<Scalar> S;  // The overlap matrix (of the scalar (AO) basis).
 
-    std::deque<RTransformation<Scalar>> coefficient_matrices;
-    std::deque<Orbital1DM<Scalar>> density_matrices;                 // Expressed in the scalar (AO) basis.
-    std::deque<ScalarRSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
-    std::deque<VectorX<Scalar>> error_vectors;                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    RingBuffer<RTransformation<Scalar>> coefficient_matrices {DefaultHistoryDepth};
+    RingBuffer<Orbital1DM<Scalar>> density_matrices {DefaultHistoryDepth};                 // Expressed in the scalar (AO) basis.
+    RingBuffer<ScalarRSQOneElectronOperator<Scalar>> fock_matrices {DefaultHistoryDepth};  // Expressed in the scalar (AO) basis.
+    RingBuffer<VectorX<Scalar>> error_vectors {DefaultHistoryDepth};                       // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
 
     RSQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis.
 
+    std::shared_ptr<BaseJKBuilder> jk_builder;  // If set, the Fock matrices are built from the direct and exchange matrices that this builder provides (e.g. through direct SCF or density fitting), instead of from the two-electron integrals in `sq_hamiltonian`.
+
+    IterationArena arena;  // Scratch memory for the intermediates of a single iteration, which is released at the start of every iteration.
+
 
 public:
     /*
@@ -80,8 +91,9 @@ public:
     RHFSCFEnvironment(const size_t N, const RSQHamiltonian<Scalar>& sq_hamiltonian, const ScalarRSQOneElectronOperator<Scalar>& S, const RTransformation<Scalar>& C_initial) :
         N {N},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {
+        sq_hamiltonian {sq_hamiltonian} {
+
+        this->coefficient_matrices.push_back(C_initial);
 
         if (this->N % 2 != 0) {  // If the total number of electrons is odd.
             throw std::invalid_argument("RHFSCFEnvironment::RHFSCFEnvironment(const size_t, const RSQHamiltonian<Scalar>&, const SquareMatrix<Scalar>&, const RTransformation<Scalar>&): You have given an odd number of electrons.");
@@ -114,6 +126,31 @@ public:
     }
 
 
+    /**
+     *  Initialize an RHF SCF environment that builds its Fock matrices through a JK builder, with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix. The four-index two-electron integrals are never stored: the direct and exchange matrices are provided by the given JK builder, e.g. by recalculating (and screening) the integrals during every Fock matrix build (direct SCF) or through density fitting.
+     * 
+     *  @param N                    The total number of electrons.
+     *  @param H_core               The core Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                    The overlap operator (of the scalar (AO) basis).
+     *  @param jk_builder           The builder that calculates the direct (Coulomb) and exchange matrices over the same scalar basis.
+     * 
+     *  @return An RHF SCF environment that builds its Fock matrices through a JK builder, with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix.
+     */
+    static RHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N, const ScalarRSQOneElectronOperator<Scalar>& H_core, const ScalarRSQOneElectronOperator<Scalar>& S, const std::shared_ptr<BaseJKBuilder>& jk_builder) {
+
+        if (jk_builder->numberOfBasisFunctions() != H_core.numberOfOrbitals()) {
+            throw std::invalid_argument("RHFSCFEnvironment::WithCoreGuess(const size_t, const ScalarRSQOneElectronOperator<Scalar>&, const ScalarRSQOneElectronOperator<Scalar>&, const std::shared_ptr<BaseJKBuilder>&): The JK builder is not compatible with the given core Hamiltonian.");
+        }
+
+        // Only store the core Hamiltonian: the two-electron contributions are handled by the JK builder.
+        const RSQHamiltonian<Scalar> sq_hamiltonian {std::vector<ScalarRSQOneElectronOperator<Scalar>> {H_core}, std::vector<ScalarRSQTwoElectronOperator<Scalar>> {}};
+
+        auto environment = RHFSCFEnvironment<Scalar>::WithCoreGuess(N, sq_hamiltonian, S);
+        environment.jk_builder = jk_builder;
+        return environment;
+    }
+
+
     /**
      *  Initialize an RHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from certain elements.
      * 
@@ -170,6 +207,30 @@ public:
 
         return RHFSCFEnvironment<Scalar>(N, sq_hamiltonian, S, C_initial_complex);
     }
+
+
+    /*
+     *  HISTORY
+     */
+
+    /**
+     *  @return The maximum number of iterates (coefficient matrices, density matrices, Fock matrices, error vectors and orbital energies) that this environment keeps.
+     */
+    size_t historyDepth() const { return this->density_matrices.capacity(); }
+
+    /**
+     *  Change the maximum number of iterates (coefficient matrices, density matrices, Fock matrices, error vectors and orbital energies) that this environment keeps. Only the most recent iterates are retained.
+     *
+     *  @param history_depth            The maximum number of iterates that are kept. It should be at least as large as the maximum DIIS subspace dimension.
+     */
+    void setHistoryDepth(const size_t history_depth) {
+
+        this->orbital_energies.setCapacity(history_depth);
+        this->coefficient_matrices.setCapacity(history_depth);
+        this->density_matrices.setCapacity(history_depth);
+        this->fock_matrices.setCapacity(history_depth);
+        this->error_vectors.setCapacity(history_depth);
+    }
 };
 
 
@@ -20,6 +20,7 @@
 
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/HF/RHF/RHFAugmentedHessianOrbitalRotation.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixCalculation.hpp"
 #include "QCMethod/HF/RHF/RHFDensityMatrixDamper.hpp"
 #include "QCMethod/HF/RHF/RHFElectronicEnergyCalculation.hpp"
@@ -29,6 +30,8 @@
 #include "QCMethod/HF/RHF/RHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/RHF/RHFSCFEnvironment.hpp"
 
+#include <algorithm>
+
 
 namespace GQCP {
 
@@ -68,15 +71,44 @@ public:
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<Orbital1DM<Scalar>>(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const RingBuffer<Orbital1DM<Scalar>>&(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<Orbital1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, RingBuffer<Orbital1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
 
         return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(damped_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
 
 
+    /**
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A DIIS RHF SCF solver whose DIIS coefficients are blended with ADIIS coefficients while the error is large, which makes the early iterations more robust. It uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<RHFSCFEnvironment<Scalar>> ADIIS(const size_t minimum_subspace_dimension = 2, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' an ADIIS-DIIS RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<Scalar>> adiis_rhf_scf_cycle {};
+        adiis_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<Scalar>())
+            .add(RHFFockMatrixCalculation<Scalar>())
+            .add(RHFErrorCalculation<Scalar>())
+            .add(RHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension, true))  // This also calculates the next coefficient matrix.
+            .add(RHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const RingBuffer<Orbital1DM<Scalar>>&(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<Orbital1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, RingBuffer<Orbital1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(adiis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
      *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
@@ -97,9 +129,9 @@ public:
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<Orbital1DM<Scalar>>(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const RingBuffer<Orbital1DM<Scalar>>&(const RHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<Orbital1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, RingBuffer<Orbital1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
 
         return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(diis_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
@@ -123,13 +155,43 @@ public:
             .add(RHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<Orbital1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<Scalar>, RHFSCFEnvironment<Scalar>, RingBuffer<Orbital1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
 
         return IterativeAlgorithm<RHFSCFEnvironment<Scalar>>(plain_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
+
+
+    /**
+     *  @param trust_radius                         The initial trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A second-order RHF SCF solver that rotates the orbitals through augmented Hessian steps in a trust region, using matrix-free orbital Hessian-vector products. It uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     * 
+     *  @note Every macro-iteration costs one Fock build, plus one Fock build for every Hessian-vector product in the micro-iterations.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, IterativeAlgorithm<RHFSCFEnvironment<double>>> SecondOrder(const double trust_radius = 0.5, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a second-order RHF SCF solver.
+        StepCollection<RHFSCFEnvironment<double>> second_order_rhf_scf_cycle {};
+        second_order_rhf_scf_cycle
+            .add(RHFDensityMatrixCalculation<double>())
+            .add(RHFFockMatrixCalculation<double>())
+            .add(RHFAugmentedHessianOrbitalRotation<double>(trust_radius, std::max(trust_radius, 1.0)))  // This calculates the next coefficient matrix.
+            .add(RHFElectronicEnergyCalculation<double>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const RHFSCFEnvironment<double>& environment) -> const RingBuffer<Orbital1DM<double>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<Orbital1DM<double>, RHFSCFEnvironment<double>, RingBuffer<Orbital1DM<double>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the RHF density matrix in AO basis"};
+
+        return IterativeAlgorithm<RHFSCFEnvironment<double>>(second_order_rhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
@@ -0,0 +1,300 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+
+#include "Basis/Transformations/UTransformation.hpp"
+#include "Basis/Transformations/UTransformationComponent.hpp"
+#include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Minimization/AugmentedHessianStepUpdate.hpp"
+#include "Mathematical/Optimization/Minimization/MinimizationEnvironment.hpp"
+#include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
+#include "QCModel/HF/UHF.hpp"
+
+#include <Eigen/Dense>
+
+#include <type_traits>
+
+
+namespace GQCP {
+
+
+/**
+ *  An iteration step that rotates the current alpha and beta orbitals through a second-order (augmented Hessian, trust-region) step on the UHF energy, instead of diagonalizing the Fock matrices.
+ * 
+ *  The orbital rotation generators kappa_sigma(ai) between the virtual and occupied orbitals of both spin components parametrize the new coefficient matrices as C_sigma' = C_sigma exp(-kappa_sigma). The orbital Hessian is never constructed: every product of the Hessian with a trial vector only requires the two-electron parts of the Fock matrices for a pair of alpha and beta response densities, i.e. one (possibly direct) Fock build.
+ * 
+ *  Before every step, the current orbitals are canonicalized in their occupied and virtual subspaces, so that the converged orbitals diagonalize the Fock matrices. If a step raises the energy, it is rejected and a shorter step is taken from the previous orbitals.
+ * 
+ *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: only real scalars are supported.
+ */
+template <typename _Scalar>
+class UHFAugmentedHessianOrbitalRotation:
+    public Step<UHFSCFEnvironment<_Scalar>> {
+
+public:
+    using Scalar = _Scalar;
+    using Environment = UHFSCFEnvironment<Scalar>;
+    static_assert(std::is_same<Scalar, double>::value, "The second-order UHF SCF step is only implemented for real-valued calculations.");
+
+
+private:
+    Minimization::AugmentedHessianStepUpdate<double, MinimizationEnvironment<double>> augmented_hessian_step;  // The step that solves the augmented Hessian problem in the trust region.
+    double initial_trust_radius;                                                                                // The trust radius with which every run starts.
+
+    // The orbitals (and their Fock matrices and energy) from which the most recent step was taken. If that step raised the energy, a shorter step is taken from these orbitals.
+    bool has_reference;
+    double reference_energy;
+    UTransformation<double> reference_coefficient_matrix;
+    ScalarUSQOneElectronOperator<double> reference_fock_matrix;
+
+
+public:
+    /*
+     *  CONSTRUCTORS
+     */
+
+    /**
+     *  @param trust_radius                             The initial trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     *  @param maximum_trust_radius                     The trust radius is never enlarged beyond this value.
+     *  @param maximum_number_of_micro_iterations       The maximum number of Hessian-vector products (i.e. Fock builds) that may be calculated for one step.
+     */
+    UHFAugmentedHessianOrbitalRotation(const double trust_radius = 0.5, const double maximum_trust_radius = 1.0, const size_t maximum_number_of_micro_iterations = 32) :
+        augmented_hessian_step {trust_radius, maximum_trust_radius, maximum_number_of_micro_iterations},
+        initial_trust_radius {trust_radius},
+        has_reference {false},
+        reference_energy {0.0},
+        reference_coefficient_matrix {UTransformationComponent<double> {SquareMatrix<double>::Zero(0)}, UTransformationComponent<double> {SquareMatrix<double>::Zero(0)}},
+        reference_fock_matrix {SquareMatrix<double>::Zero(0), SquareMatrix<double>::Zero(0)} {}
+
+
+    /*
+     *  PUBLIC OVERRIDDEN METHODS
+     */
+
+    /**
+     *  @return A textual description of this algorithmic step.
+     */
+    std::string description() const override {
+        return "Rotate the current alpha and beta orbitals through an augmented Hessian step in a trust region. Add the associated coefficient matrices and orbital energies to the environment.";
+    }
+
+
+    /**
+     *  Rotate the current alpha and beta orbitals through an augmented Hessian step in a trust region. Add the associated coefficient matrices and orbital energies to the environment.
+     * 
+     *  @param environment              The environment that acts as a sort of calculation space.
+     */
+    void execute(Environment& environment) override {
+
+        const auto& H_core = environment.sq_hamiltonian.core();
+        const auto E = QCModel::UHF<double>::calculateElectronicEnergy(environment.density_matrices.back(), H_core, environment.fock_matrices.back());
+
+        // A new run starts from its first density matrix, so the reference orbitals and the trust radius of a previous run are discarded.
+        if (environment.density_matrices.size() == 1) {
+            this->has_reference = false;
+            this->augmented_hessian_step.setTrustRadius(this->initial_trust_radius);
+        }
+
+        // Take the step from the current orbitals, unless the previous step raised the energy.
+        if (!this->has_reference || this->augmented_hessian_step.updateTrustRadius(E - this->reference_energy)) {
+            this->has_reference = true;
+            this->reference_energy = E;
+            this->reference_coefficient_matrix = environment.coefficient_matrices.back();
+            this->reference_fock_matrix = environment.fock_matrices.back();
+        }
+
+        const auto& F_AO_a = this->reference_fock_matrix.alpha().parameters();
+        const auto& F_AO_b = this->reference_fock_matrix.beta().parameters();
+        const auto K_a = F_AO_a.dimension();
+        const auto K_b = F_AO_b.dimension();
+        const auto n_occ_a = environment.N.alpha();
+        const auto n_occ_b = environment.N.beta();
+        const auto n_virt_a = K_a - n_occ_a;
+        const auto n_virt_b = K_b - n_occ_b;
+        const auto dimension_a = n_virt_a * n_occ_a;
+        const auto dimension_b = n_virt_b * n_occ_b;
+
+
+        // Canonicalize the orbitals of both spin components in their occupied and virtual subspaces, which doesn't change the density matrices.
+        VectorX<double> orbital_energies_a {K_a};
+        VectorX<double> orbital_energies_b {K_b};
+        const SquareMatrix<double> C_a = UHFAugmentedHessianOrbitalRotation<double>::canonicalize(this->reference_coefficient_matrix.alpha().matrix(), F_AO_a, n_occ_a, orbital_energies_a);
+        const SquareMatrix<double> C_b = UHFAugmentedHessianOrbitalRotation<double>::canonicalize(this->reference_coefficient_matrix.beta().matrix(), F_AO_b, n_occ_b, orbital_energies_b);
+
+        const SquareMatrix<double> F_a = C_a.adjoint() * F_AO_a * C_a;  // The alpha Fock matrix in the canonical alpha orbitals.
+        const SquareMatrix<double> F_b = C_b.adjoint() * F_AO_b * C_b;  // The beta Fock matrix in the canonical beta orbitals.
+
+
+        // Set up the gradient and the matrix-free Hessian of the UHF energy with respect to the rotation generators (kappa_alpha(ai), kappa_beta(ai)), with the virtual index changing fastest.
+        VectorX<double> gradient {dimension_a + dimension_b};
+        const MatrixX<double> F_vo_a = F_a.block(n_occ_a, 0, n_virt_a, n_occ_a);
+        const MatrixX<double> F_vo_b = F_b.block(n_occ_b, 0, n_virt_b, n_occ_b);
+        gradient << -2 * Eigen::Map<const Eigen::VectorXd>(F_vo_a.data(), dimension_a), -2 * Eigen::Map<const Eigen::VectorXd>(F_vo_b.data(), dimension_b);
+
+        const auto gradient_function = [&gradient](const VectorX<double>& x) { return gradient; };
+
+        const auto hessian_vector_product_function = [&](const VectorX<double>& x, const VectorX<double>& v) {
+            const Eigen::Map<const Eigen::MatrixXd> kappa_a {v.data(), static_cast<Eigen::Index>(n_virt_a), static_cast<Eigen::Index>(n_occ_a)};
+            const Eigen::Map<const Eigen::MatrixXd> kappa_b {v.data() + dimension_a, static_cast<Eigen::Index>(n_virt_b), static_cast<Eigen::Index>(n_occ_b)};
+
+            // The first-order changes of the density matrices are D_kappa_sigma = C_v kappa_sigma C_o^T + C_o kappa_sigma^T C_v^T.
+            const SquareMatrix<double> D_virtual_occupied_a = C_a.rightCols(n_virt_a) * kappa_a * C_a.leftCols(n_occ_a).transpose();
+            const SquareMatrix<double> D_virtual_occupied_b = C_b.rightCols(n_virt_b) * kappa_b * C_b.leftCols(n_occ_b).transpose();
+            const SquareMatrix<double> D_kappa_a = D_virtual_occupied_a + D_virtual_occupied_a.transpose();
+            const SquareMatrix<double> D_kappa_b = D_virtual_occupied_b + D_virtual_occupied_b.transpose();
+            const auto G = UHFAugmentedHessianOrbitalRotation<double>::calculateTwoElectronFockMatrices(D_kappa_a, D_kappa_b, environment);
+
+            // sigma_sigma(ai) = 2 (sum_b F_sigma(ab) kappa_sigma(bi) - sum_j kappa_sigma(aj) F_sigma(ji) + G_sigma(ai)), in which G_sigma is expressed in the orbital basis.
+            MatrixX<double> sigma_a = F_a.block(n_occ_a, n_occ_a, n_virt_a, n_virt_a) * kappa_a - kappa_a * F_a.block(0, 0, n_occ_a, n_occ_a) + C_a.rightCols(n_virt_a).transpose() * G.first * C_a.leftCols(n_occ_a);
+            MatrixX<double> sigma_b = F_b.block(n_occ_b, n_occ_b, n_virt_b, n_virt_b) * kappa_b - kappa_b * F_b.block(0, 0, n_occ_b, n_occ_b) + C_b.rightCols(n_virt_b).transpose() * G.second * C_b.leftCols(n_occ_b);
+
+            VectorX<double> sigma {dimension_a + dimension_b};
+            sigma << 2 * Eigen::Map<const Eigen::VectorXd>(sigma_a.data(), dimension_a), 2 * Eigen::Map<const Eigen::VectorXd>(sigma_b.data(), dimension_b);
+            return sigma;
+        };
+
+        const auto hessian_diagonal_function = [&](const VectorX<double>& x) {
+            VectorX<double> diagonal {dimension_a + dimension_b};
+            for (size_t i = 0; i < n_occ_a; i++) {
+                for (size_t a = 0; a < n_virt_a; a++) {
+                    diagonal(i * n_virt_a + a) = 2 * (orbital_energies_a(n_occ_a + a) - orbital_energies_a(i));
+                }
+            }
+            for (size_t i = 0; i < n_occ_b; i++) {
+                for (size_t a = 0; a < n_virt_b; a++) {
+                    diagonal(dimension_a + i * n_virt_b + a) = 2 * (orbital_energies_b(n_occ_b + a) - orbital_energies_b(i));
+                }
+            }
+            return diagonal;
+        };
+
+
+        // Find the augmented Hessian step and rotate the canonical orbitals with it: C_sigma' = C_sigma exp(-kappa_sigma).
+        MinimizationEnvironment<double> minimization_environment {VectorX<double>::Zero(dimension_a + dimension_b), gradient_function, hessian_vector_product_function, hessian_diagonal_function};
+        this->augmented_hessian_step.execute(minimization_environment);
+        const auto& x = minimization_environment.variables.back();
+
+        const auto U_a = UHFAugmentedHessianOrbitalRotation<double>::calculateRotation(Eigen::Map<const Eigen::MatrixXd>(x.data(), n_virt_a, n_occ_a), n_occ_a);
+        const auto U_b = UHFAugmentedHessianOrbitalRotation<double>::calculateRotation(Eigen::Map<const Eigen::MatrixXd>(x.data() + dimension_a, n_virt_b, n_occ_b), n_occ_b);
+
+        environment.coefficient_matrices.push_back(UTransformation<double> {UTransformationComponent<double> {C_a * U_a}, UTransformationComponent<double> {C_b * U_b}});
+        environment.orbital_energies.push_back(SpinResolved<VectorX<double>> {orbital_energies_a, orbital_energies_b});
+    }
+
+
+    /*
+     *  PUBLIC METHODS
+     */
+
+    /**
+     *  @return The number of Hessian-vector products (i.e. Fock builds) that were calculated for the most recent step.
+     */
+    size_t numberOfHessianVectorProducts() const { return this->augmented_hessian_step.numberOfHessianVectorProducts(); }
+
+    /**
+     *  @return The current trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     */
+    double trustRadius() const { return this->augmented_hessian_step.trustRadius(); }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Calculate the unitary matrix exp(-kappa) that belongs to the virtual-occupied rotation generators of one spin component.
+     * 
+     *  @param kappa_vo                 The rotation generators kappa(ai), as a (virtual x occupied) matrix.
+     *  @param n_occ                    The number of occupied orbitals of the spin component.
+     * 
+     *  @return The unitary matrix exp(-kappa).
+     */
+    static SquareMatrix<double> calculateRotation(const MatrixX<double>& kappa_vo, const size_t n_occ) {
+
+        const auto n_virt = static_cast<size_t>(kappa_vo.rows());
+
+        SquareMatrix<double> kappa = SquareMatrix<double>::Zero(n_occ + n_virt);
+        kappa.block(n_occ, 0, n_virt, n_occ) = kappa_vo;
+        kappa.block(0, n_occ, n_occ, n_virt) = -kappa_vo.transpose();
+
+        return UTransformationComponent<double> {UOrbitalRotationGeneratorsComponent<double>(kappa)}.matrix();
+    }
+
+
+    /**
+     *  Rotate the orbitals of one spin component among themselves, such that they diagonalize the occupied-occupied and virtual-virtual blocks of the Fock matrix.
+     * 
+     *  @param C                        The coefficient matrix of the spin component.
+     *  @param F_AO                     The Fock matrix of the spin component, expressed in the scalar basis.
+     *  @param n_occ                    The number of occupied orbitals of the spin component.
+     *  @param orbital_energies         The diagonal elements of the Fock matrix in the canonical orbitals (output).
+     * 
+     *  @return The coefficient matrix of the canonical orbitals.
+     */
+    static SquareMatrix<double> canonicalize(const SquareMatrix<double>& C, const SquareMatrix<double>& F_AO, const size_t n_occ, VectorX<double>& orbital_energies) {
+
+        const auto K = C.cols();
+        const auto n_virt = K - n_occ;
+        const SquareMatrix<double> F = C.adjoint() * F_AO * C;
+
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> occupied_eigensolver {F.topLeftCorner(n_occ, n_occ)};
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> virtual_eigensolver {F.bottomRightCorner(n_virt, n_virt)};
+
+        SquareMatrix<double> U = SquareMatrix<double>::Zero(K);
+        U.topLeftCorner(n_occ, n_occ) = occupied_eigensolver.eigenvectors();
+        U.bottomRightCorner(n_virt, n_virt) = virtual_eigensolver.eigenvectors();
+
+        orbital_energies = VectorX<double> {K};
+        orbital_energies << occupied_eigensolver.eigenvalues(), virtual_eigensolver.eigenvalues();
+
+        return C * U;
+    }
+
+
+    /**
+     *  Calculate the two-electron parts G_sigma = (J_alpha + J_beta) - K_sigma of the UHF Fock matrices for a pair of (response) density matrices.
+     * 
+     *  @param D_a                      An alpha density matrix, expressed in the scalar basis.
+     *  @param D_b                      A beta density matrix, expressed in the scalar basis.
+     *  @param environment              The environment that contains the Hamiltonian or the JK builder.
+     * 
+     *  @return The two-electron parts of the alpha and beta Fock matrices, expressed in the scalar basis.
+     * 
+     *  @note The JK builder is not updated, since the response densities are not part of the SCF iteration history.
+     */
+    static std::pair<SquareMatrix<double>, SquareMatrix<double>> calculateTwoElectronFockMatrices(const SquareMatrix<double>& D_a, const SquareMatrix<double>& D_b, const Environment& environment) {
+
+        if (environment.jk_builder) {
+            const auto JK = environment.jk_builder->calculateDirectAndExchangeMatrices({D_a, D_b});
+            const SquareMatrix<double> J = JK.first[0] + JK.first[1];
+            return {J - JK.second[0], J - JK.second[1]};
+        }
+
+        const SpinResolved1DM<double> D {SpinResolved1DMComponent<double> {D_a}, SpinResolved1DMComponent<double> {D_b}};
+        const auto F = QCModel::UHF<double>::calculateScalarBasisFockMatrix(D, environment.sq_hamiltonian);
+        const auto& H_core = environment.sq_hamiltonian.core();
+
+        return {F.alpha().parameters() - H_core.alpha().parameters(), F.beta().parameters() - H_core.beta().parameters()};
+    }
+};
+
+
+}  // namespace GQCP
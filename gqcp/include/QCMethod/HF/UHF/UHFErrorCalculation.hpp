@@ -67,14 +67,43 @@ public:
 
         const auto& D = environment.density_matrices.back();
 
-        // Calculate the errors and write them to the environment (as a vector).
-        const auto error_matrices = QCModel::UHF<Scalar>::calculateError(F, D, S);
-
-        // Transform the error matrices to error vectors.
-        const auto error_vectors = SpinResolved<VectorX<Scalar>> {error_matrices.alpha().pairWiseReduced(), error_matrices.beta().pairWiseReduced()};
+        // Calculate the error matrices FDS - SDF for both spin components in scratch memory, and transform them to column-major error vectors.
+        const auto error_vector_alpha = UHFErrorCalculation<Scalar>::calculateErrorVector(F.alpha().parameters(), D.alpha().matrix(), S.alpha().parameters(), environment.arena);
+        const auto error_vector_beta = UHFErrorCalculation<Scalar>::calculateErrorVector(F.beta().parameters(), D.beta().matrix(), S.beta().parameters(), environment.arena);
+        const auto error_vectors = SpinResolved<VectorX<Scalar>> {error_vector_alpha, error_vector_beta};
 
         environment.error_vectors.push_back(error_vectors);
     }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Calculate the error matrix FDS - SDF of one spin component in scratch memory.
+     *
+     *  @param F                        The Fock matrix of one spin component, expressed in the scalar (AO) basis.
+     *  @param D                        The density matrix of the same spin component, expressed in the scalar (AO) basis.
+     *  @param S                        The overlap matrix of the same spin component.
+     *  @param arena                    The arena that provides the scratch memory.
+     *
+     *  @return A column-major vector of the error matrix, which lives in the arena's scratch memory.
+     */
+    static IterationArena::VectorMap<Scalar> calculateErrorVector(const SquareMatrix<Scalar>& F, const SquareMatrix<Scalar>& D, const SquareMatrix<Scalar>& S, IterationArena& arena) {
+
+        const auto K = S.dimension();
+        auto intermediate = arena.template matrix<Scalar>(K, K);
+        auto error_matrix = arena.template matrix<Scalar>(K, K);
+
+        intermediate.noalias() = D * S;
+        error_matrix.noalias() = F * intermediate;
+        intermediate.noalias() = D * F;
+        error_matrix.noalias() -= S * intermediate;
+
+        return IterationArena::VectorMap<Scalar>(error_matrix.data(), error_matrix.size());
+    }
 };
 
 
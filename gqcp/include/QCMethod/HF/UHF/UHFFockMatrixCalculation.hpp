@@ -62,10 +62,54 @@ public:
 
         const auto& P = environment.density_matrices.back();  // The most recent alpha and beta density matrix.
 
+        if (environment.jk_builder) {
+            environment.fock_matrices.push_back(UHFFockMatrixCalculation<Scalar>::calculateDirectFockMatrix(P, environment));
+            return;
+        }
+
         const auto F = QCModel::UHF<Scalar>::calculateScalarBasisFockMatrix(P, environment.sq_hamiltonian);
 
         environment.fock_matrices.push_back(F);
     }
+
+
+private:
+    /*
+     *  PRIVATE METHODS
+     */
+
+    /**
+     *  Calculate the UHF Fock matrices F_sigma = H_core + (J_alpha + J_beta) - K_sigma using the direct and exchange matrices of the environment's JK builder.
+     * 
+     *  @param P                        The UHF density matrices in the scalar basis.
+     *  @param environment              The environment that contains the JK builder.
+     * 
+     *  @return The UHF Fock matrices expressed in the scalar basis.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, ScalarUSQOneElectronOperator<double>> calculateDirectFockMatrix(const SpinResolved1DM<double>& P, Environment& environment) {
+
+        const auto JK = environment.jk_builder->updateDirectAndExchangeMatrices({P.alpha().matrix(), P.beta().matrix()});
+        const auto J = JK.first[0] + JK.first[1];
+        const auto& K_a = JK.second[0];
+        const auto& K_b = JK.second[1];
+
+        const auto& H_core = environment.sq_hamiltonian.core();
+        const SquareMatrix<double> F_a = H_core.alpha().parameters() + J - K_a;
+        const SquareMatrix<double> F_b = H_core.beta().parameters() + J - K_b;
+
+        return ScalarUSQOneElectronOperator<double> {F_a, F_b};
+    }
+
+
+    /**
+     *  @note Direct SCF is only implemented for real-valued calculations.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, complex>::value, ScalarUSQOneElectronOperator<complex>> calculateDirectFockMatrix(const SpinResolved1DM<complex>& P, Environment& environment) {
+
+        throw std::invalid_argument("UHFFockMatrixCalculation::calculateDirectFockMatrix(const SpinResolved1DM<complex>&, Environment&): Direct SCF is only implemented for real-valued calculations.");
+    }
 };
 
 
@@ -19,6 +19,7 @@
 
 
 #include "Mathematical/Algorithm/Step.hpp"
+#include "Mathematical/Optimization/Accelerator/ADIIS.hpp"
 #include "Mathematical/Optimization/Accelerator/DIIS.hpp"
 #include "QCMethod/HF/UHF/UHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
@@ -31,7 +32,9 @@ namespace GQCP {
 
 
 /**
- *  An iteration step that accelerates the alpha- and beta- Fock matrices (expressed in the scalar/AO basis) based on a DIIS accelerator.
+ *  An iteration step that accelerates the alpha- and beta- Fock matrices (expressed in the scalar/AO basis) based on a DIIS accelerator, optionally blended with ADIIS in the early iterations.
+ * 
+ *  The accelerators are stateful: in every iteration, they only calculate the overlaps that involve the newest iterate in the environment.
  * 
  *  @tparam _Scalar              The scalar type used to represent the expansion coefficient/elements of the transformation matrix: real or complex.
  */
@@ -48,7 +51,11 @@ private:
     size_t minimum_subspace_dimension;  // The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
     size_t maximum_subspace_dimension;  // The maximum number of Fock matrices that can be handled by DIIS.
 
-    DIIS<Scalar> diis;  // The DIIS accelerator.
+    DIIS<Scalar> alpha_diis;  // The DIIS accelerator for the alpha Fock matrices.
+    DIIS<Scalar> beta_diis;   // The DIIS accelerator for the beta Fock matrices.
+
+    bool use_adiis;      // If the DIIS coefficients should be blended with ADIIS coefficients while the error is large.
+    ADIIS<Scalar> adiis;  // The ADIIS accelerator, which treats the alpha- and beta- Fock matrices together.
 
 
 public:
@@ -59,10 +66,15 @@ public:
     /**
      *  @param minimum_subspace_dimension       The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
      *  @param maximum_subspace_dimension       The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param use_adiis                        If the DIIS coefficients should be blended with ADIIS coefficients while the error is large.
      */
-    UHFFockMatrixDIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6) :
+    UHFFockMatrixDIIS(const size_t minimum_subspace_dimension = 6, const size_t maximum_subspace_dimension = 6, const bool use_adiis = false) :
         minimum_subspace_dimension {minimum_subspace_dimension},
-        maximum_subspace_dimension {maximum_subspace_dimension} {}
+        maximum_subspace_dimension {maximum_subspace_dimension},
+        alpha_diis {maximum_subspace_dimension},
+        beta_diis {maximum_subspace_dimension},
+        use_adiis {use_adiis},
+        adiis {maximum_subspace_dimension} {}
 
 
     /*
@@ -84,39 +96,41 @@ public:
      */
     void execute(Environment& environment) override {
 
-        if (environment.error_vectors.size() < this->minimum_subspace_dimension) {  // The beta dimension will be the same.
-
-            // No acceleration is possible, so calculate the regular Fock matrices and diagonalize them.
-            UHFFockMatrixCalculation<Scalar>().execute(environment);
-            UHFFockMatrixDiagonalization<Scalar>().execute(environment);
-            return;
+        // The environment only keeps a limited number of iterations, so it should be able to provide the requested subspace.
+        if (this->maximum_subspace_dimension > environment.error_vectors.capacity()) {
+            throw std::invalid_argument("UHFFockMatrixDIIS::execute(Environment&): The maximum subspace dimension cannot be larger than the history depth of the environment.");
         }
 
-        // Convert the deques in the environment to vectors that can be accepted by the DIIS accelerator. The total number of elements we can use in DIIS is either the maximum subspace dimension or the number of available error matrices.
-        const auto n = std::min(this->maximum_subspace_dimension, environment.error_vectors.size());
-        const std::vector<SpinResolved<VectorX<Scalar>>> error_vectors {environment.error_vectors.end() - n, environment.error_vectors.end()};  // The n-th last alpha error vectors.
-
-        const std::vector<ScalarUSQOneElectronOperator<Scalar>> fock_matrices {environment.fock_matrices.end() - n, environment.fock_matrices.end()};  // The n-th last Fock matrices.
+        // Add the newest iterate to the subspaces of the accelerators.
+        this->alpha_diis.update(environment.error_vectors, [](const SpinResolved<VectorX<Scalar>>& error) -> const VectorX<Scalar>& { return error.alpha(); });
+        this->beta_diis.update(environment.error_vectors, [](const SpinResolved<VectorX<Scalar>>& error) -> const VectorX<Scalar>& { return error.beta(); });
+        if (this->use_adiis) {
+            const auto trace = [](const SpinResolved1DM<Scalar>& P, const ScalarUSQOneElectronOperator<Scalar>& F) {
+                return P.alpha().matrix().transpose().cwiseProduct(F.alpha().parameters()).sum() + P.beta().matrix().transpose().cwiseProduct(F.beta().parameters()).sum();
+            };
+            this->adiis.update(environment.density_matrices, environment.fock_matrices, trace);
+        }
 
-        std::vector<SquareMatrix<Scalar>> alpha_fock_matrices;
-        std::vector<SquareMatrix<Scalar>> beta_fock_matrices;
+        if (this->alpha_diis.subspaceDimension() < this->minimum_subspace_dimension) {  // The beta dimension will be the same.
 
-        for (size_t i = 0; i < fock_matrices.size(); i++) {
-            alpha_fock_matrices.push_back(fock_matrices[i].alpha().parameters());
-            beta_fock_matrices.push_back(fock_matrices[i].beta().parameters());
+            // No acceleration is possible, so diagonalize the regular Fock matrices, which have already been calculated in this iteration.
+            UHFFockMatrixDiagonalization<Scalar>().execute(environment);
+            return;
         }
 
-        std::vector<VectorX<Scalar>> alpha_error_vectors;
-        std::vector<VectorX<Scalar>> beta_error_vectors;
+        // Calculate the accelerated Fock matrices directly from the most recent Fock matrices in the environment, and do a diagonalization step on them.
+        auto alpha_coefficients = this->alpha_diis.coefficients();
+        auto beta_coefficients = this->beta_diis.coefficients();
+        if (this->use_adiis) {
+            const auto& error = environment.error_vectors.back();
+            const auto error_size = std::max(error.alpha().cwiseAbs().maxCoeff(), error.beta().cwiseAbs().maxCoeff());
 
-        for (size_t i = 0; i < error_vectors.size(); i++) {
-            alpha_error_vectors.push_back(error_vectors[i].alpha());
-            beta_error_vectors.push_back(error_vectors[i].beta());
+            alpha_coefficients = this->adiis.blend(alpha_coefficients, error_size);
+            beta_coefficients = this->adiis.blend(beta_coefficients, error_size);
         }
 
-        // Calculate the accelerated Fock matrices and do a diagonalization step on them.
-        const auto F_alpha_accelerated = this->diis.accelerate(alpha_fock_matrices, alpha_error_vectors);
-        const auto F_beta_accelerated = this->diis.accelerate(beta_fock_matrices, beta_error_vectors);
+        const auto F_alpha_accelerated = DIIS<Scalar>::linearCombination(environment.fock_matrices, alpha_coefficients, [](const ScalarUSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.alpha().parameters(); });
+        const auto F_beta_accelerated = DIIS<Scalar>::linearCombination(environment.fock_matrices, beta_coefficients, [](const ScalarUSQOneElectronOperator<Scalar>& F) -> const SquareMatrix<Scalar>& { return F.beta().parameters(); });
 
         const ScalarUSQOneElectronOperator<Scalar> F_accelerated {F_alpha_accelerated, F_beta_accelerated};
 
@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Integrals/BaseJKBuilder.hpp"
 #include "Basis/Transformations/UTransformation.hpp"
 #include "Basis/Transformations/UTransformationComponent.hpp"
 #include "DensityMatrix/SpinResolved1DM.hpp"
@@ -25,10 +26,13 @@
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "Operator/SecondQuantized/USQOneElectronOperator.hpp"
 #include "QCModel/HF/RHF.hpp"
+#include "Utilities/IterationArena.hpp"
+#include "Utilities/RingBuffer.hpp"
 
 #include <Eigen/Dense>
 
 #include <deque>
+#include <memory>
 
 
 namespace GQCP {
@@ -48,24 +52,31 @@ public:
 
 
 public:
+    // The default maximum number of iterates that are kept, which is sufficient for the default DIIS subspace dimension and for checking convergence.
+    static constexpr size_t DefaultHistoryDepth = 8;
+
     SpinResolved<size_t> N;  // The number of alpha and beta electrons (the number of occupied alpha-spin-orbitals).
 
     std::deque<Scalar> electronic_energies;
 
-    std::deque<SpinResolved<VectorX<Scalar>>> orbital_energies;  // The alpha and beta MO energies.
+    RingBuffer<SpinResolved<VectorX<Scalar>>> orbital_energies {DefaultHistoryDepth};  // The alpha and beta MO energies.
 
     ScalarUSQOneElectronOperator<Scalar> S;  // The overlap operator (of the scalar (AO) basis).
 
-    std::deque<UTransformation<Scalar>> coefficient_matrices;  // The alpha and beta coefficient matrices.
+    RingBuffer<UTransformation<Scalar>> coefficient_matrices {DefaultHistoryDepth};  // The alpha and beta coefficient matrices.
 
-    std::deque<SpinResolved1DM<Scalar>> density_matrices;  // Expressed in the scalar (AO) basis.
+    RingBuffer<SpinResolved1DM<Scalar>> density_matrices {DefaultHistoryDepth};  // Expressed in the scalar (AO) basis.
 
-    std::deque<ScalarUSQOneElectronOperator<Scalar>> fock_matrices;  // Expressed in the scalar (AO) basis.
+    RingBuffer<ScalarUSQOneElectronOperator<Scalar>> fock_matrices {DefaultHistoryDepth};  // Expressed in the scalar (AO) basis.
 
-    std::deque<SpinResolved<VectorX<Scalar>>> error_vectors;  // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
+    RingBuffer<SpinResolved<VectorX<Scalar>>> error_vectors {DefaultHistoryDepth};  // Expressed in the scalar (AO) basis, used when doing DIIS calculations: the real error matrices should be converted to column-major error vectors for the DIIS algorithm to be used correctly.
 
     USQHamiltonian<Scalar> sq_hamiltonian;  // The Hamiltonian expressed in the scalar (AO) basis.
 
+    std::shared_ptr<BaseJKBuilder> jk_builder;  // If set, the Fock matrices are built from the direct and exchange matrices that this builder provides (e.g. through direct SCF or density fitting), instead of from the two-electron integrals in `sq_hamiltonian`.
+
+    IterationArena arena;  // Scratch memory for the intermediates of a single iteration, which is released at the start of every iteration.
+
 
 public:
     /*
@@ -85,8 +96,10 @@ public:
     UHFSCFEnvironment(const size_t N_alpha, const size_t N_beta, const USQHamiltonian<Scalar>& sq_hamiltonian, const ScalarUSQOneElectronOperator<Scalar>& S, const UTransformation<Scalar>& C_initial) :
         N {N_alpha, N_beta},
         S {S},
-        sq_hamiltonian {sq_hamiltonian},
-        coefficient_matrices {C_initial} {}
+        sq_hamiltonian {sq_hamiltonian} {
+
+        this->coefficient_matrices.push_back(C_initial);
+    }
 
 
     /**
@@ -131,6 +144,32 @@ public:
     }
 
 
+    /**
+     *  Initialize a UHF SCF environment that builds its Fock matrices through a JK builder, with initial coefficient matrices (equal for alpha and beta) that are obtained by diagonalizing the core Hamiltonian matrix. The four-index two-electron integrals are never stored: the direct and exchange matrices are provided by the given JK builder, e.g. by recalculating (and screening) the integrals during every Fock matrix build (direct SCF) or through density fitting.
+     * 
+     *  @param N_alpha                  The number of alpha electrons (the number of occupied alpha-spin-orbitals).
+     *  @param N_beta                   The number of beta electrons (the number of occupied beta-spin-orbitals).
+     *  @param H_core                   The core Hamiltonian expressed in the scalar (AO) basis.
+     *  @param S                        The overlap matrix (of the scalar (AO) basis).
+     *  @param jk_builder               The builder that calculates the direct (Coulomb) and exchange matrices over the same scalar basis.
+     * 
+     *  @return A UHF SCF environment that builds its Fock matrices through a JK builder, with initial coefficient matrices (equal for alpha and beta) that are obtained by diagonalizing the core Hamiltonian matrix.
+     */
+    static UHFSCFEnvironment<Scalar> WithCoreGuess(const size_t N_alpha, const size_t N_beta, const ScalarUSQOneElectronOperator<Scalar>& H_core, const ScalarUSQOneElectronOperator<Scalar>& S, const std::shared_ptr<BaseJKBuilder>& jk_builder) {
+
+        if ((jk_builder->numberOfBasisFunctions() != H_core.alpha().numberOfOrbitals()) || (jk_builder->numberOfBasisFunctions() != H_core.beta().numberOfOrbitals())) {
+            throw std::invalid_argument("UHFSCFEnvironment::WithCoreGuess(const size_t, const size_t, const ScalarUSQOneElectronOperator<Scalar>&, const ScalarUSQOneElectronOperator<Scalar>&, const std::shared_ptr<BaseJKBuilder>&): The JK builder is not compatible with the given core Hamiltonian.");
+        }
+
+        // Only store the core Hamiltonian: the two-electron contributions are handled by the JK builder.
+        const USQHamiltonian<Scalar> sq_hamiltonian {std::vector<ScalarUSQOneElectronOperator<Scalar>> {H_core}, std::vector<ScalarUSQTwoElectronOperator<Scalar>> {}};
+
+        auto environment = UHFSCFEnvironment<Scalar>::WithCoreGuess(N_alpha, N_beta, sq_hamiltonian, S);
+        environment.jk_builder = jk_builder;
+        return environment;
+    }
+
+
     /**
      *  Initialize a UHF SCF environment with an initial coefficient matrix that is obtained by diagonalizing the core Hamiltonian matrix and subsequently adding/subtracting a small complex value from certain elements.
      * 
@@ -191,6 +230,30 @@ public:
 
         return UHFSCFEnvironment<Scalar>(N_alpha, N_beta, sq_hamiltonian, S, C_initial_complex);
     }
+
+
+    /*
+     *  HISTORY
+     */
+
+    /**
+     *  @return The maximum number of iterates (coefficient matrices, density matrices, Fock matrices, error vectors and orbital energies) that this environment keeps.
+     */
+    size_t historyDepth() const { return this->density_matrices.capacity(); }
+
+    /**
+     *  Change the maximum number of iterates (coefficient matrices, density matrices, Fock matrices, error vectors and orbital energies) that this environment keeps. Only the most recent iterates are retained.
+     *
+     *  @param history_depth            The maximum number of iterates that are kept. It should be at least as large as the maximum DIIS subspace dimension.
+     */
+    void setHistoryDepth(const size_t history_depth) {
+
+        this->orbital_energies.setCapacity(history_depth);
+        this->coefficient_matrices.setCapacity(history_depth);
+        this->density_matrices.setCapacity(history_depth);
+        this->fock_matrices.setCapacity(history_depth);
+        this->error_vectors.setCapacity(history_depth);
+    }
 };
 
 
@@ -21,6 +21,7 @@
 #include "Mathematical/Algorithm/CompoundConvergenceCriterion.hpp"
 #include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/ConsecutiveIteratesNormConvergence.hpp"
+#include "QCMethod/HF/UHF/UHFAugmentedHessianOrbitalRotation.hpp"
 #include "QCMethod/HF/UHF/UHFDensityMatrixCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFElectronicEnergyCalculation.hpp"
 #include "QCMethod/HF/UHF/UHFErrorCalculation.hpp"
@@ -29,6 +30,8 @@
 #include "QCMethod/HF/UHF/UHFFockMatrixDiagonalization.hpp"
 #include "QCMethod/HF/UHF/UHFSCFEnvironment.hpp"
 
+#include <algorithm>
+
 
 namespace GQCP {
 
@@ -49,6 +52,35 @@ public:
      *  PUBLIC STATIC METHODS
      */
 
+    /**
+     *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
+     *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
+     *  @param threshold                            The threshold that is used in comparing both the alpha and beta density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A DIIS UHF SCF solver whose DIIS coefficients are blended with ADIIS coefficients while the error is large, which makes the early iterations more robust. It uses the combination of norm of the difference of two consecutive alpha and beta density matrices as a convergence criterion.
+     */
+    static IterativeAlgorithm<UHFSCFEnvironment<Scalar>> ADIIS(const size_t minimum_subspace_dimension = 2, const size_t maximum_subspace_dimension = 6, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' an ADIIS-DIIS UHF SCF solver.
+        StepCollection<UHFSCFEnvironment<Scalar>> adiis_uhf_scf_cycle {};
+        adiis_uhf_scf_cycle
+            .add(UHFDensityMatrixCalculation<Scalar>())
+            .add(UHFFockMatrixCalculation<Scalar>())
+            .add(UHFErrorCalculation<Scalar>())
+            .add(UHFFockMatrixDIIS<Scalar>(minimum_subspace_dimension, maximum_subspace_dimension, true))  // This also calculates the next coefficient matrix.
+            .add(UHFElectronicEnergyCalculation<Scalar>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const std::function<const RingBuffer<SpinResolved1DM<Scalar>>&(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, RingBuffer<SpinResolved1DM<Scalar>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
+
+        return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(adiis_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
+
+
     /**
      *  @param minimum_subspace_dimension           The minimum number of Fock matrices that have to be in the subspace before enabling DIIS.
      *  @param maximum_subspace_dimension           The maximum number of Fock matrices that can be handled by DIIS.
@@ -69,9 +101,9 @@ public:
             .add(UHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<SpinResolved1DM<Scalar>>(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const RingBuffer<SpinResolved1DM<Scalar>>&(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, RingBuffer<SpinResolved1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
 
         return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(diis_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
@@ -95,13 +127,42 @@ public:
             .add(UHFElectronicEnergyCalculation<Scalar>());
 
         // Create a convergence criterion on the norm of subsequent density matrices.
-        const std::function<std::deque<SpinResolved1DM<Scalar>>(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) { return environment.density_matrices; };
+        const std::function<const RingBuffer<SpinResolved1DM<Scalar>>&(const UHFSCFEnvironment<Scalar>&)> density_matrix_extractor = [](const UHFSCFEnvironment<Scalar>& environment) -> const RingBuffer<SpinResolved1DM<Scalar>>& { return environment.density_matrices; };
 
-        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>>;
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<Scalar>, UHFSCFEnvironment<Scalar>, RingBuffer<SpinResolved1DM<Scalar>>>;
         const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
 
         return IterativeAlgorithm<UHFSCFEnvironment<Scalar>>(plain_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
     }
+
+    /**
+     *  @param trust_radius                         The initial trust radius, i.e. the maximum norm of the orbital rotation generators in one step.
+     *  @param threshold                            The threshold that is used in comparing the density matrices.
+     *  @param maximum_number_of_iterations         The maximum number of iterations the algorithm may perform.
+     * 
+     *  @return A second-order UHF SCF solver that rotates the alpha and beta orbitals through augmented Hessian steps in a trust region, using matrix-free orbital Hessian-vector products. It uses the norm of the difference of two consecutive density matrices as a convergence criterion.
+     * 
+     *  @note Every macro-iteration costs one Fock build, plus one Fock build for every Hessian-vector product in the micro-iterations.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, IterativeAlgorithm<UHFSCFEnvironment<double>>> SecondOrder(const double trust_radius = 0.5, const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128) {
+
+        // Create the iteration cycle that effectively 'defines' a second-order UHF SCF solver.
+        StepCollection<UHFSCFEnvironment<double>> second_order_uhf_scf_cycle {};
+        second_order_uhf_scf_cycle
+            .add(UHFDensityMatrixCalculation<double>())
+            .add(UHFFockMatrixCalculation<double>())
+            .add(UHFAugmentedHessianOrbitalRotation<double>(trust_radius, std::max(trust_radius, 1.0)))  // This calculates the next coefficient matrix.
+            .add(UHFElectronicEnergyCalculation<double>());
+
+        // Create a convergence criterion on the norm of subsequent density matrices.
+        const auto density_matrix_extractor = [](const UHFSCFEnvironment<double>& environment) -> const RingBuffer<SpinResolved1DM<double>>& { return environment.density_matrices; };
+
+        using ConvergenceType = ConsecutiveIteratesNormConvergence<SpinResolved1DM<double>, UHFSCFEnvironment<double>, RingBuffer<SpinResolved1DM<double>>>;
+        const ConvergenceType convergence_criterion {threshold, density_matrix_extractor, "the UHF spin resolved density matrix in AO basis"};
+
+        return IterativeAlgorithm<UHFSCFEnvironment<double>>(second_order_uhf_scf_cycle, convergence_criterion, maximum_number_of_iterations);
+    }
 };
 
 
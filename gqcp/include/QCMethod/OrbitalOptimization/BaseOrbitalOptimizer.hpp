@@ -73,6 +73,17 @@ public:
     virtual void prepareConvergenceChecking(const RSQHamiltonian<double>& sq_hamiltonian) = 0;
 
 
+    // PUBLIC VIRTUAL METHODS
+
+    /**
+     *  Rotate the Hamiltonian and the spinor basis into the next iteration. By default, they are rotated with the rotation matrix from calculateNewRotationMatrix().
+     * 
+     *  @param spinor_basis         the current spinor basis
+     *  @param sq_hamiltonian       the current Hamiltonian
+     */
+    virtual void applyNewRotation(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian);
+
+
     // PUBLIC METHODS
 
     /**
@@ -83,7 +94,7 @@ public:
     /**
      *  Optimize the Hamiltonian by subsequently
      *      - checking for convergence (see checkForConvergence())
-     *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation matrix (see calculateNewRotationMatrix())
+     *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation (see applyNewRotation())
      * 
      *  @param spinor_basis         the initial spinor basis that contains the spinors to be optimized
      *  @param sq_hamiltonian       the initial (guess for the) Hamiltonian
@@ -109,6 +109,14 @@ public:
      */
     void prepareConvergenceChecking(const RSQHamiltonian<double>& sq_hamiltonian) override;
 
+    /**
+     *  Rotate the Hamiltonian and the spinor basis into the next iteration, by applying the optimal Jacobi rotation in place. Only the orbitals p and q are mixed, so this avoids the O(K^5) transformation with the full rotation matrix.
+     * 
+     *  @param spinor_basis         the current spinor basis
+     *  @param sq_hamiltonian       the current Hamiltonian
+     */
+    void applyNewRotation(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) override;
+
 
     // PUBLIC METHODS
 
@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include "Basis/Integrals/DensityFittingFactors.hpp"
 #include "Molecule/Molecule.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/HF/RHF.hpp"
@@ -35,4 +36,26 @@ namespace GQCP {
 double calculateRMP2EnergyCorrection(const RSQHamiltonian<double>& sq_hamiltonian, const QCModel::RHF<double>& rhf_parameters);
 
 
+/**
+ *  Calculate the RMP2 energy correction from the two-electron integrals in the scalar (AO) basis. Only the (ia|jb)-block of the integrals in the RHF orbital basis is calculated, so the full set of MO integrals is never formed.
+ *
+ *  @param g_op                     the two-electron operator expressed in the scalar (AO) basis, in chemist's notation
+ *  @param rhf_parameters           the converged solution to the RHF SCF equations
+ *
+ *  @return the RMP2 energy correction
+ */
+double calculateRMP2EnergyCorrection(const ScalarRSQTwoElectronOperator<double>& g_op, const QCModel::RHF<double>& rhf_parameters);
+
+
+/**
+ *  Calculate the RMP2 energy correction from density-fitted two-electron integrals. Only the occupied-virtual block of the factors is transformed to the RHF orbital basis, so the (ia|jb) integrals are the only ones that are ever formed.
+ *
+ *  @param factors                  the density fitting factors expressed in the scalar (AO) basis
+ *  @param rhf_parameters           the converged solution to the RHF SCF equations
+ *
+ *  @return the (density-fitted) RMP2 energy correction
+ */
+double calculateRMP2EnergyCorrection(const DensityFittingFactors& factors, const QCModel::RHF<double>& rhf_parameters);
+
+
 }  // namespace GQCP
@@ -19,6 +19,7 @@
 
 
 #include "Basis/SpinorBasis/OrbitalSpace.hpp"
+#include "Mathematical/Representation/TensorContraction.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/CC/T2Amplitudes.hpp"
 
@@ -164,6 +165,68 @@ public:
     }
 
 
+    /**
+     *  Calculate the values for all the CCD T2-amplitude equations at once, evaluated at the given T2-amplitudes (and itermediates). Every term of the equations is calculated as a tensor contraction that is reduced to a matrix-matrix product.
+     *      f_{ij}^{ab} = <Phi_{ij}^{ab}| H |Phi_0>             with H the similarity-transformed normal-ordered Hamiltonian
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param V_A                          the antisymmetrized two-electron integrals (in physicist's notation)
+     *  @param t2                           the T2-amplitudes
+     *  @param F1                           the F1-intermediate (equation (3) in Stanton1991)
+     *  @param F2                           the F2-intermediate (equation (4) in Stanton1991)
+     *  @param W1                           the W1-intermediate (equation (6) in Stanton1991)
+     *  @param W2                           the W2-intermediate (equation (7) in Stanton1991)
+     *  @param W3                           the W3-intermediate (equation (8) in Stantion1991)
+     * 
+     *  @return the values for the CCD T2-amplitude equations, as an occupied-occupied-virtual-virtual object
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateT2AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2, const ImplicitMatrixSlice<Scalar>& F1, const ImplicitMatrixSlice<Scalar>& F2, const ImplicitRankFourTensorSlice<Scalar>& W1, const ImplicitRankFourTensorSlice<Scalar>& W2, const ImplicitRankFourTensorSlice<Scalar>& W3) {
+
+        const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+        const Eigen::array<int, 4> swap_ij {1, 0, 2, 3};
+        const Eigen::array<int, 4> swap_ab {0, 1, 3, 2};
+        const Eigen::array<int, 4> swap_ij_ab {1, 0, 3, 2};
+
+        // We will use equation (2) in Stanton1991 by putting the left-hand term (with the energy denominator) to the right.
+        auto result = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);  // the contribution from the first term
+
+        const VectorX<Scalar> f_occupied = orbital_space.denseSliceOf(f, occupied, occupied).diagonal();
+        const VectorX<Scalar> f_virtual = orbital_space.denseSliceOf(f, virtual_, virtual_).diagonal();
+        for (Eigen::Index b = 0; b < f_virtual.size(); b++) {
+            for (Eigen::Index a = 0; a < f_virtual.size(); a++) {
+                for (Eigen::Index j = 0; j < f_occupied.size(); j++) {
+                    for (Eigen::Index i = 0; i < f_occupied.size(); i++) {
+                        result(i, j, a, b) -= t2_dense(i, j, a, b) * (f_occupied(i) + f_occupied(j) - f_virtual(a) - f_virtual(b));  // the contribution from the left-hand side
+                    }
+                }
+            }
+        }
+
+        // Calculate the contribution from the second term.
+        const auto X = contractThroughMatrixProduct<4>(t2_dense, "ijae", asRankTwoTensor(F1.asMatrix()), "be", "ijab");
+        result.Eigen() += X.Eigen() - X.shuffle(swap_ab);  // P(ab) applied
+
+        // Calculate the contribution from the third term.
+        const auto Y = contractThroughMatrixProduct<4>(t2_dense, "imab", asRankTwoTensor(F2.asMatrix()), "mj", "ijab");
+        result.Eigen() += Y.shuffle(swap_ij) - Y.Eigen();  // P(ij) applied
+
+        // Calculate the contributions from the fourth and fifth term.
+        result.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(t2_dense, "mnab", W1.asTensor(), "mnij", "ijab").Eigen();
+        result.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(t2_dense, "ijef", W2.asTensor(), "abef", "ijab").Eigen();
+
+        // Calculate the contribution from the sixth term.
+        const auto Z = contractThroughMatrixProduct<4>(t2_dense, "imae", W3.asTensor(), "mbej", "ijab");
+        result.Eigen() += Z.Eigen() - Z.shuffle(swap_ij) - Z.shuffle(swap_ab) + Z.shuffle(swap_ij_ab);  // P(ij) P(ab) applied
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, virtual_, virtual_, result);
+    }
+
+
     /**
      *  @param f                    the (inactive) Fock matrix
      *  @param V_A                  the antisymmetrized two-electron integrals (in physicist's notation)
@@ -176,32 +239,18 @@ public:
     static ImplicitMatrixSlice<Scalar> calculateF1(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993.
-        auto F1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
-                // Calculate the contribution from the first term.
-                if (a != e) {  // (1 - delta_ae)
-                    value += f(a, e);
-                }
+        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993, where the fourth term is a contraction over the occupied-virtual blocks.
+        MatrixX<Scalar> F1 = orbital_space.denseSliceOf(f, virtual_, virtual_);
+        F1.diagonal().setZero();  // (1 - delta_ae)
 
-                // Calculate the contribution from the fourth term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value -= 0.5 * t2(m, n, a, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
+        F1 -= 0.5 * contractThroughMatrixProduct<2>(t2.asImplicitRankFourTensorSlice().asTensor(), "mnaf", V_oovv, "mnef", "ae").asMatrix();
 
-                F1(a, e) = value;
-            }
-        }
-
-        return F1;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, F1);
     }
 
 
@@ -217,32 +266,18 @@ public:
     static ImplicitMatrixSlice<Scalar> calculateF2(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for F2 in equation (4) in Stanton1991.
-        auto F2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
-                // Calculate the contribution from the first term.
-                if (m != i) {  // (1 - delta_mi)
-                    value += f(m, i);
-                }
+        // Implement the formula for F2 in equation (4) in Stanton1991, where the fourth term is a contraction over the occupied-virtual blocks.
+        MatrixX<Scalar> F2 = orbital_space.denseSliceOf(f, occupied, occupied);
+        F2.diagonal().setZero();  // (1 - delta_mi)
 
-                // Calculate the contribution from the fourth term.
-                for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += 0.5 * t2(i, n, e, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
-
-                F2(m, i) = value;
-            }
-        }
+        F2 += 0.5 * contractThroughMatrixProduct<2>(t2.asImplicitRankFourTensorSlice().asTensor(), "inef", V_oovv, "mnef", "mi").asMatrix();
 
-        return F2;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, F2);
     }
 
 
@@ -257,32 +292,16 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateW1(const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for W1 (equation 6).
-        auto W1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied-occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, n, i, j);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
-                        // Calculate the contribution from the third term.
-                        for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value += 0.25 * t2(i, j, e, f) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W1(m, n, i, j) = value;
-                    }
-                }
-            }
-        }
+        // Implement the formula for W1 (equation 6).
+        auto W1 = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, occupied);
+        W1.Eigen() += Scalar {0.25} * contractThroughMatrixProduct<4>(t2.asImplicitRankFourTensorSlice().asTensor(), "ijef", V_oovv, "mnef", "mnij").Eigen();
 
-        return W1;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, occupied, occupied, W1);
     }
 
 
@@ -297,32 +316,16 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateW2(const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
         // Implement the formula for W2 (equation 7).
-        auto W2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual-virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto f : orbital_space.indices(OccupationType::k_virtual)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(a, b, e, f);
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                                value += 0.25 * t2(m, n, a, b) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W2(a, b, e, f) = value;
-                    }
-                }
-            }
-        }
+        auto W2 = orbital_space.denseSliceOf(V_A, virtual_, virtual_, virtual_, virtual_);
+        W2.Eigen() += Scalar {0.25} * contractThroughMatrixProduct<4>(t2.asImplicitRankFourTensorSlice().asTensor(), "mnab", V_oovv, "mnef", "abef").Eigen();
 
-        return W2;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, virtual_, virtual_, W2);
     }
 
 
@@ -337,32 +340,16 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateW3(const SquareRankFourTensor<Scalar>& V_A, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
         // Implement the formula for W3 (equation 8).
-        auto W3 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied);  // zero-initialize an occupied-virtual-virtual-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, b, e, j);
-
-                        // Calculate the contribution from the fourth term.
-                        for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value -= 0.5 * t2(j, n, f, b) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W3(m, b, e, j) = value;
-                    }
-                }
-            }
-        }
+        auto W3 = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, occupied);
+        W3.Eigen() -= Scalar {0.5} * contractThroughMatrixProduct<4>(t2.asImplicitRankFourTensorSlice().asTensor(), "jnfb", V_oovv, "mnef", "mbej").Eigen();
 
-        return W3;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, virtual_, occupied, W3);
     }
 
 
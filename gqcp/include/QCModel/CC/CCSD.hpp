@@ -19,6 +19,7 @@
 
 
 #include "Basis/SpinorBasis/OrbitalSpace.hpp"
+#include "Mathematical/Representation/TensorContraction.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "QCModel/CC/T1Amplitudes.hpp"
 #include "QCModel/CC/T2Amplitudes.hpp"
@@ -275,6 +276,142 @@ public:
     }
 
 
+    /**
+     *  Calculate the values for all the CCSD T1-amplitude equations at once, evaluated at the given T1- and T2-amplitudes (and itermediates). Every term of the equations is calculated as a tensor contraction that is reduced to a matrix-matrix product.
+     *      f_i^a = <Phi_i^a| H |Phi_0>             with H the similarity-transformed normal-ordered Hamiltonian
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param V_A                          the antisymmetrized two-electron integrals (in physicist's notation)
+     *  @param t1                           the T1-amplitudes
+     *  @param t2                           the T2-amplitudes
+     *  @param F1                           the F1-intermediate (equation (3) in Stanton1991)
+     *  @param F2                           the F2-intermediate (equation (4) in Stanton1991)
+     *  @param F3                           the F3-intermediate (equation (5) in Stantion1991)
+     * 
+     *  @return the values for the CCSD T1-amplitude equations, as an occupied-virtual object
+     */
+    static ImplicitMatrixSlice<Scalar> calculateT1AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitMatrixSlice<Scalar>& F1, const ImplicitMatrixSlice<Scalar>& F2, const ImplicitMatrixSlice<Scalar>& F3) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto t1_dense = asRankTwoTensor(t1_matrix);
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+        const auto V_ovov = orbital_space.denseSliceOf(V_A, occupied, virtual_, occupied, virtual_);
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_oovo = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, occupied);
+
+        // We will use equation (1) in Stanton1991 by putting the left-hand term (with the energy denominator) to the right.
+        const VectorX<Scalar> f_occupied = orbital_space.denseSliceOf(f, occupied, occupied).diagonal();
+        const VectorX<Scalar> f_virtual = orbital_space.denseSliceOf(f, virtual_, virtual_).diagonal();
+
+        MatrixX<Scalar> result = orbital_space.denseSliceOf(f, occupied, virtual_);  // the contribution from the first term
+        for (Eigen::Index a = 0; a < f_virtual.size(); a++) {
+            for (Eigen::Index i = 0; i < f_occupied.size(); i++) {
+                result(i, a) -= t1_matrix(i, a) * (f_occupied(i) - f_virtual(a));  // the contribution from the left-hand side
+            }
+        }
+
+        // Calculate the contributions from the second and third term.
+        result += t1_matrix * F1.asMatrix().transpose();
+        result -= F2.asMatrix().transpose() * t1_matrix;
+
+        // Calculate the contributions from the fourth to the seventh term.
+        result += contractThroughMatrixProduct<2>(t2_dense, "imae", asRankTwoTensor(F3.asMatrix()), "me", "ia").asMatrix();
+        result -= contractThroughMatrixProduct<2>(t1_dense, "nf", V_ovov, "naif", "ia").asMatrix();
+        result -= 0.5 * contractThroughMatrixProduct<2>(t2_dense, "imef", V_ovvv, "maef", "ia").asMatrix();
+        result -= 0.5 * contractThroughMatrixProduct<2>(t2_dense, "mnae", V_oovo, "nmei", "ia").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, result);
+    }
+
+
+    /**
+     *  Calculate the values for all the CCSD T2-amplitude equations at once, evaluated at the given T1- and T2-amplitudes (and itermediates). Every term of the equations is calculated as a tensor contraction that is reduced to a matrix-matrix product.
+     *      f_{ij}^{ab} = <Phi_{ij}^{ab}| H |Phi_0>             with H the similarity-transformed normal-ordered Hamiltonian
+     * 
+     *  @param f                            the (inactive) Fock matrix
+     *  @param V_A                          the antisymmetrized two-electron integrals (in physicist's notation)
+     *  @param t1                           the T1-amplitudes
+     *  @param t2                           the T2-amplitudes
+     *  @param tau2                         the tau2-intermediate (equation (10) in Stanton1991)
+     *  @param F1                           the F1-intermediate (equation (3) in Stanton1991)
+     *  @param F2                           the F2-intermediate (equation (4) in Stanton1991)
+     *  @param F3                           the F3-intermediate (equation (5) in Stantion1991)
+     *  @param W1                           the W1-intermediate (equation (6) in Stanton1991)
+     *  @param W2                           the W2-intermediate (equation (7) in Stanton1991)
+     *  @param W3                           the W3-intermediate (equation (8) in Stantion1991)
+     * 
+     *  @return the values for the CCSD T2-amplitude equations, as an occupied-occupied-virtual-virtual object
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateT2AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitRankFourTensorSlice<Scalar>& tau2, const ImplicitMatrixSlice<Scalar>& F1, const ImplicitMatrixSlice<Scalar>& F2, const ImplicitMatrixSlice<Scalar>& F3, const ImplicitRankFourTensorSlice<Scalar>& W1, const ImplicitRankFourTensorSlice<Scalar>& W2, const ImplicitRankFourTensorSlice<Scalar>& W3) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto t1_dense = asRankTwoTensor(t1_matrix);
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto& tau2_dense = tau2.asTensor();
+
+        const auto V_ovvo = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, occupied);
+        const auto V_vvvo = orbital_space.denseSliceOf(V_A, virtual_, virtual_, virtual_, occupied);
+        const auto V_ovoo = orbital_space.denseSliceOf(V_A, occupied, virtual_, occupied, occupied);
+
+        const Eigen::array<int, 4> swap_ij {1, 0, 2, 3};
+        const Eigen::array<int, 4> swap_ab {0, 1, 3, 2};
+        const Eigen::array<int, 4> swap_ij_ab {1, 0, 3, 2};
+
+        // We will use equation (2) in Stanton1991 by putting the left-hand term (with the energy denominator) to the right.
+        auto result = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);  // the contribution from the first term
+
+        const VectorX<Scalar> f_occupied = orbital_space.denseSliceOf(f, occupied, occupied).diagonal();
+        const VectorX<Scalar> f_virtual = orbital_space.denseSliceOf(f, virtual_, virtual_).diagonal();
+        for (Eigen::Index b = 0; b < f_virtual.size(); b++) {
+            for (Eigen::Index a = 0; a < f_virtual.size(); a++) {
+                for (Eigen::Index j = 0; j < f_occupied.size(); j++) {
+                    for (Eigen::Index i = 0; i < f_occupied.size(); i++) {
+                        result(i, j, a, b) -= t2_dense(i, j, a, b) * (f_occupied(i) + f_occupied(j) - f_virtual(a) - f_virtual(b));  // the contribution from the left-hand side
+                    }
+                }
+            }
+        }
+
+        // Calculate the contribution from the second term, in which the F3-contribution is absorbed in a modified F1-intermediate.
+        const MatrixX<Scalar> F1_modified = F1.asMatrix() - 0.5 * t1_matrix.transpose() * F3.asMatrix();
+        const auto X = contractThroughMatrixProduct<4>(t2_dense, "ijae", asRankTwoTensor(F1_modified), "be", "ijab");
+        result.Eigen() += X.Eigen() - X.shuffle(swap_ab);  // P(ab) applied
+
+        // Calculate the contribution from the third term, in which the F3-contribution is absorbed in a modified F2-intermediate.
+        const MatrixX<Scalar> F2_modified = F2.asMatrix() + 0.5 * F3.asMatrix() * t1_matrix.transpose();
+        const auto Y = contractThroughMatrixProduct<4>(t2_dense, "imab", asRankTwoTensor(F2_modified), "mj", "ijab");
+        result.Eigen() += Y.shuffle(swap_ij) - Y.Eigen();  // P(ij) applied
+
+        // Calculate the contributions from the fourth and fifth term.
+        result.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(tau2_dense, "mnab", W1.asTensor(), "mnij", "ijab").Eigen();
+        result.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(tau2_dense, "ijef", W2.asTensor(), "abef", "ijab").Eigen();
+
+        // Calculate the contribution from the sixth term.
+        const auto t1_V = contractThroughMatrixProduct<4>(t1_dense, "ie", V_ovvo, "mbej", "imbj");
+        const Tensor<Scalar, 4> Z = contractThroughMatrixProduct<4>(t2_dense, "imae", W3.asTensor(), "mbej", "ijab").Eigen() - contractThroughMatrixProduct<4>(t1_dense, "ma", t1_V, "imbj", "ijab").Eigen();
+        result.Eigen() += Z.Eigen() - Z.shuffle(swap_ij) - Z.shuffle(swap_ab) + Z.shuffle(swap_ij_ab);  // P(ij) P(ab) applied
+
+        // Calculate the contribution from the seventh term.
+        const auto R = contractThroughMatrixProduct<4>(t1_dense, "ie", V_vvvo, "abej", "ijab");
+        result.Eigen() += R.Eigen() - R.shuffle(swap_ij);  // P(ij) applied
+
+        // Calculate the contribution from the eighth term.
+        const auto S = contractThroughMatrixProduct<4>(t1_dense, "ma", V_ovoo, "mbij", "ijab");
+        result.Eigen() += S.shuffle(swap_ab) - S.Eigen();  // P(ab) applied
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, virtual_, virtual_, result);
+    }
+
+
     /**
      *  @param f                    the (inactive) Fock matrix
      *  @param V_A                  the antisymmetrized two-electron integrals (in physicist's notation)
@@ -288,44 +425,23 @@ public:
     static ImplicitMatrixSlice<Scalar> calculateF1(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2_tilde) {
 
         const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993.
-        auto F1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                // Calculate the contribution from the first term.
-                if (a != e) {  // (1 - delta_ae)
-                    value += f(a, e);
-                }
-
-                // Calculate the contribution from the second term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    value -= 0.5 * f(m, e) * t1(m, a);
-                }
-
-                // Calculate the contribution from the third term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto f : orbital_space.indices(OccupationType::k_virtual)) {
-                        value += t1(m, f) * V_A(m, a, f, e);
-                    }
-                }
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());  // t1(i,a)
+        const MatrixX<Scalar> f_ov = orbital_space.denseSliceOf(f, occupied, virtual_);
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
-                // Calculate the contribution from the fourth term.
-                for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value -= 0.5 * tau2_tilde(m, n, a, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
+        // Implement the formula for the F1-intermediate: equation (3) in Stanton1993, where every term is a contraction over the occupied-virtual blocks.
+        MatrixX<Scalar> F1 = orbital_space.denseSliceOf(f, virtual_, virtual_);
+        F1.diagonal().setZero();  // (1 - delta_ae)
 
-                F1(a, e) = value;
-            }
-        }
+        F1 -= 0.5 * t1_dense.asMatrix().transpose() * f_ov;
+        F1 += contractThroughMatrixProduct<2>(t1_dense, "mf", V_ovvv, "mafe", "ae").asMatrix();
+        F1 -= 0.5 * contractThroughMatrixProduct<2>(tau2_tilde.asTensor(), "mnaf", V_oovv, "mnef", "ae").asMatrix();
 
-        return F1;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, F1);
     }
 
 
@@ -342,44 +458,23 @@ public:
     static ImplicitMatrixSlice<Scalar> calculateF2(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2_tilde) {
 
         const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for F2 in equation (4) in Stanton1991.
-        auto F2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                // Calculate the contribution from the first term.
-                if (m != i) {  // (1 - delta_mi)
-                    value += f(m, i);
-                }
-
-                // Calculate the contribution from the second term.
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    value += 0.5 * t1(i, e) * f(m, e);
-                }
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());  // t1(i,a)
+        const MatrixX<Scalar> f_ov = orbital_space.denseSliceOf(f, occupied, virtual_);
+        const auto V_ooov = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
-                // Calculate the contribution from the third term.
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                        value += t1(n, e) * V_A(m, n, i, e);
-                    }
-                }
+        // Implement the formula for F2 in equation (4) in Stanton1991, where every term is a contraction over the occupied-virtual blocks.
+        MatrixX<Scalar> F2 = orbital_space.denseSliceOf(f, occupied, occupied);
+        F2.diagonal().setZero();  // (1 - delta_mi)
 
-                // Calculate the contribution from the fourth term.
-                for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += 0.5 * tau2_tilde(i, n, e, f) * V_A(m, n, e, f);
-                        }
-                    }
-                }
+        F2 += 0.5 * f_ov * t1_dense.asMatrix().transpose();
+        F2 += contractThroughMatrixProduct<2>(t1_dense, "ne", V_ooov, "mnie", "mi").asMatrix();
+        F2 += 0.5 * contractThroughMatrixProduct<2>(tau2_tilde.asTensor(), "inef", V_oovv, "mnef", "mi").asMatrix();
 
-                F2(m, i) = value;
-            }
-        }
-
-        return F2;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, F2);
     }
 
 
@@ -395,28 +490,17 @@ public:
     static ImplicitMatrixSlice<Scalar> calculateF3(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1) {
 
         const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for F3 in equation (5) in Stanton1991.
-        auto F3 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual);  // zero-initialize an occupied-virtual object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                // Calculate the contribution from the first term.
-                value += f(m, e);
-
-                // Calculate the contribution from the second term.
-                for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                        value += t1(n, f) * V_A(m, n, e, f);
-                    }
-                }
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());  // t1(i,a)
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
-                F3(m, e) = value;
-            }
-        }
+        // Implement the formula for F3 in equation (5) in Stanton1991.
+        MatrixX<Scalar> F3 = orbital_space.denseSliceOf(f, occupied, virtual_);
+        F3 += contractThroughMatrixProduct<2>(t1_dense, "nf", V_oovv, "mnef", "me").asMatrix();
 
-        return F3;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, F3);
     }
 
 
@@ -431,21 +515,16 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateTau2(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces for t1 and t2 are equal
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for tau2 (equation 10).
-        auto tau2 = t2.asImplicitRankFourTensorSlice();  // the contribution from the first term
+        // Implement the formula for tau2 (equation 10), in which the products of T1-amplitudes are an outer product.
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto t1_t1 = contractThroughMatrixProduct<4>(t1_dense, "ia", t1_dense, "jb", "ijab");
 
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        tau2(i, j, a, b) += t1(i, a) * t1(j, b) - t1(i, b) * t1(j, a);
-                    }
-                }
-            }
-        }
+        const Tensor<Scalar, 4> tau2 = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + t1_t1.Eigen() - t1_t1.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});
 
-        return tau2;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, virtual_, virtual_, tau2);
     }
 
 
@@ -460,21 +539,16 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateTau2Tilde(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces for t1 and t2 are equal
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
 
-        // Implement the formula for tau2_tilde (equation 9).
-        auto tau2_tilde = t2.asImplicitRankFourTensorSlice();  // the contribution from the first term
+        // Implement the formula for tau2_tilde (equation 9), in which the products of T1-amplitudes are an outer product.
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto t1_t1 = contractThroughMatrixProduct<4>(t1_dense, "ia", t1_dense, "jb", "ijab");
 
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        tau2_tilde(i, j, a, b) += 0.5 * (t1(i, a) * t1(j, b) - t1(i, b) * t1(j, a));
-                    }
-                }
-            }
-        }
+        const Tensor<Scalar, 4> tau2_tilde = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + Scalar {0.5} * (t1_t1.Eigen() - t1_t1.shuffle(Eigen::array<int, 4> {0, 1, 3, 2}));
 
-        return tau2_tilde;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, virtual_, virtual_, tau2_tilde);
     }
 
 
@@ -490,38 +564,22 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateW1(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2) {
 
         const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_ooov = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
         // Implement the formula for W1 (equation 6).
-        auto W1 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied, OccupationType::k_occupied);  // zero-initialize an occupied-occupied-occupied-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, n, i, j);
-
-                        // Calculate the contribution from the second term.
-                        for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += t1(j, e) * V_A(m, n, i, e);
-                            value -= t1(i, e) * V_A(m, n, j, e);  // P(ij) applied
-                        }
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value += 0.25 * tau2(i, j, e, f) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W1(m, n, i, j) = value;
-                    }
-                }
-            }
-        }
+        auto W1 = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, occupied);
 
-        return W1;
+        const auto X = contractThroughMatrixProduct<4>(t1_dense, "je", V_ooov, "mnie", "mnij");
+        W1.Eigen() += X.Eigen() - X.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});  // P(ij) applied
+
+        W1.Eigen() += Scalar {0.25} * contractThroughMatrixProduct<4>(tau2.asTensor(), "ijef", V_oovv, "mnef", "mnij").Eigen();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, occupied, occupied, W1);
     }
 
 
@@ -537,38 +595,22 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateW2(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2) {
 
         const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_vovv = orbital_space.denseSliceOf(V_A, virtual_, occupied, virtual_, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
         // Implement the formula for W2 (equation 7).
-        auto W2 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_virtual);  // zero-initialize a virtual-virtual-virtual-virtual object
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto f : orbital_space.indices(OccupationType::k_virtual)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(a, b, e, f);
-
-                        // Calculate the contribution from the second term.
-                        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                            value -= t1(m, b) * V_A(a, m, e, f);
-                            value += t1(m, a) * V_A(b, m, e, f);  // P(ab) applied
-                        }
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                                value += 0.25 * tau2(m, n, a, b) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W2(a, b, e, f) = value;
-                    }
-                }
-            }
-        }
+        auto W2 = orbital_space.denseSliceOf(V_A, virtual_, virtual_, virtual_, virtual_);
+
+        const auto X = contractThroughMatrixProduct<4>(t1_dense, "mb", V_vovv, "amef", "abef");
+        W2.Eigen() += X.shuffle(Eigen::array<int, 4> {1, 0, 2, 3}) - X.Eigen();  // P(ab) applied
+
+        W2.Eigen() += Scalar {0.25} * contractThroughMatrixProduct<4>(tau2.asTensor(), "mnab", V_oovv, "mnef", "abef").Eigen();
 
-        return W2;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, virtual_, virtual_, W2);
     }
 
 
@@ -584,42 +626,24 @@ public:
     static ImplicitRankFourTensorSlice<Scalar> calculateW3(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
 
         const auto& orbital_space = t1.orbitalSpace();  // assume the orbital spaces for t1 and t2 are equal
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_oovo = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, occupied);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
 
         // Implement the formula for W3 (equation 8).
-        auto W3 = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_virtual, OccupationType::k_occupied);  // zero-initialize an occupied-virtual-virtual-occupied object
-        for (const auto& m : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& e : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                        Scalar value {0.0};  // zero-initialize the scalar value to be added
-
-                        // Calculate the contribution from the first term.
-                        value += V_A(m, b, e, j);
-
-                        // Calculate the contribution from the second term.
-                        for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                            value += t1(j, f) * V_A(m, b, e, f);
-                        }
-
-                        // Calculate the contribution from the third term.
-                        for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                            value -= t1(n, b) * V_A(m, n, e, j);
-                        }
-
-                        // Calculate the contribution from the fourth term.
-                        for (const auto& n : orbital_space.indices(OccupationType::k_occupied)) {
-                            for (const auto& f : orbital_space.indices(OccupationType::k_virtual)) {
-                                value -= (0.5 * t2(j, n, f, b) + t1(j, f) * t1(n, b)) * V_A(m, n, e, f);
-                            }
-                        }
-
-                        W3(m, b, e, j) = value;
-                    }
-                }
-            }
-        }
+        auto W3 = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, occupied);
+
+        W3.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "jf", V_ovvv, "mbef", "mbej").Eigen();
+        W3.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "nb", V_oovo, "mnej", "mbej").Eigen();
+
+        const Tensor<Scalar, 4> Z = Scalar {0.5} * t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + contractThroughMatrixProduct<4>(t1_dense, "jf", t1_dense, "nb", "jnfb").Eigen();
+        W3.Eigen() -= contractThroughMatrixProduct<4>(Z, "jnfb", V_oovv, "mnef", "mbej").Eigen();
 
-        return W3;
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, virtual_, occupied, W3);
     }
 
 
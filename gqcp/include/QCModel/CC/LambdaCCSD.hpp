@@ -0,0 +1,971 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/SpinorBasis/OrbitalSpace.hpp"
+#include "DensityMatrix/G1DM.hpp"
+#include "DensityMatrix/G2DM.hpp"
+#include "Mathematical/Representation/TensorContraction.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCModel/CC/CCSD.hpp"
+#include "QCModel/CC/T1Amplitudes.hpp"
+#include "QCModel/CC/T2Amplitudes.hpp"
+#include "Utilities/complex.hpp"
+
+#include <type_traits>
+
+
+namespace GQCP {
+namespace QCModel {
+
+
+/**
+ *  The CCSD wave function model, together with the Λ-amplitudes that make the CCSD Lagrangian
+ *      L = <Phi_0| (1 + Λ) exp(-T) H exp(T) |Phi_0>
+ *  stationary with respect to the T1- and T2-amplitudes. The Λ-amplitudes give access to the CCSD response density matrices.
+ *
+ *  The Λ1- and Λ2-amplitudes are stored as `T1Amplitudes` and `T2Amplitudes`, since they have the same (occupied-virtual) index structure: λ_i^a = l1(i,a) and λ_{ij}^{ab} = l2(i,j,a,b).
+ *  The implementation follows Gauss1995 (J. Chem. Phys. 103, 3561), Table III, and uses the notation <pq||rs> = V_A(p,q,r,s) for the antisymmetrized two-electron integrals in physicist's notation.
+ *
+ *  @tparam _Scalar             The scalar type of the amplitudes.
+ */
+template <typename _Scalar>
+class LambdaCCSD {
+public:
+    // The scalar type of the amplitudes.
+    using Scalar = _Scalar;
+
+
+private:
+    // The T1-amplitudes.
+    T1Amplitudes<Scalar> t1;
+
+    // The T2-amplitudes.
+    T2Amplitudes<Scalar> t2;
+
+    // The Λ1-amplitudes.
+    T1Amplitudes<Scalar> l1;
+
+    // The Λ2-amplitudes.
+    T2Amplitudes<Scalar> l2;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct a Λ-CCSD model from converged T- and Λ-amplitudes.
+     *
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     */
+    LambdaCCSD(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2) :
+        t1 {t1},
+        t2 {t2},
+        l1 {l1},
+        l2 {l2} {}
+
+
+    /*
+     *  MARK: Elements of the similarity-transformed Hamiltonian
+     */
+
+    /**
+     *  @param f                    The (inactive) Fock matrix.
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param F3                   The F3-intermediate (equation (5) in Stanton1991), which is the occupied-virtual block of the similarity-transformed Hamiltonian.
+     *
+     *  @return The occupied-occupied block of the similarity-transformed Hamiltonian, F_mi in Gauss1995.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateHbarOO(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitMatrixSlice<Scalar>& F3) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto V_ooov = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        // The products of T1-amplitudes that appear in Gauss1995 are absorbed in the F3-intermediate.
+        MatrixX<Scalar> H_oo = orbital_space.denseSliceOf(f, occupied, occupied);
+        H_oo += F3.asMatrix() * t1_matrix.transpose();
+        H_oo += contractThroughMatrixProduct<2>(asRankTwoTensor(t1_matrix), "ne", V_ooov, "mnie", "mi").asMatrix();
+        H_oo += 0.5 * contractThroughMatrixProduct<2>(t2.asImplicitRankFourTensorSlice().asTensor(), "inef", V_oovv, "mnef", "mi").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, H_oo);
+    }
+
+
+    /**
+     *  @param f                    The (inactive) Fock matrix.
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param F3                   The F3-intermediate (equation (5) in Stanton1991), which is the occupied-virtual block of the similarity-transformed Hamiltonian.
+     *
+     *  @return The virtual-virtual block of the similarity-transformed Hamiltonian, F_ae in Gauss1995.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateHbarVV(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitMatrixSlice<Scalar>& F3) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        // The products of T1-amplitudes that appear in Gauss1995 are absorbed in the F3-intermediate.
+        MatrixX<Scalar> H_vv = orbital_space.denseSliceOf(f, virtual_, virtual_);
+        H_vv -= t1_matrix.transpose() * F3.asMatrix();
+        H_vv += contractThroughMatrixProduct<2>(asRankTwoTensor(t1_matrix), "mf", V_ovvv, "mafe", "ae").asMatrix();
+        H_vv -= 0.5 * contractThroughMatrixProduct<2>(t2.asImplicitRankFourTensorSlice().asTensor(), "mnaf", V_oovv, "mnef", "ae").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, H_vv);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param tau2                 The tau2-intermediate (equation (10) in Stanton1991).
+     *
+     *  @return The occupied-occupied-occupied-occupied block of the similarity-transformed Hamiltonian, W_mnij in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarOOOO(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_ooov = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        auto W = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, occupied);
+
+        const auto X = contractThroughMatrixProduct<4>(t1_dense, "je", V_ooov, "mnie", "mnij");
+        W.Eigen() += X.Eigen() - X.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});  // P(ij) applied
+
+        W.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(tau2.asTensor(), "ijef", V_oovv, "mnef", "mnij").Eigen();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, occupied, occupied, W);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param tau2                 The tau2-intermediate (equation (10) in Stanton1991).
+     *
+     *  @return The virtual-virtual-virtual-virtual block of the similarity-transformed Hamiltonian, W_abef in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarVVVV(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const ImplicitRankFourTensorSlice<Scalar>& tau2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_vovv = orbital_space.denseSliceOf(V_A, virtual_, occupied, virtual_, virtual_);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        auto W = orbital_space.denseSliceOf(V_A, virtual_, virtual_, virtual_, virtual_);
+
+        const auto X = contractThroughMatrixProduct<4>(t1_dense, "mb", V_vovv, "amef", "abef");
+        W.Eigen() += X.shuffle(Eigen::array<int, 4> {1, 0, 2, 3}) - X.Eigen();  // P(ab) applied
+
+        W.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(tau2.asTensor(), "mnab", V_oovv, "mnef", "abef").Eigen();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, virtual_, virtual_, W);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *
+     *  @return The occupied-virtual-virtual-occupied block of the similarity-transformed Hamiltonian, W_mbej in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarOVVO(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_oovo = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, occupied);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        // Unlike the W3-intermediate (equation (8) in Stanton1991), the T2-amplitudes contribute with their full weight.
+        auto W = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, occupied);
+
+        W.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "jf", V_ovvv, "mbef", "mbej").Eigen();
+        W.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "nb", V_oovo, "mnej", "mbej").Eigen();
+
+        const Tensor<Scalar, 4> Z = t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + contractThroughMatrixProduct<4>(t1_dense, "jf", t1_dense, "nb", "jnfb").Eigen();
+        W.Eigen() -= contractThroughMatrixProduct<4>(Z, "jnfb", V_oovv, "mnef", "mbej").Eigen();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, virtual_, occupied, W);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *
+     *  @return The occupied-occupied-occupied-virtual block of the similarity-transformed Hamiltonian, W_mnie in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarOOOV(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        auto W = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, virtual_);
+        W.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "if", V_oovv, "mnfe", "mnie").Eigen();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, occupied, virtual_, W);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *
+     *  @return The virtual-occupied-virtual-virtual block of the similarity-transformed Hamiltonian, W_amef in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarVOVV(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        auto W = orbital_space.denseSliceOf(V_A, virtual_, occupied, virtual_, virtual_);
+        W.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "na", V_oovv, "nmef", "amef").Eigen();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, occupied, virtual_, virtual_, W);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param tau2                 The tau2-intermediate (equation (10) in Stanton1991).
+     *  @param F3                   The F3-intermediate (equation (5) in Stanton1991), which is the occupied-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_oooo               The occupied-occupied-occupied-occupied block of the similarity-transformed Hamiltonian.
+     *
+     *  @return The occupied-virtual-occupied-occupied block of the similarity-transformed Hamiltonian, W_mbij in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarOVOO(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitRankFourTensorSlice<Scalar>& tau2, const ImplicitMatrixSlice<Scalar>& F3, const ImplicitRankFourTensorSlice<Scalar>& W_oooo) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_ooov = orbital_space.denseSliceOf(V_A, occupied, occupied, occupied, virtual_);
+        const auto V_ovvo = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, occupied);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        auto W = orbital_space.denseSliceOf(V_A, occupied, virtual_, occupied, occupied);
+
+        W.Eigen() -= contractThroughMatrixProduct<4>(asRankTwoTensor(F3.asMatrix()), "me", t2_dense, "ijbe", "mbij").Eigen();
+        W.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "nb", W_oooo.asTensor(), "mnij", "mbij").Eigen();
+        W.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(V_ovvv, "mbef", tau2.asTensor(), "ijef", "mbij").Eigen();
+
+        // The terms with a P(ij) permutation are collected in one intermediate, in which the T1-amplitudes are contracted with a dressed <mb||ej>.
+        const Tensor<Scalar, 4> V_dressed = V_ovvo.Eigen() - contractThroughMatrixProduct<4>(t2_dense, "njbf", V_oovv, "mnef", "mbej").Eigen();
+        const Tensor<Scalar, 4> X = contractThroughMatrixProduct<4>(V_ooov, "mnie", t2_dense, "jnbe", "mbij").Eigen() + contractThroughMatrixProduct<4>(t1_dense, "ie", V_dressed, "mbej", "mbij").Eigen();
+        W.Eigen() += X.Eigen() - X.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});  // P(ij) applied
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, occupied, occupied, W);
+    }
+
+
+    /**
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param tau2                 The tau2-intermediate (equation (10) in Stanton1991).
+     *  @param F3                   The F3-intermediate (equation (5) in Stanton1991), which is the occupied-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_vvvv               The virtual-virtual-virtual-virtual block of the similarity-transformed Hamiltonian.
+     *
+     *  @return The virtual-virtual-virtual-occupied block of the similarity-transformed Hamiltonian, W_abei in Gauss1995.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateHbarVVVO(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const ImplicitRankFourTensorSlice<Scalar>& tau2, const ImplicitMatrixSlice<Scalar>& F3, const ImplicitRankFourTensorSlice<Scalar>& W_vvvv) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto V_oovo = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, occupied);
+        const auto V_ovvv = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, virtual_);
+        const auto V_ovvo = orbital_space.denseSliceOf(V_A, occupied, virtual_, virtual_, occupied);
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        auto W = orbital_space.denseSliceOf(V_A, virtual_, virtual_, virtual_, occupied);
+
+        W.Eigen() -= contractThroughMatrixProduct<4>(asRankTwoTensor(F3.asMatrix()), "me", t2_dense, "miab", "abei").Eigen();
+        W.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "if", W_vvvv.asTensor(), "abef", "abei").Eigen();
+        W.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(V_oovo, "mnei", tau2.asTensor(), "mnab", "abei").Eigen();
+
+        // The terms with a P(ab) permutation are collected in one intermediate, in which the T1-amplitudes are contracted with a dressed <mb||ei>.
+        const Tensor<Scalar, 4> V_dressed = V_ovvo.Eigen() - contractThroughMatrixProduct<4>(t2_dense, "nibf", V_oovv, "mnef", "mbei").Eigen();
+        const Tensor<Scalar, 4> X = contractThroughMatrixProduct<4>(V_ovvv, "mbef", t2_dense, "miaf", "abei").Eigen() + contractThroughMatrixProduct<4>(t1_dense, "ma", V_dressed, "mbei", "abei").Eigen();
+        W.Eigen() -= X.Eigen() - X.shuffle(Eigen::array<int, 4> {1, 0, 2, 3});  // P(ab) applied
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, virtual_, occupied, W);
+    }
+
+
+    /*
+     *  MARK: Λ-amplitude equations
+     */
+
+    /**
+     *  @param t2                   The T2-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *
+     *  @return The occupied-occupied three-body intermediate G_mi in Gauss1995.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateGOO(const T2Amplitudes<Scalar>& t2, const T2Amplitudes<Scalar>& l2) {
+
+        const auto& orbital_space = t2.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+
+        const MatrixX<Scalar> G = 0.5 * contractThroughMatrixProduct<2>(t2.asImplicitRankFourTensorSlice().asTensor(), "mnef", l2.asImplicitRankFourTensorSlice().asTensor(), "inef", "mi").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, G);
+    }
+
+
+    /**
+     *  @param t2                   The T2-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *
+     *  @return The virtual-virtual three-body intermediate G_ae in Gauss1995.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateGVV(const T2Amplitudes<Scalar>& t2, const T2Amplitudes<Scalar>& l2) {
+
+        const auto& orbital_space = t2.orbitalSpace();
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const MatrixX<Scalar> G = -0.5 * contractThroughMatrixProduct<2>(l2.asImplicitRankFourTensorSlice().asTensor(), "mnaf", t2.asImplicitRankFourTensorSlice().asTensor(), "mnef", "ae").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, virtual_, G);
+    }
+
+
+    /**
+     *  Calculate the values for all the Λ1-amplitude equations at once, i.e. the derivatives of the CCSD Lagrangian with respect to the T1-amplitudes. Every term of the equations is calculated as a tensor contraction that is reduced to a matrix-matrix product.
+     *
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *  @param H_ov                 The occupied-virtual block of the similarity-transformed Hamiltonian, i.e. the F3-intermediate.
+     *  @param H_oo                 The occupied-occupied block of the similarity-transformed Hamiltonian.
+     *  @param H_vv                 The virtual-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_ovvo               The occupied-virtual-virtual-occupied block of the similarity-transformed Hamiltonian.
+     *  @param W_ooov               The occupied-occupied-occupied-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_vovv               The virtual-occupied-virtual-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_ovoo               The occupied-virtual-occupied-occupied block of the similarity-transformed Hamiltonian.
+     *  @param W_vvvo               The virtual-virtual-virtual-occupied block of the similarity-transformed Hamiltonian.
+     *  @param G_oo                 The occupied-occupied three-body intermediate.
+     *  @param G_vv                 The virtual-virtual three-body intermediate.
+     *
+     *  @return The values for the Λ1-amplitude equations, as an occupied-virtual object.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateLambda1AmplitudeEquations(const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2, const ImplicitMatrixSlice<Scalar>& H_ov, const ImplicitMatrixSlice<Scalar>& H_oo, const ImplicitMatrixSlice<Scalar>& H_vv, const ImplicitRankFourTensorSlice<Scalar>& W_ovvo, const ImplicitRankFourTensorSlice<Scalar>& W_ooov, const ImplicitRankFourTensorSlice<Scalar>& W_vovv, const ImplicitRankFourTensorSlice<Scalar>& W_ovoo, const ImplicitRankFourTensorSlice<Scalar>& W_vvvo, const ImplicitMatrixSlice<Scalar>& G_oo, const ImplicitMatrixSlice<Scalar>& G_vv) {
+
+        const auto& orbital_space = l1.orbitalSpace();  // Assume l1 and l2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& l1_matrix = l1.asImplicitMatrixSlice().asMatrix();
+        const auto& l2_dense = l2.asImplicitRankFourTensorSlice().asTensor();
+
+        // Since the diagonal Fock matrix elements are included in H_oo and H_vv, the result also contains the contribution of the energy denominator.
+        MatrixX<Scalar> result = H_ov.asMatrix();
+        result += l1_matrix * H_vv.asMatrix();
+        result -= H_oo.asMatrix() * l1_matrix;
+
+        result += contractThroughMatrixProduct<2>(asRankTwoTensor(l1_matrix), "me", W_ovvo.asTensor(), "ieam", "ia").asMatrix();
+        result += 0.5 * contractThroughMatrixProduct<2>(l2_dense, "imef", W_vvvo.asTensor(), "efam", "ia").asMatrix();
+        result -= 0.5 * contractThroughMatrixProduct<2>(l2_dense, "mnae", W_ovoo.asTensor(), "iemn", "ia").asMatrix();
+
+        result -= contractThroughMatrixProduct<2>(asRankTwoTensor(G_vv.asMatrix()), "ef", W_vovv.asTensor(), "eifa", "ia").asMatrix();
+        result -= contractThroughMatrixProduct<2>(asRankTwoTensor(G_oo.asMatrix()), "mn", W_ooov.asTensor(), "mina", "ia").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, result);
+    }
+
+
+    /**
+     *  Calculate the values for all the Λ2-amplitude equations at once, i.e. the derivatives of the CCSD Lagrangian with respect to the T2-amplitudes. Every term of the equations is calculated as a tensor contraction that is reduced to a matrix-matrix product.
+     *
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *  @param H_ov                 The occupied-virtual block of the similarity-transformed Hamiltonian, i.e. the F3-intermediate.
+     *  @param H_oo                 The occupied-occupied block of the similarity-transformed Hamiltonian.
+     *  @param H_vv                 The virtual-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_oooo               The occupied-occupied-occupied-occupied block of the similarity-transformed Hamiltonian.
+     *  @param W_vvvv               The virtual-virtual-virtual-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_ovvo               The occupied-virtual-virtual-occupied block of the similarity-transformed Hamiltonian.
+     *  @param W_ooov               The occupied-occupied-occupied-virtual block of the similarity-transformed Hamiltonian.
+     *  @param W_vovv               The virtual-occupied-virtual-virtual block of the similarity-transformed Hamiltonian.
+     *  @param G_oo                 The occupied-occupied three-body intermediate.
+     *  @param G_vv                 The virtual-virtual three-body intermediate.
+     *
+     *  @return The values for the Λ2-amplitude equations, as an occupied-occupied-virtual-virtual object.
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateLambda2AmplitudeEquations(const SquareRankFourTensor<Scalar>& V_A, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2, const ImplicitMatrixSlice<Scalar>& H_ov, const ImplicitMatrixSlice<Scalar>& H_oo, const ImplicitMatrixSlice<Scalar>& H_vv, const ImplicitRankFourTensorSlice<Scalar>& W_oooo, const ImplicitRankFourTensorSlice<Scalar>& W_vvvv, const ImplicitRankFourTensorSlice<Scalar>& W_ovvo, const ImplicitRankFourTensorSlice<Scalar>& W_ooov, const ImplicitRankFourTensorSlice<Scalar>& W_vovv, const ImplicitMatrixSlice<Scalar>& G_oo, const ImplicitMatrixSlice<Scalar>& G_vv) {
+
+        const auto& orbital_space = l1.orbitalSpace();  // Assume l1 and l2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto l1_dense = asRankTwoTensor(l1.asImplicitMatrixSlice().asMatrix());
+        const auto& l2_dense = l2.asImplicitRankFourTensorSlice().asTensor();
+        const auto V_oovv = orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_);
+
+        const Eigen::array<int, 4> swap_ij {1, 0, 2, 3};
+        const Eigen::array<int, 4> swap_ab {0, 1, 3, 2};
+        const Eigen::array<int, 4> swap_ij_ab {1, 0, 3, 2};
+
+        auto result = V_oovv;
+
+        // Calculate the contributions with a P(ab) permutation. Since the diagonal Fock matrix elements are included in H_oo and H_vv, the result also contains the contribution of the energy denominator.
+        const Tensor<Scalar, 4> X = contractThroughMatrixProduct<4>(l2_dense, "ijae", asRankTwoTensor(H_vv.asMatrix()), "eb", "ijab").Eigen() - contractThroughMatrixProduct<4>(l1_dense, "ma", W_ooov.asTensor(), "ijmb", "ijab").Eigen() + contractThroughMatrixProduct<4>(V_oovv, "ijae", asRankTwoTensor(G_vv.asMatrix()), "be", "ijab").Eigen();
+        result.Eigen() += X.Eigen() - X.shuffle(swap_ab);  // P(ab) applied
+
+        // Calculate the contributions with a P(ij) permutation.
+        const Tensor<Scalar, 4> Y = contractThroughMatrixProduct<4>(l1_dense, "ie", W_vovv.asTensor(), "ejab", "ijab").Eigen() - contractThroughMatrixProduct<4>(l2_dense, "imab", asRankTwoTensor(H_oo.asMatrix()), "jm", "ijab").Eigen() - contractThroughMatrixProduct<4>(V_oovv, "imab", asRankTwoTensor(G_oo.asMatrix()), "mj", "ijab").Eigen();
+        result.Eigen() += Y.Eigen() - Y.shuffle(swap_ij);  // P(ij) applied
+
+        // Calculate the contributions from the particle-particle and hole-hole ladders.
+        result.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(l2_dense, "mnab", W_oooo.asTensor(), "ijmn", "ijab").Eigen();
+        result.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(l2_dense, "ijef", W_vvvv.asTensor(), "efab", "ijab").Eigen();
+
+        // Calculate the contributions with a P(ij) P(ab) permutation.
+        const Tensor<Scalar, 4> Z = contractThroughMatrixProduct<4>(l2_dense, "imae", W_ovvo.asTensor(), "jebm", "ijab").Eigen() + contractThroughMatrixProduct<4>(l1_dense, "ia", asRankTwoTensor(H_ov.asMatrix()), "jb", "ijab").Eigen();
+        result.Eigen() += Z.Eigen() - Z.shuffle(swap_ij) - Z.shuffle(swap_ab) + Z.shuffle(swap_ij_ab);  // P(ij) P(ab) applied
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, virtual_, virtual_, result);
+    }
+
+
+    /*
+     *  MARK: Density matrices
+     */
+
+    /**
+     *  Calculate the (unrelaxed) CCSD response 1-DM, i.e. the derivative of the CCSD Lagrangian with respect to the one-electron integrals.
+     *
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *
+     *  @return The Hermitian part of the CCSD response 1-DM, which yields the same expectation values for Hermitian operators.
+     */
+    static G1DM<Scalar> calculate1DM(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2) {
+
+        const auto D = LambdaCCSD<Scalar>::calculateNonHermitian1DM(t1, t2, l1, l2);
+        return G1DM<Scalar>(0.5 * (D + D.adjoint()));
+    }
+
+
+    /**
+     *  Calculate the (unrelaxed) CCSD response 2-DM, i.e. the derivative of the CCSD Lagrangian with respect to the two-electron integrals.
+     *
+     *  The derivative is calculated block by block, by contracting the Λ-amplitudes with every term of the amplitude equations in Stanton1991. This costs about as much as a single CCSD iteration.
+     *
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *
+     *  @return The Hermitian part of the CCSD response 2-DM, which yields the same expectation values for Hermitian operators.
+     */
+    static G2DM<Scalar> calculate2DM(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2) {
+
+        return LambdaCCSD<Scalar>::hermitian2DM(LambdaCCSD<Scalar>::calculateNonHermitian2DM(t1, t2, l1, l2));
+    }
+
+
+    /**
+     *  Calculate the (orbital-)relaxed CCSD response 1-DM, i.e. the derivative of the CCSD energy with respect to the one-electron integrals, including the response of the (Hartree-Fock) orbitals.
+     *
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *  @param z                    The orbital response multipliers z_ai, as a virtual-occupied object.
+     *
+     *  @return The Hermitian part of the relaxed CCSD response 1-DM.
+     */
+    static G1DM<Scalar> calculateRelaxed1DM(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2, const ImplicitMatrixSlice<Scalar>& z) {
+
+        // The orbital response multipliers are the derivatives of the Lagrangian with respect to the virtual-occupied Fock matrix elements.
+        SquareMatrix<Scalar> D = LambdaCCSD<Scalar>::calculateNonHermitian1DM(t1, t2, l1, l2);
+        LambdaCCSD<Scalar>::addToBlock(D, t1.orbitalSpace(), OccupationType::k_virtual, OccupationType::k_occupied, z.asMatrix());
+        return G1DM<Scalar>(0.5 * (D + D.adjoint()));
+    }
+
+
+    /**
+     *  Calculate the (orbital-)relaxed CCSD response 2-DM, i.e. the derivative of the CCSD energy with respect to the two-electron integrals, including the response of the (Hartree-Fock) orbitals.
+     *
+     *  @param t1                   The T1-amplitudes.
+     *  @param t2                   The T2-amplitudes.
+     *  @param l1                   The Λ1-amplitudes.
+     *  @param l2                   The Λ2-amplitudes.
+     *  @param z                    The orbital response multipliers z_ai, as a virtual-occupied object.
+     *
+     *  @return The Hermitian part of the relaxed CCSD response 2-DM.
+     */
+    static G2DM<Scalar> calculateRelaxed2DM(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2, const ImplicitMatrixSlice<Scalar>& z) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto M = orbital_space.numberOfOrbitals();
+
+        // The orbital response multipliers are the derivatives of the Lagrangian with respect to the virtual-occupied Fock matrix elements.
+        MatrixX<Scalar> Z = MatrixX<Scalar>::Zero(M, M);
+        LambdaCCSD<Scalar>::addToBlock(Z, orbital_space, OccupationType::k_virtual, OccupationType::k_occupied, z.asMatrix());
+
+        auto Gamma = LambdaCCSD<Scalar>::calculateNonHermitian2DM(t1, t2, l1, l2);
+        LambdaCCSD<Scalar>::addFockContribution(Z, orbital_space, Gamma);
+
+        return LambdaCCSD<Scalar>::hermitian2DM(Gamma);
+    }
+
+
+    /*
+     *  MARK: Orbital response
+     */
+
+    /**
+     *  @param f                    The (inactive) Fock matrix, expressed in the canonical Hartree-Fock spinors.
+     *  @param V_A                  The antisymmetrized two-electron integrals (in physicist's notation).
+     *  @param orbital_space        The orbital space which encapsulates the occupied-virtual separation.
+     *
+     *  @return The response force constant of the orbital response (Z-vector) equations, i.e. the derivative of the virtual-occupied Fock matrix elements with respect to the virtual-occupied orbital rotation generators. Its rows and columns are indexed by the column-major (a,i) pairs.
+     *
+     *  @note The orbital rotations are assumed to be real.
+     */
+    static SquareMatrix<Scalar> calculateOrbitalResponseForceConstant(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V_A, const OrbitalSpace& orbital_space) {
+
+        static_assert(std::is_same<Scalar, double>::value, "QCModel::LambdaCCSD::calculateOrbitalResponseForceConstant(const SquareMatrix<Scalar>&, const SquareRankFourTensor<Scalar>&, const OrbitalSpace&): The orbital response equations are only implemented for real orbitals.");
+
+        const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+        const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+        const auto n_o = occupied_indices.size();
+        const auto n_v = virtual_indices.size();
+
+        // A_{ai,bj} = delta_ij f_ab - delta_ab f_ij + <ab||ij> + <aj||ib>
+        SquareMatrix<Scalar> A = SquareMatrix<Scalar>::Zero(n_v * n_o);
+        for (size_t j_ = 0; j_ < n_o; j_++) {
+            const auto j = occupied_indices[j_];
+            for (size_t b_ = 0; b_ < n_v; b_++) {
+                const auto b = virtual_indices[b_];
+                const auto column = b_ + n_v * j_;
+
+                for (size_t i_ = 0; i_ < n_o; i_++) {
+                    const auto i = occupied_indices[i_];
+                    for (size_t a_ = 0; a_ < n_v; a_++) {
+                        const auto a = virtual_indices[a_];
+                        const auto row = a_ + n_v * i_;
+
+                        A(row, column) = V_A(a, b, i, j) + V_A(a, j, i, b);
+                        if (i == j) {
+                            A(row, column) += f(a, b);
+                        }
+                        if (a == b) {
+                            A(row, column) -= f(i, j);
+                        }
+                    }
+                }
+            }
+        }
+
+        return A;
+    }
+
+
+    /**
+     *  @param sq_hamiltonian       The Hamiltonian, expressed in the canonical Hartree-Fock spinors.
+     *  @param D                    The (unrelaxed) CCSD response 1-DM.
+     *  @param d                    The (unrelaxed) CCSD response 2-DM.
+     *  @param orbital_space        The orbital space which encapsulates the occupied-virtual separation.
+     *
+     *  @return The response force of the orbital response (Z-vector) equations, i.e. minus the derivative of the CCSD Lagrangian with respect to the virtual-occupied orbital rotation generators, as a virtual-occupied object.
+     *
+     *  @note The orbital rotations are assumed to be real.
+     */
+    static ImplicitMatrixSlice<Scalar> calculateOrbitalResponseForce(const GSQHamiltonian<Scalar>& sq_hamiltonian, const G1DM<Scalar>& D, const G2DM<Scalar>& d, const OrbitalSpace& orbital_space) {
+
+        static_assert(std::is_same<Scalar, double>::value, "QCModel::LambdaCCSD::calculateOrbitalResponseForce(const GSQHamiltonian<Scalar>&, const G1DM<Scalar>&, const G2DM<Scalar>&, const OrbitalSpace&): The orbital response equations are only implemented for real orbitals.");
+
+        const auto& h = sq_hamiltonian.core().parameters();
+        const auto& g = sq_hamiltonian.twoElectron().parameters();
+        const auto& D_matrix = D.matrix();
+        const auto& d_tensor = d.tensor();
+
+        // Calculate the generalized Fock matrix W_xy, i.e. the derivative of the Lagrangian with respect to the orbital coefficient U_xy of a unitary transformation, evaluated at the identity. Since the integrals are real and the density matrices are Hermitian, the contributions of all two-electron indices can be combined into one contraction.
+        const Tensor<Scalar, 4> d_symmetrized = d_tensor.Eigen() + d_tensor.shuffle(Eigen::array<int, 4> {1, 0, 2, 3});
+        MatrixX<Scalar> W = 2 * h * D_matrix.transpose();
+        W += contractThroughMatrixProduct<2>(Tensor<Scalar, 4>(g), "xqrs", d_symmetrized, "yqrs", "xy").asMatrix();
+
+        // The derivative with respect to the anti-Hermitian rotation generator kappa_ai = -kappa_ia is W_ai - W_ia.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+        const MatrixX<Scalar> force = -(orbital_space.denseSliceOf(W, virtual_, occupied) - orbital_space.denseSliceOf(W, occupied, virtual_).transpose());
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(virtual_, occupied, force);
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The T1-amplitudes.
+     */
+    const T1Amplitudes<Scalar>& t1Amplitudes() const { return this->t1; }
+
+    /**
+     *  @return The T2-amplitudes.
+     */
+    const T2Amplitudes<Scalar>& t2Amplitudes() const { return this->t2; }
+
+    /**
+     *  @return The Λ1-amplitudes.
+     */
+    const T1Amplitudes<Scalar>& lambda1Amplitudes() const { return this->l1; }
+
+    /**
+     *  @return The Λ2-amplitudes.
+     */
+    const T2Amplitudes<Scalar>& lambda2Amplitudes() const { return this->l2; }
+
+    /**
+     *  @return The orbital space which encapsulates the occupied-virtual separation.
+     */
+    const OrbitalSpace& orbitalSpace() const { return this->t1.orbitalSpace(); }
+
+
+    /*
+     *  MARK: Density matrices
+     */
+
+    /**
+     *  @return The Hermitian part of the (unrelaxed) CCSD response 1-DM.
+     */
+    G1DM<Scalar> calculate1DM() const { return LambdaCCSD<Scalar>::calculate1DM(this->t1, this->t2, this->l1, this->l2); }
+
+    /**
+     *  @return The Hermitian part of the (unrelaxed) CCSD response 2-DM.
+     */
+    G2DM<Scalar> calculate2DM() const { return LambdaCCSD<Scalar>::calculate2DM(this->t1, this->t2, this->l1, this->l2); }
+
+    /**
+     *  @param z                    The orbital response multipliers z_ai, as a virtual-occupied object.
+     *
+     *  @return The Hermitian part of the relaxed CCSD response 1-DM.
+     */
+    G1DM<Scalar> calculateRelaxed1DM(const ImplicitMatrixSlice<Scalar>& z) const { return LambdaCCSD<Scalar>::calculateRelaxed1DM(this->t1, this->t2, this->l1, this->l2, z); }
+
+    /**
+     *  @param z                    The orbital response multipliers z_ai, as a virtual-occupied object.
+     *
+     *  @return The Hermitian part of the relaxed CCSD response 2-DM.
+     */
+    G2DM<Scalar> calculateRelaxed2DM(const ImplicitMatrixSlice<Scalar>& z) const { return LambdaCCSD<Scalar>::calculateRelaxed2DM(this->t1, this->t2, this->l1, this->l2, z); }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @return The full (non-Hermitian) CCSD response 1-DM D(p,q) = <p^dagger q>.
+     */
+    static SquareMatrix<Scalar> calculateNonHermitian1DM(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto& l1_matrix = l1.asImplicitMatrixSlice().asMatrix();
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto& l2_dense = l2.asImplicitRankFourTensorSlice().asTensor();
+
+        // The occupied-occupied and virtual-virtual blocks, without the reference contribution.
+        const MatrixX<Scalar> D_oo = -t1_matrix * l1_matrix.transpose() - 0.5 * contractThroughMatrixProduct<2>(t2_dense, "imef", l2_dense, "jmef", "ij").asMatrix();
+        const MatrixX<Scalar> D_vv = l1_matrix.transpose() * t1_matrix + 0.5 * contractThroughMatrixProduct<2>(l2_dense, "mnea", t2_dense, "mneb", "ab").asMatrix();
+
+        // The occupied-virtual block can be expressed in terms of the correlation contributions to the other blocks.
+        MatrixX<Scalar> D_ov = t1_matrix + contractThroughMatrixProduct<2>(asRankTwoTensor(l1_matrix), "me", t2_dense, "imae", "ia").asMatrix();
+        D_ov += D_oo * t1_matrix - t1_matrix * (D_vv - l1_matrix.transpose() * t1_matrix);
+
+        const auto M = orbital_space.numberOfOrbitals();
+        SquareMatrix<Scalar> D = SquareMatrix<Scalar>::Zero(M);
+        for (const auto& i : orbital_space.indices(occupied)) {
+            D(i, i) = 1.0;  // The reference contribution.
+        }
+        LambdaCCSD<Scalar>::addToBlock(D, orbital_space, occupied, occupied, D_oo);
+        LambdaCCSD<Scalar>::addToBlock(D, orbital_space, virtual_, virtual_, D_vv);
+        LambdaCCSD<Scalar>::addToBlock(D, orbital_space, occupied, virtual_, D_ov);
+        LambdaCCSD<Scalar>::addToBlock(D, orbital_space, virtual_, occupied, l1_matrix.transpose());
+
+        return D;
+    }
+
+
+    /**
+     *  @return The full (non-Hermitian) CCSD response 2-DM Gamma(p,q,r,s) = <p^dagger q^dagger s r>, in physicist's notation.
+     */
+    static SquareRankFourTensor<Scalar> calculateNonHermitian2DM(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2, const T1Amplitudes<Scalar>& l1, const T2Amplitudes<Scalar>& l2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto M = orbital_space.numberOfOrbitals();
+        const auto o = OccupationType::k_occupied;
+        const auto v = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto& l1_matrix = l1.asImplicitMatrixSlice().asMatrix();
+        const auto t1_dense = asRankTwoTensor(t1_matrix);
+        const auto l1_dense = asRankTwoTensor(l1_matrix);
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto& l2_dense = l2.asImplicitRankFourTensorSlice().asTensor();
+        const auto tau2 = QCModel::CCSD<Scalar>::calculateTau2(t1, t2).asTensor();
+        const auto tau2_tilde = QCModel::CCSD<Scalar>::calculateTau2Tilde(t1, t2).asTensor();
+
+        // Every term of the CCSD energy and of the Λ-weighted amplitude equations in Stanton1991 is linear in the integrals, so its derivative is the contraction of the remaining factors. The derivatives with respect to the F1-, F2-, F3-, W1-, W2- and W3-intermediates are calculated first.
+        // The factor 1/4 of the Λ2-amplitudes in the Lagrangian is absorbed in the permutation operators, since the Λ2-amplitudes are antisymmetric.
+        const MatrixX<Scalar> F1_modified_bar = 0.5 * contractThroughMatrixProduct<2>(l2_dense, "ijab", t2_dense, "ijae", "be").asMatrix();
+        const MatrixX<Scalar> F2_modified_bar = -0.5 * contractThroughMatrixProduct<2>(l2_dense, "ijab", t2_dense, "imab", "mj").asMatrix();
+
+        const MatrixX<Scalar> F1_bar = F1_modified_bar + l1_matrix.transpose() * t1_matrix;
+        const MatrixX<Scalar> F2_bar = F2_modified_bar - t1_matrix * l1_matrix.transpose();
+        const MatrixX<Scalar> F3_bar = -0.5 * t1_matrix * F1_modified_bar + 0.5 * F2_modified_bar * t1_matrix + contractThroughMatrixProduct<2>(l1_dense, "ia", t2_dense, "imae", "me").asMatrix();
+        const auto F1_bar_dense = asRankTwoTensor(F1_bar);
+        const auto F2_bar_dense = asRankTwoTensor(F2_bar);
+        const auto F3_bar_dense = asRankTwoTensor(F3_bar);
+
+        const Tensor<Scalar, 4> W1_bar = Scalar {0.125} * contractThroughMatrixProduct<4>(tau2, "mnab", l2_dense, "ijab", "mnij").Eigen();
+        const Tensor<Scalar, 4> W2_bar = Scalar {0.125} * contractThroughMatrixProduct<4>(l2_dense, "ijab", tau2, "ijef", "abef").Eigen();
+        const auto W3_bar = contractThroughMatrixProduct<4>(l2_dense, "ijab", t2_dense, "imae", "mbej");
+
+
+        // Collect the derivatives with respect to every block of the antisymmetrized two-electron integrals.
+        SquareRankFourTensor<Scalar> V_bar = SquareRankFourTensor<Scalar>::Zero(M);
+
+        // The occupied-occupied-virtual-virtual block gets contributions from the energy, from the first term of the T2-amplitude equations and from all the intermediates.
+        const auto Z = Tensor<Scalar, 4>(Scalar {0.5} * t2_dense.Eigen() + contractThroughMatrixProduct<4>(t1_dense, "jf", t1_dense, "nb", "jnfb").Eigen());
+        Tensor<Scalar, 4> V_oovv_bar = Scalar {0.25} * (t2_dense.Eigen() + l2_dense.Eigen()) + Scalar {0.5} * contractThroughMatrixProduct<4>(t1_dense, "ia", t1_dense, "jb", "ijab").Eigen();
+        V_oovv_bar.Eigen() -= Scalar {0.5} * contractThroughMatrixProduct<4>(tau2_tilde, "mnaf", F1_bar_dense, "ae", "mnef").Eigen();
+        V_oovv_bar.Eigen() += Scalar {0.5} * contractThroughMatrixProduct<4>(F2_bar_dense, "mi", tau2_tilde, "inef", "mnef").Eigen();
+        V_oovv_bar.Eigen() += contractThroughMatrixProduct<4>(F3_bar_dense, "me", t1_dense, "nf", "mnef").Eigen();
+        V_oovv_bar.Eigen() += Scalar {0.25} * contractThroughMatrixProduct<4>(W1_bar, "mnij", tau2, "ijef", "mnef").Eigen();
+        V_oovv_bar.Eigen() += Scalar {0.25} * contractThroughMatrixProduct<4>(tau2, "mnab", W2_bar, "abef", "mnef").Eigen();
+        V_oovv_bar.Eigen() -= contractThroughMatrixProduct<4>(W3_bar, "mbej", Z, "jnfb", "mnef").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, o, v, v, V_oovv_bar);
+
+        // The occupied-virtual-virtual-occupied block.
+        const auto l2_t1 = contractThroughMatrixProduct<4>(l2_dense, "ijab", t1_dense, "ie", "ejab");
+        const Tensor<Scalar, 4> V_ovvo_bar = W3_bar.Eigen() - contractThroughMatrixProduct<4>(t1_dense, "ma", l2_t1, "ejab", "mbej").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, v, v, o, V_ovvo_bar);
+
+        // The virtual-virtual-virtual-occupied and occupied-virtual-occupied-occupied blocks.
+        const Tensor<Scalar, 4> V_vvvo_bar = Scalar {0.5} * contractThroughMatrixProduct<4>(t1_dense, "ie", l2_dense, "ijab", "abej").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, v, v, v, o, V_vvvo_bar);
+
+        const Tensor<Scalar, 4> V_ovoo_bar = Scalar {-0.5} * contractThroughMatrixProduct<4>(t1_dense, "ma", l2_dense, "ijab", "mbij").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, v, o, o, V_ovoo_bar);
+
+        // The occupied-virtual-occupied-virtual block.
+        const Tensor<Scalar, 4> V_ovov_bar = Scalar {-1.0} * contractThroughMatrixProduct<4>(l1_dense, "ia", t1_dense, "nf", "naif").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, v, o, v, V_ovov_bar);
+
+        // The occupied-virtual-virtual-virtual block.
+        Tensor<Scalar, 4> V_ovvv_bar = Scalar {-0.5} * contractThroughMatrixProduct<4>(l1_dense, "ia", t2_dense, "imef", "maef").Eigen();
+        V_ovvv_bar.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "mf", F1_bar_dense, "ae", "mafe").Eigen();
+        V_ovvv_bar.Eigen() += contractThroughMatrixProduct<4>(W3_bar, "mbej", t1_dense, "jf", "mbef").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, v, v, v, V_ovvv_bar);
+
+        // The occupied-occupied-virtual-occupied block.
+        Tensor<Scalar, 4> V_oovo_bar = Scalar {-0.5} * contractThroughMatrixProduct<4>(l1_dense, "ia", t2_dense, "mnae", "nmei").Eigen();
+        V_oovo_bar.Eigen() -= contractThroughMatrixProduct<4>(W3_bar, "mbej", t1_dense, "nb", "mnej").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, o, v, o, V_oovo_bar);
+
+        // The occupied-occupied-occupied-virtual block.
+        const Tensor<Scalar, 4> V_ooov_bar = contractThroughMatrixProduct<4>(F2_bar_dense, "mi", t1_dense, "ne", "mnie").Eigen() + Scalar {2.0} * contractThroughMatrixProduct<4>(W1_bar, "mnij", t1_dense, "je", "mnie").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, o, o, v, V_ooov_bar);
+
+        // The virtual-occupied-virtual-virtual block.
+        const Tensor<Scalar, 4> V_vovv_bar = Scalar {-2.0} * contractThroughMatrixProduct<4>(W2_bar, "abef", t1_dense, "mb", "amef").Eigen();
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, v, o, v, v, V_vovv_bar);
+
+        // The occupied-occupied-occupied-occupied and virtual-virtual-virtual-virtual blocks.
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, o, o, o, o, W1_bar);
+        LambdaCCSD<Scalar>::addToBlock(V_bar, orbital_space, v, v, v, v, W2_bar);
+
+
+        // Since V_A is antisymmetric, only the antisymmetric part of its derivative contributes: Gamma(p,q,r,s) = 4 V_bar_A(p,q,r,s).
+        SquareRankFourTensor<Scalar> Gamma {M};
+        Gamma.Eigen() = V_bar.Eigen() - V_bar.shuffle(Eigen::array<int, 4> {1, 0, 2, 3}) - V_bar.shuffle(Eigen::array<int, 4> {0, 1, 3, 2}) + V_bar.shuffle(Eigen::array<int, 4> {1, 0, 3, 2});
+
+        // The (inactive) Fock matrix depends on the two-electron integrals as well: both the reference and the correlation contributions to the 1-DM appear in the 2-DM.
+        const auto D = LambdaCCSD<Scalar>::calculateNonHermitian1DM(t1, t2, l1, l2);
+        MatrixX<Scalar> D_reference = MatrixX<Scalar>::Zero(M, M);
+        for (const auto& i : orbital_space.indices(o)) {
+            D_reference(i, i) = 1.0;
+        }
+        LambdaCCSD<Scalar>::addFockContribution(D - 0.5 * D_reference, orbital_space, Gamma);
+
+        return Gamma;
+    }
+
+
+    /**
+     *  Add the contribution of a derivative with respect to the (inactive) Fock matrix elements f_pq = h_pq + sum_k <pk||qk> to the non-Hermitian 2-DM.
+     *
+     *  @param X                    The derivative with respect to the Fock matrix elements.
+     *  @param orbital_space        The orbital space which encapsulates the occupied-virtual separation.
+     *  @param Gamma                The non-Hermitian 2-DM Gamma(p,q,r,s) = <p^dagger q^dagger s r>, to which the contribution is added.
+     */
+    static void addFockContribution(const MatrixX<Scalar>& X, const OrbitalSpace& orbital_space, SquareRankFourTensor<Scalar>& Gamma) {
+
+        const auto M = orbital_space.numberOfOrbitals();
+        for (const auto& k : orbital_space.indices(OccupationType::k_occupied)) {
+            for (size_t q = 0; q < M; q++) {
+                for (size_t p = 0; p < M; p++) {
+                    Gamma(p, k, q, k) += X(p, q);
+                    Gamma(k, p, q, k) -= X(p, q);
+                    Gamma(p, k, k, q) -= X(p, q);
+                    Gamma(k, p, k, q) += X(p, q);
+                }
+            }
+        }
+    }
+
+
+    /**
+     *  Add a dense block to the given matrix, at the positions of the given occupation types.
+     *
+     *  @param A                    The matrix to which the block is added.
+     *  @param orbital_space        The orbital space which encapsulates the occupied-virtual separation.
+     *  @param row_type             The occupation type of the rows of the block.
+     *  @param column_type          The occupation type of the columns of the block.
+     *  @param block                The dense block.
+     */
+    static void addToBlock(MatrixX<Scalar>& A, const OrbitalSpace& orbital_space, const OccupationType row_type, const OccupationType column_type, const MatrixX<Scalar>& block) {
+
+        const auto& row_indices = orbital_space.indices(row_type);
+        const auto& column_indices = orbital_space.indices(column_type);
+
+        for (size_t q = 0; q < column_indices.size(); q++) {
+            for (size_t p = 0; p < row_indices.size(); p++) {
+                A(row_indices[p], column_indices[q]) += block(p, q);
+            }
+        }
+    }
+
+
+    /**
+     *  Add a dense block to the given tensor, at the positions of the given occupation types.
+     *
+     *  @param T                    The tensor to which the block is added.
+     *  @param orbital_space        The orbital space which encapsulates the occupied-virtual separation.
+     *  @param axis1_type           The occupation type of the first axis of the block.
+     *  @param axis2_type           The occupation type of the second axis of the block.
+     *  @param axis3_type           The occupation type of the third axis of the block.
+     *  @param axis4_type           The occupation type of the fourth axis of the block.
+     *  @param block                The dense block.
+     */
+    static void addToBlock(SquareRankFourTensor<Scalar>& T, const OrbitalSpace& orbital_space, const OccupationType axis1_type, const OccupationType axis2_type, const OccupationType axis3_type, const OccupationType axis4_type, const Tensor<Scalar, 4>& block) {
+
+        const auto& axis1_indices = orbital_space.indices(axis1_type);
+        const auto& axis2_indices = orbital_space.indices(axis2_type);
+        const auto& axis3_indices = orbital_space.indices(axis3_type);
+        const auto& axis4_indices = orbital_space.indices(axis4_type);
+
+        for (size_t s = 0; s < axis4_indices.size(); s++) {
+            for (size_t r = 0; r < axis3_indices.size(); r++) {
+                for (size_t q = 0; q < axis2_indices.size(); q++) {
+                    for (size_t p = 0; p < axis1_indices.size(); p++) {
+                        T(axis1_indices[p], axis2_indices[q], axis3_indices[r], axis4_indices[s]) += block(p, q, r, s);
+                    }
+                }
+            }
+        }
+    }
+
+
+    /**
+     *  @param Gamma                A non-Hermitian 2-DM Gamma(p,q,r,s) = <p^dagger q^dagger s r>, in physicist's notation.
+     *
+     *  @return The Hermitian part of the given 2-DM, in the chemist's notation d(p,q,r,s) = <p^dagger r^dagger s q> of `G2DM`.
+     */
+    static G2DM<Scalar> hermitian2DM(const SquareRankFourTensor<Scalar>& Gamma) {
+
+        const auto M = Gamma.dimension();
+        SquareRankFourTensor<Scalar> d {M};
+        for (size_t p = 0; p < M; p++) {
+            for (size_t q = 0; q < M; q++) {
+                for (size_t r = 0; r < M; r++) {
+                    for (size_t s = 0; s < M; s++) {
+                        d(p, q, r, s) = 0.5 * (Gamma(p, r, q, s) + GQCP::conj(Gamma(q, s, p, r)));
+                    }
+                }
+            }
+        }
+
+        return G2DM<Scalar>(d);
+    }
+};
+
+
+}  // namespace QCModel
+}  // namespace GQCP
@@ -0,0 +1,446 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include "Basis/SpinorBasis/OrbitalSpace.hpp"
+#include "Mathematical/Representation/TensorContraction.hpp"
+#include "QCModel/CC/T1Amplitudes.hpp"
+#include "QCModel/CC/T2Amplitudes.hpp"
+
+
+namespace GQCP {
+namespace QCModel {
+
+
+/**
+ *  The spin-adapted closed-shell CCSD (restricted coupled-cluster singles and doubles) wave function model.
+ *
+ *  The amplitudes are expressed in the spatial orbitals of a closed-shell (RHF) reference: t_i^a is the amplitude of the alpha (or beta) single excitation i -> a, and t_{ij}^{ab} is the amplitude of the alpha-beta double excitation (i alpha, j beta) -> (a alpha, b beta). The amplitudes of all the other spin cases follow from these. The equations are the spin-adapted equations of Stanton1991, in the form of Crawford's closed-shell CCSD implementation.
+ *
+ *  @tparam _Scalar             The scalar type of the amplitudes.
+ */
+template <typename _Scalar>
+class RCCSD {
+public:
+    // The scalar type of the amplitudes.
+    using Scalar = _Scalar;
+
+
+private:
+    // The spatial-orbital T1-amplitudes.
+    T1Amplitudes<Scalar> t1;
+
+    // The (alpha-beta) spatial-orbital T2-amplitudes.
+    T2Amplitudes<Scalar> t2;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Construct a closed-shell CCSD wave function from its converged T1- and T2-amplitudes.
+     *
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     */
+    RCCSD(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) :
+        t1 {t1},
+        t2 {t2} {}
+
+
+    /*
+     *  MARK: Amplitude equations
+     */
+
+    /**
+     *  Calculate the closed-shell CCSD correlation energy.
+     *
+     *  @param f                    The (inactive) spatial-orbital Fock matrix.
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The closed-shell CCSD correlation energy.
+     */
+    static Scalar calculateCorrelationEnergy(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        // E = 2 f_{ia} t_i^a + (2 <ij|ab> - <ij|ba>) (t_{ij}^{ab} + t_i^a t_j^b).
+        const MatrixX<Scalar> f_ov = orbital_space.denseSliceOf(f, occupied, virtual_);
+        const auto tau2 = RCCSD<Scalar>::calculateTau2(t1, t2);
+        const auto L_oovv = RCCSD<Scalar>::spinAdapted(orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_));
+
+        const Scalar E_singles = 2.0 * (f_ov.array() * t1.asImplicitMatrixSlice().asMatrix().array()).sum();
+        const Scalar E_doubles = contractThroughMatrixProduct<0>(L_oovv, "ijab", tau2, "ijab", "")();
+
+        return E_singles + E_doubles;
+    }
+
+
+    /**
+     *  Calculate the values for all the closed-shell CCSD T1-amplitude equations, evaluated at the given T1- and T2-amplitudes.
+     *
+     *  @param f                    The (inactive) spatial-orbital Fock matrix.
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The values for the T1-amplitude equations, as an occupied-virtual object. These vanish for the converged amplitudes, and contain the term -t_i^a (f_{ii} - f_{aa}), such that a Jacobi update reads t_i^a += f_i^a / (f_{ii} - f_{aa}).
+     */
+    static ImplicitMatrixSlice<Scalar> calculateT1AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto t1_dense = asRankTwoTensor(t1_matrix);
+        const auto t2_bar = RCCSD<Scalar>::spinAdapted(t2.asImplicitRankFourTensorSlice().asTensor());  // 2 t_{ij}^{ab} - t_{ij}^{ba}
+
+        const auto V_ovvo = orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, occupied);
+        const auto V_ovov = orbital_space.denseSliceOf(V, occupied, virtual_, occupied, virtual_);
+        const auto V_ovvv = orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, virtual_);
+        const auto V_oovo = orbital_space.denseSliceOf(V, occupied, occupied, virtual_, occupied);
+        const auto V_ooov = orbital_space.denseSliceOf(V, occupied, occupied, occupied, virtual_);
+
+        const auto F_ae = RCCSD<Scalar>::calculateFae(f, V, t1, t2);
+        const auto F_mi = RCCSD<Scalar>::calculateFmi(f, V, t1, t2);
+        const auto F_me = RCCSD<Scalar>::calculateFme(f, V, t1);
+
+
+        MatrixX<Scalar> result = orbital_space.denseSliceOf(f, occupied, virtual_);
+        result += t1_matrix * F_ae.transpose();
+        result -= F_mi.transpose() * t1_matrix;
+        result += contractThroughMatrixProduct<2>(t2_bar, "imae", asRankTwoTensor(F_me), "me", "ia").asMatrix();
+
+        // 2 <na|fi> - <na|if>
+        const Tensor<Scalar, 4> L_ovvo = Scalar {2.0} * V_ovvo.Eigen() - V_ovov.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});
+        result += contractThroughMatrixProduct<2>(t1_dense, "nf", L_ovvo, "nafi", "ia").asMatrix();
+
+        result += contractThroughMatrixProduct<2>(t2_bar, "mief", V_ovvv, "maef", "ia").asMatrix();
+
+        // 2 <nm|ei> - <nm|ie>
+        const Tensor<Scalar, 4> L_oovo = Scalar {2.0} * V_oovo.Eigen() - V_ooov.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});
+        result -= contractThroughMatrixProduct<2>(t2.asImplicitRankFourTensorSlice().asTensor(), "mnae", L_oovo, "nmei", "ia").asMatrix();
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, virtual_, result);
+    }
+
+
+    /**
+     *  Calculate the values for all the closed-shell CCSD T2-amplitude equations, evaluated at the given T1- and T2-amplitudes.
+     *
+     *  @param f                    The (inactive) spatial-orbital Fock matrix.
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The values for the (alpha-beta) T2-amplitude equations, as an occupied-occupied-virtual-virtual object. These vanish for the converged amplitudes, and contain the term -t_{ij}^{ab} (f_{ii} + f_{jj} - f_{aa} - f_{bb}), such that a Jacobi update reads t_{ij}^{ab} += f_{ij}^{ab} / (f_{ii} + f_{jj} - f_{aa} - f_{bb}).
+     */
+    static ImplicitRankFourTensorSlice<Scalar> calculateT2AmplitudeEquations(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();  // Assume t1 and t2 have the same orbital space.
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto t1_dense = asRankTwoTensor(t1_matrix);
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto tau2 = RCCSD<Scalar>::calculateTau2(t1, t2);
+
+        const auto V_oovv = orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_);
+        const auto V_ovvv = orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, virtual_);
+        const auto V_ovvo = orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, occupied);
+        const auto V_ovov = orbital_space.denseSliceOf(V, occupied, virtual_, occupied, virtual_);
+
+        const auto F_ae = RCCSD<Scalar>::calculateFae(f, V, t1, t2);
+        const auto F_mi = RCCSD<Scalar>::calculateFmi(f, V, t1, t2);
+        const auto F_me = RCCSD<Scalar>::calculateFme(f, V, t1);
+
+        const auto W_mnij = RCCSD<Scalar>::calculateWmnij(V, t1, t2);
+        const auto W_mbej = RCCSD<Scalar>::calculateWmbej(V, t1, t2);
+        const auto W_mbje = RCCSD<Scalar>::calculateWmbje(V, t1, t2);
+
+        const Eigen::array<int, 4> swap_ab {0, 1, 3, 2};
+
+
+        // The terms that are gathered in X are subject to the permutation P(ij,ab), i.e. X_{ij}^{ab} + X_{ji}^{ba}. The terms that are already symmetric under it are added to the result directly.
+        auto result = V_oovv;
+
+        // The contributions from the Fock-like intermediates, in which the F_me-contributions are absorbed.
+        const MatrixX<Scalar> F_be = F_ae - 0.5 * t1_matrix.transpose() * F_me;
+        const MatrixX<Scalar> F_mj = F_mi + 0.5 * F_me * t1_matrix.transpose();
+
+        Tensor<Scalar, 4> X = contractThroughMatrixProduct<4>(t2_dense, "ijae", asRankTwoTensor(F_be), "be", "ijab");
+        X.Eigen() -= contractThroughMatrixProduct<4>(t2_dense, "imab", asRankTwoTensor(F_mj), "mj", "ijab").Eigen();
+
+        // The contributions from the particle-particle ladder (through a direct contraction with the bare integrals) and the hole-hole ladder.
+        result.Eigen() += contractThroughMatrixProduct<4>(tau2, "mnab", W_mnij, "mnij", "ijab").Eigen();
+        result.Eigen() += contractThroughMatrixProduct<4>(tau2, "ijef", orbital_space.denseSliceOf(V, virtual_, virtual_, virtual_, virtual_), "abef", "ijab").Eigen();
+
+        const auto Z_mbij = contractThroughMatrixProduct<4>(V_ovvv, "mbef", tau2, "ijef", "mbij");
+        X.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "ma", Z_mbij, "mbij", "ijab").Eigen();
+
+        // The contributions from the ring intermediates.
+        const Tensor<Scalar, 4> t2_ring = Scalar {2.0} * t2_dense.Eigen() - t2_dense.shuffle(swap_ab);  // 2 t_{im}^{ae} - t_{im}^{ea}
+        X.Eigen() += contractThroughMatrixProduct<4>(t2_ring, "imae", W_mbej, "mbej", "ijab").Eigen();
+        X.Eigen() += contractThroughMatrixProduct<4>(t2_dense, "imae", W_mbje, "mbje", "ijab").Eigen();
+        X.Eigen() += contractThroughMatrixProduct<4>(t2_dense, "mjae", W_mbje, "mbie", "ijab").Eigen();
+
+        // The remaining contributions that are quadratic in the T1-amplitudes.
+        const auto t1_V_ovvo = contractThroughMatrixProduct<4>(t1_dense, "ie", V_ovvo, "mbej", "imbj");
+        X.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "ma", t1_V_ovvo, "imbj", "ijab").Eigen();
+
+        const auto t1_V_ovov = contractThroughMatrixProduct<4>(t1_dense, "ie", V_ovov, "maje", "imaj");
+        X.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "mb", t1_V_ovov, "imaj", "ijab").Eigen();
+
+        // The remaining contributions that are linear in the T1-amplitudes.
+        X.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "ie", orbital_space.denseSliceOf(V, virtual_, virtual_, virtual_, occupied), "abej", "ijab").Eigen();
+        X.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "ma", orbital_space.denseSliceOf(V, occupied, virtual_, occupied, occupied), "mbij", "ijab").Eigen();
+
+        result.Eigen() += X.Eigen() + X.shuffle(Eigen::array<int, 4> {1, 0, 3, 2});  // P(ij,ab) applied
+
+        return orbital_space.template createRepresentableObjectFor<Scalar>(occupied, occupied, virtual_, virtual_, result);
+    }
+
+
+    /*
+     *  MARK: Intermediates
+     */
+
+    /**
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the intermediate tau_{ij}^{ab} = t_{ij}^{ab} + t_i^a t_j^b.
+     */
+    static Tensor<Scalar, 4> calculateTau2(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        return Tensor<Scalar, 4>(t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + contractThroughMatrixProduct<4>(t1_dense, "ia", t1_dense, "jb", "ijab").Eigen());
+    }
+
+
+    /**
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the intermediate tau~_{ij}^{ab} = t_{ij}^{ab} + 1/2 t_i^a t_j^b.
+     */
+    static Tensor<Scalar, 4> calculateTau2Tilde(const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        return Tensor<Scalar, 4>(t2.asImplicitRankFourTensorSlice().asTensor().Eigen() + Scalar {0.5} * contractThroughMatrixProduct<4>(t1_dense, "ia", t1_dense, "jb", "ijab").Eigen());
+    }
+
+
+    /**
+     *  @param f                    The (inactive) spatial-orbital Fock matrix.
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the virtual-virtual intermediate F_{ae}, the spin-adapted analogue of equation (3) in Stanton1991 that includes the diagonal of the Fock matrix.
+     */
+    static MatrixX<Scalar> calculateFae(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto L_ovvv = RCCSD<Scalar>::spinAdapted(orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, virtual_));
+        const auto L_oovv = RCCSD<Scalar>::spinAdapted(orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_));
+
+        MatrixX<Scalar> F_ae = orbital_space.denseSliceOf(f, virtual_, virtual_);
+        F_ae -= 0.5 * t1_matrix.transpose() * orbital_space.denseSliceOf(f, occupied, virtual_);
+        F_ae += contractThroughMatrixProduct<2>(asRankTwoTensor(t1_matrix), "mf", L_ovvv, "mafe", "ae").asMatrix();
+        F_ae -= contractThroughMatrixProduct<2>(RCCSD<Scalar>::calculateTau2Tilde(t1, t2), "mnaf", L_oovv, "mnef", "ae").asMatrix();
+
+        return F_ae;
+    }
+
+
+    /**
+     *  @param f                    The (inactive) spatial-orbital Fock matrix.
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *
+     *  @return The dense representation of the occupied-virtual intermediate F_{me}, the spin-adapted analogue of equation (5) in Stanton1991.
+     */
+    static MatrixX<Scalar> calculateFme(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto L_oovv = RCCSD<Scalar>::spinAdapted(orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_));
+
+        MatrixX<Scalar> F_me = orbital_space.denseSliceOf(f, occupied, virtual_);
+        F_me += contractThroughMatrixProduct<2>(asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix()), "nf", L_oovv, "mnef", "me").asMatrix();
+
+        return F_me;
+    }
+
+
+    /**
+     *  @param f                    The (inactive) spatial-orbital Fock matrix.
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the occupied-occupied intermediate F_{mi}, the spin-adapted analogue of equation (4) in Stanton1991 that includes the diagonal of the Fock matrix.
+     */
+    static MatrixX<Scalar> calculateFmi(const SquareMatrix<Scalar>& f, const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();
+        const auto V_oovo = orbital_space.denseSliceOf(V, occupied, occupied, virtual_, occupied);
+        const Tensor<Scalar, 4> L_ooov = Scalar {2.0} * orbital_space.denseSliceOf(V, occupied, occupied, occupied, virtual_).Eigen() - V_oovo.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});  // 2 <mn|ie> - <mn|ei>
+        const auto L_oovv = RCCSD<Scalar>::spinAdapted(orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_));
+
+        MatrixX<Scalar> F_mi = orbital_space.denseSliceOf(f, occupied, occupied);
+        F_mi += 0.5 * orbital_space.denseSliceOf(f, occupied, virtual_) * t1_matrix.transpose();
+        F_mi += contractThroughMatrixProduct<2>(asRankTwoTensor(t1_matrix), "ne", L_ooov, "mnie", "mi").asMatrix();
+        F_mi += contractThroughMatrixProduct<2>(RCCSD<Scalar>::calculateTau2Tilde(t1, t2), "inef", L_oovv, "mnef", "mi").asMatrix();
+
+        return F_mi;
+    }
+
+
+    /**
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the ring intermediate W_{mbej}, the spin-adapted analogue of equation (8) in Stanton1991.
+     */
+    static Tensor<Scalar, 4> calculateWmbej(const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+        const auto V_oovv = orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_);
+
+        auto W_mbej = orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, occupied);
+        W_mbej.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "jf", orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, virtual_), "mbef", "mbej").Eigen();
+        W_mbej.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "nb", orbital_space.denseSliceOf(V, occupied, occupied, virtual_, occupied), "mnej", "mbej").Eigen();
+
+        const Tensor<Scalar, 4> Z = Scalar {0.5} * t2_dense.Eigen() + contractThroughMatrixProduct<4>(t1_dense, "jf", t1_dense, "nb", "jnfb").Eigen();
+        W_mbej.Eigen() -= contractThroughMatrixProduct<4>(Z, "jnfb", V_oovv, "mnef", "mbej").Eigen();
+
+        // t_{nj}^{fb} <mn|ef> - 1/2 t_{nj}^{fb} <mn|fe>
+        const Tensor<Scalar, 4> V_ring = V_oovv.Eigen() - Scalar {0.5} * V_oovv.shuffle(Eigen::array<int, 4> {0, 1, 3, 2});
+        W_mbej.Eigen() += contractThroughMatrixProduct<4>(t2_dense, "njfb", V_ring, "mnef", "mbej").Eigen();
+
+        return W_mbej;
+    }
+
+
+    /**
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the exchange-type ring intermediate W_{mbje}, which arises in the spin adaptation of equation (8) in Stanton1991.
+     */
+    static Tensor<Scalar, 4> calculateWmbje(const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+        const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+        Tensor<Scalar, 4> W_mbje = -orbital_space.denseSliceOf(V, occupied, virtual_, occupied, virtual_).Eigen();
+        W_mbje.Eigen() -= contractThroughMatrixProduct<4>(t1_dense, "jf", orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, virtual_), "mbfe", "mbje").Eigen();
+        W_mbje.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "nb", orbital_space.denseSliceOf(V, occupied, occupied, occupied, virtual_), "mnje", "mbje").Eigen();
+
+        const Tensor<Scalar, 4> Z = Scalar {0.5} * t2_dense.Eigen() + contractThroughMatrixProduct<4>(t1_dense, "jf", t1_dense, "nb", "jnfb").Eigen();
+        W_mbje.Eigen() += contractThroughMatrixProduct<4>(Z, "jnfb", orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_), "mnfe", "mbje").Eigen();
+
+        return W_mbje;
+    }
+
+
+    /**
+     *  @param V                    The spatial-orbital two-electron integrals, in physicist's notation.
+     *  @param t1                   The spatial-orbital T1-amplitudes.
+     *  @param t2                   The (alpha-beta) spatial-orbital T2-amplitudes.
+     *
+     *  @return The dense representation of the hole-hole ladder intermediate W_{mnij}, the spin-adapted analogue of equation (6) in Stanton1991. The particle-particle ladder contribution of equation (7) is folded into it.
+     */
+    static Tensor<Scalar, 4> calculateWmnij(const SquareRankFourTensor<Scalar>& V, const T1Amplitudes<Scalar>& t1, const T2Amplitudes<Scalar>& t2) {
+
+        const auto& orbital_space = t1.orbitalSpace();
+        const auto occupied = OccupationType::k_occupied;
+        const auto virtual_ = OccupationType::k_virtual;
+
+        const auto t1_dense = asRankTwoTensor(t1.asImplicitMatrixSlice().asMatrix());
+
+        auto W_mnij = orbital_space.denseSliceOf(V, occupied, occupied, occupied, occupied);
+        W_mnij.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "je", orbital_space.denseSliceOf(V, occupied, occupied, occupied, virtual_), "mnie", "mnij").Eigen();
+        W_mnij.Eigen() += contractThroughMatrixProduct<4>(t1_dense, "ie", orbital_space.denseSliceOf(V, occupied, occupied, virtual_, occupied), "mnej", "mnij").Eigen();
+        W_mnij.Eigen() += contractThroughMatrixProduct<4>(RCCSD<Scalar>::calculateTau2(t1, t2), "ijef", orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_), "mnef", "mnij").Eigen();
+
+        return W_mnij;
+    }
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @return The spatial-orbital T1-amplitudes.
+     */
+    const T1Amplitudes<Scalar>& t1Amplitudes() const { return this->t1; }
+
+    /**
+     *  @return The (alpha-beta) spatial-orbital T2-amplitudes.
+     */
+    const T2Amplitudes<Scalar>& t2Amplitudes() const { return this->t2; }
+
+
+private:
+    /**
+     *  @param T                    A rank-four tensor T_{pqrs}.
+     *
+     *  @return The spin-adapted combination 2 T_{pqrs} - T_{pqsr}.
+     */
+    static Tensor<Scalar, 4> spinAdapted(const Tensor<Scalar, 4>& T) {
+        return Tensor<Scalar, 4>(Scalar {2.0} * T.Eigen() - T.shuffle(Eigen::array<int, 4> {0, 1, 3, 2}));
+    }
+};
+
+
+}  // namespace QCModel
+}  // namespace GQCP
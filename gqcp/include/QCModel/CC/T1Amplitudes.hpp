@@ -147,6 +147,19 @@ public:
     const OrbitalSpace& orbitalSpace() const { return this->orbital_space; }
 
 
+    /*
+     *  MARK: Conversions
+     */
+
+    /**
+     *  @tparam NewScalar           The scalar type that the amplitudes should be converted to.
+     * 
+     *  @return A copy of these T1-amplitudes in which every amplitude is converted to the given scalar type.
+     */
+    template <typename NewScalar>
+    T1Amplitudes<NewScalar> cast() const { return T1Amplitudes<NewScalar>(this->t.template cast<NewScalar>(), this->orbital_space); }
+
+
     /*
      *  MARK: Linear algebra
      */
@@ -166,15 +179,8 @@ public:
      */
     Self& operator+=(const Self& rhs) override {
 
-        // Prepare some variables.
-        const auto& row_map = this->asImplicitMatrixSlice().rowIndexMap();
-        const auto& col_map = this->asImplicitMatrixSlice().columnIndexMap();
-
-        // Sum the matrix representations.
-        const MatrixX<Scalar> t_sum_dense = this->asImplicitMatrixSlice().asMatrix() + rhs.asImplicitMatrixSlice().asMatrix();
-        const ImplicitMatrixSlice<Scalar> t_sum_slice {row_map, col_map, t_sum_dense};
-
-        this->t = t_sum_slice;
+        // Sum the matrix representations in-place, so that the index maps of the slice are kept.
+        this->t.asMatrix() += rhs.asImplicitMatrixSlice().asMatrix();
 
         return *this;
     }
@@ -185,15 +191,8 @@ public:
      */
     Self& operator*=(const Scalar& a) override {
 
-        // Prepare some variables.
-        const auto& row_map = this->asImplicitMatrixSlice().rowIndexMap();
-        const auto& col_map = this->asImplicitMatrixSlice().columnIndexMap();
-
-        // Multiply the matrix representation.
-        const MatrixX<Scalar> t_multiplied_dense = a * this->asImplicitMatrixSlice().asMatrix();
-        const ImplicitMatrixSlice<Scalar> t_multiplied_slice {row_map, col_map, t_multiplied_dense};
-
-        this->t = t_multiplied_slice;
+        // Multiply the matrix representation in-place, so that the index maps of the slice are kept.
+        this->t.asMatrix() *= a;
 
         return *this;
     }
@@ -155,6 +155,19 @@ public:
     const OrbitalSpace& orbitalSpace() const { return this->orbital_space; }
 
 
+    /*
+     *  MARK: Conversions
+     */
+
+    /**
+     *  @tparam NewScalar           The scalar type that the amplitudes should be converted to.
+     * 
+     *  @return A copy of these T2-amplitudes in which every amplitude is converted to the given scalar type.
+     */
+    template <typename NewScalar>
+    T2Amplitudes<NewScalar> cast() const { return T2Amplitudes<NewScalar>(this->t.template cast<NewScalar>(), this->orbital_space); }
+
+
     /*
      *  MARK: Linear algebra
      */
@@ -162,7 +175,7 @@ public:
     /**
      *  @return The Frobenius norm of these T2-amplitudes.
      */
-    Scalar norm() const { return this->asImplicitRankFourTensorSlice().asMatrix().norm(); }
+    Scalar norm() const { return this->asImplicitRankFourTensorSlice().matrixView().norm(); }
 
 
     /*
@@ -174,14 +187,8 @@ public:
      */
     Self& operator+=(const Self& rhs) override {
 
-        // Prepare some variables.
-        const auto& index_maps = this->asImplicitRankFourTensorSlice().indexMaps();
-
-        // Add the tensor representations.
-        const Tensor<Scalar, 4> t_sum_dense = this->asImplicitRankFourTensorSlice().asTensor().Eigen() + rhs.asImplicitRankFourTensorSlice().asTensor().Eigen();
-        const ImplicitRankFourTensorSlice<Scalar> t_sum_slice {index_maps, t_sum_dense};
-
-        this->t = t_sum_slice;
+        // Add the tensor representations in-place, so that the index maps of the slice are kept.
+        this->t.matrixView() += rhs.asImplicitRankFourTensorSlice().matrixView();
 
         return *this;
     }
@@ -192,14 +199,8 @@ public:
      */
     Self& operator*=(const Scalar& a) override {
 
-        // Prepare some variables.
-        const auto& index_maps = this->asImplicitRankFourTensorSlice().indexMaps();
-
-        // Multiply the tensor representation.
-        const Tensor<Scalar, 4> t_multiplied_dense = a * this->asImplicitRankFourTensorSlice().asTensor().Eigen();
-        const ImplicitRankFourTensorSlice<Scalar> t_multiplied_slice {index_maps, t_multiplied_dense};
-
-        this->t = t_multiplied_slice;
+        // Multiply the tensor representation in-place, so that the index maps of the slice are kept.
+        this->t.matrixView() *= a;
 
         return *this;
     }
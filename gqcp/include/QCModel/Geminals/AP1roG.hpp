@@ -94,6 +94,23 @@ public:
      */
     static MatrixFunction<double> callablePSEJacobian(const RSQHamiltonian<double>& sq_hamiltonian, const size_t N_P);
 
+    /**
+     *  @param sq_hamiltonian       the Hamiltonian expressed in an orthonormal basis
+     *  @param G                    the AP1roG geminal coefficients
+     *  @param Y                    an occupied-virtual matrix, i.e. a direction in the space of the geminal coefficients
+     *
+     *  @return the product sum_{jb} J_{ia,jb} Y_j^b of the Jacobian of the PSEs (evaluated at the given geminal coefficients) with the given direction, without constructing the Jacobian
+     */
+    static ImplicitMatrixSlice<double> calculatePSEJacobianProduct(const RSQHamiltonian<double>& sq_hamiltonian, const AP1roGGeminalCoefficients& G, const ImplicitMatrixSlice<double>& Y);
+
+    /**
+     *  @param sq_hamiltonian           the Hamiltonian expressed in an orthonormal basis
+     *  @param N_P                      the number of electron pairs
+     *
+     *  @return a callable (i.e. with operator()) expression for the product of the Jacobian with a direction: both accepted VectorX<double> arguments, i.e. the geminal coefficients and the direction, should be in a column-major representation
+     */
+    static JacobianVectorProductFunction<double> callablePSEJacobianProduct(const RSQHamiltonian<double>& sq_hamiltonian, const size_t N_P);
+
     /**
      *  @param sq_hamiltonian           the Hamiltonian expressed in an orthonormal basis
      *  @param N_P                      the number of electron pairs
@@ -20,6 +20,7 @@
 
 #include "Basis/Transformations/GTransformation.hpp"
 #include "DensityMatrix/G1DM.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
 #include "Operator/FirstQuantized/ElectronicSpinOperator.hpp"
 #include "Operator/FirstQuantized/ElectronicSpinSquaredOperator.hpp"
@@ -153,6 +154,23 @@ public:
     }
 
 
+    /**
+     *  @param P                    The (spin-blocked) GHF density matrix expressed in the underlying scalar orbital bases.
+     *
+     *  @return The density matrix in which only the alpha-alpha and beta-beta spin-blocks are kept, and the off-diagonal spin-blocks are zero.
+     */
+    static SquareMatrix<Scalar> spinDiagonalBlocks(const G1DM<Scalar>& P) {
+
+        const auto M = P.numberOfOrbitals();  // The total number of basis functions.
+
+        SquareMatrix<Scalar> P_diagonal = SquareMatrix<Scalar>::Zero(M);
+        P_diagonal.topLeftCorner(M / 2, M / 2) = P.matrix().topLeftCorner(M / 2, M / 2);
+        P_diagonal.bottomRightCorner(M / 2, M / 2) = P.matrix().bottomRightCorner(M / 2, M / 2);
+
+        return P_diagonal;
+    }
+
+
     /**
      *  Calculate the GHF direct (Coulomb) operator.
      *
@@ -165,24 +183,13 @@ public:
      */
     static ScalarGSQOneElectronOperator<Scalar> calculateScalarBasisDirectMatrix(const G1DM<Scalar>& P, const GSQHamiltonian<Scalar>& sq_hamiltonian) {
 
-        // To perform the contraction, we will first have to convert the density matrix into a Eigen::Tensor (since contractions are only implemented for tensors).
-        // Since the two-electron integrals are spin-blocked (due to the nature of quantizing in a GSpinorBasis), the contractions must happen with a density matrix of the same dimension (M: the number of spinors). Therefore, we will construct a zero density matrix in which we only fill in one of the spin-blocks.
-        const auto M = P.numberOfOrbitals();  // The total number of basis functions.
-        SquareMatrix<Scalar> P_aa = SquareMatrix<Scalar>::Zero(M);
-        P_aa.topLeftCorner(M / 2, M / 2) = P.matrix().topLeftCorner(M / 2, M / 2);
-
-        SquareMatrix<Scalar> P_bb = SquareMatrix<Scalar>::Zero(M);
-        P_bb.bottomRightCorner(M / 2, M / 2) = P.matrix().bottomRightCorner(M / 2, M / 2);
-
         // Specify the contraction pairs for the direct contractions:
         //      P(rho lambda) (mu nu|rho lambda).
         // See knowdes: https://gqcg-res.github.io/knowdes/derivation-of-the-ghf-scf-equations-through-lagrange-multipliers.html
+        // Since the two-electron integrals are spin-blocked (due to the nature of quantizing in a GSpinorBasis), only the alpha-alpha and beta-beta blocks of the density matrix contribute. Since the contraction is linear, J_aa + J_bb is found from one contraction with both diagonal spin-blocks.
         const auto& g = sq_hamiltonian.twoElectron().parameters();
-        const auto Ja = g.template einsum<2>("ijkl,kl->ij", P_aa).asMatrix();
-        const auto Jb = g.template einsum<2>("ijkl,kl->ij", P_bb).asMatrix();
-
 
-        return ScalarGSQOneElectronOperator<Scalar>(Ja + Jb);
+        return ScalarGSQOneElectronOperator<Scalar>(g.contractDirect(QCModel::GHF<Scalar>::spinDiagonalBlocks(P)));
     }
 
 
@@ -196,33 +203,12 @@ public:
      */
     static ScalarGSQOneElectronOperator<Scalar> calculateScalarBasisExchangeMatrix(const G1DM<Scalar>& P, const GSQHamiltonian<Scalar>& sq_hamiltonian) {
 
-        // To perform the contraction, we will first have to convert the density matrix into a Eigen::Tensor (since contractions are only implemented for tensors).
-        // Since the two-electron integrals are spin-blocked (due to the nature of quantizing in a GSpinorBasis), the contractions must happen with a density matrix of the same dimension (M: the number of spinors). Therefore, we will construct a zero density matrix in which we only fill in one of the spin-blocks.
-        const auto M = P.numberOfOrbitals();  // The total number of basis functions.
-
-        SquareMatrix<Scalar> P_aa = SquareMatrix<Scalar>::Zero(M);
-        P_aa.topLeftCorner(M / 2, M / 2) = P.matrix().topLeftCorner(M / 2, M / 2);
-
-        SquareMatrix<Scalar> P_ab = SquareMatrix<Scalar>::Zero(M);
-        P_ab.topRightCorner(M / 2, M / 2) = P.matrix().topRightCorner(M / 2, M / 2);
-
-        SquareMatrix<Scalar> P_ba = SquareMatrix<Scalar>::Zero(M);
-        P_ba.bottomLeftCorner(M / 2, M / 2) = P.matrix().bottomLeftCorner(M / 2, M / 2);
-
-        SquareMatrix<Scalar> P_bb = SquareMatrix<Scalar>::Zero(M);
-        P_bb.bottomRightCorner(M / 2, M / 2) = P.matrix().bottomRightCorner(M / 2, M / 2);
-
-
         // Specify the contraction pairs for the exchange contractions:
         //      P(lambda rho) (mu rho|lambda nu).
+        // All four spin-blocks of the density matrix contribute, so K_aa + K_ab + K_ba + K_bb is found from one contraction with the full density matrix.
         const auto& g = sq_hamiltonian.twoElectron().parameters();
-        const auto K_aa = g.template einsum<2>("ijkl,kj->il", P_aa).asMatrix();
-        const auto K_ab = g.template einsum<2>("ijkl,kj->il", P_ba).asMatrix();
-        const auto K_ba = g.template einsum<2>("ijkl,kj->il", P_ab).asMatrix();
-        const auto K_bb = g.template einsum<2>("ijkl,kj->il", P_bb).asMatrix();
 
-        // Each of the spin-blocks are calculated separately (while the other blocks are zero), so the total exchange matrix can be calculated as the sum of each part.
-        return ScalarGSQOneElectronOperator<Scalar>(K_aa + K_ab + K_ba + K_bb);
+        return ScalarGSQOneElectronOperator<Scalar>(g.contractExchange(P.matrix()));
     }
 
 
@@ -236,11 +222,13 @@ public:
      */
     static ScalarGSQOneElectronOperator<Scalar> calculateScalarBasisFockMatrix(const G1DM<Scalar>& P, const GSQHamiltonian<Scalar>& sq_hamiltonian) {
 
-        const auto& H_core = sq_hamiltonian.core();
-        const auto J = QCModel::GHF<Scalar>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian);
-        const auto K = QCModel::GHF<Scalar>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian);
+        // Calculate the direct matrix (from the diagonal spin-blocks) and the exchange matrix (from the full density matrix) in one pass over the two-electron integrals, see also `calculateScalarBasisDirectMatrix` and `calculateScalarBasisExchangeMatrix`.
+        const auto& g = sq_hamiltonian.twoElectron().parameters();
+        const auto JK = g.contractDirectAndExchange({QCModel::GHF<Scalar>::spinDiagonalBlocks(P), P.matrix()});
+        const auto& J = JK.first[0];
+        const auto& K = JK.second[1];
 
-        return H_core + J - K;
+        return ScalarGSQOneElectronOperator<Scalar> {sq_hamiltonian.core().parameters() + J - K};
     }
 
 
@@ -602,6 +590,123 @@ public:
     }
 
 
+    /*
+     *  MARK: Matrix-free stability
+     */
+
+    /**
+     *  Calculate the product of a real GHF stability matrix (A + B or A - B) with a vector, without constructing the stability matrix itself.
+     *
+     *  Embedding the vector x(ia) into the virtual-occupied block of a matrix D, the product can be written as
+     *      ((A +- B) x)(ia) = (F_AA - F_II) x(ia) + J[D^T +- D](ai) - K[D^T +- D](ai),
+     *  which only requires one direct and exchange contraction of the (non-antisymmetrized) two-electron integrals.
+     *
+     *  @param gsq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'generalized' spinor basis of the GHF MOs, which contains the necessary two-electron operators.
+     *  @param x                    The vector, with the same (ia)-ordering as the rows and columns of the stability matrices.
+     *  @param sign                 The sign (+1 or -1) with which the B-matrix is added to the A-matrix.
+     *
+     *  @return The product (A + sign * B) x.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateStabilityMatrixVectorProduct(const GSQHamiltonian<double>& gsq_hamiltonian, const VectorX<double>& x, const double sign) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const auto M = this->numberOfSpinors();
+
+        if (static_cast<size_t>(x.size()) != n_occ * n_virt) {
+            throw std::invalid_argument("QCModel::GHF<double>::calculateStabilityMatrixVectorProduct(const GSQHamiltonian<double>&, const VectorX<double>&, const double): The given vector's dimension is not compatible with the number of occupied-virtual spinor pairs.");
+        }
+
+        const auto& g = gsq_hamiltonian.twoElectron().parameters();
+
+
+        // Since the virtual index changes fastest in the (ia)-ordering, x can be interpreted as a (column-major) v x o matrix X(a, i).
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> X {x.data(), static_cast<Eigen::Index>(n_virt), static_cast<Eigen::Index>(n_occ)};
+
+        SquareMatrix<double> D = SquareMatrix<double>::Zero(M);
+        D.block(n_occ, 0, n_virt, n_occ) = X;
+        const SquareMatrix<double> D_combined = D.transpose() + sign * D;
+
+        const auto JK = g.contractDirectAndExchange({D_combined});
+        const MatrixX<double> sigma = this->excitationEnergies().cwiseProduct(X) + (JK.first[0] - JK.second[0]).block(n_occ, 0, n_virt, n_occ);
+
+        return VectorX<double> {Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma.data(), sigma.size())};
+    }
+
+
+    /**
+     *  Calculate the diagonal of a real GHF stability matrix (A + B or A - B).
+     *
+     *  @param gsq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'generalized' spinor basis of the GHF MOs, which contains the necessary two-electron operators.
+     *
+     *  @return The diagonal of (A +- B), with the same (ia)-ordering as the rows and columns of the stability matrices.
+     *
+     *  @note Since the diagonal of B vanishes, the diagonals of A + B and A - B are equal.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateStabilityMatrixDiagonal(const GSQHamiltonian<double>& gsq_hamiltonian) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+
+        const auto& g = gsq_hamiltonian.twoElectron().parameters();
+        const auto F_values = this->excitationEnergies();
+
+        // A(ia,ia) = F_AA - F_II + (AI||IA) = F_AA - F_II + (AI|IA) - (AA|II).
+        VectorX<double> diagonal {n_occ * n_virt};
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t a = 0; a < n_virt; a++) {
+                const auto A = n_occ + a;  // The index of the virtual spinor in the full spinor basis.
+
+                diagonal(i * n_virt + a) = F_values(a, i) + g(A, i, i, A) - g(A, A, i, i);
+            }
+        }
+
+        return diagonal;
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the internal stability matrix (A + B) of the real GHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param gsq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'generalized' spinor basis of the GHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the internal stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> internalStabilityEnvironment(const GSQHamiltonian<double>& gsq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [ghf = *this, &gsq_hamiltonian](const VectorX<double>& x) { return ghf.calculateStabilityMatrixVectorProduct(gsq_hamiltonian, x, 1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateStabilityMatrixDiagonal(gsq_hamiltonian), number_of_guess_vectors);
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the real->complex external stability matrix (A - B) of the real GHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param gsq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'generalized' spinor basis of the GHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the real->complex stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> realComplexStabilityEnvironment(const GSQHamiltonian<double>& gsq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [ghf = *this, &gsq_hamiltonian](const VectorX<double>& x) { return ghf.calculateStabilityMatrixVectorProduct(gsq_hamiltonian, x, -1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateStabilityMatrixDiagonal(gsq_hamiltonian), number_of_guess_vectors);
+    }
+
+
     /**
      *  @return The transformation that expresses the GHF MOs in terms of the underlying AOs.
      */
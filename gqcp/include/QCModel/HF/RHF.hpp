@@ -24,6 +24,7 @@
 #include "Basis/Transformations/RTransformation.hpp"
 #include "DensityMatrix/Orbital1DM.hpp"
 #include "Mathematical/Grid/CubicGrid.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
 #include "Mathematical/Representation/LeviCivitaTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
@@ -297,28 +298,97 @@ public:
      *  @param N_P                  The number of electron pairs.
      *
      *  @return The RHF orbital Hessian as a ImplicitRankFourTensorSlice, i.e. an object with a suitable operator() implemented.
+     *
+     *  @note The inactive Fockian is calculated only once, and the Hessian is assembled from (v x v)-blocks of the two-electron integrals, one for every pair of occupied orbitals (i,j).
      */
     static ImplicitRankFourTensorSlice<Scalar> calculateOrbitalHessianTensor(const RSQHamiltonian<Scalar>& sq_hamiltonian, const size_t N_P) {
 
         // Create an occupied-virtual orbital space.
         const auto K = sq_hamiltonian.numberOfOrbitals();
-        const auto orbital_space = OrbitalSpace::Implicit({{OccupationType::k_occupied, N_P}, {OccupationType::k_virtual, K - N_P}});  // N_P occupied spatial orbitals, K-N_P virtual spatial orbitals
+        const auto n_occ = N_P;
+        const auto n_virt = K - N_P;
+        const auto orbital_space = RHF<Scalar>::orbitalSpace(K, N_P);
 
-        auto hessian = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied);  // zero-initialize an object suitable for the representation of a virtual-occupied,virtual-occupied object (ai,bj)
+        const auto F = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+        const auto& g = sq_hamiltonian.twoElectron().parameters();
 
-        // Loop over all indices (ai,bj) to construct the orbital hessian.
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
 
-                for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                    for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                        hessian(a, i, b, j) = RHF<Scalar>::calculateOrbitalHessianElement(sq_hamiltonian, N_P, a, i, b, j);
-                    }
+        // The Hessian is stored as a (column-major) matrix H(ai,bj), so the block belonging to the occupied orbitals (i,j) is the contiguous block H(. i, . j).
+        MatrixX<Scalar> H = MatrixX<Scalar>::Zero(n_virt * n_occ, n_virt * n_occ);
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t j = 0; j < n_occ; j++) {
+                auto H_ij = H.block(i * n_virt, j * n_virt, n_virt, n_virt);
+
+                // The two-electron part: 4 g(a i b j) - g(a b i j) - g(a j b i).
+                H_ij = 4 * g.matrixSlice(0, 2, i, j).block(n_occ, n_occ, n_virt, n_virt) - g.matrixSlice(0, 1, i, j).block(n_occ, n_occ, n_virt, n_virt) - g.matrixSlice(0, 2, j, i).block(n_occ, n_occ, n_virt, n_virt);
+
+                // The inactive Fockian part.
+                if (i == j) {
+                    H_ij += F.block(n_occ, n_occ, n_virt, n_virt);
                 }
+                H_ij.diagonal().array() -= F(i, j);
             }
         }
+        H *= 4;
+
 
-        return hessian;
+        // Wrap the Hessian matrix into a virtual-occupied,virtual-occupied object (ai,bj).
+        const Tensor<Scalar, 4> H_tensor = Eigen::TensorMap<const Eigen::Tensor<Scalar, 4>>(H.data(), n_virt, n_occ, n_virt, n_occ);
+        return ImplicitRankFourTensorSlice<Scalar>::FromBlockRanges(n_occ, K, 0, n_occ, n_occ, K, 0, n_occ, H_tensor);
+    }
+
+
+    /**
+     *  Calculate the product of the RHF orbital Hessian with a vector, without constructing the Hessian itself. The two-electron part is found from direct and exchange contractions with the 'density' kappa, requiring only one pass over the two-electron integrals, so that this costs O(K^4) time and O(K^2) memory instead of the O(o^2 v^2) memory of the Hessian.
+     *
+     *  @param sq_hamiltonian       The Hamiltonian expressed in an orthonormal basis.
+     *  @param N_P                  The number of electron pairs.
+     *  @param x                    The vector kappa(ai), with the same (column-major) ordering as the rows and columns of `calculateOrbitalHessianTensor(...).asMatrix()`.
+     *
+     *  @return The product of the RHF orbital Hessian with the given vector.
+     *
+     *  @note This method uses the eight-fold permutational symmetry of real-valued two-electron integrals, and is hence only enabled for real scalars.
+     */
+    template <typename Z = Scalar>
+    static enable_if_t<std::is_same<Z, double>::value, VectorX<double>> calculateOrbitalHessianVectorProduct(const RSQHamiltonian<double>& sq_hamiltonian, const size_t N_P, const VectorX<double>& x) {
+
+        // Prepare some variables.
+        const auto K = sq_hamiltonian.numberOfOrbitals();
+        const auto n_occ = N_P;
+        const auto n_virt = K - N_P;
+
+        if (static_cast<size_t>(x.size()) != n_virt * n_occ) {
+            throw std::invalid_argument("RHF::calculateOrbitalHessianVectorProduct(const RSQHamiltonian<double>&, const size_t, const VectorX<double>&): The given vector's dimension is not compatible with the number of occupied-virtual orbital pairs.");
+        }
+
+        const auto orbital_space = RHF<double>::orbitalSpace(K, N_P);
+        const auto F = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+        const auto& g = sq_hamiltonian.twoElectron().parameters();
+
+
+        // Embed kappa(b j) into the virtual-occupied block of a full matrix D, so that the two-electron part can be written as
+        //      sum_{b j} g(a i b j) kappa(b j) = J[D](a i),
+        //      sum_{b j} g(a j b i) kappa(b j) = K[D](a i),
+        //      sum_{b j} g(a b i j) kappa(b j) = K[D^T](a i),
+        // in which the last line uses g(a b i j) = g(a b j i).
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> kappa {x.data(), static_cast<Eigen::Index>(n_virt), static_cast<Eigen::Index>(n_occ)};
+
+        SquareMatrix<double> D = SquareMatrix<double>::Zero(K);
+        D.block(n_occ, 0, n_virt, n_occ) = kappa;
+        const SquareMatrix<double> D_transpose = D.transpose();
+
+        const auto JK = g.contractDirectAndExchange({D, D_transpose});
+        const auto& J = JK.first[0];
+        const auto& K_D = JK.second[0];
+        const auto& K_D_transpose = JK.second[1];
+
+
+        // Assemble sigma(a i) = 4 (sum_b F(a b) kappa(b i) - sum_j F(i j) kappa(a j) + 4 J(a i) - K[D^T](a i) - K[D](a i)).
+        MatrixX<double> sigma = F.block(n_occ, n_occ, n_virt, n_virt) * kappa - kappa * F.block(0, 0, n_occ, n_occ).transpose();
+        sigma += 4 * J.block(n_occ, 0, n_virt, n_occ) - K_D_transpose.block(n_occ, 0, n_virt, n_occ) - K_D.block(n_occ, 0, n_virt, n_occ);
+        sigma *= 4;
+
+        return VectorX<double> {Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma.data(), sigma.size())};
     }
 
 
@@ -390,8 +460,8 @@ public:
         const auto orbital_space = this->orbitalSpace();
 
         // Create the number of occupied and virtual orbitals.
-        const auto& n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
-        const auto& n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
 
         // The two electron integrals are extracted from the Hamiltonian.
         const auto& g = rsq_hamiltonian.twoElectron().parameters();
@@ -400,32 +470,22 @@ public:
         // The excitationEnergies API can be used to find these values.
         const auto F_values = this->excitationEnergies();
 
-        // The next step is to create the needed tensor slice.
-        // Zero-initialize an occupied-virtual-occupied-virtual object.
-        auto singlet_A_slice = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual);
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        singlet_A_slice(i, a, j, b) = 2.0 * g(a, i, j, b) - g(a, b, j, i);
-                    }
-                }
-            }
-        }
+        // The rows and columns of the stability matrix are compound indices (ia) and (jb), in which the virtual index changes fastest. Hence, for every pair of occupied orbitals (i,j), the elements form a contiguous (v x v)-block, which we can fill in from a (v x v)-block of the two-electron integrals.
+        MatrixX<Scalar> singlet_A_matrix = MatrixX<Scalar>::Zero(n_occ * n_virt, n_occ * n_virt);
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t j = 0; j < n_occ; j++) {
+                auto block_ij = singlet_A_matrix.block(i * n_virt, j * n_virt, n_virt, n_virt);
 
-        // Turn the ImplicitRankFourTensorSlice in an actual Tensor.
-        auto singlet_A_iajb = singlet_A_slice.asTensor();
+                // The two-electron part: 2 g(a i j b) - g(a b j i).
+                block_ij = 2.0 * g.matrixSlice(0, 3, i, j).block(n_occ, n_occ, n_virt, n_virt) - g.matrixSlice(0, 1, j, i).block(n_occ, n_occ, n_virt, n_virt);
 
-        // Add the previously calculated F values on the correct positions.
-        for (int a = 0; a < n_virt; a++) {
-            for (int i = 0; i < n_occ; i++) {
-                singlet_A_iajb(i, a, i, a) += F_values(a, i);
+                // Add the previously calculated F values on the diagonal.
+                if (i == j) {
+                    block_ij.diagonal() += F_values.col(i);
+                }
             }
         }
 
-        // Finally, reshape the tensor to a matrix.
-        const auto singlet_A_matrix = singlet_A_iajb.reshape(n_occ * n_virt, n_occ * n_virt);
-
         return singlet_A_matrix;
     }
 
@@ -446,31 +506,22 @@ public:
         const auto orbital_space = this->orbitalSpace();
 
         // Create the number of occupied and virtual orbitals.
-        const auto& n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
-        const auto& n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
 
         // The two electron integrals are extracted from the Hamiltonian.
         const auto& g = rsq_hamiltonian.twoElectron().parameters();
 
-        // The next step is to create the needed tensor slice.
-        // Zero-initialize an occupied-virtual-occupied-virtual object.
-        auto singlet_B_slice = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual);
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        singlet_B_slice(i, a, j, b) = 2.0 * g(a, i, b, j) - g(a, j, b, i);
-                    }
-                }
+        MatrixX<Scalar> singlet_B_matrix = MatrixX<Scalar>::Zero(n_occ * n_virt, n_occ * n_virt);
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t j = 0; j < n_occ; j++) {
+                auto block_ij = singlet_B_matrix.block(i * n_virt, j * n_virt, n_virt, n_virt);
+
+                // The two-electron part: 2 g(a i b j) - g(a j b i).
+                block_ij = 2.0 * g.matrixSlice(0, 2, i, j).block(n_occ, n_occ, n_virt, n_virt) - g.matrixSlice(0, 2, j, i).block(n_occ, n_occ, n_virt, n_virt);
             }
         }
 
-        // Turn the ImplicitRankFourTensorSlice in an actual Tensor.
-        auto singlet_B_iajb = singlet_B_slice.asTensor();
-
-        // Finally, reshape the tensor to a matrix.
-        const auto singlet_B_matrix = singlet_B_iajb.reshape(n_occ * n_virt, n_occ * n_virt);
-
         return singlet_B_matrix;
     }
 
@@ -491,8 +542,8 @@ public:
         const auto orbital_space = this->orbitalSpace();
 
         // Create the number of occupied and virtual orbitals.
-        const auto& n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
-        const auto& n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
 
         // The two electron integrals are extracted from the Hamiltonian.
         const auto& g = rsq_hamiltonian.twoElectron().parameters();
@@ -501,32 +552,21 @@ public:
         // The excitationEnergies API can be used to find these values.
         const auto F_values = this->excitationEnergies();
 
-        // The next step is to create the needed tensor slice.
-        // Zero-initialize an occupied-virtual-occupied-virtual object.
-        auto triplet_A_slice = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual);
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        triplet_A_slice(i, a, j, b) = -g(a, b, j, i);
-                    }
-                }
-            }
-        }
+        MatrixX<Scalar> triplet_A_matrix = MatrixX<Scalar>::Zero(n_occ * n_virt, n_occ * n_virt);
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t j = 0; j < n_occ; j++) {
+                auto block_ij = triplet_A_matrix.block(i * n_virt, j * n_virt, n_virt, n_virt);
 
-        // Turn the ImplicitRankFourTensorSlice in an actual Tensor.
-        auto triplet_A_iajb = triplet_A_slice.asTensor();
+                // The two-electron part: -g(a b j i).
+                block_ij = -g.matrixSlice(0, 1, j, i).block(n_occ, n_occ, n_virt, n_virt);
 
-        // Add the previously calculated F values on the correct positions.
-        for (int a = 0; a < n_virt; a++) {
-            for (int i = 0; i < n_occ; i++) {
-                triplet_A_iajb(i, a, i, a) += F_values(a, i);
+                // Add the previously calculated F values on the diagonal.
+                if (i == j) {
+                    block_ij.diagonal() += F_values.col(i);
+                }
             }
         }
 
-        // Finally, reshape the tensor to a matrix.
-        const auto triplet_A_matrix = triplet_A_iajb.reshape(n_occ * n_virt, n_occ * n_virt);
-
         return triplet_A_matrix;
     }
 
@@ -547,31 +587,22 @@ public:
         const auto orbital_space = this->orbitalSpace();
 
         // Create the number of occupied and virtual orbitals.
-        const auto& n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
-        const auto& n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
 
         // The two electron integrals are extracted from the Hamiltonian.
         const auto& g = rsq_hamiltonian.twoElectron().parameters();
 
-        // The next step is to create the needed tensor slice.
-        // Zero-initialize an occupied-virtual-occupied-virtual object.
-        auto triplet_B_slice = orbital_space.template initializeRepresentableObjectFor<Scalar>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual);
-        for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-                for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                    for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                        triplet_B_slice(i, a, j, b) = -g(a, j, b, i);
-                    }
-                }
+        MatrixX<Scalar> triplet_B_matrix = MatrixX<Scalar>::Zero(n_occ * n_virt, n_occ * n_virt);
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t j = 0; j < n_occ; j++) {
+                auto block_ij = triplet_B_matrix.block(i * n_virt, j * n_virt, n_virt, n_virt);
+
+                // The two-electron part: -g(a j b i).
+                block_ij = -g.matrixSlice(0, 2, j, i).block(n_occ, n_occ, n_virt, n_virt);
             }
         }
 
-        // Turn the ImplicitRankFourTensorSlice in an actual Tensor.
-        auto triplet_B_iajb = triplet_B_slice.asTensor();
-
-        // Finally, reshape the tensor to a matrix.
-        const auto triplet_B_matrix = triplet_B_iajb.reshape(n_occ * n_virt, n_occ * n_virt);
-
         return triplet_B_matrix;
     }
 
@@ -589,6 +620,149 @@ public:
     }
 
 
+    /*
+     *  MARK: Matrix-free stability
+     */
+
+    /**
+     *  Calculate the product of a real RHF stability matrix (A + B or A - B) with a vector, without constructing the stability matrix itself.
+     *
+     *  Embedding the vector x(ia) into the virtual-occupied block of a matrix D, the products can be written as
+     *      (A x)(ia) = (F_R)_AA x(ia) - (F_R)_II x(ia) + c J[D^T](ai) - K[D^T](ai),
+     *      (B x)(ia) = c J[D](ai) - K[D](ai),
+     *  in which c = 2 for the singlet and c = 0 for the triplet matrices. Hence, (A +- B) x only requires one direct and exchange contraction with D^T +- D, which costs O(K^4) time and O(K^2) memory instead of the O(o^2 v^2) memory of the stability matrices.
+     *
+     *  @param rsq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'restricted' spin orbital basis of the RHF MOs, which contains the necessary two-electron operators.
+     *  @param x                    The vector, with the same (ia)-ordering as the rows and columns of the stability matrices.
+     *  @param singlet              If true, use the singlet stability matrices. If false, use the triplet stability matrices.
+     *  @param sign                 The sign (+1 or -1) with which the B-matrix is added to the A-matrix.
+     *
+     *  @return The product (A + sign * B) x.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateStabilityMatrixVectorProduct(const RSQHamiltonian<double>& rsq_hamiltonian, const VectorX<double>& x, const bool singlet, const double sign) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+        const auto K = this->numberOfSpatialOrbitals();
+
+        if (static_cast<size_t>(x.size()) != n_occ * n_virt) {
+            throw std::invalid_argument("QCModel::RHF<double>::calculateStabilityMatrixVectorProduct(const RSQHamiltonian<double>&, const VectorX<double>&, const bool, const double): The given vector's dimension is not compatible with the number of occupied-virtual orbital pairs.");
+        }
+
+        const auto& g = rsq_hamiltonian.twoElectron().parameters();
+
+
+        // Since the virtual index changes fastest in the (ia)-ordering, x can be interpreted as a (column-major) v x o matrix X(a, i).
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> X {x.data(), static_cast<Eigen::Index>(n_virt), static_cast<Eigen::Index>(n_occ)};
+
+        SquareMatrix<double> D = SquareMatrix<double>::Zero(K);
+        D.block(n_occ, 0, n_virt, n_occ) = X;
+        const SquareMatrix<double> D_combined = D.transpose() + sign * D;
+
+        MatrixX<double> sigma = this->excitationEnergies().cwiseProduct(X);
+        if (singlet) {
+            const auto JK = g.contractDirectAndExchange({D_combined});
+            sigma += 2 * JK.first[0].block(n_occ, 0, n_virt, n_occ) - JK.second[0].block(n_occ, 0, n_virt, n_occ);
+        } else {
+            sigma -= g.contractExchange(D_combined).block(n_occ, 0, n_virt, n_occ);
+        }
+
+        return VectorX<double> {Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma.data(), sigma.size())};
+    }
+
+
+    /**
+     *  Calculate the diagonal of a real RHF stability matrix (A + B or A - B).
+     *
+     *  @param rsq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'restricted' spin orbital basis of the RHF MOs, which contains the necessary two-electron operators.
+     *  @param singlet              If true, use the singlet stability matrices. If false, use the triplet stability matrices.
+     *  @param sign                 The sign (+1 or -1) with which the B-matrix is added to the A-matrix.
+     *
+     *  @return The diagonal of (A + sign * B), with the same (ia)-ordering as the rows and columns of the stability matrices.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateStabilityMatrixDiagonal(const RSQHamiltonian<double>& rsq_hamiltonian, const bool singlet, const double sign) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+
+        const auto& g = rsq_hamiltonian.twoElectron().parameters();
+        const auto F_values = this->excitationEnergies();
+        const double c = singlet ? 2.0 : 0.0;
+
+        // A(ia,ia) = (F_R)_AA - (F_R)_II + c (AI|IA) - (AA|II) and B(ia,ia) = c (AI|AI) - (AI|AI).
+        VectorX<double> diagonal {n_occ * n_virt};
+        for (size_t i = 0; i < n_occ; i++) {
+            for (size_t a = 0; a < n_virt; a++) {
+                const auto A = n_occ + a;  // The index of the virtual orbital in the full orbital basis.
+
+                diagonal(i * n_virt + a) = F_values(a, i) + c * g(A, i, i, A) - g(A, A, i, i) + sign * (c - 1.0) * g(A, i, A, i);
+            }
+        }
+
+        return diagonal;
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the internal stability matrix (singlet A + singlet B) of the real RHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param rsq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'restricted' spin orbital basis of the RHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the internal stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> internalStabilityEnvironment(const RSQHamiltonian<double>& rsq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [rhf = *this, &rsq_hamiltonian](const VectorX<double>& x) { return rhf.calculateStabilityMatrixVectorProduct(rsq_hamiltonian, x, true, 1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateStabilityMatrixDiagonal(rsq_hamiltonian, true, 1.0), number_of_guess_vectors);
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the real->complex external stability matrix (singlet A - singlet B) of the real RHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param rsq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'restricted' spin orbital basis of the RHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the real->complex stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> realComplexStabilityEnvironment(const RSQHamiltonian<double>& rsq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [rhf = *this, &rsq_hamiltonian](const VectorX<double>& x) { return rhf.calculateStabilityMatrixVectorProduct(rsq_hamiltonian, x, true, -1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateStabilityMatrixDiagonal(rsq_hamiltonian, true, -1.0), number_of_guess_vectors);
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the restricted->unrestricted external stability matrix (triplet A + triplet B) of the real RHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param rsq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'restricted' spin orbital basis of the RHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the restricted->unrestricted stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> restrictedUnrestrictedStabilityEnvironment(const RSQHamiltonian<double>& rsq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [rhf = *this, &rsq_hamiltonian](const VectorX<double>& x) { return rhf.calculateStabilityMatrixVectorProduct(rsq_hamiltonian, x, false, 1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateStabilityMatrixDiagonal(rsq_hamiltonian, false, 1.0), number_of_guess_vectors);
+    }
+
+
     /*
      *  MARK: Density matrices
      */
@@ -752,17 +926,14 @@ public:
         // Get the two-electron parameters.
         const auto& g = sq_hamiltonian.twoElectron().parameters();
 
-        // To calculate G, we must perform two double contractions:
+        // To calculate G, we must perform two double contractions, which are fused into one pass over the two-electron integrals:
         //      1. (mu nu|rho lambda) P(lambda rho),
-        const Tensor<Scalar, 2> direct_contraction = g.template einsum<2>("ijkl,kl->ij", D.matrix());
         //      2. -0.5 (mu lambda|rho nu) P(lambda rho).
-        const Tensor<Scalar, 2> exchange_contraction = -0.5 * g.template einsum<2>("ijkl,kj->il", D.matrix());
-
-        // The previous contractions are Tensor<Scalar, 2> instances. In order to calculate the total G matrix, we will convert them back into GQCP::Matrix<Scalar>.
-        auto G1 = direct_contraction.asMatrix();
-        auto G2 = exchange_contraction.asMatrix();
+        const auto JK = g.contractDirectAndExchange({D.matrix()});
+        const auto& J = JK.first[0];
+        const auto& K = JK.second[0];
 
-        return ScalarRSQOneElectronOperator<Scalar> {sq_hamiltonian.core().parameters() + G1 + G2};
+        return ScalarRSQOneElectronOperator<Scalar> {sq_hamiltonian.core().parameters() + J - 0.5 * K};
     }
 
 
@@ -23,6 +23,7 @@
 #include "Basis/Transformations/UTransformationComponent.hpp"
 #include "DensityMatrix/SpinResolved1DM.hpp"
 #include "DensityMatrix/SpinResolved2DM.hpp"
+#include "Mathematical/Optimization/Eigenproblem/EigenproblemEnvironment.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Operator/SecondQuantized/MixedUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
@@ -343,8 +344,8 @@ public:
 
         // Specify the contraction pairs for the direct contractions:
         //      (mu nu|rho lambda) P(rho lambda).
-        const auto J_alpha = g_a.template einsum<2>("ijkl,kl->ij", P.alpha().matrix()).asMatrix();
-        const auto J_beta = g_b.template einsum<2>("ijkl,kl->ij", P.beta().matrix()).asMatrix();
+        const auto J_alpha = g_a.contractDirect(P.alpha().matrix());
+        const auto J_beta = g_b.contractDirect(P.beta().matrix());
 
         // Calculate the total J tensor.
         const auto J = J_alpha + J_beta;
@@ -369,8 +370,8 @@ public:
 
         // Specify the contraction pairs for the exchange contraction:
         //      (mu rho|lambda nu) P(lambda rho).
-        const auto K_alpha = g_a.template einsum<2>("ijkl,kj->il", P.alpha().matrix()).asMatrix();
-        const auto K_beta = g_b.template einsum<2>("ijkl,kj->il", P.beta().matrix()).asMatrix();
+        const auto K_alpha = g_a.contractExchange(P.alpha().matrix());
+        const auto K_beta = g_b.contractExchange(P.beta().matrix());
 
         return ScalarUSQOneElectronOperator<Scalar> {K_alpha, K_beta};
     }
@@ -390,17 +391,21 @@ public:
         // H_core is always the same.
         const auto& H_core = sq_hamiltonian.core();
 
-        // Get the alpha and beta parameters of the coulomb and exchange matrices.
-        const auto J_a = UHF<Scalar>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian).alpha().parameters();
-        const auto J_b = UHF<Scalar>::calculateScalarBasisDirectMatrix(P, sq_hamiltonian).beta().parameters();
+        // Calculate the alpha and beta direct and exchange matrices, in one pass over each of the pure spin components of the two-electron integrals.
+        const auto& g_a = sq_hamiltonian.twoElectron().alphaAlpha().parameters();
+        const auto& g_b = sq_hamiltonian.twoElectron().betaBeta().parameters();
+
+        const auto JK_alpha = g_a.contractDirectAndExchange({P.alpha().matrix()});
+        const auto JK_beta = g_b.contractDirectAndExchange({P.beta().matrix()});
 
-        const auto K_a = UHF<Scalar>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian).alpha().parameters();
-        const auto K_b = UHF<Scalar>::calculateScalarBasisExchangeMatrix(P, sq_hamiltonian).beta().parameters();
+        const SquareMatrix<Scalar> J = JK_alpha.first[0] + JK_beta.first[0];
+        const auto& K_a = JK_alpha.second[0];
+        const auto& K_b = JK_beta.second[0];
 
 
         // Generate the alpha and beta Fock matrix and put them in a USQOneElectronOperator.
-        const auto F_a = H_core.alpha().parameters() + J_a - K_a;
-        const auto F_b = H_core.beta().parameters() + J_b - K_b;
+        const SquareMatrix<Scalar> F_a = H_core.alpha().parameters() + J - K_a;
+        const SquareMatrix<Scalar> F_b = H_core.beta().parameters() + J - K_b;
 
         return ScalarUSQOneElectronOperator<Scalar> {F_a, F_b};
     }
@@ -1079,6 +1084,289 @@ public:
     }
 
 
+    /*
+     *  MARK: Matrix-free stability
+     */
+
+    /**
+     *  Calculate the product of a real spin-conserved UHF stability matrix (A' + B' or A' - B') with a vector, without constructing the stability matrix itself.
+     *
+     *  Embedding the alpha- and beta-parts of the vector into the virtual-occupied blocks of the matrices D_alpha and D_beta, the product can be written in terms of direct and exchange contractions of S_sigma = D_sigma^T +- D_sigma:
+     *      ((A' +- B') x)_alpha(ia) = ((F_alpha)_AA - (F_alpha)_II) x_alpha(ia) + J_aa[S_alpha](ai) - K_aa[S_alpha](ai) + J_ab[S_beta](ai),
+     *  and analogously for the beta-part.
+     *
+     *  @param usq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *  @param x                    The vector, with the same ordering as the rows and columns of the spin-conserved stability matrices: first all alpha (ia)-pairs, then all beta (ia)-pairs.
+     *  @param sign                 The sign (+1 or -1) with which the B'-matrix is added to the A'-matrix.
+     *
+     *  @return The product (A' + sign * B') x.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateSpinConservedStabilityMatrixVectorProduct(const USQHamiltonian<double>& usq_hamiltonian, const VectorX<double>& x, const double sign) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ_a = orbital_space.alpha().numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt_a = orbital_space.alpha().numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ_b = orbital_space.beta().numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt_b = orbital_space.beta().numberOfOrbitals(OccupationType::k_virtual);
+        const auto K = this->numberOfSpinOrbitals(Spin::alpha);  // Assume K_alpha and K_beta are equal.
+
+        const auto dimension_a = n_occ_a * n_virt_a;
+        const auto dimension_b = n_occ_b * n_virt_b;
+        if (static_cast<size_t>(x.size()) != dimension_a + dimension_b) {
+            throw std::invalid_argument("QCModel::UHF<double>::calculateSpinConservedStabilityMatrixVectorProduct(const USQHamiltonian<double>&, const VectorX<double>&, const double): The given vector's dimension is not compatible with the number of spin-conserved occupied-virtual orbital pairs.");
+        }
+
+        const auto& g_aaaa = usq_hamiltonian.twoElectron().alphaAlpha().parameters();
+        const auto& g_aabb = usq_hamiltonian.twoElectron().alphaBeta().parameters();
+        const auto& g_bbaa = usq_hamiltonian.twoElectron().betaAlpha().parameters();
+        const auto& g_bbbb = usq_hamiltonian.twoElectron().betaBeta().parameters();
+
+
+        // Since the virtual index changes fastest in the (ia)-ordering, the parts of x can be interpreted as (column-major) v x o matrices X(a, i).
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> X_a {x.data(), static_cast<Eigen::Index>(n_virt_a), static_cast<Eigen::Index>(n_occ_a)};
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> X_b {x.data() + dimension_a, static_cast<Eigen::Index>(n_virt_b), static_cast<Eigen::Index>(n_occ_b)};
+
+        SquareMatrix<double> D_a = SquareMatrix<double>::Zero(K);
+        D_a.block(n_occ_a, 0, n_virt_a, n_occ_a) = X_a;
+        const SquareMatrix<double> S_a = D_a.transpose() + sign * D_a;
+
+        SquareMatrix<double> D_b = SquareMatrix<double>::Zero(K);
+        D_b.block(n_occ_b, 0, n_virt_b, n_occ_b) = X_b;
+        const SquareMatrix<double> S_b = D_b.transpose() + sign * D_b;
+
+        const auto JK_a = g_aaaa.contractDirectAndExchange({S_a});
+        const auto JK_b = g_bbbb.contractDirectAndExchange({S_b});
+        const SquareMatrix<double> sigma_a = JK_a.first[0] - JK_a.second[0] + g_aabb.contractDirect(S_b);
+        const SquareMatrix<double> sigma_b = JK_b.first[0] - JK_b.second[0] + g_bbaa.contractDirect(S_a);
+
+        const auto F_values = this->excitationEnergies();
+        const MatrixX<double> sigma_X_a = F_values.alpha().cwiseProduct(X_a) + sigma_a.block(n_occ_a, 0, n_virt_a, n_occ_a);
+        const MatrixX<double> sigma_X_b = F_values.beta().cwiseProduct(X_b) + sigma_b.block(n_occ_b, 0, n_virt_b, n_occ_b);
+
+        VectorX<double> product {dimension_a + dimension_b};
+        product.head(dimension_a) = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma_X_a.data(), dimension_a);
+        product.tail(dimension_b) = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma_X_b.data(), dimension_b);
+
+        return product;
+    }
+
+
+    /**
+     *  Calculate the diagonal of a real spin-conserved UHF stability matrix (A' + B' or A' - B').
+     *
+     *  @param usq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *
+     *  @return The diagonal of (A' +- B'), with the same ordering as the rows and columns of the spin-conserved stability matrices.
+     *
+     *  @note Since the diagonal of B' vanishes, the diagonals of A' + B' and A' - B' are equal.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateSpinConservedStabilityMatrixDiagonal(const USQHamiltonian<double>& usq_hamiltonian) const {
+
+        const auto orbital_space = this->orbitalSpace();
+        const auto F_values = this->excitationEnergies();
+
+        // A'(ia,ia) = (F_sigma)_AA - (F_sigma)_II + (AI|IA)_sigma - (AA|II)_sigma.
+        std::vector<VectorX<double>> diagonal_components;
+        for (const auto& sigma : {Spin::alpha, Spin::beta}) {
+            const auto n_occ = orbital_space.component(sigma).numberOfOrbitals(OccupationType::k_occupied);
+            const auto n_virt = orbital_space.component(sigma).numberOfOrbitals(OccupationType::k_virtual);
+            const auto& g = (sigma == Spin::alpha) ? usq_hamiltonian.twoElectron().alphaAlpha().parameters() : usq_hamiltonian.twoElectron().betaBeta().parameters();
+
+            VectorX<double> diagonal_component {n_occ * n_virt};
+            for (size_t i = 0; i < n_occ; i++) {
+                for (size_t a = 0; a < n_virt; a++) {
+                    const auto A = n_occ + a;  // The index of the virtual orbital in the full orbital basis.
+
+                    diagonal_component(i * n_virt + a) = F_values.component(sigma)(a, i) + g(A, i, i, A) - g(A, A, i, i);
+                }
+            }
+            diagonal_components.push_back(diagonal_component);
+        }
+
+        VectorX<double> diagonal {diagonal_components[0].size() + diagonal_components[1].size()};
+        diagonal << diagonal_components[0], diagonal_components[1];
+
+        return diagonal;
+    }
+
+
+    /**
+     *  Calculate the product of the real spin-unconserved UHF stability matrix A'' - B'' with a vector, without constructing the stability matrix itself.
+     *
+     *  Embedding the (beta -> alpha)-part x_1 and the (alpha -> beta)-part x_2 of the vector into the matrices E_1 (alpha rows, beta columns) and E_2 (beta rows, alpha columns), the product only requires the mixed-spin exchange contractions of M = E_1^T - E_2:
+     *      ((A'' - B'') x)_1 = ((F_alpha)_AA - (F_beta)_II) x_1(ia) - K_ab[M](ai),
+     *      ((A'' - B'') x)_2 = ((F_beta)_AA - (F_alpha)_II) x_2(ia) + K_ba[M^T](ai).
+     *
+     *  @param usq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *  @param x                    The vector, with the same ordering as the rows and columns of the spin-unconserved stability matrices: first all (beta-occupied, alpha-virtual)-pairs, then all (alpha-occupied, beta-virtual)-pairs.
+     *
+     *  @return The product (A'' - B'') x.
+     *
+     *  @note For a general UHF reference, this product uses the mixed-spin exchange integrals (AJ|BI) for B''. It coincides with `calculateSpinUnconservedB` whenever the alpha- and beta-orbitals are equal.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateSpinUnconservedStabilityMatrixVectorProduct(const USQHamiltonian<double>& usq_hamiltonian, const VectorX<double>& x) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ_a = orbital_space.alpha().numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt_a = orbital_space.alpha().numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ_b = orbital_space.beta().numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt_b = orbital_space.beta().numberOfOrbitals(OccupationType::k_virtual);
+        const auto K = this->numberOfSpinOrbitals(Spin::alpha);  // Assume K_alpha and K_beta are equal.
+
+        const auto dimension_1 = n_occ_b * n_virt_a;
+        const auto dimension_2 = n_occ_a * n_virt_b;
+        if (static_cast<size_t>(x.size()) != dimension_1 + dimension_2) {
+            throw std::invalid_argument("QCModel::UHF<double>::calculateSpinUnconservedStabilityMatrixVectorProduct(const USQHamiltonian<double>&, const VectorX<double>&): The given vector's dimension is not compatible with the number of spin-unconserved occupied-virtual orbital pairs.");
+        }
+
+        const auto& g_aabb = usq_hamiltonian.twoElectron().alphaBeta().parameters();
+        const auto& g_bbaa = usq_hamiltonian.twoElectron().betaAlpha().parameters();
+
+
+        // Since the virtual index changes fastest in the (ia)-ordering, the parts of x can be interpreted as (column-major) v x o matrices X(a, i).
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> X_1 {x.data(), static_cast<Eigen::Index>(n_virt_a), static_cast<Eigen::Index>(n_occ_b)};
+        const Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> X_2 {x.data() + dimension_1, static_cast<Eigen::Index>(n_virt_b), static_cast<Eigen::Index>(n_occ_a)};
+
+        SquareMatrix<double> E_1 = SquareMatrix<double>::Zero(K);
+        E_1.block(n_occ_a, 0, n_virt_a, n_occ_b) = X_1;
+
+        SquareMatrix<double> E_2 = SquareMatrix<double>::Zero(K);
+        E_2.block(n_occ_b, 0, n_virt_b, n_occ_a) = X_2;
+
+        const SquareMatrix<double> M = E_1.transpose() - E_2;
+        const SquareMatrix<double> sigma_1 = g_aabb.contractExchange(M);
+        const SquareMatrix<double> sigma_2 = g_bbaa.contractExchange(SquareMatrix<double>(M.transpose()));
+
+
+        // The mixed-spin excitation energies are the differences between the virtual orbital energies of one spin component and the occupied orbital energies of the other.
+        const auto occupied_energies = this->occupiedOrbitalEnergies();
+        const auto virtual_energies = this->virtualOrbitalEnergies();
+
+        MatrixX<double> sigma_X_1 = -sigma_1.block(n_occ_a, 0, n_virt_a, n_occ_b);
+        for (size_t i = 0; i < n_occ_b; i++) {
+            for (size_t a = 0; a < n_virt_a; a++) {
+                sigma_X_1(a, i) += (virtual_energies.alpha()[a] - occupied_energies.beta()[i]) * X_1(a, i);
+            }
+        }
+
+        MatrixX<double> sigma_X_2 = sigma_2.block(n_occ_b, 0, n_virt_b, n_occ_a);
+        for (size_t i = 0; i < n_occ_a; i++) {
+            for (size_t a = 0; a < n_virt_b; a++) {
+                sigma_X_2(a, i) += (virtual_energies.beta()[a] - occupied_energies.alpha()[i]) * X_2(a, i);
+            }
+        }
+
+        VectorX<double> product {dimension_1 + dimension_2};
+        product.head(dimension_1) = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma_X_1.data(), dimension_1);
+        product.tail(dimension_2) = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(sigma_X_2.data(), dimension_2);
+
+        return product;
+    }
+
+
+    /**
+     *  Calculate the diagonal of the real spin-unconserved UHF stability matrix A'' - B''.
+     *
+     *  @param usq_hamiltonian      The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *
+     *  @return The diagonal of A'' - B'', with the same ordering as the rows and columns of the spin-unconserved stability matrices.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, VectorX<double>> calculateSpinUnconservedStabilityMatrixDiagonal(const USQHamiltonian<double>& usq_hamiltonian) const {
+
+        // Prepare some variables.
+        const auto orbital_space = this->orbitalSpace();
+        const auto n_occ_a = orbital_space.alpha().numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt_a = orbital_space.alpha().numberOfOrbitals(OccupationType::k_virtual);
+        const auto n_occ_b = orbital_space.beta().numberOfOrbitals(OccupationType::k_occupied);
+        const auto n_virt_b = orbital_space.beta().numberOfOrbitals(OccupationType::k_virtual);
+
+        const auto& g_aabb = usq_hamiltonian.twoElectron().alphaBeta().parameters();
+        const auto occupied_energies = this->occupiedOrbitalEnergies();
+        const auto virtual_energies = this->virtualOrbitalEnergies();
+
+        // Since the diagonal blocks of B'' vanish, the diagonal only contains A''(ia,ia) = F_AA - F_II - (AA|II).
+        VectorX<double> diagonal {n_occ_b * n_virt_a + n_occ_a * n_virt_b};
+        for (size_t i = 0; i < n_occ_b; i++) {
+            for (size_t a = 0; a < n_virt_a; a++) {
+                const auto A = n_occ_a + a;  // The index of the alpha-virtual orbital in the full orbital basis.
+
+                diagonal(i * n_virt_a + a) = virtual_energies.alpha()[a] - occupied_energies.beta()[i] - g_aabb(A, A, i, i);
+            }
+        }
+
+        const auto offset = n_occ_b * n_virt_a;
+        for (size_t i = 0; i < n_occ_a; i++) {
+            for (size_t a = 0; a < n_virt_b; a++) {
+                const auto A = n_occ_b + a;  // The index of the beta-virtual orbital in the full orbital basis.
+
+                diagonal(offset + i * n_virt_b + a) = virtual_energies.beta()[a] - occupied_energies.alpha()[i] - g_aabb(i, i, A, A);
+            }
+        }
+
+        return diagonal;
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the internal stability matrix (A' + B') of the real UHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param usq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the internal stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> internalStabilityEnvironment(const USQHamiltonian<double>& usq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [uhf = *this, &usq_hamiltonian](const VectorX<double>& x) { return uhf.calculateSpinConservedStabilityMatrixVectorProduct(usq_hamiltonian, x, 1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateSpinConservedStabilityMatrixDiagonal(usq_hamiltonian), number_of_guess_vectors);
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the real->complex external stability matrix (A' - B') of the real UHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param usq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the real->complex stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> realComplexStabilityEnvironment(const USQHamiltonian<double>& usq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [uhf = *this, &usq_hamiltonian](const VectorX<double>& x) { return uhf.calculateSpinConservedStabilityMatrixVectorProduct(usq_hamiltonian, x, -1.0); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateSpinConservedStabilityMatrixDiagonal(usq_hamiltonian), number_of_guess_vectors);
+    }
+
+
+    /**
+     *  Create an environment that can be used to find the lowest eigenvalues of the unrestricted->generalized external stability matrix (A'' - B'') of the real UHF method with an iterative eigensolver (e.g. `EigenproblemSolver::Davidson`), without constructing the stability matrix.
+     *
+     *  @param usq_hamiltonian              The second quantized Hamiltonian, expressed in the orthonormal, 'unrestricted' spin orbital basis of the UHF MOs, which contains the necessary two-electron operators.
+     *  @param number_of_guess_vectors      The number of initial guess vectors.
+     *
+     *  @return An environment for the iterative diagonalization of the unrestricted->generalized stability matrix.
+     *
+     *  @note The environment refers to the given Hamiltonian, which should hence outlive it.
+     */
+    template <typename S = Scalar>
+    enable_if_t<std::is_same<S, double>::value, EigenproblemEnvironment<double>> unrestrictedGeneralizedStabilityEnvironment(const USQHamiltonian<double>& usq_hamiltonian, const size_t number_of_guess_vectors = 1) const {
+
+        const auto matvec_function = [uhf = *this, &usq_hamiltonian](const VectorX<double>& x) { return uhf.calculateSpinUnconservedStabilityMatrixVectorProduct(usq_hamiltonian, x); };
+        return EigenproblemEnvironment<double>::Iterative(matvec_function, this->calculateSpinUnconservedStabilityMatrixDiagonal(usq_hamiltonian), number_of_guess_vectors);
+    }
+
+
     /**
      *  @return A matrix containing all the possible excitation energies of the wavefunction model, belonging to a certain spin component.
      *
@@ -0,0 +1,334 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <Eigen/Dense>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A monotonic (bump) allocator for scratch matrices, vectors and tensors whose lifetime is a single iteration of an iterative algorithm.
+ *
+ *  Scratch objects are handed out as Eigen maps onto blocks of memory that are owned by the arena. All of them are released at once through `reset()`, which `IterativeAlgorithm::perform` calls at the start of every iteration for environments that have an `arena` member. If an iteration needed more than one block, `reset()` merges the blocks into a single one, so that from then on, iterations with the same memory demand don't perform any heap allocations at all.
+ *
+ *  @note A map that is handed out by this arena must not be used after the next call to `reset()`.
+ */
+class IterationArena {
+public:
+    // The alignment (in bytes) of every allocation, which is sufficient for any vectorized Eigen kernel.
+    static constexpr size_t Alignment = 64;
+
+    // The minimum size (in bytes) of a block that this arena allocates.
+    static constexpr size_t MinimumBlockSize = 4096;
+
+    // A writable map onto a scratch matrix.
+    template <typename Scalar>
+    using MatrixMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>, Eigen::Aligned64>;
+
+    // A writable map onto a scratch (column) vector.
+    template <typename Scalar>
+    using VectorMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>, Eigen::Aligned64>;
+
+    // A writable map onto a scratch tensor.
+    template <typename Scalar, int Rank>
+    using TensorMap = Eigen::TensorMap<Eigen::Tensor<Scalar, Rank>, Eigen::Aligned64>;
+
+
+private:
+    /**
+     *  A contiguous piece of memory from which allocations are carved.
+     */
+    struct Block {
+        // The owned memory, which is slightly larger than `size` so that `begin` can be aligned.
+        std::unique_ptr<unsigned char[]> storage;
+
+        // The aligned start of the usable memory.
+        unsigned char* begin;
+
+        // The number of usable bytes.
+        size_t size;
+
+        // The number of bytes that have been handed out in the current iteration.
+        size_t used;
+    };
+
+
+    // The blocks of memory that are owned by this arena. Allocations are carved from them in order.
+    std::vector<Block> blocks;
+
+    // The index of the block that is currently allocated from.
+    size_t current;
+
+    // The number of bytes that have been handed out since the last reset.
+    size_t bytes_in_use;
+
+    // The largest number of bytes that has been in use at the same time.
+    size_t peak_bytes;
+
+    // The number of blocks that have been requested from the heap.
+    size_t number_of_block_allocations;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create an empty arena.
+     *
+     *  @param capacity         The number of bytes that should already be reserved.
+     */
+    explicit IterationArena(const size_t capacity = 0) :
+        current {0},
+        bytes_in_use {0},
+        peak_bytes {0},
+        number_of_block_allocations {0} {
+
+        this->reserve(capacity);
+    }
+
+
+    /**
+     *  Scratch memory is never shared or duplicated: a copy of an arena starts out empty, with the same capacity.
+     */
+    IterationArena(const IterationArena& other) :
+        IterationArena(other.capacity()) {}
+
+    IterationArena& operator=(const IterationArena& other) {
+
+        if (this != &other) {
+            this->reset();
+            this->reserve(other.capacity());
+        }
+
+        return *this;
+    }
+
+    IterationArena(IterationArena&&) = default;
+    IterationArena& operator=(IterationArena&&) = default;
+
+
+    /*
+     *  MARK: Allocation
+     */
+
+    /**
+     *  @param number_of_bytes          The number of bytes that should be allocated.
+     *
+     *  @return A pointer to uninitialized scratch memory that is aligned to `Alignment` bytes and that is valid until the next reset.
+     */
+    void* allocate(const size_t number_of_bytes) {
+
+        const auto aligned_number_of_bytes = IterationArena::alignedSize(std::max<size_t>(number_of_bytes, 1));
+
+        // Find a block with enough room, starting from the current one. Only allocate a new block if none of them fit.
+        while (this->current < this->blocks.size() && (this->blocks[this->current].size - this->blocks[this->current].used) < aligned_number_of_bytes) {
+            this->current++;
+        }
+        if (this->current == this->blocks.size()) {
+            const auto previous_size = this->blocks.empty() ? size_t {0} : this->blocks.back().size;
+            this->addBlock(std::max({aligned_number_of_bytes, 2 * previous_size, MinimumBlockSize}));
+        }
+
+        auto& block = this->blocks[this->current];
+        void* pointer = block.begin + block.used;
+        block.used += aligned_number_of_bytes;
+
+        this->bytes_in_use += aligned_number_of_bytes;
+        this->peak_bytes = std::max(this->peak_bytes, this->bytes_in_use);
+
+        return pointer;
+    }
+
+
+    /**
+     *  @param rows             The number of rows of the scratch matrix.
+     *  @param cols             The number of columns of the scratch matrix.
+     *
+     *  @return A map onto an uninitialized scratch matrix that is valid until the next reset.
+     */
+    template <typename Scalar>
+    MatrixMap<Scalar> matrix(const size_t rows, const size_t cols) {
+        return MatrixMap<Scalar>(this->allocateScalars<Scalar>(rows * cols), rows, cols);
+    }
+
+
+    /**
+     *  @param size             The number of elements of the scratch vector.
+     *
+     *  @return A map onto an uninitialized scratch vector that is valid until the next reset.
+     */
+    template <typename Scalar>
+    VectorMap<Scalar> vector(const size_t size) {
+        return VectorMap<Scalar>(this->allocateScalars<Scalar>(size), size);
+    }
+
+
+    /**
+     *  @param dimensions       The dimensions of the scratch tensor.
+     *
+     *  @return A map onto an uninitialized scratch tensor that is valid until the next reset.
+     */
+    template <typename Scalar, typename... Dimensions>
+    TensorMap<Scalar, sizeof...(Dimensions)> tensor(const Dimensions... dimensions) {
+
+        size_t number_of_elements = 1;
+        for (const auto dimension : {static_cast<size_t>(dimensions)...}) {
+            number_of_elements *= dimension;
+        }
+
+        return TensorMap<Scalar, sizeof...(Dimensions)>(this->allocateScalars<Scalar>(number_of_elements), static_cast<Eigen::Index>(dimensions)...);
+    }
+
+
+    /**
+     *  Release all scratch memory that has been handed out, keeping the blocks for re-use. If more than one block is owned, they are merged into a single block that can hold all of them.
+     */
+    void reset() {
+
+        if (this->blocks.size() > 1) {
+            const auto total_size = this->capacity();
+
+            this->blocks.clear();
+            this->addBlock(total_size);
+        }
+
+        for (auto& block : this->blocks) {
+            block.used = 0;
+        }
+        this->current = 0;
+        this->bytes_in_use = 0;
+    }
+
+
+    /**
+     *  Make sure that allocations of at least the given total number of bytes can be made without requesting memory from the heap.
+     *
+     *  @param capacity         The number of bytes that should be available.
+     *
+     *  @note Allocations never go back to the unused tail of a block that has been skipped, and never span two blocks. The room is therefore only considered to be available if the current block or one of the (unused) blocks after it can hold all of it. Otherwise, it is reserved in a new block.
+     */
+    void reserve(const size_t capacity) {
+
+        if (capacity == 0) {
+            return;
+        }
+
+        for (size_t i = this->current; i < this->blocks.size(); i++) {
+            if (this->blocks[i].size - this->blocks[i].used >= capacity) {
+                return;
+            }
+        }
+
+        this->addBlock(IterationArena::alignedSize(capacity));
+    }
+
+
+    /*
+     *  MARK: Instrumentation
+     */
+
+    /**
+     *  @return The number of bytes that have been handed out since the last reset.
+     */
+    size_t bytesInUse() const { return this->bytes_in_use; }
+
+    /**
+     *  @return The total number of bytes in the blocks that this arena owns.
+     */
+    size_t capacity() const {
+
+        size_t total_size = 0;
+        for (const auto& block : this->blocks) {
+            total_size += block.size;
+        }
+
+        return total_size;
+    }
+
+    /**
+     *  @return The number of blocks that have been requested from the heap over the lifetime of this arena. In a steady state, this number doesn't change anymore.
+     */
+    size_t numberOfBlockAllocations() const { return this->number_of_block_allocations; }
+
+    /**
+     *  @return The largest number of bytes that has been in use at the same time, i.e. the peak scratch memory of a single iteration.
+     */
+    size_t peakBytes() const { return this->peak_bytes; }
+
+
+private:
+    /*
+     *  MARK: Helpers
+     */
+
+    /**
+     *  @param number_of_bytes          A number of bytes.
+     *
+     *  @return The given number of bytes, rounded up to a multiple of the alignment.
+     */
+    static size_t alignedSize(const size_t number_of_bytes) { return (number_of_bytes + Alignment - 1) / Alignment * Alignment; }
+
+
+    /**
+     *  Request a new block from the heap and append it to the blocks of this arena.
+     *
+     *  @param size             The number of usable bytes of the new block.
+     */
+    void addBlock(const size_t size) {
+
+        Block block;
+        block.storage.reset(new unsigned char[size + Alignment - 1]);
+
+        const auto address = reinterpret_cast<std::uintptr_t>(block.storage.get());
+        block.begin = block.storage.get() + (Alignment - address % Alignment) % Alignment;
+        block.size = size;
+        block.used = 0;
+
+        this->blocks.push_back(std::move(block));
+        this->number_of_block_allocations++;
+    }
+
+
+    /**
+     *  @param number_of_elements       The number of scalars that should be allocated.
+     *
+     *  @return A pointer to uninitialized scratch memory for the given number of scalars.
+     */
+    template <typename Scalar>
+    Scalar* allocateScalars(const size_t number_of_elements) {
+
+        static_assert(std::is_trivially_destructible<Scalar>::value, "IterationArena: Scratch objects are never destroyed, so their scalar type should be trivially destructible.");
+        return static_cast<Scalar*>(this->allocate(number_of_elements * sizeof(Scalar)));
+    }
+};
+
+
+}  // namespace GQCP
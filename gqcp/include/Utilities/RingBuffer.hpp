@@ -0,0 +1,383 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace GQCP {
+
+
+/**
+ *  A sequence container with a fixed capacity that only keeps its most recently added elements.
+ *
+ *  When the buffer is full, adding a new element overwrites the oldest one. Since elements are copy-assigned into the slots they overwrite, dynamically-sized elements (like Eigen matrices of a fixed dimension) reuse their storage instead of being reallocated.
+ *
+ *  @tparam _Value          The type of the stored elements.
+ */
+template <typename _Value>
+class RingBuffer {
+public:
+    // The type of the stored elements.
+    using Value = _Value;
+
+    // STL-compatible alias for the type of the stored elements.
+    using value_type = Value;
+
+
+    /**
+     *  A random-access iterator over the elements of a ring buffer, from the oldest to the most recent one.
+     */
+    class ConstIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Value*;
+        using reference = const Value&;
+
+
+    private:
+        // The ring buffer that is iterated over.
+        const RingBuffer* buffer;
+
+        // The logical index of the current element, i.e. 0 for the oldest element.
+        difference_type index;
+
+
+    public:
+        /**
+         *  @param buffer           The ring buffer that is iterated over.
+         *  @param index            The logical index of the current element, i.e. 0 for the oldest element.
+         */
+        ConstIterator(const RingBuffer* buffer, const difference_type index) :
+            buffer {buffer},
+            index {index} {}
+
+
+        /*
+         *  MARK: Access
+         */
+
+        reference operator*() const { return (*this->buffer)[this->index]; }
+        pointer operator->() const { return &(*this->buffer)[this->index]; }
+        reference operator[](const difference_type n) const { return (*this->buffer)[this->index + n]; }
+
+
+        /*
+         *  MARK: Arithmetic
+         */
+
+        ConstIterator& operator++() {
+            ++this->index;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            auto copy = *this;
+            ++this->index;
+            return copy;
+        }
+
+        ConstIterator& operator--() {
+            --this->index;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            auto copy = *this;
+            --this->index;
+            return copy;
+        }
+
+        ConstIterator& operator+=(const difference_type n) {
+            this->index += n;
+            return *this;
+        }
+
+        ConstIterator& operator-=(const difference_type n) {
+            this->index -= n;
+            return *this;
+        }
+
+        ConstIterator operator+(const difference_type n) const { return ConstIterator(this->buffer, this->index + n); }
+        ConstIterator operator-(const difference_type n) const { return ConstIterator(this->buffer, this->index - n); }
+        friend ConstIterator operator+(const difference_type n, const ConstIterator& it) { return it + n; }
+
+        difference_type operator-(const ConstIterator& other) const { return this->index - other.index; }
+
+
+        /*
+         *  MARK: Comparison
+         */
+
+        bool operator==(const ConstIterator& other) const { return (this->buffer == other.buffer) && (this->index == other.index); }
+        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+        bool operator<(const ConstIterator& other) const { return this->index < other.index; }
+        bool operator>(const ConstIterator& other) const { return this->index > other.index; }
+        bool operator<=(const ConstIterator& other) const { return this->index <= other.index; }
+        bool operator>=(const ConstIterator& other) const { return this->index >= other.index; }
+    };
+
+
+private:
+    // The maximum number of elements that this buffer keeps.
+    size_t m_capacity;
+
+    // The storage of the elements. It grows until it contains `capacity` slots, after which the oldest slots are overwritten.
+    std::vector<Value> slots;
+
+    // The position (in `slots`) of the oldest element.
+    size_t first;
+
+    // The number of elements that are currently stored.
+    size_t count;
+
+
+public:
+    /*
+     *  MARK: Constructors
+     */
+
+    /**
+     *  Create an empty ring buffer.
+     *
+     *  @param capacity         The maximum number of elements that this buffer keeps.
+     */
+    explicit RingBuffer(const size_t capacity) :
+        m_capacity {capacity},
+        first {0},
+        count {0} {
+
+        if (capacity == 0) {
+            throw std::invalid_argument("RingBuffer(const size_t): The capacity of a ring buffer should be at least 1.");
+        }
+
+        this->slots.reserve(capacity);
+    }
+
+
+    /**
+     *  Since a new element may be a reference to one of the stored ones (e.g. `buffer.push_back(buffer.back())`), the storage of a copy is reserved for its full capacity as well, so that adding elements never reallocates it.
+     */
+    RingBuffer(const RingBuffer& other) :
+        m_capacity {other.m_capacity},
+        slots {other.slots},
+        first {other.first},
+        count {other.count} {
+
+        this->slots.reserve(this->m_capacity);
+    }
+
+    RingBuffer& operator=(const RingBuffer& other) {
+
+        if (this != &other) {
+            this->m_capacity = other.m_capacity;
+            this->slots = other.slots;
+            this->slots.reserve(this->m_capacity);
+            this->first = other.first;
+            this->count = other.count;
+        }
+
+        return *this;
+    }
+
+    RingBuffer(RingBuffer&&) = default;
+    RingBuffer& operator=(RingBuffer&&) = default;
+
+
+    /*
+     *  MARK: Access
+     */
+
+    /**
+     *  @param index            The logical index of an element, i.e. 0 for the oldest stored element.
+     *
+     *  @return A read-only reference to the element at the given index.
+     */
+    const Value& operator[](const size_t index) const { return this->slots[(this->first + index) % this->m_capacity]; }
+
+    /**
+     *  @param index            The logical index of an element, i.e. 0 for the oldest stored element.
+     *
+     *  @return A writable reference to the element at the given index.
+     */
+    Value& operator[](const size_t index) { return this->slots[(this->first + index) % this->m_capacity]; }
+
+    /**
+     *  @return A read-only reference to the most recently added element.
+     */
+    const Value& back() const { return (*this)[this->count - 1]; }
+
+    /**
+     *  @return A writable reference to the most recently added element.
+     */
+    Value& back() { return (*this)[this->count - 1]; }
+
+    /**
+     *  @return A read-only reference to the oldest stored element.
+     */
+    const Value& front() const { return (*this)[0]; }
+
+    /**
+     *  @return An iterator to the oldest stored element.
+     */
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+
+    /**
+     *  @return An iterator past the most recently added element.
+     */
+    ConstIterator end() const { return ConstIterator(this, static_cast<std::ptrdiff_t>(this->count)); }
+
+    /**
+     *  @return The stored elements, from the oldest to the most recent one.
+     */
+    std::vector<Value> asVector() const { return std::vector<Value>(this->begin(), this->end()); }
+
+
+    /*
+     *  MARK: Modifiers
+     */
+
+    /**
+     *  Add an element. If the buffer is full, the oldest element is overwritten.
+     *
+     *  @param value            The element that should be added.
+     */
+    void push_back(const Value& value) {
+
+        if (this->count < this->m_capacity) {
+            const auto position = (this->first + this->count) % this->m_capacity;
+
+            if (position < this->slots.size()) {
+                this->slots[position] = value;  // Re-use a slot that was freed through `pop_back`.
+            } else {
+                this->slots.push_back(value);
+            }
+
+            this->count++;
+        } else {
+            this->slots[this->first] = value;  // Overwrite the oldest element.
+            this->first = (this->first + 1) % this->m_capacity;
+        }
+    }
+
+
+    /**
+     *  Add an element by assigning the given source to the slot it is going to occupy. If the buffer is full, the oldest element is overwritten.
+     *
+     *  Unlike `push_back`, no temporary element is created. If the source is an Eigen expression or map and the recycled slot already has the right dimensions, no memory is allocated.
+     *
+     *  @param source           The value or expression that the new element should be assigned from.
+     */
+    template <typename Source>
+    void assign_back(const Source& source) {
+
+        if (this->count < this->m_capacity) {
+            const auto position = (this->first + this->count) % this->m_capacity;
+
+            if (position < this->slots.size()) {
+                this->slots[position] = source;
+            } else {
+                this->slots.emplace_back(source);
+            }
+
+            this->count++;
+        } else {
+            this->slots[this->first] = source;
+            this->first = (this->first + 1) % this->m_capacity;
+        }
+    }
+
+
+    /**
+     *  Remove the most recently added element. Its slot is kept, so that its storage can be re-used by the next `push_back`.
+     */
+    void pop_back() {
+
+        if (this->count == 0) {
+            throw std::out_of_range("RingBuffer::pop_back(): The buffer is empty.");
+        }
+
+        this->count--;
+    }
+
+
+    /**
+     *  Remove all elements, keeping their slots.
+     */
+    void clear() {
+        this->first = 0;
+        this->count = 0;
+    }
+
+
+    /**
+     *  Change the capacity of this buffer. If the new capacity is smaller than the current number of elements, only the most recent elements are kept.
+     *
+     *  @param capacity         The maximum number of elements that this buffer keeps.
+     */
+    void setCapacity(const size_t capacity) {
+
+        if (capacity == 0) {
+            throw std::invalid_argument("RingBuffer::setCapacity(const size_t): The capacity of a ring buffer should be at least 1.");
+        }
+
+        const auto number_of_kept_elements = std::min(this->count, capacity);
+
+        std::vector<Value> new_slots;
+        new_slots.reserve(capacity);
+        for (size_t i = this->count - number_of_kept_elements; i < this->count; i++) {
+            new_slots.push_back(std::move((*this)[i]));
+        }
+
+        this->slots = std::move(new_slots);
+        this->m_capacity = capacity;
+        this->first = 0;
+        this->count = number_of_kept_elements;
+    }
+
+
+    /*
+     *  MARK: General information
+     */
+
+    /**
+     *  @return The maximum number of elements that this buffer keeps.
+     */
+    size_t capacity() const { return this->m_capacity; }
+
+    /**
+     *  @return If this buffer contains no elements.
+     */
+    bool empty() const { return this->count == 0; }
+
+    /**
+     *  @return The number of elements that are currently stored.
+     */
+    size_t size() const { return this->count; }
+};
+
+
+}  // namespace GQCP
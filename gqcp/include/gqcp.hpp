@@ -23,10 +23,15 @@
 #include "Basis/BiorthogonalBasis/SimpleLowdinPairingBasis.hpp"
 #include "Basis/BiorthogonalBasis/ULowdinPairingBasis.hpp"
 #include "Basis/BiorthogonalBasis/ULowdinPairingBasisComponent.hpp"
+#include "Basis/Integrals/BaseJKBuilder.hpp"
 #include "Basis/Integrals/BaseOneElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/BaseOneElectronIntegralEngine.hpp"
 #include "Basis/Integrals/BaseTwoElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/BaseTwoElectronIntegralEngine.hpp"
+#include "Basis/Integrals/DensityFittedJKBuilder.hpp"
+#include "Basis/Integrals/DensityFittingFactors.hpp"
+#include "Basis/Integrals/DirectJKBuilder.hpp"
+#include "Basis/Integrals/InCoreJKBuilder.hpp"
 #include "Basis/Integrals/IntegralCalculator.hpp"
 #include "Basis/Integrals/IntegralEngine.hpp"
 #include "Basis/Integrals/Interfaces/LibcintInterfacer.hpp"
@@ -58,6 +63,7 @@
 #include "Basis/Integrals/Primitive/PrimitiveLinearMomentumIntegralEngine.hpp"
 #include "Basis/Integrals/Primitive/PrimitiveNuclearAttractionIntegralEngine.hpp"
 #include "Basis/Integrals/Primitive/PrimitiveOverlapIntegralEngine.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
 #include "Basis/Integrals/TwoElectronIntegralBuffer.hpp"
 #include "Basis/Integrals/TwoElectronIntegralEngine.hpp"
 #include "Basis/NonOrthogonalBasis/GNonOrthogonalStateBasis.hpp"
@@ -80,6 +86,7 @@
 #include "Basis/SpinorBasis/USpinOrbitalBasis.hpp"
 #include "Basis/SpinorBasis/USpinOrbitalBasisComponent.hpp"
 #include "Basis/Transformations/BasisTransformable.hpp"
+#include "Basis/Transformations/FourIndexTransformation.hpp"
 #include "Basis/Transformations/GOrbitalRotationGenerators.hpp"
 #include "Basis/Transformations/GTransformation.hpp"
 #include "Basis/Transformations/JacobiRotatable.hpp"
@@ -131,6 +138,7 @@
 #include "Mathematical/Functions/DyadicCartesianDirection.hpp"
 #include "Mathematical/Functions/EvaluableLinearCombination.hpp"
 #include "Mathematical/Functions/Function.hpp"
+#include "Mathematical/Functions/TabulatedBoysFunction.hpp"
 #include "Mathematical/Functions/VectorSpaceArithmetic.hpp"
 #include "Mathematical/Grid/CubicGrid.hpp"
 #include "Mathematical/Grid/Field.hpp"
@@ -146,6 +154,7 @@
 #include "Mathematical/Optimization/Eigenproblem/Davidson/ResidualVectorConvergence.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceMatrixCalculation.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceMatrixDiagonalization.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/SubspacePrecisionUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Davidson/SubspaceUpdate.hpp"
 #include "Mathematical/Optimization/Eigenproblem/DenseDiagonalization.hpp"
 #include "Mathematical/Optimization/Eigenproblem/Eigenpair.hpp"
@@ -170,12 +179,14 @@
 #include "Mathematical/Optimization/NonLinearEquation/step.hpp"
 #include "Mathematical/Optimization/OptimizationEnvironment.hpp"
 #include "Mathematical/Representation/Array.hpp"
+#include "Mathematical/Representation/ContractionPlan.hpp"
 #include "Mathematical/Representation/DenseVectorizer.hpp"
 #include "Mathematical/Representation/ImplicitMatrixSlice.hpp"
 #include "Mathematical/Representation/ImplicitRankFourTensorSlice.hpp"
 #include "Mathematical/Representation/LeviCivitaTensor.hpp"
 #include "Mathematical/Representation/Matrix.hpp"
 #include "Mathematical/Representation/MatrixRepresentationEvaluationContainer.hpp"
+#include "Mathematical/Representation/PackedSquareRankFourTensor.hpp"
 #include "Mathematical/Representation/SquareMatrix.hpp"
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
 #include "Mathematical/Representation/StorageArray.hpp"
@@ -215,6 +226,7 @@
 #include "Operator/FirstQuantized/OrbitalZeemanOperator.hpp"
 #include "Operator/FirstQuantized/OverlapOperator.hpp"
 #include "Operator/FirstQuantized/SpinZeemanOperator.hpp"
+#include "Operator/SecondQuantized/CholeskyRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/EvaluableRSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/GSQTwoElectronOperator.hpp"
@@ -223,10 +235,12 @@
 #include "Operator/SecondQuantized/ModelHamiltonian/HoppingMatrix.hpp"
 #include "Operator/SecondQuantized/ModelHamiltonian/HubbardHamiltonian.hpp"
 #include "Operator/SecondQuantized/OperatorTraits.hpp"
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/PureUSQTwoElectronOperatorComponent.hpp"
 #include "Operator/SecondQuantized/RSQOneElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "Operator/SecondQuantized/SQOperatorExpression.hpp"
 #include "Operator/SecondQuantized/SQOperatorStorage.hpp"
 #include "Operator/SecondQuantized/SQOperatorStorageBase.hpp"
 #include "Operator/SecondQuantized/SimpleSQOneElectronOperator.hpp"
@@ -261,6 +275,16 @@
 #include "QCMethod/CC/CCSDEnvironment.hpp"
 #include "QCMethod/CC/CCSDIntermediatesUpdate.hpp"
 #include "QCMethod/CC/CCSDSolver.hpp"
+#include "QCMethod/CC/LambdaCCSD.hpp"
+#include "QCMethod/CC/LambdaCCSDAmplitudesUpdate.hpp"
+#include "QCMethod/CC/LambdaCCSDIntermediatesUpdate.hpp"
+#include "QCMethod/CC/LambdaCCSDSolver.hpp"
+#include "QCMethod/CC/MixedPrecisionCCSDUpdate.hpp"
+#include "QCMethod/CC/PerturbativeTriples.hpp"
+#include "QCMethod/CC/RCCSD.hpp"
+#include "QCMethod/CC/RCCSDAmplitudesUpdate.hpp"
+#include "QCMethod/CC/RCCSDEnergyCalculation.hpp"
+#include "QCMethod/CC/RCCSDSolver.hpp"
 #include "QCMethod/CC/T2DIIS.hpp"
 #include "QCMethod/CC/T2ErrorCalculation.hpp"
 #include "QCMethod/CI/CI.hpp"
@@ -310,6 +334,8 @@
 #include "QCMethod/RMP2/RMP2.hpp"
 #include "QCModel/CC/CCD.hpp"
 #include "QCModel/CC/CCSD.hpp"
+#include "QCModel/CC/LambdaCCSD.hpp"
+#include "QCModel/CC/RCCSD.hpp"
 #include "QCModel/CC/T1Amplitudes.hpp"
 #include "QCModel/CC/T2Amplitudes.hpp"
 #include "QCModel/CI/LinearExpansion.hpp"
@@ -330,6 +356,7 @@
 #include "QuantumChemical/spinor_tags.hpp"
 #include "Utilities/CRTP.hpp"
 #include "Utilities/Eigen.hpp"
+#include "Utilities/IterationArena.hpp"
 #include "Utilities/aliases.hpp"
 #include "Utilities/complex.hpp"
 #include "Utilities/memory.hpp"
@@ -0,0 +1,145 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/DensityFittedJKBuilder.hpp"
+
+#include <Eigen/Eigenvalues>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param factors              The density fitting factors over the scalar basis.
+ */
+DensityFittedJKBuilder::DensityFittedJKBuilder(const DensityFittingFactors& factors) :
+    factors {factors} {
+
+    if (factors.numberOfRows() != factors.numberOfColumns()) {
+        throw std::invalid_argument("DensityFittedJKBuilder::DensityFittedJKBuilder(const DensityFittingFactors&): The density fitting factors should be expressed over one scalar basis.");
+    }
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Create a density-fitted JK builder that uses Libint2 to calculate the three-center and two-center integrals.
+ *
+ *  @param scalar_basis                     The scalar basis over whose basis functions the direct and exchange matrices should be expressed.
+ *  @param auxiliary_scalar_basis           The auxiliary (fitting) scalar basis.
+ *
+ *  @return A density-fitted JK builder that uses Libint2 to calculate the three-center and two-center integrals.
+ */
+DensityFittedJKBuilder DensityFittedJKBuilder::Libint(const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_scalar_basis) {
+
+    return DensityFittedJKBuilder(DensityFittingFactors::Libint(scalar_basis, auxiliary_scalar_basis));
+}
+
+
+/*
+ *  MARK: Building
+ */
+
+/**
+ *  Calculate the direct and exchange matrices for the given density matrices.
+ *
+ *  @param densities            The density matrices, expressed in the scalar basis.
+ *
+ *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+ */
+std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> DensityFittedJKBuilder::calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) {
+
+    const auto nbf = this->numberOfBasisFunctions();
+    const auto number_of_factors = this->factors.numberOfFactors();
+    const auto& B = this->factors.matrix();
+
+    // View all factors as one (nbf x nbf * number of factors)-matrix [B^0 B^1 ...].
+    const Eigen::Map<const Eigen::MatrixXd> all_factors {B.data(), static_cast<Eigen::Index>(nbf), static_cast<Eigen::Index>(nbf * number_of_factors)};
+
+    std::vector<SquareMatrix<double>> J;
+    std::vector<SquareMatrix<double>> K;
+    J.reserve(densities.size());
+    K.reserve(densities.size());
+    for (const auto& D : densities) {
+        if (D.dimension() != nbf) {
+            throw std::invalid_argument("DensityFittedJKBuilder::calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>&): The dimension of a density matrix does not match the number of basis functions.");
+        }
+
+
+        // The direct matrix only requires two matrix-vector products: gamma_m = B^m : D and J = sum_m B^m gamma_m.
+        const Eigen::Map<const Eigen::VectorXd> D_vector {D.data(), static_cast<Eigen::Index>(nbf * nbf)};
+        const VectorX<double> gamma = B.transpose() * D_vector;
+
+        SquareMatrix<double> J_D = SquareMatrix<double>::Zero(nbf);
+        Eigen::Map<Eigen::VectorXd> J_vector {J_D.data(), static_cast<Eigen::Index>(nbf * nbf)};
+        J_vector.noalias() = B * gamma;
+        J.push_back(J_D);
+
+
+        // The exchange matrix.
+        SquareMatrix<double> K_D = SquareMatrix<double>::Zero(nbf);
+        if (D.isApprox(D.transpose(), 1.0e-12)) {
+
+            // Factorize D = V d V^T, only keeping the eigenvectors that contribute.
+            Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {D};
+            const auto& d = eigensolver.eigenvalues();
+            const auto cutoff = 1.0e-14 * std::max(1.0, d.cwiseAbs().maxCoeff());
+
+            std::vector<Eigen::Index> significant_indices;
+            for (Eigen::Index r = 0; r < d.size(); r++) {
+                if (std::abs(d(r)) > cutoff) {
+                    significant_indices.push_back(r);
+                }
+            }
+
+            const auto rank = static_cast<Eigen::Index>(significant_indices.size());
+            MatrixX<double> V {nbf, rank};
+            VectorX<double> d_significant {rank};
+            for (Eigen::Index r = 0; r < rank; r++) {
+                V.col(r) = eigensolver.eigenvectors().col(significant_indices[r]);
+                d_significant(r) = d(significant_indices[r]);
+            }
+
+            // Since the factors over one scalar basis are symmetric, (B^m V)^T = V^T B^m, which can be calculated for all factors at once.
+            const MatrixX<double> X = V.transpose() * all_factors;  // The block m represents (B^m V)^T.
+            for (size_t m = 0; m < number_of_factors; m++) {
+                const auto X_m = X.middleCols(m * nbf, nbf);
+                K_D.noalias() += X_m.transpose() * d_significant.asDiagonal() * X_m;
+            }
+        } else {
+
+            // K = sum_m B^m D^T B^m, in which D^T B^m can be calculated for all factors at once.
+            const MatrixX<double> X = D.transpose() * all_factors;  // The block m represents D^T B^m.
+            for (size_t m = 0; m < number_of_factors; m++) {
+                K_D.noalias() += all_factors.middleCols(m * nbf, nbf) * X.middleCols(m * nbf, nbf);
+            }
+        }
+        K.push_back(K_D);
+    }
+
+    return {J, K};
+}
+
+
+}  // namespace GQCP
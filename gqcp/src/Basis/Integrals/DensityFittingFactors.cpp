@@ -0,0 +1,369 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/DensityFittingFactors.hpp"
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/Integrals/IntegralEngine.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
+
+#include <Eigen/Eigenvalues>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param B                The factors, where column m contains the column-major storage of the factor B^m.
+ *  @param rows             The number of rows of one factor B^m.
+ *  @param cols             The number of columns of one factor B^m.
+ */
+DensityFittingFactors::DensityFittingFactors(const MatrixX<double>& B, const size_t rows, const size_t cols) :
+    rows {rows},
+    cols {cols},
+    B {B} {
+
+    if (static_cast<size_t>(B.rows()) != rows * cols) {
+        throw std::invalid_argument("DensityFittingFactors::DensityFittingFactors(const MatrixX<double>&, const size_t, const size_t): The number of rows of the given matrix does not match the dimensions of one factor.");
+    }
+}
+
+
+/**
+ *  Fit the factors from the three-center and two-center integrals over an auxiliary basis.
+ *
+ *  @param three_center_integrals           The three-center integrals, where the element (P, p, q) represents (P|p q).
+ *  @param two_center_integrals             The two-center integrals (P|Q), i.e. the Coulomb metric of the auxiliary basis.
+ *  @param threshold                        The threshold below which eigenvalues of the Coulomb metric are discarded.
+ */
+DensityFittingFactors::DensityFittingFactors(const Tensor<double, 3>& three_center_integrals, const SquareMatrix<double>& two_center_integrals, const double threshold) :
+    rows {static_cast<size_t>(three_center_integrals.dimension(1))},
+    cols {static_cast<size_t>(three_center_integrals.dimension(2))} {
+
+    const auto naux = static_cast<size_t>(three_center_integrals.dimension(0));
+    if (two_center_integrals.dimension() != naux) {
+        throw std::invalid_argument("DensityFittingFactors::DensityFittingFactors(const Tensor<double, 3>&, const SquareMatrix<double>&, const double): The dimensions of the three-center and two-center integrals are incompatible.");
+    }
+
+
+    // Construct the inverse square root of the Coulomb metric in the space of its significant eigenvectors.
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {two_center_integrals};
+    const auto& eigenvalues = eigensolver.eigenvalues();
+    const auto& eigenvectors = eigensolver.eigenvectors();
+
+    std::vector<size_t> significant_indices;
+    for (size_t m = 0; m < naux; m++) {
+        if (eigenvalues(m) > threshold) {
+            significant_indices.push_back(m);
+        }
+    }
+
+    MatrixX<double> metric_inverse_sqrt {naux, significant_indices.size()};
+    for (size_t k = 0; k < significant_indices.size(); k++) {
+        const auto m = significant_indices[k];
+        metric_inverse_sqrt.col(k) = eigenvectors.col(m) / std::sqrt(eigenvalues(m));
+    }
+
+
+    // Since the three-center integrals are stored column-major, they can be viewed as an (naux x rows * cols)-matrix whose element (P, p + rows * q) represents (P|p q). The fitting then becomes a single matrix-matrix product.
+    const Eigen::Map<const Eigen::MatrixXd> three_center_matrix {three_center_integrals.data(), static_cast<Eigen::Index>(naux), static_cast<Eigen::Index>(this->rows * this->cols)};
+    this->B = three_center_matrix.transpose() * metric_inverse_sqrt;
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Calculate the density fitting factors over a scalar basis, using an auxiliary scalar basis and Libint2 for the three-center and two-center integrals.
+ *
+ *  @param scalar_basis                     The scalar basis over whose basis functions the two-electron integrals should be approximated.
+ *  @param auxiliary_scalar_basis           The auxiliary (fitting) scalar basis, e.g. one that is read in from a 'cc-pvdz-ri' or 'def2-universal-jkfit' basis set.
+ *  @param threshold                        The threshold below which eigenvalues of the Coulomb metric are discarded.
+ *
+ *  @return The density fitting factors over the given scalar basis.
+ */
+DensityFittingFactors DensityFittingFactors::Libint(const ScalarBasis<GTOShell>& scalar_basis, const ScalarBasis<GTOShell>& auxiliary_scalar_basis, const double threshold) {
+
+    const auto three_center_integrals = IntegralCalculator::calculateLibintThreeCenterIntegrals(CoulombRepulsionOperator(), auxiliary_scalar_basis, scalar_basis);
+    const auto two_center_integrals = IntegralCalculator::calculateLibintTwoCenterIntegrals(CoulombRepulsionOperator(), auxiliary_scalar_basis);
+
+    return DensityFittingFactors(three_center_integrals, two_center_integrals, threshold);
+}
+
+
+/**
+ *  Perform a pivoted (incomplete) Cholesky decomposition of a positive semi-definite supermatrix M(p + rows * q, r + rows * s), whose columns are only calculated when they are chosen as a pivot.
+ *
+ *  In every step, the largest remaining diagonal element is chosen as the pivot, and the procedure stops when all remaining diagonal elements are smaller than the threshold. Since the error matrix is positive semi-definite as well, every element of M is then reproduced to within the threshold.
+ *
+ *  @param diagonal                         The diagonal of the supermatrix.
+ *  @param calculate_column                 A function that calculates the column of the supermatrix that corresponds to the given compound index.
+ *  @param rows                             The number of rows of one factor.
+ *  @param cols                             The number of columns of one factor.
+ *  @param threshold                        The threshold on the remaining diagonal elements.
+ *
+ *  @return The Cholesky vectors as factors.
+ */
+DensityFittingFactors DensityFittingFactors::PivotedCholesky(const VectorX<double>& diagonal, const std::function<VectorX<double>(const size_t)>& calculate_column, const size_t rows, const size_t cols, const double threshold) {
+
+    const auto dimension = rows * cols;
+    if (static_cast<size_t>(diagonal.size()) != dimension) {
+        throw std::invalid_argument("DensityFittingFactors::PivotedCholesky(const VectorX<double>&, const std::function<VectorX<double>(const size_t)>&, const size_t, const size_t, const double): The dimension of the diagonal does not match the dimensions of one factor.");
+    }
+
+
+    // The Cholesky vectors are stored in a matrix whose capacity is doubled whenever it is exhausted, which avoids reallocating for every new vector.
+    VectorX<double> residual_diagonal = diagonal;
+    MatrixX<double> L {dimension, std::min<size_t>(dimension, 64)};
+    size_t number_of_vectors = 0;
+
+    while (number_of_vectors < dimension) {
+        Eigen::Index pivot;
+        const double maximum_residual = residual_diagonal.maxCoeff(&pivot);
+        if ((maximum_residual < threshold) || (maximum_residual <= 0.0)) {
+            break;
+        }
+
+        // Calculate the new Cholesky vector from the pivot column, with the contributions of the previous Cholesky vectors removed.
+        VectorX<double> vector = calculate_column(pivot);
+        if (number_of_vectors > 0) {
+            vector.noalias() -= L.leftCols(number_of_vectors) * L.row(pivot).head(number_of_vectors).transpose();
+        }
+        vector /= std::sqrt(maximum_residual);
+
+        if (number_of_vectors == static_cast<size_t>(L.cols())) {
+            L.conservativeResize(Eigen::NoChange, std::min<size_t>(dimension, 2 * L.cols()));
+        }
+        L.col(number_of_vectors) = vector;
+        number_of_vectors++;
+
+        residual_diagonal -= vector.cwiseAbs2();
+        residual_diagonal(pivot) = 0.0;  // Avoid round-off errors for the pivot, which is now reproduced exactly.
+    }
+
+    return DensityFittingFactors(L.leftCols(number_of_vectors), rows, cols);
+}
+
+
+/**
+ *  Perform a pivoted Cholesky decomposition of the given two-electron integrals.
+ *
+ *  @param g                                The two-electron integrals, in chemist's notation.
+ *  @param threshold                        The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+ *
+ *  @return The Cholesky vectors of the two-electron integrals.
+ */
+DensityFittingFactors DensityFittingFactors::Cholesky(const Tensor<double, 4>& g, const double threshold) {
+
+    const auto rows = static_cast<size_t>(g.dimension(0));
+    const auto cols = static_cast<size_t>(g.dimension(1));
+    if ((static_cast<size_t>(g.dimension(2)) != rows) || (static_cast<size_t>(g.dimension(3)) != cols)) {
+        throw std::invalid_argument("DensityFittingFactors::Cholesky(const Tensor<double, 4>&, const double): The dimensions of the bra and ket of the two-electron integrals should be equal.");
+    }
+
+    // The column-major storage of g(p, q, r, s) coincides with the one of the supermatrix M(p + rows * q, r + rows * s).
+    const auto dimension = static_cast<Eigen::Index>(rows * cols);
+    const Eigen::Map<const Eigen::MatrixXd> M {g.data(), dimension, dimension};
+
+    const VectorX<double> diagonal = M.diagonal();
+    const auto calculate_column = [&M](const size_t index) -> VectorX<double> { return M.col(index); };
+
+    return DensityFittingFactors::PivotedCholesky(diagonal, calculate_column, rows, cols, threshold);
+}
+
+
+/**
+ *  Perform a pivoted Cholesky decomposition of the Coulomb repulsion integrals over a scalar basis, using Libint2. Only the diagonal integrals (p q|p q) and the columns (. .|r s) of the chosen pivots are ever calculated, so the full set of two-electron integrals is never stored.
+ *
+ *  @param scalar_basis                     The scalar basis over whose basis functions the two-electron integrals should be decomposed.
+ *  @param threshold                        The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+ *
+ *  @return The Cholesky vectors of the Coulomb repulsion integrals.
+ */
+DensityFittingFactors DensityFittingFactors::LibintCholesky(const ScalarBasis<GTOShell>& scalar_basis, const double threshold) {
+
+    const auto& shell_set = scalar_basis.shellSet();
+    auto engine = IntegralEngine::Libint(CoulombRepulsionOperator(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
+    const auto& shell_pairs = scalar_basis.shellPairs();
+    const auto number_of_shells = shell_pairs.numberOfShells();
+    const auto number_of_shell_pairs = shell_pairs.numberOfShellPairs();
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+
+    // Prepare the lookups from a basis function to its shell, and from two shells to their shell pair. Shell pairs that are absent from the list have a zero diagonal, so they are never chosen as a pivot.
+    std::vector<size_t> shell_indices(K);
+    for (size_t a = 0; a < number_of_shells; a++) {
+        const auto bf_a = shell_pairs.basisFunctionIndex(a);
+        for (size_t f = 0; f < shell_pairs.shell(a).numberOfBasisFunctions(); f++) {
+            shell_indices[bf_a + f] = a;
+        }
+    }
+
+    std::vector<size_t> shell_pair_indices(number_of_shells * number_of_shells, number_of_shell_pairs);
+    for (size_t i = 0; i < number_of_shell_pairs; i++) {
+        const auto& pair = shell_pairs.shellPair(i);
+        shell_pair_indices[pair.first_shell_index + number_of_shells * pair.second_shell_index] = i;
+    }
+
+
+    // Calculate the diagonal integrals (p q|p q) from the shell quartets (a b|a b).
+    VectorX<double> diagonal = VectorX<double>::Zero(K * K);
+    for (size_t i = 0; i < number_of_shell_pairs; i++) {
+        const auto& pair = shell_pairs.shellPair(i);
+        const auto nbf_a = shell_pairs.shell(pair.first_shell_index).numberOfBasisFunctions();
+        const auto nbf_b = shell_pairs.shell(pair.second_shell_index).numberOfBasisFunctions();
+
+        const auto buffer = engine.calculate(shell_pairs, i, shell_pairs, i);
+        for (size_t f1 = 0; f1 < nbf_a; f1++) {
+            for (size_t f2 = 0; f2 < nbf_b; f2++) {
+                const auto p = pair.first_basis_function_index + f1;
+                const auto q = pair.second_basis_function_index + f2;
+                diagonal(p + K * q) = buffer->value(0, f1, f2, f1, f2);
+            }
+        }
+    }
+
+
+    // Calculating a pivot column (. .|r s) requires the shell quartets (a b|c d) over all bra shell pairs, which yield the columns of all basis function pairs in the ket shell pair (c d) at once. Since consecutive pivots often belong to the same shell pair, the most recently calculated block of columns is kept.
+    size_t cached_pair_index = number_of_shell_pairs;
+    MatrixX<double> cached_columns;
+
+    const auto calculate_column = [&](const size_t index) -> VectorX<double> {
+        const auto r = index % K;
+        const auto s = index / K;
+        const auto pair_index = shell_pair_indices[shell_indices[r] + number_of_shells * shell_indices[s]];
+        const auto& ket = shell_pairs.shellPair(pair_index);
+        const auto nbf_c = shell_pairs.shell(ket.first_shell_index).numberOfBasisFunctions();
+        const auto nbf_d = shell_pairs.shell(ket.second_shell_index).numberOfBasisFunctions();
+
+        if (pair_index != cached_pair_index) {
+            cached_columns = MatrixX<double>::Zero(K * K, nbf_c * nbf_d);
+
+            for (size_t i = 0; i < number_of_shell_pairs; i++) {
+                const auto& bra = shell_pairs.shellPair(i);
+                const auto nbf_a = shell_pairs.shell(bra.first_shell_index).numberOfBasisFunctions();
+                const auto nbf_b = shell_pairs.shell(bra.second_shell_index).numberOfBasisFunctions();
+
+                const auto buffer = engine.calculate(shell_pairs, i, shell_pairs, pair_index);
+                if (buffer->areIntegralsAllZero()) {
+                    continue;
+                }
+
+                for (size_t f1 = 0; f1 < nbf_a; f1++) {
+                    for (size_t f2 = 0; f2 < nbf_b; f2++) {
+                        const auto p = bra.first_basis_function_index + f1;
+                        const auto q = bra.second_basis_function_index + f2;
+
+                        for (size_t f3 = 0; f3 < nbf_c; f3++) {
+                            for (size_t f4 = 0; f4 < nbf_d; f4++) {
+                                cached_columns(p + K * q, f3 + nbf_c * f4) = buffer->value(0, f1, f2, f3, f4);
+                            }
+                        }
+                    }
+                }
+            }
+            cached_pair_index = pair_index;
+        }
+
+        return cached_columns.col((r - ket.first_basis_function_index) + nbf_c * (s - ket.second_basis_function_index));
+    };
+
+    return DensityFittingFactors::PivotedCholesky(diagonal, calculate_column, K, K, threshold);
+}
+
+
+/*
+ *  MARK: Access
+ */
+
+/**
+ *  @param m            The index of the factor.
+ *
+ *  @return The factor B^m as a (rows x columns)-matrix.
+ */
+MatrixX<double> DensityFittingFactors::factor(const size_t m) const {
+
+    return Eigen::Map<const Eigen::MatrixXd>(this->B.col(m).data(), this->rows, this->cols);
+}
+
+
+/*
+ *  MARK: Transformations
+ */
+
+/**
+ *  Transform both indices of every factor, i.e. B'^m = C_left^T B^m C_right. By choosing only some columns of the coefficient matrices, the factors can be restricted to e.g. the occupied-virtual block.
+ *
+ *  @param C_left           The coefficient matrix that transforms the first index of every factor.
+ *  @param C_right          The coefficient matrix that transforms the second index of every factor.
+ *
+ *  @return The transformed factors.
+ */
+DensityFittingFactors DensityFittingFactors::transformed(const MatrixX<double>& C_left, const MatrixX<double>& C_right) const {
+
+    if ((static_cast<size_t>(C_left.rows()) != this->rows) || (static_cast<size_t>(C_right.rows()) != this->cols)) {
+        throw std::invalid_argument("DensityFittingFactors::transformed(const MatrixX<double>&, const MatrixX<double>&): The dimensions of the coefficient matrices are incompatible with the factors.");
+    }
+
+    const auto number_of_factors = this->numberOfFactors();
+    const auto new_rows = C_left.cols();
+    const auto new_cols = C_right.cols();
+
+
+    // Since all factors are stored contiguously, they can be viewed as one (rows x cols * number of factors)-matrix [B^0 B^1 ...], whose first index can be transformed for all factors at once.
+    const Eigen::Map<const Eigen::MatrixXd> all_factors {this->B.data(), static_cast<Eigen::Index>(this->rows), static_cast<Eigen::Index>(this->cols * number_of_factors)};
+    const MatrixX<double> half_transformed = C_left.transpose() * all_factors;
+
+    // The second index has to be transformed factor per factor.
+    MatrixX<double> B_transformed {new_rows * new_cols, number_of_factors};
+    for (size_t m = 0; m < number_of_factors; m++) {
+        Eigen::Map<Eigen::MatrixXd> factor_transformed {B_transformed.col(m).data(), new_rows, new_cols};
+        factor_transformed.noalias() = half_transformed.middleCols(m * this->cols, this->cols) * C_right;
+    }
+
+    return DensityFittingFactors(B_transformed, new_rows, new_cols);
+}
+
+
+/*
+ *  MARK: Integrals
+ */
+
+/**
+ *  @return The density-fitted two-electron integrals (p q|r s) = sum_m B^m(p q) B^m(r s), in chemist's notation.
+ */
+Tensor<double, 4> DensityFittingFactors::calculateIntegrals() const {
+
+    Tensor<double, 4> g {static_cast<long>(this->rows), static_cast<long>(this->cols), static_cast<long>(this->rows), static_cast<long>(this->cols)};
+
+    // The column-major storage of the tensor g(p, q, r, s) coincides with the column-major storage of the matrix product B B^T, whose element (p + rows * q, r + rows * s) represents (p q|r s).
+    const auto dimension = static_cast<Eigen::Index>(this->rows * this->cols);
+    Eigen::Map<Eigen::MatrixXd> g_matrix {g.data(), dimension, dimension};
+    g_matrix.noalias() = this->B * this->B.transpose();
+
+    return g;
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,240 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/DirectJKBuilder.hpp"
+
+#include "Basis/Integrals/IntegralEngine.hpp"
+
+#include <algorithm>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Create a direct JK builder that uses Libint2 to calculate the Coulomb repulsion integrals.
+ *
+ *  @param scalar_basis                 The scalar basis over whose basis functions the direct and exchange matrices should be expressed.
+ *  @param screening_threshold          The threshold for the density-weighted Schwarz screening of shell quartets.
+ *  @param full_rebuild_frequency       The number of updates after which the direct and exchange matrices are rebuilt from scratch, i.e. every `full_rebuild_frequency`-th update is a full build.
+ *
+ *  @return A direct JK builder that uses Libint2 to calculate the Coulomb repulsion integrals.
+ */
+DirectJKBuilder DirectJKBuilder::Libint(const ScalarBasis<GTOShell>& scalar_basis, const double screening_threshold, const size_t full_rebuild_frequency) {
+
+    const auto& shell_set = scalar_basis.shellSet();
+    const auto engine = IntegralEngine::Libint(CoulombRepulsionOperator(), shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+
+    // Copy the shell pairs that are cached in the scalar basis, since the builder stores its own Schwarz bounds.
+    return DirectJKBuilder(scalar_basis.shellPairs(), engine, screening_threshold, full_rebuild_frequency);
+}
+
+
+/*
+ *  MARK: Access
+ */
+
+/**
+ *  @return The number of basis functions over which the direct and exchange matrices are expressed.
+ */
+size_t DirectJKBuilder::numberOfBasisFunctions() const {
+
+    const auto last_shell_index = this->shell_pairs.numberOfShells() - 1;
+    return this->shell_pairs.basisFunctionIndex(last_shell_index) + this->shell_pairs.shell(last_shell_index).numberOfBasisFunctions();
+}
+
+
+/*
+ *  MARK: Building
+ */
+
+/**
+ *  Calculate the direct and exchange matrices for the given density matrices, in one pass over the shell quartets.
+ *
+ *  @param densities            The density matrices, expressed in the scalar basis.
+ *
+ *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+ */
+std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> DirectJKBuilder::calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) {
+
+    const auto nbf = this->numberOfBasisFunctions();
+    for (const auto& D : densities) {
+        if (D.dimension() != nbf) {
+            throw std::invalid_argument("DirectJKBuilder::calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>&): The dimension of a density matrix does not match the number of basis functions.");
+        }
+    }
+
+    const auto number_of_densities = densities.size();
+    std::vector<SquareMatrix<double>> J(number_of_densities, SquareMatrix<double>::Zero(nbf));
+    std::vector<SquareMatrix<double>> K(number_of_densities, SquareMatrix<double>::Zero(nbf));
+
+
+    // For the density-weighted screening, determine the largest absolute density matrix element of every shell block, over all density matrices.
+    const auto number_of_shells = this->shell_pairs.numberOfShells();
+    MatrixX<double> D_max = MatrixX<double>::Zero(number_of_shells, number_of_shells);
+    for (size_t a = 0; a < number_of_shells; a++) {
+        const auto bf_a = this->shell_pairs.basisFunctionIndex(a);
+        const auto nbf_a = this->shell_pairs.shell(a).numberOfBasisFunctions();
+
+        for (size_t b = 0; b < number_of_shells; b++) {
+            const auto bf_b = this->shell_pairs.basisFunctionIndex(b);
+            const auto nbf_b = this->shell_pairs.shell(b).numberOfBasisFunctions();
+
+            for (const auto& D : densities) {
+                D_max(a, b) = std::max(D_max(a, b), D.block(bf_a, bf_b, nbf_a, nbf_b).cwiseAbs().maxCoeff());
+            }
+        }
+    }
+
+
+    // Loop over the symmetry-unique shell quartets (ab|cd), with a >= b, c >= d and (ab) >= (cd).
+    this->number_of_calculated_shell_quartets = 0;
+    for (size_t p = 0; p < this->unique_pair_indices.size(); p++) {
+        const auto& bra = this->shell_pairs.shellPair(this->unique_pair_indices[p]);
+        const auto a = bra.first_shell_index;
+        const auto b = bra.second_shell_index;
+
+        for (size_t q = 0; q <= p; q++) {
+            const auto& ket = this->shell_pairs.shellPair(this->unique_pair_indices[q]);
+            const auto c = ket.first_shell_index;
+            const auto d = ket.second_shell_index;
+
+            // The direct contributions are contracted with D(ab) and D(cd), the exchange contributions with D(ac), D(ad), D(bc) and D(bd).
+            const auto D_quartet = std::max({2 * D_max(a, b), 2 * D_max(c, d), D_max(a, c), D_max(a, d), D_max(b, c), D_max(b, d)});
+            if (bra.schwarz_bound * ket.schwarz_bound * D_quartet < this->screening_threshold) {
+                continue;
+            }
+
+            const auto buffer = this->engine->calculate(this->shell_pairs, this->unique_pair_indices[p], this->shell_pairs, this->unique_pair_indices[q]);
+            this->number_of_calculated_shell_quartets++;
+            if (buffer->areIntegralsAllZero()) {
+                continue;
+            }
+
+            // Every unique integral represents up to 8 equivalent integrals. Accumulating all 8 permutations with a weight of (degeneracy / 8) counts every integral of the full tensor exactly once.
+            const double degeneracy = (a == b ? 1.0 : 2.0) * (c == d ? 1.0 : 2.0) * (p == q ? 1.0 : 2.0);
+            const double weight = degeneracy / 8.0;
+
+            const auto nbf_a = this->shell_pairs.shell(a).numberOfBasisFunctions();
+            const auto nbf_b = this->shell_pairs.shell(b).numberOfBasisFunctions();
+            const auto nbf_c = this->shell_pairs.shell(c).numberOfBasisFunctions();
+            const auto nbf_d = this->shell_pairs.shell(d).numberOfBasisFunctions();
+
+            for (size_t f1 = 0; f1 < nbf_a; f1++) {
+                const auto mu = bra.first_basis_function_index + f1;
+
+                for (size_t f2 = 0; f2 < nbf_b; f2++) {
+                    const auto nu = bra.second_basis_function_index + f2;
+
+                    for (size_t f3 = 0; f3 < nbf_c; f3++) {
+                        const auto rho = ket.first_basis_function_index + f3;
+
+                        for (size_t f4 = 0; f4 < nbf_d; f4++) {
+                            const auto lambda = ket.second_basis_function_index + f4;
+
+                            const auto value = weight * buffer->value(0, f1, f2, f3, f4);
+                            for (size_t i = 0; i < number_of_densities; i++) {
+                                const auto& D = densities[i];
+
+                                // The direct contributions of (mu nu|rho lambda) and its permutations.
+                                const auto J_bra = value * (D(rho, lambda) + D(lambda, rho));
+                                const auto J_ket = value * (D(mu, nu) + D(nu, mu));
+                                J[i](mu, nu) += J_bra;
+                                J[i](nu, mu) += J_bra;
+                                J[i](rho, lambda) += J_ket;
+                                J[i](lambda, rho) += J_ket;
+
+                                // The exchange contributions of (mu nu|rho lambda) and its permutations: (ij|kl) contributes D(kj) to K(il).
+                                K[i](mu, lambda) += value * D(rho, nu);
+                                K[i](nu, lambda) += value * D(rho, mu);
+                                K[i](mu, rho) += value * D(lambda, nu);
+                                K[i](nu, rho) += value * D(lambda, mu);
+                                K[i](rho, nu) += value * D(mu, lambda);
+                                K[i](lambda, nu) += value * D(mu, rho);
+                                K[i](rho, mu) += value * D(nu, lambda);
+                                K[i](lambda, mu) += value * D(nu, rho);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return {J, K};
+}
+
+
+/**
+ *  Update the direct and exchange matrices for the given density matrices, using the density matrices of the previous update as a reference.
+ *
+ *  Since J and K are linear in the density matrix, only the contributions of the density matrix differences ΔD have to be calculated. Since ΔD becomes smaller during an SCF procedure, the density-weighted screening then neglects more and more shell quartets, which makes late iterations cheaper.
+ *
+ *  @param densities            The density matrices, expressed in the scalar basis.
+ *
+ *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+ *
+ *  @note A full build is performed for the first update, for every `full_rebuild_frequency`-th update after it (i.e. after `full_rebuild_frequency - 1` incremental updates), and whenever the number of density matrices changes.
+ */
+std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> DirectJKBuilder::updateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) {
+
+    const auto number_of_densities = densities.size();
+    const bool is_full_build = (this->reference_densities.size() != number_of_densities) || (this->number_of_incremental_builds + 1 >= this->full_rebuild_frequency);
+
+    if (is_full_build) {
+        const auto JK = this->calculateDirectAndExchangeMatrices(densities);
+
+        this->reference_direct_matrices = JK.first;
+        this->reference_exchange_matrices = JK.second;
+        this->number_of_incremental_builds = 0;
+    } else {
+        std::vector<SquareMatrix<double>> delta_densities;
+        delta_densities.reserve(number_of_densities);
+        for (size_t i = 0; i < number_of_densities; i++) {
+            delta_densities.push_back(densities[i] - this->reference_densities[i]);
+        }
+
+        const auto delta_JK = this->calculateDirectAndExchangeMatrices(delta_densities);
+        for (size_t i = 0; i < number_of_densities; i++) {
+            this->reference_direct_matrices[i] += delta_JK.first[i];
+            this->reference_exchange_matrices[i] += delta_JK.second[i];
+        }
+        this->number_of_incremental_builds++;
+    }
+
+    this->reference_densities = densities;
+    return {this->reference_direct_matrices, this->reference_exchange_matrices};
+}
+
+
+/**
+ *  Forget the reference density matrices, such that the next update is a full build.
+ */
+void DirectJKBuilder::resetIncrementalBuilds() {
+
+    this->reference_densities.clear();
+    this->reference_direct_matrices.clear();
+    this->reference_exchange_matrices.clear();
+    this->number_of_incremental_builds = 0;
+}
+
+
+}  // namespace GQCP
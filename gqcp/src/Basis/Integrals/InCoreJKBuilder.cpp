@@ -0,0 +1,52 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Basis/Integrals/InCoreJKBuilder.hpp"
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param g                    The packed two-electron integrals over the scalar basis, in chemist's notation.
+ */
+InCoreJKBuilder::InCoreJKBuilder(const PackedSquareRankFourTensor<double>& g) :
+    g {g} {}
+
+
+/*
+ *  MARK: Building
+ */
+
+/**
+ *  Calculate the direct and exchange matrices for the given density matrices.
+ *
+ *  @param densities            The density matrices, expressed in the scalar basis.
+ *
+ *  @return A pair containing the direct matrices and the exchange matrices, in the order of the given density matrices.
+ */
+std::pair<std::vector<SquareMatrix<double>>, std::vector<SquareMatrix<double>>> InCoreJKBuilder::calculateDirectAndExchangeMatrices(const std::vector<SquareMatrix<double>>& densities) {
+
+    return this->g.contractDirectAndExchange(densities);
+}
+
+
+}  // namespace GQCP
@@ -157,6 +157,12 @@ std::vector<libint2::Atom> LibintInterfacer::interface(const std::vector<Nucleus
  */
 libint2::Shell LibintInterfacer::interface(const GTOShell& shell) const {
 
+    // The unit shell cannot be renorm()alized, so libint2 provides a dedicated one.
+    if (shell.isUnit()) {
+        return libint2::Shell::unit();
+    }
+
+
     // Part 1: exponents
     const auto libint_alpha = this->interface(shell.gaussianExponents());
 
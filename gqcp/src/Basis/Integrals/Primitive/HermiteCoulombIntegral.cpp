@@ -17,7 +17,9 @@
 
 #include "Basis/Integrals/Primitive/HermiteCoulombIntegral.hpp"
 
-#include "Mathematical/Functions/BoysFunction.hpp"
+#include "Mathematical/Functions/TabulatedBoysFunction.hpp"
+
+#include <cmath>
 
 
 namespace GQCP {
@@ -33,9 +35,34 @@ namespace GQCP {
  *  @param C            The nuclear center.
  */
 HermiteCoulombIntegral::HermiteCoulombIntegral(const double p, const Vector<double, 3>& P, const Vector<double, 3>& C) :
+    HermiteCoulombIntegral(p, P, C, 0) {}
+
+
+/**
+ *  @param p                    The exponent of the Hermite Gaussian.
+ *  @param P                    The center of the Hermite Gaussian.
+ *  @param C                    The nuclear center.
+ *  @param maximum_order        The maximum order n for which the base case R^n_{000} should be precomputed. This should be t + u + v for the highest-degree integral R^0_{tuv} that will be requested.
+ *
+ *  @note All base case values are calculated at once through the tabulated Boys function, so that the recursion does not have to evaluate the Boys function in every one of its leaves.
+ */
+HermiteCoulombIntegral::HermiteCoulombIntegral(const double p, const Vector<double, 3>& P, const Vector<double, 3>& C, const size_t maximum_order) :
     p {p},
     P {P},
-    C {C} {}
+    C {C},
+    maximum_order {maximum_order},
+    base_values(maximum_order + 1) {
+
+    // Calculate F_0(x), ..., F_N(x) through one downward recursion, and absorb the factors (-2p)^n.
+    const double x = p * (P - C).squaredNorm();
+    TabulatedBoysFunction::Default().valuesUpTo(maximum_order, x, this->base_values.data());
+
+    double factor = 1.0;
+    for (auto& value : this->base_values) {
+        value *= factor;
+        factor *= -2.0 * p;
+    }
+}
 
 
 /*
@@ -61,11 +88,15 @@ double HermiteCoulombIntegral::operator()(const size_t n, const int t, const int
     }
 
 
-    // Provide the base case for (t == u == v == 0).
+    // Provide the base case for (t == u == v == 0). Use the precomputed values if they are available.
     if ((t == 0) && (u == 0) && (v == 0)) {
+        if (n <= this->maximum_order) {
+            return this->base_values[n];
+        }
+
         const double R2_PC = R_PC.squaredNorm();
 
-        return std::pow(-2.0 * this->p, n) * BoysFunction()(n, p * R2_PC);
+        return std::pow(-2.0 * this->p, n) * TabulatedBoysFunction::Default()(n, p * R2_PC);
     }
 
 
@@ -56,6 +56,24 @@ GTOShell::GTOShell(const size_t l, const Nucleus& nucleus, const std::vector<dou
 }
 
 
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Create a unit shell, i.e. an s-type shell that consists of a single primitive with a Gaussian exponent of zero and a contraction coefficient of one, representing the constant function 1.
+ * 
+ *  @return A unit shell.
+ * 
+ *  @note Placing a unit shell in a shell quartet reduces four-center integrals to three- or two-center integrals, e.g. (P 1|a b) = (P|a b).
+ */
+GTOShell GTOShell::Unit() {
+
+    // The constant function cannot be normalized, so we mark its (trivial) normalization factors as being embedded already.
+    return GTOShell(0, Nucleus(), {0.0}, {1.0}, false, true, true);
+}
+
+
 /*
  *  MARK: Shell characteristics
  */
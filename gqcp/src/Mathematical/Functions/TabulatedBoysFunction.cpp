@@ -0,0 +1,245 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Mathematical/Functions/TabulatedBoysFunction.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Static members
+ */
+
+constexpr double TabulatedBoysFunction::grid_spacing;
+constexpr size_t TabulatedBoysFunction::number_of_taylor_terms;
+constexpr double TabulatedBoysFunction::maximum_tabulated_argument;
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  Construct the tabulated Boys function by pretabulating the Boys function values on the interpolation grid.
+ *
+ *  @param maximum_order            The maximum order of the Boys function that should be able to be evaluated. Since the upward recursion is only stable for orders smaller than the argument, this order should not exceed 36.
+ *
+ *  @note The default maximum order suffices for Coulomb repulsion integrals over shells up to i-functions.
+ */
+TabulatedBoysFunction::TabulatedBoysFunction(const size_t maximum_order) :
+    maximum_order {maximum_order},
+    number_of_tabulated_orders {maximum_order + number_of_taylor_terms} {
+
+    if (maximum_order > 36) {
+        throw std::invalid_argument("TabulatedBoysFunction::TabulatedBoysFunction(const size_t): The maximum order of the tabulated Boys function should not exceed 36.");
+    }
+
+    const auto number_of_grid_points = static_cast<size_t>(std::round(maximum_tabulated_argument / grid_spacing)) + 1;
+    this->table.resize(number_of_grid_points * this->number_of_tabulated_orders);
+
+    const auto N = this->number_of_tabulated_orders - 1;  // The highest tabulated order.
+    for (size_t k = 0; k < number_of_grid_points; k++) {
+        const double x = k * grid_spacing;
+        const double exp_x = std::exp(-x);
+        double* F = &this->table[k * this->number_of_tabulated_orders];
+
+        // Calculate the highest order through its (positive-term, hence numerically stable) series expansion:
+        //      F_N(x) = exp(-x) sum_i (2x)^i / ((2N + 1) (2N + 3) ... (2N + 2i + 1)).
+        double term = 1.0 / (2 * N + 1);
+        double series = term;
+        for (size_t i = 1; term > 1.0e-17 * series; i++) {
+            term *= 2 * x / (2 * N + 2 * i + 1);
+            series += term;
+        }
+        F[N] = exp_x * series;
+
+        // Calculate the lower orders through the downward recursion.
+        for (size_t n = N; n > 0; n--) {
+            F[n - 1] = (2 * x * F[n] + exp_x) / (2 * n - 1);
+        }
+    }
+}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  @return The tabulated Boys function with the default maximum order that is shared throughout the library. Its table is only constructed once, upon its first use.
+ */
+const TabulatedBoysFunction& TabulatedBoysFunction::Default() {
+
+    static const TabulatedBoysFunction boys_function {};  // Function-local statics are initialized in a thread-safe way.
+    return boys_function;
+}
+
+
+/*
+ *  MARK: Function evaluation
+ */
+
+/**
+ *  Calculate the value for the real-valued Boys function F_n(x).
+ *
+ *  @param n        The degree of the Boys function.
+ *  @param x        The non-negative argument for the Boys function.
+ *
+ *  @return The value F_n(x).
+ */
+double TabulatedBoysFunction::operator()(const size_t n, const double x) const {
+
+    if (n > this->maximum_order) {
+        throw std::invalid_argument("TabulatedBoysFunction::operator()(const size_t, const double): The requested order exceeds the maximum tabulated order.");
+    }
+
+    if (x < 0.0) {
+        throw std::invalid_argument("TabulatedBoysFunction::operator()(const size_t, const double): The argument should be non-negative.");
+    }
+
+
+    // For small arguments, the requested order can be interpolated directly.
+    if (x < maximum_tabulated_argument) {
+        const auto k = static_cast<size_t>(x / grid_spacing + 0.5);  // The index of the nearest grid point.
+        const double minus_delta = k * grid_spacing - x;
+        const double* F = &this->table[k * this->number_of_tabulated_orders + n];
+
+        // Evaluate the Taylor expansion sum_j F_{n+j}(x_k) (-delta)^j / j! through a Horner scheme.
+        double value = F[number_of_taylor_terms - 1];
+        for (size_t j = number_of_taylor_terms - 1; j > 0; j--) {
+            value = F[j - 1] + minus_delta * value / j;
+        }
+
+        return value;
+    }
+
+
+    // For large arguments, use the upward recursion.
+    const double exp_x = std::exp(-x);
+    double value = 0.5 * std::sqrt(boost::math::constants::pi<double>() / x) * std::erf(std::sqrt(x));
+    for (size_t m = 0; m < n; m++) {
+        value = ((2 * m + 1) * value - exp_x) / (2 * x);
+    }
+
+    return value;
+}
+
+
+/**
+ *  Calculate all the values F_0(x), F_1(x), ..., F_N(x) at once.
+ *
+ *  @param N            The maximum degree of the Boys function.
+ *  @param x            The non-negative argument for the Boys function.
+ *  @param values       A pointer to a contiguous array of (at least) N + 1 elements, to which the values are written.
+ */
+void TabulatedBoysFunction::valuesUpTo(const size_t N, const double x, double* values) const {
+
+    if (N > this->maximum_order) {
+        throw std::invalid_argument("TabulatedBoysFunction::valuesUpTo(const size_t, const double, double*): The requested order exceeds the maximum tabulated order.");
+    }
+
+    if (x < 0.0) {
+        throw std::invalid_argument("TabulatedBoysFunction::valuesUpTo(const size_t, const double, double*): The argument should be non-negative.");
+    }
+
+    const double exp_x = std::exp(-x);
+
+
+    // For small arguments, interpolate the highest order and recurse downwards.
+    if (x < maximum_tabulated_argument) {
+        values[N] = this->operator()(N, x);
+
+        for (size_t n = N; n > 0; n--) {
+            values[n - 1] = (2 * x * values[n] + exp_x) / (2 * n - 1);
+        }
+    }
+
+
+    // For large arguments, calculate F_0 exactly and recurse upwards.
+    else {
+        values[0] = 0.5 * std::sqrt(boost::math::constants::pi<double>() / x) * std::erf(std::sqrt(x));
+
+        for (size_t n = 0; n < N; n++) {
+            values[n + 1] = ((2 * n + 1) * values[n] - exp_x) / (2 * x);
+        }
+    }
+}
+
+
+/**
+ *  Calculate all the values F_0(x), F_1(x), ..., F_N(x) at once.
+ *
+ *  @param N            The maximum degree of the Boys function.
+ *  @param x            The non-negative argument for the Boys function.
+ *
+ *  @return A vector containing the values F_0(x), F_1(x), ..., F_N(x).
+ */
+VectorX<double> TabulatedBoysFunction::valuesUpTo(const size_t N, const double x) const {
+
+    VectorX<double> values {N + 1};
+    this->valuesUpTo(N, x, values.data());
+
+    return values;
+}
+
+
+/**
+ *  Calculate all the values F_0(x_i), F_1(x_i), ..., F_N(x_i) for a batch of arguments.
+ *
+ *  @param N            The maximum degree of the Boys function.
+ *  @param x            The batch of non-negative arguments for the Boys function.
+ *
+ *  @return A (number of arguments x N+1)-matrix, in which the element (i, n) represents F_n(x_i). Since the matrix is column-major, the values of one order are contiguous over all the arguments, which is the SIMD-friendly layout for subsequent recursions.
+ */
+MatrixX<double> TabulatedBoysFunction::valuesUpTo(const size_t N, const VectorX<double>& x) const {
+
+    const auto number_of_arguments = x.size();
+    MatrixX<double> values {number_of_arguments, N + 1};
+
+    // Interpolate the highest order for every argument. Large arguments get their full set of values through the upward recursion, which overwrites the downward-recursed values afterwards.
+    const VectorX<double> exp_x = (-x.array()).exp();
+    for (size_t i = 0; i < number_of_arguments; i++) {
+        values(i, N) = (x(i) < maximum_tabulated_argument) ? this->operator()(N, x(i)) : 0.0;
+    }
+
+    // Perform the downward recursion as a contiguous loop over all arguments for every order.
+    for (size_t n = N; n > 0; n--) {
+        values.col(n - 1).array() = (2 * x.array() * values.col(n).array() + exp_x.array()) / (2 * n - 1);
+    }
+
+    // Overwrite the values for the arguments for which the upward recursion is stable.
+    std::vector<double> large_argument_values(N + 1);
+    for (size_t i = 0; i < number_of_arguments; i++) {
+        if (x(i) >= maximum_tabulated_argument) {
+            this->valuesUpTo(N, x(i), large_argument_values.data());
+            for (size_t n = 0; n <= N; n++) {
+                values(i, n) = large_argument_values[n];
+            }
+        }
+    }
+
+    return values;
+}
+
+
+}  // namespace GQCP
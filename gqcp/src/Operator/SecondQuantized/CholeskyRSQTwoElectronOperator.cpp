@@ -0,0 +1,349 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Operator/SecondQuantized/CholeskyRSQTwoElectronOperator.hpp"
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Constructors
+ */
+
+/**
+ *  @param cholesky_vectors             The Cholesky vectors (or any other symmetric three-index factorization, such as density fitting factors) of the two-electron integrals. Its factors should be square.
+ */
+CholeskyRSQTwoElectronOperator::CholeskyRSQTwoElectronOperator(const DensityFittingFactors& cholesky_vectors) :
+    cholesky_vectors {cholesky_vectors} {
+
+    if (cholesky_vectors.numberOfRows() != cholesky_vectors.numberOfColumns()) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::CholeskyRSQTwoElectronOperator(const DensityFittingFactors&): The Cholesky vectors should be square.");
+    }
+}
+
+
+/**
+ *  The default constructor, which creates an operator of dimension zero.
+ */
+CholeskyRSQTwoElectronOperator::CholeskyRSQTwoElectronOperator() :
+    CholeskyRSQTwoElectronOperator(DensityFittingFactors(MatrixX<double>::Zero(0, 0), 0, 0)) {}
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Decompose a dense two-electron operator through a pivoted Cholesky decomposition.
+ *
+ *  @param g_op                         The dense two-electron operator, expressed in chemist's notation.
+ *  @param threshold                    The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+ *
+ *  @return The Cholesky-decomposed two-electron operator.
+ */
+CholeskyRSQTwoElectronOperator CholeskyRSQTwoElectronOperator::FromDense(const ScalarRSQTwoElectronOperator<double>& g_op, const double threshold) {
+
+    if (g_op.isExpressedUsingPhysicistsNotation()) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::FromDense(const ScalarRSQTwoElectronOperator<double>&, const double): The two-electron operator should be expressed in chemist's notation.");
+    }
+
+    return CholeskyRSQTwoElectronOperator {DensityFittingFactors::Cholesky(g_op.parameters(), threshold)};
+}
+
+
+/**
+ *  Decompose the Coulomb repulsion integrals over a scalar basis, calculating only their diagonal and the pivot columns through Libint2.
+ *
+ *  @param scalar_basis                 The scalar basis over whose basis functions the two-electron integrals should be decomposed.
+ *  @param threshold                    The threshold on the remaining diagonal elements, which bounds the error on every reconstructed integral.
+ *
+ *  @return The Cholesky-decomposed Coulomb repulsion operator, expressed in the scalar basis.
+ */
+CholeskyRSQTwoElectronOperator CholeskyRSQTwoElectronOperator::Libint(const ScalarBasis<GTOShell>& scalar_basis, const double threshold) {
+
+    return CholeskyRSQTwoElectronOperator {DensityFittingFactors::LibintCholesky(scalar_basis, threshold)};
+}
+
+
+/**
+ *  @param dim                          The number of orbitals.
+ *
+ *  @return A two-electron operator without any Cholesky vectors, i.e. a zero operator.
+ */
+CholeskyRSQTwoElectronOperator CholeskyRSQTwoElectronOperator::Zero(const size_t dim) {
+
+    return CholeskyRSQTwoElectronOperator {DensityFittingFactors(MatrixX<double>::Zero(dim * dim, 0), dim, dim)};
+}
+
+
+/*
+ *  MARK: Access
+ */
+
+/**
+ *  @param p            The first index.
+ *  @param q            The second index.
+ *  @param r            The third index.
+ *  @param s            The fourth index.
+ *
+ *  @return The reconstructed two-electron integral g(p q r s).
+ */
+double CholeskyRSQTwoElectronOperator::operator()(const size_t p, const size_t q, const size_t r, const size_t s) const {
+
+    const auto K = this->numberOfOrbitals();
+    const auto& L = this->cholesky_vectors.matrix();
+
+    return L.row(p + K * q).dot(L.row(r + K * s));
+}
+
+
+/**
+ *  @return The reconstructed two-electron integrals g(p q r s), in chemist's notation.
+ *
+ *  @note This requires O(K^4) memory and should therefore only be used when the full set of integrals is really necessary.
+ */
+SquareRankFourTensor<double> CholeskyRSQTwoElectronOperator::parameters() const {
+
+    return SquareRankFourTensor<double> {this->cholesky_vectors.calculateIntegrals()};
+}
+
+
+/*
+ *  MARK: Calculations
+ */
+
+/**
+ *  Calculate the expectation value of this two-electron operator, given a two-electron density matrix. (This includes the prefactor 1/2.)
+ *
+ *  @param d            The 2-DM (that represents the wave function).
+ *
+ *  @return The expectation value of this two-electron operator, with the given 2-DM.
+ */
+StorageArray<double, ScalarVectorizer> CholeskyRSQTwoElectronOperator::calculateExpectationValue(const Orbital2DM<double>& d) const {
+
+    const auto K = this->numberOfOrbitals();
+    if (d.numberOfOrbitals() != K) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::calculateExpectationValue(const Orbital2DM<double>&): The given 2-DM's dimension is not compatible with the two-electron operator.");
+    }
+
+    // Viewing the 2-DM as the supermatrix d(p + K q, r + K s), the expectation value 0.5 sum_J L^J(p q) d(p q r s) L^J(r s) becomes a trace.
+    const Eigen::Map<const Eigen::MatrixXd> d_matrix {d.tensor().data(), static_cast<Eigen::Index>(K * K), static_cast<Eigen::Index>(K * K)};
+    const auto& L = this->cholesky_vectors.matrix();
+
+    const double expectation_value = 0.5 * L.cwiseProduct(d_matrix * L).sum();
+    return StorageArray<double, ScalarVectorizer> {expectation_value, ScalarVectorizer()};
+}
+
+
+/**
+ *  Calculate the Fockian matrix of this two-electron operator.
+ *
+ *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+ *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+ *
+ *  @return The Fockian matrix.
+ */
+StorageArray<SquareMatrix<double>, ScalarVectorizer> CholeskyRSQTwoElectronOperator::calculateFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const {
+
+    const auto K = this->numberOfOrbitals();
+    if (D.numberOfOrbitals() != K) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::calculateFockianMatrix(const Orbital1DM<double>&, const Orbital2DM<double>&): The 1-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+    if (d.numberOfOrbitals() != K) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::calculateFockianMatrix(const Orbital1DM<double>&, const Orbital2DM<double>&): The 2-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+
+    // With Y^J(p r) = sum_{s t} d(p r s t) L^J(s t), the Fockian matrix F(p q) = 0.5 sum_{r s t} g(q r s t) (d(p r s t) + d(r p s t)) becomes 0.5 sum_J (Y^J + Y^J^T) L^J^T.
+    const Eigen::Map<const Eigen::MatrixXd> d_matrix {d.tensor().data(), static_cast<Eigen::Index>(K * K), static_cast<Eigen::Index>(K * K)};
+    const auto& L = this->cholesky_vectors.matrix();
+    const MatrixX<double> Y = d_matrix * L;
+
+    SquareMatrix<double> F = SquareMatrix<double>::Zero(K);
+    for (size_t J = 0; J < this->numberOfCholeskyVectors(); J++) {
+        const Eigen::Map<const Eigen::MatrixXd> Y_J {Y.col(J).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+        const Eigen::Map<const Eigen::MatrixXd> L_J {L.col(J).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+
+        F.noalias() += 0.5 * (Y_J + Y_J.transpose()) * L_J.transpose();
+    }
+
+    return StorageArray<SquareMatrix<double>, ScalarVectorizer> {F, ScalarVectorizer()};
+}
+
+
+/**
+ *  Calculate the super-Fockian matrix of this two-electron operator.
+ *
+ *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+ *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+ *
+ *  @return The super-Fockian matrix.
+ *
+ *  @note Since the super-Fockian matrix is a rank-four tensor itself, it is calculated from the reconstructed two-electron integrals.
+ */
+StorageArray<SquareRankFourTensor<double>, ScalarVectorizer> CholeskyRSQTwoElectronOperator::calculateSuperFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const {
+
+    return this->dense().calculateSuperFockianMatrix(D, d);
+}
+
+
+/**
+ *  Calculate the direct (Coulomb) matrix J(p q) = sum_{r s} g(p q r s) D(r s).
+ *
+ *  @param D            The 1-DM.
+ *
+ *  @return The direct matrix.
+ */
+SquareMatrix<double> CholeskyRSQTwoElectronOperator::calculateDirectMatrix(const Orbital1DM<double>& D) const {
+
+    const auto K = this->numberOfOrbitals();
+    if (D.numberOfOrbitals() != K) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::calculateDirectMatrix(const Orbital1DM<double>&): The 1-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+    // vec(J) = sum_J vec(L^J) (vec(L^J)^T vec(D)).
+    const auto& L = this->cholesky_vectors.matrix();
+    const Eigen::Map<const Eigen::VectorXd> D_vector {D.matrix().data(), static_cast<Eigen::Index>(K * K)};
+    const VectorX<double> gamma = L.transpose() * D_vector;
+    const VectorX<double> J_vector = L * gamma;
+
+    return SquareMatrix<double> {Eigen::Map<const Eigen::MatrixXd>(J_vector.data(), K, K)};
+}
+
+
+/**
+ *  Calculate the exchange matrix K(p s) = sum_{q r} g(p q r s) D(r q).
+ *
+ *  @param D            The 1-DM.
+ *
+ *  @return The exchange matrix.
+ */
+SquareMatrix<double> CholeskyRSQTwoElectronOperator::calculateExchangeMatrix(const Orbital1DM<double>& D) const {
+
+    const auto K = this->numberOfOrbitals();
+    if (D.numberOfOrbitals() != K) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::calculateExchangeMatrix(const Orbital1DM<double>&): The 1-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+    // K = sum_J L^J D^T L^J.
+    const auto& L = this->cholesky_vectors.matrix();
+    const SquareMatrix<double> D_transpose = D.matrix().transpose();
+
+    SquareMatrix<double> K_matrix = SquareMatrix<double>::Zero(K);
+    for (size_t J = 0; J < this->numberOfCholeskyVectors(); J++) {
+        const Eigen::Map<const Eigen::MatrixXd> L_J {L.col(J).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+        K_matrix.noalias() += L_J * D_transpose * L_J;
+    }
+
+    return K_matrix;
+}
+
+
+/**
+ *  @return The one-electron operator that is the difference between this two-electron operator (E_PQRS) and a product of one-electron operators (E_PQ E_RS).
+ */
+ScalarRSQOneElectronOperator<double> CholeskyRSQTwoElectronOperator::effectiveOneElectronPartition() const {
+
+    // k(p q) = -0.5 sum_r g(p r r q) = -0.5 sum_J (L^J L^J)(p q).
+    const auto K = this->numberOfOrbitals();
+    const auto& L = this->cholesky_vectors.matrix();
+
+    SquareMatrix<double> k = SquareMatrix<double>::Zero(K);
+    for (size_t J = 0; J < this->numberOfCholeskyVectors(); J++) {
+        const Eigen::Map<const Eigen::MatrixXd> L_J {L.col(J).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+        k.noalias() -= 0.5 * L_J * L_J;
+    }
+
+    return ScalarRSQOneElectronOperator<double> {k};
+}
+
+
+/*
+ *  MARK: Conforming to `BasisTransformable`
+ */
+
+/**
+ *  Apply the basis transformation and return the resulting two-electron operator. Every Cholesky vector transforms as a one-electron operator, so this costs O(K^3) per Cholesky vector.
+ *
+ *  @param T            The basis transformation.
+ *
+ *  @return The basis-transformed two-electron operator.
+ */
+CholeskyRSQTwoElectronOperator CholeskyRSQTwoElectronOperator::transformed(const RTransformation<double>& T) const {
+
+    return CholeskyRSQTwoElectronOperator {this->cholesky_vectors.transformed(T.matrix())};
+}
+
+
+/*
+ *  MARK: Conforming to `JacobiRotatable`
+ */
+
+/**
+ *  Apply the Jacobi rotation and return the result. Since a Jacobi rotation only mixes two rows and two columns of every Cholesky vector, this costs O(K) per Cholesky vector.
+ *
+ *  @param jacobi_rotation          The Jacobi rotation.
+ *
+ *  @return The Jacobi-rotated two-electron operator.
+ */
+CholeskyRSQTwoElectronOperator CholeskyRSQTwoElectronOperator::rotated(const JacobiRotation& jacobi_rotation) const {
+
+    // Use Eigen's Jacobi module to apply the Jacobi rotation directly to every Cholesky vector (cfr. T.adjoint() * L^J * T).
+    const auto p = jacobi_rotation.p();
+    const auto q = jacobi_rotation.q();
+    const auto jacobi_rotation_eigen = jacobi_rotation.Eigen();
+
+    const auto K = this->numberOfOrbitals();
+    MatrixX<double> L = this->cholesky_vectors.matrix();
+    for (size_t J = 0; J < this->numberOfCholeskyVectors(); J++) {
+        Eigen::Map<Eigen::MatrixXd> L_J {L.col(J).data(), static_cast<Eigen::Index>(K), static_cast<Eigen::Index>(K)};
+        L_J.applyOnTheLeft(p, q, jacobi_rotation_eigen.adjoint());
+        L_J.applyOnTheRight(p, q, jacobi_rotation_eigen);
+    }
+
+    return CholeskyRSQTwoElectronOperator {DensityFittingFactors(L, K, K)};
+}
+
+
+/*
+ *  MARK: Operations
+ */
+
+/**
+ *  Addition-assignment, which appends the Cholesky vectors of the other operator.
+ */
+CholeskyRSQTwoElectronOperator& CholeskyRSQTwoElectronOperator::operator+=(const CholeskyRSQTwoElectronOperator& rhs) {
+
+    const auto K = this->numberOfOrbitals();
+    if (rhs.numberOfOrbitals() != K) {
+        throw std::invalid_argument("CholeskyRSQTwoElectronOperator::operator+=(const CholeskyRSQTwoElectronOperator&): The dimensions of the two-electron operators are incompatible.");
+    }
+
+    const auto& L_lhs = this->cholesky_vectors.matrix();
+    const auto& L_rhs = rhs.cholesky_vectors.matrix();
+
+    MatrixX<double> L {K * K, L_lhs.cols() + L_rhs.cols()};
+    L << L_lhs, L_rhs;
+
+    this->cholesky_vectors = DensityFittingFactors(L, K, K);
+    return *this;
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,239 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Named constructors
+ */
+
+/**
+ *  Pack a dense two-electron operator.
+ *
+ *  @param g_op                         The dense two-electron operator, expressed in chemist's notation.
+ *
+ *  @return The packed two-electron operator.
+ */
+PackedRSQTwoElectronOperator PackedRSQTwoElectronOperator::FromDense(const ScalarRSQTwoElectronOperator<double>& g_op) {
+
+    if (g_op.isExpressedUsingPhysicistsNotation()) {
+        throw std::invalid_argument("PackedRSQTwoElectronOperator::FromDense(const ScalarRSQTwoElectronOperator<double>&): The two-electron operator should be expressed in chemist's notation.");
+    }
+
+    return PackedRSQTwoElectronOperator {PackedSquareRankFourTensor<double>(g_op.parameters())};
+}
+
+
+/*
+ *  MARK: Calculations
+ */
+
+/**
+ *  Calculate the expectation value of this two-electron operator, given a two-electron density matrix. (This includes the prefactor 1/2.)
+ *
+ *  @param d            The 2-DM (that represents the wave function).
+ *
+ *  @return The expectation value of this two-electron operator, with the given 2-DM.
+ */
+StorageArray<double, ScalarVectorizer> PackedRSQTwoElectronOperator::calculateExpectationValue(const Orbital2DM<double>& d) const {
+
+    const auto K = this->numberOfOrbitals();
+    if (d.numberOfOrbitals() != K) {
+        throw std::invalid_argument("PackedRSQTwoElectronOperator::calculateExpectationValue(const Orbital2DM<double>&): The given 2-DM's dimension is not compatible with the two-electron operator.");
+    }
+
+    // Perform the contraction 0.5 g(p q r s) d(p q r s).
+    const auto& g = this->parameters();
+    const auto& d_tensor = d.tensor();
+
+    double expectation_value = 0.0;
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    expectation_value += 0.5 * g(p, q, r, s) * d_tensor(p, q, r, s);
+                }
+            }
+        }
+    }
+
+    return StorageArray<double, ScalarVectorizer> {expectation_value, ScalarVectorizer()};
+}
+
+
+/**
+ *  Calculate the Fockian matrix of this two-electron operator.
+ *
+ *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+ *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+ *
+ *  @return The Fockian matrix.
+ */
+StorageArray<SquareMatrix<double>, ScalarVectorizer> PackedRSQTwoElectronOperator::calculateFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const {
+
+    const auto K = this->numberOfOrbitals();
+    if (D.numberOfOrbitals() != K) {
+        throw std::invalid_argument("PackedRSQTwoElectronOperator::calculateFockianMatrix(const Orbital1DM<double>&, const Orbital2DM<double>&): The 1-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+    if (d.numberOfOrbitals() != K) {
+        throw std::invalid_argument("PackedRSQTwoElectronOperator::calculateFockianMatrix(const Orbital1DM<double>&, const Orbital2DM<double>&): The 2-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+
+    // A KISS implementation of the calculation of the Fockian matrix.
+    const auto& g = this->parameters();
+    const auto& d_tensor = d.tensor();
+
+    SquareMatrix<double> F = SquareMatrix<double>::Zero(K);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    for (size_t t = 0; t < K; t++) {
+                        F(p, q) += 0.5 * g(q, r, s, t) * (d_tensor(p, r, s, t) + d_tensor(r, p, s, t));  // Include a factor 1/2 to accommodate for response density matrices.
+                    }
+                }
+            }
+        }
+    }
+
+    return StorageArray<SquareMatrix<double>, ScalarVectorizer> {F, ScalarVectorizer()};
+}
+
+
+/**
+ *  Calculate the super-Fockian matrix of this two-electron operator.
+ *
+ *  @param D            The 1-DM (or the response 1-DM for made-variational wave function models).
+ *  @param d            The 2-DM (or the response 2-DM for made-variational wave function models).
+ *
+ *  @return The super-Fockian matrix.
+ *
+ *  @note Since the super-Fockian matrix is a rank-four tensor itself, it is calculated from the unpacked two-electron integrals.
+ */
+StorageArray<SquareRankFourTensor<double>, ScalarVectorizer> PackedRSQTwoElectronOperator::calculateSuperFockianMatrix(const Orbital1DM<double>& D, const Orbital2DM<double>& d) const {
+
+    return this->dense().calculateSuperFockianMatrix(D, d);
+}
+
+
+/**
+ *  Calculate the direct (Coulomb) matrix J(p q) = sum_{r s} g(p q r s) D(r s).
+ *
+ *  @param D            The 1-DM.
+ *
+ *  @return The direct matrix.
+ */
+SquareMatrix<double> PackedRSQTwoElectronOperator::calculateDirectMatrix(const Orbital1DM<double>& D) const {
+
+    if (D.numberOfOrbitals() != this->numberOfOrbitals()) {
+        throw std::invalid_argument("PackedRSQTwoElectronOperator::calculateDirectMatrix(const Orbital1DM<double>&): The 1-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+    return this->parameters().contractDirect(D.matrix());
+}
+
+
+/**
+ *  Calculate the exchange matrix K(p s) = sum_{q r} g(p q r s) D(r q).
+ *
+ *  @param D            The 1-DM.
+ *
+ *  @return The exchange matrix.
+ */
+SquareMatrix<double> PackedRSQTwoElectronOperator::calculateExchangeMatrix(const Orbital1DM<double>& D) const {
+
+    if (D.numberOfOrbitals() != this->numberOfOrbitals()) {
+        throw std::invalid_argument("PackedRSQTwoElectronOperator::calculateExchangeMatrix(const Orbital1DM<double>&): The 1-DM's dimensions are not compatible with this two-electron operator.");
+    }
+
+    return this->parameters().contractExchange(D.matrix());
+}
+
+
+/**
+ *  @return The one-electron operator that is the difference between this two-electron operator (E_PQRS) and a product of one-electron operators (E_PQ E_RS).
+ */
+ScalarRSQOneElectronOperator<double> PackedRSQTwoElectronOperator::effectiveOneElectronPartition() const {
+
+    // k(p q) = -0.5 sum_r g(p r r q).
+    const auto K = this->numberOfOrbitals();
+    const auto& g = this->parameters();
+
+    SquareMatrix<double> k = SquareMatrix<double>::Zero(K);
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                k(p, q) -= 0.5 * g(p, r, r, q);
+            }
+        }
+    }
+
+    return ScalarRSQOneElectronOperator<double> {k};
+}
+
+
+/*
+ *  MARK: Conforming to `BasisTransformable`
+ */
+
+/**
+ *  Apply the basis transformation and return the resulting two-electron operator. The transformation is performed on the pair matrix g(pq, rs), so the full K^4 tensor is never formed.
+ *
+ *  @param T            The basis transformation.
+ *
+ *  @return The basis-transformed two-electron operator.
+ */
+PackedRSQTwoElectronOperator PackedRSQTwoElectronOperator::transformed(const RTransformation<double>& T) const {
+
+    return PackedRSQTwoElectronOperator {this->parameters().transformed(T.matrix())};
+}
+
+
+/*
+ *  MARK: Conforming to `JacobiRotatable`
+ */
+
+/**
+ *  Apply the Jacobi rotation and return the result. Since a Jacobi rotation only mixes two rows and two columns of every column of the pair matrix, this costs O(K^4), which is dominated by the unpacking of the pair matrix.
+ *
+ *  @param jacobi_rotation          The Jacobi rotation.
+ *
+ *  @return The Jacobi-rotated two-electron operator.
+ */
+PackedRSQTwoElectronOperator PackedRSQTwoElectronOperator::rotated(const JacobiRotation& jacobi_rotation) const {
+
+    // Use Eigen's Jacobi module to apply the Jacobi rotation directly to every column of the pair matrix (cfr. T.adjoint() * M * T).
+    const auto p = jacobi_rotation.p();
+    const auto q = jacobi_rotation.q();
+    const auto jacobi_rotation_eigen = jacobi_rotation.Eigen();
+
+    return PackedRSQTwoElectronOperator {this->parameters().pairTransformed([p, q, &jacobi_rotation_eigen](SquareMatrix<double> M) {
+        M.applyOnTheLeft(p, q, jacobi_rotation_eigen.adjoint());
+        M.applyOnTheRight(p, q, jacobi_rotation_eigen);
+        return M;
+    })};
+}
+
+
+}  // namespace GQCP
@@ -0,0 +1,430 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "QCMethod/CC/PerturbativeTriples.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+
+namespace GQCP {
+
+
+/*
+ *  MARK: Helpers
+ */
+
+/**
+ *  Evaluate an energy contribution for every occupied triplet, distributed over a number of threads.
+ *
+ *  Every thread owns its own workspace, and repeatedly claims the next unprocessed triplet. The contributions are gathered per triplet and summed afterwards in a fixed order, so the result does not depend on the scheduling of the threads.
+ *
+ *  If a thread throws an exception, the remaining triplets are abandoned and the first exception is rethrown in the calling thread after all threads have been joined.
+ *
+ *  @tparam WorkspaceFactory        the type of the callable that creates a per-thread workspace
+ *  @tparam Kernel                  the type of the callable that calculates the contribution of one triplet
+ *
+ *  @param triplets                 the occupied triplets
+ *  @param create_workspace         a callable that creates a fresh workspace for one thread
+ *  @param kernel                   a callable with signature double(const std::array<size_t, 3>&, Workspace&), in which Workspace is the type that is created by the factory
+ *  @param number_of_threads        the number of threads; 0 means as many threads as are supported by the hardware
+ *  @param verbose                  if true, the progress over the triplets and the total wall time are printed to the standard output
+ *
+ *  @return the sum of the contributions of all triplets
+ */
+template <typename WorkspaceFactory, typename Kernel>
+static double sumOverTriplets(const std::vector<std::array<size_t, 3>>& triplets, const WorkspaceFactory& create_workspace, const Kernel& kernel, size_t number_of_threads, const bool verbose) {
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    if (number_of_threads == 0) {
+        number_of_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    number_of_threads = std::max<size_t>(std::min(number_of_threads, triplets.size()), 1);
+
+
+    std::vector<double> contributions(triplets.size(), 0.0);
+    std::atomic<size_t> next_triplet {0};
+    std::atomic<size_t> finished_triplets {0};
+    std::mutex output_mutex;
+    size_t reported_percentage = 0;
+
+    // An exception that escapes a std::thread would terminate the program, so every thread stores its exception, to be rethrown after joining.
+    std::vector<std::exception_ptr> exceptions(number_of_threads);
+
+    const auto work = [&](const size_t thread_index) {
+        try {
+            auto workspace = create_workspace();
+
+            for (size_t t = next_triplet++; t < triplets.size(); t = next_triplet++) {
+                contributions[t] = kernel(triplets[t], workspace);
+
+                if (verbose) {
+                    const auto percentage = 100 * (++finished_triplets) / triplets.size();
+
+                    std::lock_guard<std::mutex> lock {output_mutex};
+                    if (percentage >= reported_percentage + 10) {
+                        reported_percentage = percentage - percentage % 10;
+                        std::cout << "(T): " << reported_percentage << "% of the " << triplets.size() << " occupied triplets done." << std::endl;
+                    }
+                }
+            }
+        } catch (...) {
+            exceptions[thread_index] = std::current_exception();
+            next_triplet = triplets.size();  // Let the other threads stop claiming triplets.
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t thread_index = 1; thread_index < number_of_threads; thread_index++) {
+        threads.emplace_back(work, thread_index);
+    }
+    work(0);  // The calling thread does its share of the work as well.
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+
+    double E = 0.0;
+    for (const auto& contribution : contributions) {
+        E += contribution;
+    }
+
+    if (verbose) {
+        const auto stop = std::chrono::high_resolution_clock::now();
+        std::cout << "(T): " << triplets.size() << " occupied triplets on " << number_of_threads << " thread(s) took "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count()
+                  << " milliseconds to complete." << std::endl;
+    }
+
+    return E;
+}
+
+
+/**
+ *  Permute the axes of a virtual-virtual-virtual block and add it to another one.
+ *
+ *  @param source                   the block that is permuted, stored column-major
+ *  @param shuffle                  the permutation of the axes, in the convention of Eigen::Tensor::shuffle
+ *  @param factor                   the factor with which the permuted block is multiplied
+ *  @param target                   the block to which the permuted block is added, as a v x v^2 matrix
+ */
+static void addPermutedBlock(const MatrixX<double>& source, const Eigen::array<int, 3>& shuffle, const double factor, MatrixX<double>& target) {
+
+    const auto v = static_cast<Eigen::Index>(target.rows());
+    const Eigen::TensorMap<const Eigen::Tensor<double, 3>> source_map {source.data(), v, v, v};
+    Eigen::TensorMap<Eigen::Tensor<double, 3>> target_map {target.data(), v, v, v};
+
+    target_map += factor * source_map.shuffle(shuffle);
+}
+
+
+/**
+ *  @param T                        a rank-four tensor
+ *  @param shuffle                  the new order of the axes
+ *
+ *  @return the tensor with its axes reordered, such that fixing its last two indices leaves a contiguous block in memory
+ */
+static Tensor<double, 4> reordered(const Tensor<double, 4>& T, const Eigen::array<int, 4>& shuffle) {
+    return Tensor<double, 4>(T.shuffle(shuffle));
+}
+
+
+/*
+ *  MARK: General spinor basis
+ */
+
+/**
+ *  Calculate the (T) perturbative triples correction to the CCSD energy, in a general spinor basis.
+ *
+ *  @param sq_hamiltonian           the Hamiltonian expressed in the canonical (HF) spinor basis that was used for the CCSD calculation
+ *  @param ccsd_parameters          the converged CCSD amplitudes
+ *  @param number_of_threads        the number of threads over which the occupied triplets are distributed; 0 means as many threads as are supported by the hardware
+ *  @param verbose                  if true, the progress over the occupied triplets and the total wall time are printed to the standard output
+ *
+ *  @return the (T) energy correction
+ */
+double calculatePerturbativeTriplesCorrection(const GSQHamiltonian<double>& sq_hamiltonian, const QCModel::CCSD<double>& ccsd_parameters, const size_t number_of_threads, const bool verbose) {
+
+    const auto& t1 = ccsd_parameters.t1Amplitudes();
+    const auto& t2 = ccsd_parameters.t2Amplitudes();
+
+    const auto& orbital_space = t1.orbitalSpace();
+    const auto occupied = OccupationType::k_occupied;
+    const auto virtual_ = OccupationType::k_virtual;
+    const auto o = orbital_space.numberOfOrbitals(occupied);
+    const auto v = orbital_space.numberOfOrbitals(virtual_);
+
+    const auto f = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+    const auto V_A = sq_hamiltonian.twoElectron().convertedToPhysicistsNotation().antisymmetrized().parameters();
+
+    const VectorX<double> e_occupied = orbital_space.denseSliceOf(f, occupied, occupied).diagonal();
+    const VectorX<double> e_virtual = orbital_space.denseSliceOf(f, virtual_, virtual_).diagonal();
+    const MatrixX<double> f_ov = orbital_space.denseSliceOf(f, occupied, virtual_);
+
+
+    // Reorder the required integral and amplitude blocks once, such that every block that is needed for one triplet is contiguous and can be used as a matrix in a matrix-matrix product.
+    const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();  // t_i^a
+    const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+    const auto V_vovv = reordered(orbital_space.denseSliceOf(V_A, virtual_, occupied, virtual_, virtual_), {0, 2, 3, 1});  // <ei||bc> as (e,b,c,i)
+    const auto V_ovoo = orbital_space.denseSliceOf(V_A, occupied, virtual_, occupied, occupied);                             // <ma||jk> as (m,a,j,k)
+    const auto V_oovv = reordered(orbital_space.denseSliceOf(V_A, occupied, occupied, virtual_, virtual_), {2, 3, 0, 1});  // <jk||bc> as (b,c,j,k)
+    const auto t2_vvoo = reordered(t2_dense, {2, 3, 0, 1});                                                                  // t_jk^ae as (a,e,j,k), and t_jk^bc as (b,c,j,k)
+    const auto t2_ovvo = reordered(t2_dense, {1, 2, 3, 0});                                                                  // t_im^bc as (m,b,c,i)
+
+    using ConstMap = Eigen::Map<const Eigen::MatrixXd>;
+
+
+    // In the (i;j,k)-term, the connected triples read sum_e t_jk^ae <ei||bc> - sum_m t_im^bc <ma||jk> and the disconnected triples read t_i^a <jk||bc> + f_ia t_jk^bc. Both are stored as (a,bc) matrices.
+    struct Workspace {
+        MatrixX<double> connected_raw;
+        MatrixX<double> disconnected_raw;
+        MatrixX<double> connected_i;  // after applying P(i/jk)
+        MatrixX<double> disconnected_i;
+        MatrixX<double> connected;  // after applying P(i/jk) and P(a/bc)
+        MatrixX<double> disconnected;
+    };
+    const auto create_workspace = [v]() {
+        return Workspace {MatrixX<double>(v, v * v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v)};
+    };
+
+    const auto add_raw_terms = [&](const size_t i, const size_t j, const size_t k, const double factor, Workspace& workspace) {
+        const ConstMap t2_jk {t2_vvoo.data() + v * v * (j + o * k), static_cast<Eigen::Index>(v), static_cast<Eigen::Index>(v)};
+        const ConstMap V_i {V_vovv.data() + v * v * v * i, static_cast<Eigen::Index>(v), static_cast<Eigen::Index>(v * v)};
+        const ConstMap V_jk {V_ovoo.data() + o * v * (j + o * k), static_cast<Eigen::Index>(o), static_cast<Eigen::Index>(v)};
+        const ConstMap t2_i {t2_ovvo.data() + o * v * v * i, static_cast<Eigen::Index>(o), static_cast<Eigen::Index>(v * v)};
+        const Eigen::Map<const Eigen::VectorXd> V_oovv_jk {V_oovv.data() + v * v * (j + o * k), static_cast<Eigen::Index>(v * v)};
+        const Eigen::Map<const Eigen::VectorXd> t2_jk_bc {t2_vvoo.data() + v * v * (j + o * k), static_cast<Eigen::Index>(v * v)};
+
+        workspace.connected_raw.noalias() = t2_jk * V_i;
+        workspace.connected_raw.noalias() -= V_jk.transpose() * t2_i;
+        workspace.connected_i += factor * workspace.connected_raw;
+
+        workspace.disconnected_raw.noalias() = t1_matrix.row(i).transpose() * V_oovv_jk.transpose() + f_ov.row(i).transpose() * t2_jk_bc.transpose();
+        workspace.disconnected_i += factor * workspace.disconnected_raw;
+    };
+
+
+    const auto kernel = [&](const std::array<size_t, 3>& triplet, Workspace& workspace) {
+        const auto i = triplet[0];
+        const auto j = triplet[1];
+        const auto k = triplet[2];
+
+        // Apply P(i/jk) = 1 - P(ij) - P(ik).
+        workspace.connected_i.setZero();
+        workspace.disconnected_i.setZero();
+        add_raw_terms(i, j, k, 1.0, workspace);
+        add_raw_terms(j, i, k, -1.0, workspace);
+        add_raw_terms(k, j, i, -1.0, workspace);
+
+        // Apply P(a/bc) = 1 - P(ab) - P(ac).
+        workspace.connected = workspace.connected_i;
+        addPermutedBlock(workspace.connected_i, {1, 0, 2}, -1.0, workspace.connected);
+        addPermutedBlock(workspace.connected_i, {2, 1, 0}, -1.0, workspace.connected);
+
+        workspace.disconnected = workspace.disconnected_i;
+        addPermutedBlock(workspace.disconnected_i, {1, 0, 2}, -1.0, workspace.disconnected);
+        addPermutedBlock(workspace.disconnected_i, {2, 1, 0}, -1.0, workspace.disconnected);
+
+        // E_ijk = sum_abc W_ijk^abc (W_ijk^abc + V_ijk^abc) / D_ijk^abc.
+        const double e_ijk = e_occupied(i) + e_occupied(j) + e_occupied(k);
+
+        double E = 0.0;
+        for (size_t c = 0; c < v; c++) {
+            for (size_t b = 0; b < v; b++) {
+                for (size_t a = 0; a < v; a++) {
+                    const auto bc = b + v * c;
+                    const double D = e_ijk - e_virtual(a) - e_virtual(b) - e_virtual(c);
+                    E += workspace.connected(a, bc) * (workspace.connected(a, bc) + workspace.disconnected(a, bc)) / D;
+                }
+            }
+        }
+
+        return E;
+    };
+
+
+    // The contributions are symmetric in the occupied indices, and vanish if two of them are equal, so only i<j<k have to be considered. The prefactor 1/36 is therefore multiplied by 3! = 6.
+    std::vector<std::array<size_t, 3>> triplets;
+    for (size_t i = 0; i < o; i++) {
+        for (size_t j = i + 1; j < o; j++) {
+            for (size_t k = j + 1; k < o; k++) {
+                triplets.push_back({i, j, k});
+            }
+        }
+    }
+
+    return sumOverTriplets(triplets, create_workspace, kernel, number_of_threads, verbose) / 6.0;
+}
+
+
+/*
+ *  MARK: Spin-adapted closed-shell
+ */
+
+/**
+ *  Calculate the (T) perturbative triples correction to the spin-adapted closed-shell CCSD energy.
+ *
+ *  @param sq_hamiltonian           the Hamiltonian expressed in the canonical RHF spin-orbital basis that was used for the RCCSD calculation
+ *  @param rccsd_parameters         the converged spin-adapted closed-shell CCSD amplitudes
+ *  @param number_of_threads        the number of threads over which the occupied triplets are distributed; 0 means as many threads as are supported by the hardware
+ *  @param verbose                  if true, the progress over the occupied triplets and the total wall time are printed to the standard output
+ *
+ *  @return the (T) energy correction
+ */
+double calculatePerturbativeTriplesCorrection(const RSQHamiltonian<double>& sq_hamiltonian, const QCModel::RCCSD<double>& rccsd_parameters, const size_t number_of_threads, const bool verbose) {
+
+    const auto& t1 = rccsd_parameters.t1Amplitudes();
+    const auto& t2 = rccsd_parameters.t2Amplitudes();
+
+    const auto& orbital_space = t1.orbitalSpace();
+    const auto occupied = OccupationType::k_occupied;
+    const auto virtual_ = OccupationType::k_virtual;
+    const auto o = orbital_space.numberOfOrbitals(occupied);
+    const auto v = orbital_space.numberOfOrbitals(virtual_);
+
+    const auto f = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+    const auto V = sq_hamiltonian.twoElectron().convertedToPhysicistsNotation().parameters();
+
+    const VectorX<double> e_occupied = orbital_space.denseSliceOf(f, occupied, occupied).diagonal();
+    const VectorX<double> e_virtual = orbital_space.denseSliceOf(f, virtual_, virtual_).diagonal();
+    const MatrixX<double> f_ov = orbital_space.denseSliceOf(f, occupied, virtual_);
+
+
+    // Reorder the required integral and amplitude blocks once, such that every block that is needed for one triplet is contiguous and can be used as a matrix in a matrix-matrix product.
+    const auto& t1_matrix = t1.asImplicitMatrixSlice().asMatrix();  // t_i^a
+    const auto& t2_dense = t2.asImplicitRankFourTensorSlice().asTensor();
+
+    const auto V_ovvv = reordered(orbital_space.denseSliceOf(V, occupied, virtual_, virtual_, virtual_), {2, 3, 1, 0});  // <id|ab> as (a,b,d,i)
+    const auto V_oovo = reordered(orbital_space.denseSliceOf(V, occupied, occupied, virtual_, occupied), {1, 2, 0, 3});  // <kl|cj> as (l,c,k,j)
+    const auto V_oovv = reordered(orbital_space.denseSliceOf(V, occupied, occupied, virtual_, virtual_), {2, 3, 0, 1});  // <ij|ab> as (a,b,i,j)
+    const auto t2_vvoo = reordered(t2_dense, {2, 3, 0, 1});                                                                // t_kj^cd as (c,d,k,j), and t_ij^ab as (a,b,i,j)
+    const auto t2_vvoo_i = reordered(t2_dense, {2, 3, 1, 0});                                                              // t_il^ab as (a,b,l,i)
+
+    using ConstMap = Eigen::Map<const Eigen::MatrixXd>;
+
+
+    // For an ordered occupied tuple (i,j,k), the connected triples read w_ijk^abc = sum_d <id|ab> t_kj^cd - sum_l <kl|cj> t_il^ab and the disconnected triples read v_ijk^abc = 1/2 (<ij|ab> t_k^c + t_ij^ab f_kc). Both are stored as (ab,c) matrices, which have the same memory layout as (a,bc) matrices.
+    struct Workspace {
+        MatrixX<double> connected_raw;
+        MatrixX<double> disconnected_raw;
+        MatrixX<double> connected;  // after the symmetrization over the simultaneous permutations of (ia), (jb) and (kc)
+        MatrixX<double> disconnected;
+        MatrixX<double> Z;
+        MatrixX<double> Z_spin_adapted;
+    };
+    const auto create_workspace = [v]() {
+        return Workspace {MatrixX<double>(v * v, v), MatrixX<double>(v * v, v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v), MatrixX<double>(v, v * v)};
+    };
+
+    const auto calculate_raw_terms = [&](const size_t i, const size_t j, const size_t k, Workspace& workspace) {
+        const ConstMap V_i {V_ovvv.data() + v * v * v * i, static_cast<Eigen::Index>(v * v), static_cast<Eigen::Index>(v)};
+        const ConstMap t2_kj {t2_vvoo.data() + v * v * (k + o * j), static_cast<Eigen::Index>(v), static_cast<Eigen::Index>(v)};
+        const ConstMap t2_i {t2_vvoo_i.data() + v * v * o * i, static_cast<Eigen::Index>(v * v), static_cast<Eigen::Index>(o)};
+        const ConstMap V_kj {V_oovo.data() + o * v * (k + o * j), static_cast<Eigen::Index>(o), static_cast<Eigen::Index>(v)};
+        const Eigen::Map<const Eigen::VectorXd> V_oovv_ij {V_oovv.data() + v * v * (i + o * j), static_cast<Eigen::Index>(v * v)};
+        const Eigen::Map<const Eigen::VectorXd> t2_ij {t2_vvoo.data() + v * v * (i + o * j), static_cast<Eigen::Index>(v * v)};
+
+        workspace.connected_raw.noalias() = V_i * t2_kj.transpose();
+        workspace.connected_raw.noalias() -= t2_i * V_kj;
+
+        workspace.disconnected_raw.noalias() = 0.5 * (V_oovv_ij * t1_matrix.row(k) + t2_ij * f_ov.row(k));
+    };
+
+
+    // The six simultaneous permutations of (ia), (jb) and (kc), given as the permuted occupied tuple and the corresponding Eigen shuffle of the virtual axes.
+    const std::array<std::pair<std::array<size_t, 3>, Eigen::array<int, 3>>, 6> permutations {{
+        {{0, 1, 2}, {0, 1, 2}},
+        {{0, 2, 1}, {0, 2, 1}},
+        {{1, 0, 2}, {1, 0, 2}},
+        {{1, 2, 0}, {2, 0, 1}},
+        {{2, 0, 1}, {1, 2, 0}},
+        {{2, 1, 0}, {2, 1, 0}},
+    }};
+
+    const auto kernel = [&](const std::array<size_t, 3>& triplet, Workspace& workspace) {
+        // Symmetrize the connected and disconnected triples over the simultaneous permutations of (ia), (jb) and (kc).
+        workspace.connected.setZero();
+        workspace.disconnected.setZero();
+        for (const auto& permutation : permutations) {
+            const auto& tuple = permutation.first;
+            calculate_raw_terms(triplet[tuple[0]], triplet[tuple[1]], triplet[tuple[2]], workspace);
+
+            addPermutedBlock(workspace.connected_raw, permutation.second, 1.0, workspace.connected);
+            addPermutedBlock(workspace.disconnected_raw, permutation.second, 1.0, workspace.disconnected);
+        }
+
+        // Spin-adapt Z = W + V through 4 Z_abc + Z_bca + Z_cab - 2 Z_acb - 2 Z_bac - 2 Z_cba.
+        workspace.Z = workspace.connected + workspace.disconnected;
+        workspace.Z_spin_adapted = 4.0 * workspace.Z;
+        addPermutedBlock(workspace.Z, {1, 2, 0}, 1.0, workspace.Z_spin_adapted);
+        addPermutedBlock(workspace.Z, {2, 0, 1}, 1.0, workspace.Z_spin_adapted);
+        addPermutedBlock(workspace.Z, {0, 2, 1}, -2.0, workspace.Z_spin_adapted);
+        addPermutedBlock(workspace.Z, {1, 0, 2}, -2.0, workspace.Z_spin_adapted);
+        addPermutedBlock(workspace.Z, {2, 1, 0}, -2.0, workspace.Z_spin_adapted);
+
+        // E_ijk = sum_abc W_ijk^abc Z~_ijk^abc / D_ijk^abc.
+        const double e_ijk = e_occupied(triplet[0]) + e_occupied(triplet[1]) + e_occupied(triplet[2]);
+
+        double E = 0.0;
+        for (size_t c = 0; c < v; c++) {
+            for (size_t b = 0; b < v; b++) {
+                for (size_t a = 0; a < v; a++) {
+                    const auto bc = b + v * c;
+                    const double D = e_ijk - e_virtual(a) - e_virtual(b) - e_virtual(c);
+                    E += workspace.connected(a, bc) * workspace.Z_spin_adapted(a, bc) / D;
+                }
+            }
+        }
+
+        const auto i = triplet[0];
+        const auto j = triplet[1];
+        const auto k = triplet[2];
+        const double weight = (i == j && j == k) ? 1.0 : ((i == j || j == k) ? 3.0 : 6.0);
+
+        return weight * E;
+    };
+
+
+    // The contributions are symmetric in the occupied indices, so only i<=j<=k have to be considered. They are weighted with the number of distinct permutations of the triplet inside the kernel.
+    std::vector<std::array<size_t, 3>> triplets;
+    for (size_t i = 0; i < o; i++) {
+        for (size_t j = i; j < o; j++) {
+            for (size_t k = j; k < o; k++) {
+                triplets.push_back({i, j, k});
+            }
+        }
+    }
+
+    return sumOverTriplets(triplets, create_workspace, kernel, number_of_threads, verbose) / 3.0;
+}
+
+
+}  // namespace GQCP
@@ -56,8 +56,32 @@ AP1roGJacobiOrbitalOptimizer::AP1roGJacobiOrbitalOptimizer(const size_t N_P, con
  *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
  */
 AP1roGJacobiOrbitalOptimizer::AP1roGJacobiOrbitalOptimizer(const AP1roGGeminalCoefficients& G, const double convergence_threshold, const size_t maximum_number_of_iterations) :
+    AP1roGJacobiOrbitalOptimizer(G, NonLinearEquationSolver<double>::Newton(), convergence_threshold, maximum_number_of_iterations) {}
+
+
+/**
+ *  @param N_P                              the number of electron pairs
+ *  @param K                                the number of spatial orbitals
+ *  @param pse_solver                       the solver that is used to re-solve the AP1roG PSEs in every iteration, e.g. a Newton-Krylov solver for larger systems
+ *  @param convergence_threshold            the threshold used to check for convergence
+ *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
+ *
+ *  The initial guess for the geminal coefficients is zero
+ */
+AP1roGJacobiOrbitalOptimizer::AP1roGJacobiOrbitalOptimizer(const size_t N_P, const size_t K, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double convergence_threshold, const size_t maximum_number_of_iterations) :
+    AP1roGJacobiOrbitalOptimizer(AP1roGGeminalCoefficients(N_P, K), pse_solver, convergence_threshold, maximum_number_of_iterations) {}
+
+
+/**
+ *  @param G                                the initial geminal coefficients
+ *  @param pse_solver                       the solver that is used to re-solve the AP1roG PSEs in every iteration, e.g. a Newton-Krylov solver for larger systems
+ *  @param convergence_threshold            the threshold used to check for convergence
+ *  @param maximum_number_of_iterations     the maximum number of iterations that may be used to achieve convergence
+ */
+AP1roGJacobiOrbitalOptimizer::AP1roGJacobiOrbitalOptimizer(const AP1roGGeminalCoefficients& G, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double convergence_threshold, const size_t maximum_number_of_iterations) :
     N_P {G.numberOfElectronPairs()},
     G {G},
+    pse_solver {pse_solver},
     JacobiOrbitalOptimizer(G.numberOfSpatialOrbitals(), convergence_threshold, maximum_number_of_iterations) {}
 
 
@@ -297,9 +321,8 @@ double AP1roGJacobiOrbitalOptimizer::calculateScalarFunctionChange(const RSQHami
 void AP1roGJacobiOrbitalOptimizer::prepareJacobiSpecificConvergenceChecking(const RSQHamiltonian<double>& sq_hamiltonian) {
 
     // Optimize the AP1roG wave function model in this basis and update the results.
-    auto solver = GQCP::NonLinearEquationSolver<double>::Newton();
     auto environment = GQCP::PSEnvironment::AP1roG(sq_hamiltonian, this->G);  // the initial guess are the current geminal coefficients
-    const auto qc_structure = GQCP::QCMethod::AP1roG(sq_hamiltonian, N_P).optimize(solver, environment);
+    const auto qc_structure = GQCP::QCMethod::AP1roG(sq_hamiltonian, N_P).optimize(this->pse_solver, environment);
 
     this->G = qc_structure.groundStateParameters().geminalCoefficients();
     this->E = qc_structure.groundStateEnergy();
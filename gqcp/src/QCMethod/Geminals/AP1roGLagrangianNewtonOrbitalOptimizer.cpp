@@ -54,10 +54,20 @@ AP1roGLagrangianNewtonOrbitalOptimizer::AP1roGLagrangianNewtonOrbitalOptimizer(c
  *  @param pse_maximum_number_of_iterations         the maximum number of Newton steps that may be used to achieve convergence of the PSEs
  */
 AP1roGLagrangianNewtonOrbitalOptimizer::AP1roGLagrangianNewtonOrbitalOptimizer(const AP1roGGeminalCoefficients& G, std::shared_ptr<BaseHessianModifier> hessian_modifier, const double oo_convergence_threshold, const size_t oo_maximum_number_of_iterations, const double pse_convergence_threshold, const size_t pse_maximum_number_of_iterations) :
+    AP1roGLagrangianNewtonOrbitalOptimizer(G, hessian_modifier, NonLinearEquationSolver<double>::Newton(pse_convergence_threshold, pse_maximum_number_of_iterations), oo_convergence_threshold, oo_maximum_number_of_iterations) {}
+
+
+/**
+ *  @param G                                        the initial geminal coefficients
+ *  @param hessian_modifier                         the modifier functor that should be used when an indefinite Hessian is encountered
+ *  @param pse_solver                               the solver that is used to re-solve the AP1roG PSEs in every iteration, e.g. a Newton-Krylov solver for larger systems
+ *  @param oo_convergence_threshold                 the threshold used to check for convergence
+ *  @param oo_maximum_number_of_iterations          the maximum number of iterations that may be used to achieve convergence
+ */
+AP1roGLagrangianNewtonOrbitalOptimizer::AP1roGLagrangianNewtonOrbitalOptimizer(const AP1roGGeminalCoefficients& G, std::shared_ptr<BaseHessianModifier> hessian_modifier, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double oo_convergence_threshold, const size_t oo_maximum_number_of_iterations) :
     N_P {G.numberOfElectronPairs()},
     G {G},
-    pse_convergence_threshold {pse_convergence_threshold},
-    pse_maximum_number_of_iterations {pse_maximum_number_of_iterations},
+    pse_solver {pse_solver},
     QCMethodNewtonOrbitalOptimizer(hessian_modifier, oo_convergence_threshold, oo_maximum_number_of_iterations) {}
 
 
@@ -73,11 +83,10 @@ AP1roGLagrangianNewtonOrbitalOptimizer::AP1roGLagrangianNewtonOrbitalOptimizer(c
 void AP1roGLagrangianNewtonOrbitalOptimizer::prepareDMCalculation(const RSQHamiltonian<double>& sq_hamiltonian) {
 
     // Optimize the vAP1roG wave function model in this basis and update the results.
-    auto non_linear_solver = GQCP::NonLinearEquationSolver<double>::Newton();
     auto non_linear_environment = GQCP::PSEnvironment::AP1roG(sq_hamiltonian, this->G);  // the initial guess are the current geminal coefficients
     auto linear_solver = GQCP::LinearEquationSolver<double>::HouseholderQR();
 
-    const auto qc_structure = GQCP::QCMethod::vAP1roG(sq_hamiltonian, N_P).optimize(non_linear_solver, non_linear_environment, linear_solver);
+    const auto qc_structure = GQCP::QCMethod::vAP1roG(sq_hamiltonian, N_P).optimize(this->pse_solver, non_linear_environment, linear_solver);
 
     this->G = qc_structure.groundStateParameters().geminalCoefficients();
     this->m_multipliers = qc_structure.groundStateParameters().lagrangeMultipliers();
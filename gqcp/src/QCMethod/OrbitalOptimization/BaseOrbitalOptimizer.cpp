@@ -36,6 +36,23 @@ BaseOrbitalOptimizer::BaseOrbitalOptimizer(const double convergence_threshold, c
     maximum_number_of_iterations {maximum_number_of_iterations} {}
 
 
+/*
+ *  PUBLIC VIRTUAL METHODS
+ */
+
+/**
+ *  Rotate the Hamiltonian and the spinor basis into the next iteration. By default, they are rotated with the rotation matrix from calculateNewRotationMatrix().
+ * 
+ *  @param spinor_basis         the current spinor basis
+ *  @param sq_hamiltonian       the current Hamiltonian
+ */
+void BaseOrbitalOptimizer::applyNewRotation(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) {
+
+    const auto U = this->calculateNewRotationMatrix(sq_hamiltonian);
+    rotate(U, spinor_basis, sq_hamiltonian);
+}
+
+
 /*
  *  PUBLIC METHODS
  */
@@ -43,7 +60,7 @@ BaseOrbitalOptimizer::BaseOrbitalOptimizer(const double convergence_threshold, c
 /**
  *  Optimize the Hamiltonian by subsequently
  *      - checking for convergence (see checkForConvergence())
- *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation matrix (see calculateNewRotationMatrix())
+ *      - rotating the Hamiltonian (and spinor basis) with a newly found rotation (see applyNewRotation())
  * 
  *  @param spinor_basis         the initial spinor basis that contains the spinors to be optimized
  *  @param sq_hamiltonian       the initial (guess for the) Hamiltonian
@@ -55,8 +72,7 @@ void BaseOrbitalOptimizer::optimize(RSpinOrbitalBasis<double, GTOShell>& spinor_
     }
 
     while (this->prepareConvergenceChecking(sq_hamiltonian), !this->checkForConvergence(sq_hamiltonian)) {  // result of the comma operator is the second operand, so this expression effectively means "if not converged"
-        const auto U = this->calculateNewRotationMatrix(sq_hamiltonian);
-        rotate(U, spinor_basis, sq_hamiltonian);
+        this->applyNewRotation(spinor_basis, sq_hamiltonian);
 
         this->number_of_iterations++;
         if (this->number_of_iterations > this->maximum_number_of_iterations) {
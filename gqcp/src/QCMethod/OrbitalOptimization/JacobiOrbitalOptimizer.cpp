@@ -52,6 +52,21 @@ RTransformation<double> JacobiOrbitalOptimizer::calculateNewRotationMatrix(const
 }
 
 
+/**
+ *  Rotate the Hamiltonian and the spinor basis into the next iteration, by applying the optimal Jacobi rotation in place. Only the orbitals p and q are mixed, so this avoids the O(K^5) transformation with the full rotation matrix.
+ * 
+ *  @param spinor_basis         the current spinor basis
+ *  @param sq_hamiltonian       the current Hamiltonian
+ */
+void JacobiOrbitalOptimizer::applyNewRotation(RSpinOrbitalBasis<double, GTOShell>& spinor_basis, RSQHamiltonian<double>& sq_hamiltonian) {
+
+    const auto& jacobi_rotation = this->optimal_jacobi_with_scalar.first;
+
+    spinor_basis.rotate(jacobi_rotation);
+    sq_hamiltonian.rotate(jacobi_rotation);
+}
+
+
 /**
  *  @param sq_hamiltonian           the current Hamiltonian
  * 
@@ -58,4 +58,91 @@ double calculateRMP2EnergyCorrection(const RSQHamiltonian<double>& sq_hamiltonia
 }
 
 
+/**
+ *  Calculate the RMP2 energy correction from the two-electron integrals in the scalar (AO) basis. Only the (ia|jb)-block of the integrals in the RHF orbital basis is calculated, so the full set of MO integrals is never formed.
+ *
+ *  @param g_op                     the two-electron operator expressed in the scalar (AO) basis, in chemist's notation
+ *  @param rhf_parameters           the converged solution to the RHF SCF equations
+ *
+ *  @return the RMP2 energy correction
+ */
+double calculateRMP2EnergyCorrection(const ScalarRSQTwoElectronOperator<double>& g_op, const QCModel::RHF<double>& rhf_parameters) {
+
+    // Prepare some variables.
+    const auto orbital_space = rhf_parameters.orbitalSpace();
+
+    // Calculate the (ia|jb) integrals, which can be accessed through the indices of the RHF orbitals.
+    const auto g = g_op.transformedBlock(rhf_parameters.expansion(), orbital_space, OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual);
+
+
+    double E = 0.0;
+    for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
+        double epsilon_i = rhf_parameters.orbitalEnergy(i);
+
+        for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
+            double epsilon_j = rhf_parameters.orbitalEnergy(j);
+
+            for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
+                double epsilon_a = rhf_parameters.orbitalEnergy(a);
+
+                for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
+                    double epsilon_b = rhf_parameters.orbitalEnergy(b);
+
+
+                    E -= g(i, a, j, b) * (2 * g(i, a, j, b) - g(i, b, j, a)) / (epsilon_a + epsilon_b - epsilon_i - epsilon_j);
+                }
+            }  // end of summation over virtual orbitals
+        }
+    }  // end of summation over occupied orbitals
+
+    return E;
+}
+
+
+/**
+ *  Calculate the RMP2 energy correction from density-fitted two-electron integrals. Only the occupied-virtual block of the factors is transformed to the RHF orbital basis, so the (ia|jb) integrals are the only ones that are ever formed.
+ *
+ *  @param factors                  the density fitting factors expressed in the scalar (AO) basis
+ *  @param rhf_parameters           the converged solution to the RHF SCF equations
+ *
+ *  @return the (density-fitted) RMP2 energy correction
+ */
+double calculateRMP2EnergyCorrection(const DensityFittingFactors& factors, const QCModel::RHF<double>& rhf_parameters) {
+
+    // Prepare some variables.
+    const auto orbital_space = rhf_parameters.orbitalSpace();
+    const auto n_occ = orbital_space.numberOfOrbitals(OccupationType::k_occupied);
+    const auto n_virt = orbital_space.numberOfOrbitals(OccupationType::k_virtual);
+
+    const auto& C = rhf_parameters.expansion().matrix();
+    const MatrixX<double> C_occupied = C.leftCols(n_occ);
+    const MatrixX<double> C_virtual = C.rightCols(n_virt);
+
+
+    // Calculate the (ia|jb) integrals from the occupied-virtual factors.
+    const auto g = factors.transformed(C_occupied, C_virtual).calculateIntegrals();
+
+    double E = 0.0;
+    for (size_t i = 0; i < n_occ; i++) {
+        const double epsilon_i = rhf_parameters.orbitalEnergy(i);
+
+        for (size_t j = 0; j < n_occ; j++) {
+            const double epsilon_j = rhf_parameters.orbitalEnergy(j);
+
+            for (size_t a = 0; a < n_virt; a++) {
+                const double epsilon_a = rhf_parameters.orbitalEnergy(n_occ + a);
+
+                for (size_t b = 0; b < n_virt; b++) {
+                    const double epsilon_b = rhf_parameters.orbitalEnergy(n_occ + b);
+
+                    E -= g(i, a, j, b) * (2 * g(i, a, j, b) - g(i, b, j, a)) / (epsilon_a + epsilon_b - epsilon_i - epsilon_j);
+                }
+            }  // end of summation over virtual orbitals
+        }
+    }  // end of summation over occupied orbitals
+
+    return E;
+}
+
+
 }  // namespace GQCP
@@ -21,6 +21,125 @@
 namespace GQCP {
 
 
+/*
+ *  MARK: Helpers
+ */
+
+/**
+ *  @param g                        the two-electron integrals
+ *  @param row_indices              the orbital indices that label the rows
+ *  @param column_indices           the orbital indices that label the columns
+ *
+ *  @return the matrix of the pair integrals g(p,q,p,q), in which p is a row index and q is a column index
+ */
+static MatrixX<double> pairIntegrals(const SquareRankFourTensor<double>& g, const std::vector<size_t>& row_indices, const std::vector<size_t>& column_indices) {
+
+    MatrixX<double> X {row_indices.size(), column_indices.size()};
+    for (size_t p = 0; p < row_indices.size(); p++) {
+        for (size_t q = 0; q < column_indices.size(); q++) {
+            X(p, q) = g(row_indices[p], column_indices[q], row_indices[p], column_indices[q]);
+        }
+    }
+
+    return X;
+}
+
+
+/**
+ *  @param sq_hamiltonian           the Hamiltonian expressed in an orthonormal basis
+ *  @param orbital_space            the occupied-virtual orbital space of the geminal coefficients
+ *
+ *  @return the occupied-virtual matrix D_i^a = 2 (h_aa - h_ii) + 2 sum_j [(2 g(a,a,j,j) - g(a,j,j,a)) - (2 g(i,i,j,j) - g(i,j,j,i))] - 2 (2 g(a,a,i,i) - g(a,i,i,a)), i.e. the part of the PSE coordinate function (i,a) that is linear in G_i^a and does not depend on the other geminal coefficients
+ */
+static MatrixX<double> pseLinearCoefficients(const RSQHamiltonian<double>& sq_hamiltonian, const OrbitalSpace& orbital_space) {
+
+    const auto& h = sq_hamiltonian.core().parameters();
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
+
+    const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+    const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+
+    // Calculate the Coulomb-exchange sums over the occupied orbitals.
+    const auto coulomb_exchange_sums = [&g, &occupied_indices](const std::vector<size_t>& indices) {
+        VectorX<double> c = VectorX<double>::Zero(indices.size());
+        for (size_t p_ = 0; p_ < indices.size(); p_++) {
+            const auto p = indices[p_];
+            for (const auto& j : occupied_indices) {
+                c(p_) += 2 * g(p, p, j, j) - g(p, j, j, p);
+            }
+        }
+        return c;
+    };
+    const auto c_o = coulomb_exchange_sums(occupied_indices);
+    const auto c_v = coulomb_exchange_sums(virtual_indices);
+
+    MatrixX<double> D {occupied_indices.size(), virtual_indices.size()};
+    for (size_t a_ = 0; a_ < virtual_indices.size(); a_++) {
+        const auto a = virtual_indices[a_];
+
+        for (size_t i_ = 0; i_ < occupied_indices.size(); i_++) {
+            const auto i = occupied_indices[i_];
+            D(i_, a_) = 2 * (h(a, a) - h(i, i)) + 2 * (c_v(a_) - c_o(i_)) - 2 * (2 * g(a, a, i, i) - g(a, i, i, a));
+        }
+    }
+
+    return D;
+}
+
+
+/**
+ *  @param sq_hamiltonian           the Hamiltonian expressed in an orthonormal basis
+ *  @param orbital_space            the occupied-virtual orbital space of the geminal coefficients
+ *  @param X_ov                     the occupied-virtual pair integrals g(i,a,i,a)
+ *  @param G                        the dense occupied-virtual block of the geminal coefficients
+ *
+ *  @return the occupied-virtual matrix of the contributions to the diagonal elements J_{ia,ia} of the PSE Jacobian that come on top of the contributions of its (i==j)- and (a==b)-blocks
+ */
+static MatrixX<double> pseJacobianDiagonal(const RSQHamiltonian<double>& sq_hamiltonian, const OrbitalSpace& orbital_space, const MatrixX<double>& X_ov, const MatrixX<double>& G) {
+
+    const auto& h = sq_hamiltonian.core().parameters();
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
+
+    const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+    const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+
+    // Calculate the Coulomb-exchange sums over the occupied orbitals. Note that, for the virtual orbitals, the order of the indices of the Coulomb integrals differs from the one in the PSEs.
+    VectorX<double> c_o = VectorX<double>::Zero(occupied_indices.size());
+    for (size_t i_ = 0; i_ < occupied_indices.size(); i_++) {
+        const auto i = occupied_indices[i_];
+        for (const auto& k : occupied_indices) {
+            c_o(i_) += 2 * g(i, i, k, k) - g(i, k, k, i);
+        }
+    }
+
+    VectorX<double> c_v = VectorX<double>::Zero(virtual_indices.size());
+    for (size_t a_ = 0; a_ < virtual_indices.size(); a_++) {
+        const auto a = virtual_indices[a_];
+        for (const auto& k : occupied_indices) {
+            c_v(a_) += 2 * g(k, k, a, a) - g(a, k, k, a);
+        }
+    }
+
+
+    // s_i = sum_b g(i,b,i,b) G_i^b and t_a = sum_j g(j,a,j,a) G_j^a.
+    const MatrixX<double> XG = X_ov.cwiseProduct(G);
+    const VectorX<double> s = XG.rowwise().sum();
+    const VectorX<double> t = XG.colwise().sum().transpose();
+
+    MatrixX<double> D {occupied_indices.size(), virtual_indices.size()};
+    for (size_t a_ = 0; a_ < virtual_indices.size(); a_++) {
+        const auto a = virtual_indices[a_];
+
+        for (size_t i_ = 0; i_ < occupied_indices.size(); i_++) {
+            const auto i = occupied_indices[i_];
+            D(i_, a_) = 2 * (h(a, a) - h(i, i)) - 2 * (2 * g(a, a, i, i) - g(a, i, i, a)) + 2 * (c_v(a_) - c_o(i_)) - 2 * (t(a_) + s(i_)) + 4 * XG(i_, a_);
+        }
+    }
+
+    return D;
+}
+
+
 /*
  *  STATIC PUBLIC METHODS
  */
@@ -130,17 +249,36 @@ ImplicitMatrixSlice<double> QCModel::AP1roG::calculatePSECoordinateFunctions(con
     const auto N_P = G.numberOfElectronPairs();
     const auto K = G.numberOfSpatialOrbitals();
 
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
+
     const auto orbital_space = G.orbitalSpace();
+    const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+    const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
 
-    auto F = orbital_space.initializeRepresentableObjectFor<double>(OccupationType::k_occupied, OccupationType::k_virtual);  // create a mathematical representation for an occupied-virtual object
+    const MatrixX<double> G_ov = G.asMatrix().rightCols(K - N_P);  // the dense occupied-virtual block of the geminal coefficients
 
 
-    // Loop over all the elements of F to construct it.
-    for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            F(i, a) = QCModel::AP1roG::calculatePSECoordinateFunction(sq_hamiltonian, G, i, a);
-        }
-    }
+    // Slice the pair integrals g(p,q,p,q) that appear in the PSEs.
+    const auto X_ov = pairIntegrals(g, occupied_indices, virtual_indices);
+    const auto X_vo = pairIntegrals(g, virtual_indices, occupied_indices);
+    const auto X_vv = pairIntegrals(g, virtual_indices, virtual_indices);
+    const auto X_oo = pairIntegrals(g, occupied_indices, occupied_indices);
+
+    // s_i = sum_b g(i,b,i,b) G_i^b and t_a = sum_j g(j,a,j,a) G_j^a.
+    const MatrixX<double> XG = X_ov.cwiseProduct(G_ov);
+    const VectorX<double> s = XG.rowwise().sum();
+    const VectorX<double> t = XG.colwise().sum().transpose();
+
+
+    // Evaluate all PSEs at once. The restrictions (j != i, b != a) in the element-wise formulation have been absorbed in the quadratic and the s/t-terms.
+    auto F = orbital_space.initializeRepresentableObjectFor<double>(OccupationType::k_occupied, OccupationType::k_virtual);  // create a mathematical representation for an occupied-virtual object
+    auto& F_matrix = F.asMatrix();
+
+    F_matrix = X_vo.transpose();
+    F_matrix += (3 * X_ov - X_vo.transpose()).cwiseProduct(G_ov.cwiseProduct(G_ov));
+    F_matrix += pseLinearCoefficients(sq_hamiltonian, orbital_space).cwiseProduct(G_ov);
+    F_matrix += G_ov * X_vv.transpose() + X_oo.transpose() * G_ov + G_ov * (X_ov.transpose() * G_ov);
+    F_matrix.array() -= 2 * G_ov.array() * (s.rowwise().replicate(K - N_P) + t.transpose().colwise().replicate(N_P)).array();
 
     return F;
 }
@@ -239,23 +377,42 @@ ImplicitRankFourTensorSlice<double> QCModel::AP1roG::calculatePSEJacobian(const
     // Prepare some variables.
     const auto N_P = G.numberOfElectronPairs();
     const auto K = G.numberOfSpatialOrbitals();
+    const auto V = K - N_P;  // the number of virtual orbitals
+    const auto dim = N_P * V;
+
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
 
     const auto orbital_space = G.orbitalSpace();
+    const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+    const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+
+    const MatrixX<double> G_ov = G.asMatrix().rightCols(V);  // the dense occupied-virtual block of the geminal coefficients
+
+    const auto X_ov = pairIntegrals(g, occupied_indices, virtual_indices);
+    const auto X_vv = pairIntegrals(g, virtual_indices, virtual_indices);
+    const auto X_oo = pairIntegrals(g, occupied_indices, occupied_indices);
 
+    const MatrixX<double> GX_vv = G_ov.transpose() * X_ov;  // (a,b) -> sum_k g(k,b,k,b) G_k^a
+    const MatrixX<double> GX_oo = G_ov * X_ov.transpose();  // (i,j) -> sum_c g(j,c,j,c) G_i^c
+
+
+    // The Jacobian is stored as a matrix with compound indices (i + N_P a, j + N_P b), so that its (i==j)-blocks are strided and its (a==b)-blocks are contiguous.
     auto J = orbital_space.initializeRepresentableObjectFor<double>(OccupationType::k_occupied, OccupationType::k_virtual, OccupationType::k_occupied, OccupationType::k_virtual);  // initialize an occupied-virtual, occupied-virtual tensor
+    auto J_matrix = J.matrixView();
 
+    using StridedMap = Eigen::Map<Eigen::MatrixXd, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>;
+    for (size_t i = 0; i < N_P; i++) {
+        StridedMap J_i {J_matrix.data() + i * (1 + dim), static_cast<Eigen::Index>(V), static_cast<Eigen::Index>(V), Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(N_P * dim, N_P)};
+        J_i += X_vv + GX_vv - 2 * G_ov.row(i).transpose() * X_ov.row(i);
+    }
 
-    // Loop over all elements of J to construct it.
-    for (const auto& i : orbital_space.indices(OccupationType::k_occupied)) {
-        for (const auto& a : orbital_space.indices(OccupationType::k_virtual)) {
-            for (const auto& j : orbital_space.indices(OccupationType::k_occupied)) {
-                for (const auto& b : orbital_space.indices(OccupationType::k_virtual)) {
-                    J(i, a, j, b) = QCModel::AP1roG::calculatePSEJacobianElement(sq_hamiltonian, G, i, a, j, b);
-                }
-            }
-        }
+    for (size_t a = 0; a < V; a++) {
+        J_matrix.block(N_P * a, N_P * a, N_P, N_P) += X_oo.transpose() + GX_oo - 2 * G_ov.col(a) * X_ov.col(a).transpose();
     }
 
+    const auto D = pseJacobianDiagonal(sq_hamiltonian, orbital_space, X_ov, G_ov);
+    J_matrix.diagonal() += Eigen::Map<const Eigen::VectorXd>(D.data(), dim);
+
     return J;
 }
 
@@ -278,4 +435,69 @@ MatrixFunction<double> QCModel::AP1roG::callablePSEJacobian(const RSQHamiltonian
     return callable;
 }
 
+
+/**
+ *  @param sq_hamiltonian       the Hamiltonian expressed in an orthonormal basis
+ *  @param G                    the AP1roG geminal coefficients
+ *  @param Y                    an occupied-virtual matrix, i.e. a direction in the space of the geminal coefficients
+ *
+ *  @return the product sum_{jb} J_{ia,jb} Y_j^b of the Jacobian of the PSEs (evaluated at the given geminal coefficients) with the given direction, without constructing the Jacobian
+ */
+ImplicitMatrixSlice<double> QCModel::AP1roG::calculatePSEJacobianProduct(const RSQHamiltonian<double>& sq_hamiltonian, const AP1roGGeminalCoefficients& G, const ImplicitMatrixSlice<double>& Y) {
+
+    // Prepare some variables.
+    const auto N_P = G.numberOfElectronPairs();
+    const auto K = G.numberOfSpatialOrbitals();
+
+    const auto& g = sq_hamiltonian.twoElectron().parameters();
+
+    const auto orbital_space = G.orbitalSpace();
+    const auto& occupied_indices = orbital_space.indices(OccupationType::k_occupied);
+    const auto& virtual_indices = orbital_space.indices(OccupationType::k_virtual);
+
+    const MatrixX<double> G_ov = G.asMatrix().rightCols(K - N_P);  // the dense occupied-virtual block of the geminal coefficients
+    const auto& Y_ov = Y.asMatrix();
+
+    const auto X_ov = pairIntegrals(g, occupied_indices, virtual_indices);
+    const auto X_vv = pairIntegrals(g, virtual_indices, virtual_indices);
+    const auto X_oo = pairIntegrals(g, occupied_indices, occupied_indices);
+
+    // u_i = sum_b g(i,b,i,b) Y_i^b and w_a = sum_j g(j,a,j,a) Y_j^a.
+    const MatrixX<double> XY = X_ov.cwiseProduct(Y_ov);
+    const VectorX<double> u = XY.rowwise().sum();
+    const VectorX<double> w = XY.colwise().sum().transpose();
+
+
+    // Contract the (i==j)-blocks, the (a==b)-blocks and the diagonal of the Jacobian with the direction.
+    auto JY = orbital_space.initializeRepresentableObjectFor<double>(OccupationType::k_occupied, OccupationType::k_virtual);
+    auto& JY_matrix = JY.asMatrix();
+
+    JY_matrix = Y_ov * X_vv.transpose() + (Y_ov * X_ov.transpose()) * G_ov;
+    JY_matrix += X_oo.transpose() * Y_ov + G_ov * (X_ov.transpose() * Y_ov);
+    JY_matrix.array() -= 2 * G_ov.array() * (u.rowwise().replicate(K - N_P) + w.transpose().colwise().replicate(N_P)).array();
+    JY_matrix += pseJacobianDiagonal(sq_hamiltonian, orbital_space, X_ov, G_ov).cwiseProduct(Y_ov);
+
+    return JY;
+}
+
+
+/**
+ *  @param sq_hamiltonian           the Hamiltonian expressed in an orthonormal basis
+ *  @param N_P                      the number of electron pairs
+ *
+ *  @return a callable (i.e. with operator()) expression for the product of the Jacobian with a direction: both accepted VectorX<double> arguments, i.e. the geminal coefficients and the direction, should be in a column-major representation
+ */
+JacobianVectorProductFunction<double> QCModel::AP1roG::callablePSEJacobianProduct(const RSQHamiltonian<double>& sq_hamiltonian, const size_t N_P) {
+
+    JacobianVectorProductFunction<double> callable = [&sq_hamiltonian, N_P](const VectorX<double>& x, const VectorX<double>& y) {
+        const auto K = sq_hamiltonian.numberOfOrbitals();  // the number of spatial orbitals
+
+        const auto G = AP1roGGeminalCoefficients::FromColumnMajor(x, N_P, K);
+        const auto Y = ImplicitMatrixSlice<double>::FromBlockRanges(0, N_P, N_P, K, MatrixX<double>::FromColumnMajorVector(y, N_P, K - N_P));
+        return QCModel::AP1roG::calculatePSEJacobianProduct(sq_hamiltonian, G, Y).asVector();
+    };
+
+    return callable;
+}
+
 }  // namespace GQCP
@@ -0,0 +1,77 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "DensityFittedJKBuilder"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/DensityFittedJKBuilder.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+
+
+/**
+ *  Check if the density-fitted direct and exchange matrices are equal to the contractions with the density-fitted two-electron integrals, for symmetric (semi-definite and indefinite) and non-symmetric density matrices.
+ */
+BOOST_AUTO_TEST_CASE(direct_and_exchange_matrices_h2o_sto3g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "6-31G"};
+    const auto nbf = scalar_basis.numberOfBasisFunctions();
+
+    auto jk_builder = GQCP::DensityFittedJKBuilder::Libint(scalar_basis, auxiliary_scalar_basis);
+    BOOST_CHECK_EQUAL(jk_builder.numberOfBasisFunctions(), nbf);
+
+    const auto g = jk_builder.densityFittingFactors().calculateIntegrals();
+
+
+    // Prepare an SCF-like density matrix of rank 5, a symmetric indefinite one and a non-symmetric one.
+    const GQCP::MatrixX<double> C_occupied = GQCP::MatrixX<double>::Random(nbf, 5);
+    const GQCP::SquareMatrix<double> D_scf = C_occupied * C_occupied.transpose();
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(nbf);
+    const GQCP::SquareMatrix<double> D_symmetric = D_random + D_random.transpose();
+
+    const std::vector<GQCP::SquareMatrix<double>> densities {D_scf, D_symmetric, D_random};
+    const auto JK = jk_builder.calculateDirectAndExchangeMatrices(densities);
+
+    for (size_t i = 0; i < densities.size(); i++) {
+        const auto ref_J = g.einsum<2>("ijkl,kl->ij", densities[i]).asMatrix();
+        const auto ref_K = g.einsum<2>("ijkl,kj->il", densities[i]).asMatrix();
+
+        BOOST_CHECK(JK.first[i].isApprox(ref_J, 1.0e-10));
+        BOOST_CHECK(JK.second[i].isApprox(ref_K, 1.0e-10));
+    }
+
+
+    // Check the convenience methods of the base class.
+    BOOST_CHECK(jk_builder.calculateDirectMatrix(D_scf).isApprox(JK.first[0], 1.0e-12));
+    BOOST_CHECK(jk_builder.calculateExchangeMatrix(D_scf).isApprox(JK.second[0], 1.0e-12));
+}
+
+
+/**
+ *  Check if the constructor throws when the density fitting factors are not square.
+ */
+BOOST_AUTO_TEST_CASE(constructor_throws) {
+
+    const GQCP::DensityFittingFactors rectangular_factors {GQCP::MatrixX<double>::Random(12, 5), 3, 4};
+    const GQCP::DensityFittingFactors square_factors {GQCP::MatrixX<double>::Random(16, 5), 4, 4};
+
+    BOOST_CHECK_THROW(GQCP::DensityFittedJKBuilder {rectangular_factors}, std::invalid_argument);
+    BOOST_CHECK_NO_THROW(GQCP::DensityFittedJKBuilder {square_factors});
+}
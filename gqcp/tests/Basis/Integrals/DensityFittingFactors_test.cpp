@@ -0,0 +1,159 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "DensityFittingFactors"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/DensityFittingFactors.hpp"
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+
+/**
+ *  Check the two-center and three-center integrals over the uncontracted s-functions of H in 6-31G, for which analytical expressions exist: for normalized s-type Gaussians with exponents a, b and c on the same center, (a|b) = N_a N_b 2 pi^(5/2) / (a b sqrt(a + b)) and (a|b c) = N_a N_b N_c 2 pi^(5/2) / (a (b + c) sqrt(a + b + c)).
+ */
+BOOST_AUTO_TEST_CASE(two_and_three_center_integrals_h2_631g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2_szabo.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "6-31G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "6-31G"};
+
+    const auto three_center = GQCP::IntegralCalculator::calculateLibintThreeCenterIntegrals(GQCP::CoulombRepulsionOperator(), auxiliary_scalar_basis, scalar_basis);
+    const auto two_center = GQCP::IntegralCalculator::calculateLibintTwoCenterIntegrals(GQCP::CoulombRepulsionOperator(), auxiliary_scalar_basis);
+
+    BOOST_CHECK_EQUAL(three_center.dimension(0), 4);
+    BOOST_CHECK_EQUAL(three_center.dimension(1), 4);
+    BOOST_CHECK_EQUAL(three_center.dimension(2), 4);
+    BOOST_CHECK(two_center.isApprox(two_center.transpose(), 1.0e-12));
+
+
+    // The second basis function is the uncontracted s-function on the first H-atom.
+    const double pi = boost::math::constants::pi<double>();
+    const double alpha = scalar_basis.shellSet().asVector()[1].gaussianExponents()[0];
+    const double N = std::pow(2 * alpha / pi, 0.75);
+
+    const double ref_two_center = N * N * 2 * std::pow(pi, 2.5) / (alpha * alpha * std::sqrt(2 * alpha));
+    const double ref_three_center = N * N * N * 2 * std::pow(pi, 2.5) / (alpha * 2 * alpha * std::sqrt(3 * alpha));
+
+    BOOST_CHECK(std::abs(two_center(1, 1) - ref_two_center) < 1.0e-10);
+    BOOST_CHECK(std::abs(three_center(1, 1, 1) - ref_three_center) < 1.0e-10);
+
+
+    // Check the symmetry of the three-center integrals in the orbital indices.
+    for (size_t P = 0; P < 4; P++) {
+        for (size_t p = 0; p < 4; p++) {
+            for (size_t q = 0; q < 4; q++) {
+                BOOST_CHECK(std::abs(three_center(P, p, q) - three_center(P, q, p)) < 1.0e-12);
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the density-fitted Coulomb energy is a lower bound to the exact one. Since the fitted density minimizes the Coulomb self-repulsion of the fitting error, (rho|rho) - (rho'|rho') = (rho - rho'|rho - rho') >= 0 for every density matrix.
+ */
+BOOST_AUTO_TEST_CASE(coulomb_energy_lower_bound_h2o_sto3g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "6-31G"};
+    const auto nbf = scalar_basis.numberOfBasisFunctions();
+
+    const auto factors = GQCP::DensityFittingFactors::Libint(scalar_basis, auxiliary_scalar_basis);
+    BOOST_CHECK_EQUAL(factors.numberOfRows(), nbf);
+    BOOST_CHECK_EQUAL(factors.numberOfColumns(), nbf);
+    BOOST_CHECK(factors.numberOfFactors() <= auxiliary_scalar_basis.numberOfBasisFunctions());
+
+    const auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::CoulombRepulsionOperator(), scalar_basis);
+    const auto g_DF = factors.calculateIntegrals();
+
+    for (size_t i = 0; i < 5; i++) {
+        const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(nbf);
+        const GQCP::SquareMatrix<double> D = D_random + D_random.transpose();
+
+        const double E_J = (g.einsum<2>("ijkl,kl->ij", D).asMatrix().cwiseProduct(D)).sum();
+        const double E_J_DF = (g_DF.einsum<2>("ijkl,kl->ij", D).asMatrix().cwiseProduct(D)).sum();
+
+        BOOST_CHECK(E_J_DF >= 0.0);
+        BOOST_CHECK(E_J_DF <= E_J + 1.0e-10);
+    }
+}
+
+
+/**
+ *  Check if transforming the density fitting factors is equivalent to transforming the density-fitted two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(transformed_h2o_sto3g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "6-31G"};
+    const auto nbf = scalar_basis.numberOfBasisFunctions();
+
+    const auto factors = GQCP::DensityFittingFactors::Libint(scalar_basis, auxiliary_scalar_basis);
+    const auto g = factors.calculateIntegrals();
+
+
+    // Use rectangular coefficient matrices, as for an occupied-virtual transformation.
+    const GQCP::MatrixX<double> C_left = GQCP::MatrixX<double>::Random(nbf, 3);
+    const GQCP::MatrixX<double> C_right = GQCP::MatrixX<double>::Random(nbf, 4);
+
+    const auto transformed_factors = factors.transformed(C_left, C_right);
+    BOOST_CHECK_EQUAL(transformed_factors.numberOfRows(), 3);
+    BOOST_CHECK_EQUAL(transformed_factors.numberOfColumns(), 4);
+    BOOST_CHECK_EQUAL(transformed_factors.numberOfFactors(), factors.numberOfFactors());
+
+    const auto g_transformed = transformed_factors.calculateIntegrals();
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t a = 0; a < 4; a++) {
+            for (size_t j = 0; j < 3; j++) {
+                for (size_t b = 0; b < 4; b++) {
+
+                    double ref_value = 0.0;
+                    for (size_t p = 0; p < nbf; p++) {
+                        for (size_t q = 0; q < nbf; q++) {
+                            for (size_t r = 0; r < nbf; r++) {
+                                for (size_t s = 0; s < nbf; s++) {
+                                    ref_value += C_left(p, i) * C_right(q, a) * C_left(r, j) * C_right(s, b) * g(p, q, r, s);
+                                }
+                            }
+                        }
+                    }
+
+                    BOOST_CHECK(std::abs(g_transformed(i, a, j, b) - ref_value) < 1.0e-10);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the constructor throws when the dimensions of the factors are incompatible.
+ */
+BOOST_AUTO_TEST_CASE(constructor_throws) {
+
+    const GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(12, 5);
+
+    BOOST_CHECK_NO_THROW(GQCP::DensityFittingFactors(B, 3, 4));
+    BOOST_CHECK_THROW(GQCP::DensityFittingFactors(B, 3, 3), std::invalid_argument);
+}
@@ -0,0 +1,102 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "DirectJKBuilder"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/DirectJKBuilder.hpp"
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+
+
+/**
+ *  Check if the direct and exchange matrices of a direct build are equal to the contractions with the stored two-electron integrals, also for non-symmetric density matrices.
+ */
+BOOST_AUTO_TEST_CASE(direct_vs_stored_h2o_sto3g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto nbf = scalar_basis.numberOfBasisFunctions();
+
+    const auto g = GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::CoulombRepulsionOperator(), scalar_basis);
+    auto jk_builder = GQCP::DirectJKBuilder::Libint(scalar_basis, 0.0);  // Switch off the screening.
+    BOOST_CHECK_EQUAL(jk_builder.numberOfBasisFunctions(), nbf);
+
+
+    // Check the direct and exchange matrices for a symmetric and a non-symmetric density matrix at once.
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(nbf);
+    const GQCP::SquareMatrix<double> D_symmetric = D_random + D_random.transpose();
+    const auto JK = jk_builder.calculateDirectAndExchangeMatrices({D_symmetric, D_random});
+
+    const std::vector<GQCP::SquareMatrix<double>> densities {D_symmetric, D_random};
+    for (size_t i = 0; i < densities.size(); i++) {
+        const auto ref_J = g.einsum<2>("ijkl,kl->ij", densities[i]).asMatrix();
+        const auto ref_K = g.einsum<2>("ijkl,kj->il", densities[i]).asMatrix();
+
+        BOOST_CHECK(JK.first[i].isApprox(ref_J, 1.0e-12));
+        BOOST_CHECK(JK.second[i].isApprox(ref_K, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the incremental builds, which only contract with the density matrix differences, reproduce the full builds, and if the density-weighted screening neglects more shell quartets for small density matrix differences.
+ */
+BOOST_AUTO_TEST_CASE(incremental_builds_h2o_sto3g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto nbf = scalar_basis.numberOfBasisFunctions();
+
+    auto jk_builder = GQCP::DirectJKBuilder::Libint(scalar_basis, 1.0e-10, 3);
+    auto reference_jk_builder = GQCP::DirectJKBuilder::Libint(scalar_basis, 0.0);
+
+
+    // Mimic an SCF procedure by updating with density matrices whose differences become smaller and smaller.
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(nbf);
+    GQCP::SquareMatrix<double> D = D_random + D_random.transpose();
+    std::vector<size_t> numbers_of_calculated_quartets;
+    for (size_t iteration = 0; iteration < 5; iteration++) {
+        const GQCP::SquareMatrix<double> perturbation = GQCP::SquareMatrix<double>::Random(nbf);
+        D += std::pow(1.0e-04, iteration + 1) * (perturbation + perturbation.transpose());
+
+        const auto JK = jk_builder.updateDirectAndExchangeMatrices({D});
+        const auto ref_JK = reference_jk_builder.calculateDirectAndExchangeMatrices({D});
+        numbers_of_calculated_quartets.push_back(jk_builder.numberOfCalculatedShellQuartets());
+
+        BOOST_CHECK(JK.first[0].isApprox(ref_JK.first[0], 1.0e-08));
+        BOOST_CHECK(JK.second[0].isApprox(ref_JK.second[0], 1.0e-08));
+    }
+
+    // With a full rebuild frequency of 3, the first and fourth update are full builds, while the other updates are incremental builds with a small density matrix difference.
+    BOOST_CHECK(numbers_of_calculated_quartets[1] < numbers_of_calculated_quartets[0]);
+    BOOST_CHECK(numbers_of_calculated_quartets[4] < numbers_of_calculated_quartets[3]);
+}
+
+
+/**
+ *  Check if the constructor throws when an invalid full rebuild frequency is given.
+ */
+BOOST_AUTO_TEST_CASE(constructor_throws) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+
+    BOOST_CHECK_THROW(GQCP::DirectJKBuilder::Libint(scalar_basis, 1.0e-12, 0), std::invalid_argument);
+}
@@ -0,0 +1,56 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "InCoreJKBuilder"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/InCoreJKBuilder.hpp"
+#include "Mathematical/Representation/PackedSquareRankFourTensor.hpp"
+
+
+/**
+ *  Check if the direct and exchange matrices are equal to the `einsum` contractions with the unpacked two-electron integrals, for symmetric and non-symmetric density matrices.
+ */
+BOOST_AUTO_TEST_CASE(direct_and_exchange_matrices) {
+
+    const size_t nbf = 6;
+    const auto g_packed = GQCP::PackedSquareRankFourTensor<double>::Random(nbf);
+    const auto g = g_packed.unpacked();
+
+    GQCP::InCoreJKBuilder jk_builder {g_packed};
+    BOOST_CHECK_EQUAL(jk_builder.numberOfBasisFunctions(), nbf);
+
+
+    // Prepare an SCF-like density matrix of rank 2 and a non-symmetric one.
+    const GQCP::MatrixX<double> C_occupied = GQCP::MatrixX<double>::Random(nbf, 2);
+    const GQCP::SquareMatrix<double> D_scf = C_occupied * C_occupied.transpose();
+    const GQCP::SquareMatrix<double> D_random = GQCP::SquareMatrix<double>::Random(nbf);
+
+    const std::vector<GQCP::SquareMatrix<double>> densities {D_scf, D_random};
+    const auto JK = jk_builder.calculateDirectAndExchangeMatrices(densities);
+
+    for (size_t i = 0; i < densities.size(); i++) {
+        const auto ref_J = g.einsum<2>("ijkl,kl->ij", densities[i]).asMatrix();
+        const auto ref_K = g.einsum<2>("ijkl,kj->il", densities[i]).asMatrix();
+
+        BOOST_CHECK(JK.first[i].isApprox(ref_J, 1.0e-12));
+        BOOST_CHECK(JK.second[i].isApprox(ref_K, 1.0e-12));
+    }
+
+    BOOST_CHECK_THROW(jk_builder.calculateDirectAndExchangeMatrices({GQCP::SquareMatrix<double>::Random(nbf + 1)}), std::invalid_argument);
+}
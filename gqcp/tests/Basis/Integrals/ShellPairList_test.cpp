@@ -0,0 +1,147 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "ShellPairList"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/Integrals/ShellPairList.hpp"
+#include "Basis/ScalarBasis/ScalarBasis.hpp"
+#include "Molecule/Molecule.hpp"
+
+
+/**
+ *  Check the shell pairs and primitive pairs for H2//STO-3G.
+ */
+BOOST_AUTO_TEST_CASE(shell_pair_data) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2_szabo.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const GQCP::ShellPairList<GQCP::GTOShell> shell_pairs {scalar_basis.shellSet()};
+
+    // There are two s-shells with three primitives each, which give rise to 4 shell pairs and 4 * 9 primitive pairs.
+    BOOST_CHECK_EQUAL(shell_pairs.numberOfShells(), 2);
+    BOOST_CHECK_EQUAL(shell_pairs.numberOfShellPairs(), 4);
+    BOOST_CHECK_EQUAL(shell_pairs.numberOfPrimitivePairs(), 36);
+
+
+    // Check the data of the primitive pairs of the off-diagonal shell pair.
+    const auto& pair = shell_pairs.shellPair(1);
+    BOOST_CHECK_EQUAL(pair.first_shell_index, 0);
+    BOOST_CHECK_EQUAL(pair.second_shell_index, 1);
+    BOOST_CHECK_EQUAL(pair.second_basis_function_index, 1);
+    BOOST_CHECK_EQUAL(pair.numberOfPrimitivePairs(), 9);
+
+    const auto& shell_a = shell_pairs.shell(0);
+    const auto& shell_b = shell_pairs.shell(1);
+    for (size_t k = pair.primitive_pair_begin; k < pair.primitive_pair_end; k++) {
+        const auto i = shell_pairs.firstPrimitiveIndices()[k];
+        const auto j = shell_pairs.secondPrimitiveIndices()[k];
+
+        const auto alpha = shell_a.gaussianExponents()[i];
+        const auto beta = shell_b.gaussianExponents()[j];
+        const auto& A = shell_a.nucleus().position();
+        const auto& B = shell_b.nucleus().position();
+
+        const auto d_ab = shell_a.contractionCoefficients()[i] * shell_b.contractionCoefficients()[j];
+        BOOST_CHECK(std::abs(shell_pairs.contractionCoefficients()[k] - d_ab) < 1.0e-12);
+
+        // Check the Gaussian product data.
+        const auto p = alpha + beta;
+        BOOST_CHECK(std::abs(shell_pairs.exponentSums()[k] - p) < 1.0e-12);
+        BOOST_CHECK(std::abs(shell_pairs.gaussianPrefactors()[k] - std::exp(-alpha * beta / p * (A - B).squaredNorm())) < 1.0e-12);
+
+        const GQCP::Vector<double, 3> P = (alpha * A + beta * B) / p;
+        BOOST_CHECK(std::abs(shell_pairs.productCenters(GQCP::CartesianDirection::x)[k] - P(0)) < 1.0e-12);
+        BOOST_CHECK(std::abs(shell_pairs.productCenters(GQCP::CartesianDirection::y)[k] - P(1)) < 1.0e-12);
+        BOOST_CHECK(std::abs(shell_pairs.productCenters(GQCP::CartesianDirection::z)[k] - P(2)) < 1.0e-12);
+    }
+
+
+    // Copies share the data token of their original, while new lists get a new one.
+    const auto copied_shell_pairs = shell_pairs;
+    const GQCP::ShellPairList<GQCP::GTOShell> other_shell_pairs {scalar_basis.shellSet()};
+    BOOST_CHECK_EQUAL(copied_shell_pairs.dataToken(), shell_pairs.dataToken());
+    BOOST_CHECK(other_shell_pairs.dataToken() != shell_pairs.dataToken());
+}
+
+
+/**
+ *  Check if a scalar basis constructs its shell pair list only once, and shares it with its copies.
+ */
+BOOST_AUTO_TEST_CASE(scalar_basis_shell_pairs) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+
+    const auto& shell_pairs = scalar_basis.shellPairs();
+    BOOST_CHECK_EQUAL(&scalar_basis.shellPairs(), &shell_pairs);
+    BOOST_CHECK_EQUAL(shell_pairs.numberOfShells(), scalar_basis.shellSet().numberOfShells());
+
+    const auto copied_scalar_basis = scalar_basis;
+    BOOST_CHECK_EQUAL(&copied_scalar_basis.shellPairs(), &shell_pairs);
+}
+
+
+/**
+ *  Check if the in-house Coulomb repulsion integrals that are calculated over shell pairs are equal to the ones that are calculated over shell quartets.
+ */
+BOOST_AUTO_TEST_CASE(in_house_Coulomb_repulsion_integrals) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const GQCP::ShellPairList<GQCP::GTOShell> shell_pairs {scalar_basis.shellSet()};
+
+    auto engine = GQCP::IntegralEngine::InHouse<GQCP::GTOShell>(GQCP::CoulombRepulsionOperator());
+    const auto ref_g = GQCP::IntegralCalculator::calculate(engine, scalar_basis.shellSet(), scalar_basis.shellSet())[0];
+    const auto g = GQCP::IntegralCalculator::calculate(engine, shell_pairs, shell_pairs)[0];
+
+    BOOST_CHECK(g.isApprox(ref_g, 1.0e-12));
+}
+
+
+/**
+ *  Check if the Schwarz screening over shell pairs only neglects negligible integrals, for all integral backends.
+ */
+BOOST_AUTO_TEST_CASE(Schwarz_screening) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto& shell_set = scalar_basis.shellSet();
+    const auto op = GQCP::CoulombRepulsionOperator();
+
+    const auto ref_g = GQCP::IntegralCalculator::calculateLibintIntegrals(op, scalar_basis);
+
+
+    // Check the Libint2 backend.
+    auto libint_engine = GQCP::IntegralEngine::Libint(op, shell_set.maximumNumberOfPrimitives(), shell_set.maximumAngularMomentum());
+    GQCP::ShellPairList<GQCP::GTOShell> shell_pairs {shell_set};
+    BOOST_CHECK(!shell_pairs.hasSchwarzBounds());
+
+    shell_pairs.calculateSchwarzBounds(libint_engine);
+    BOOST_CHECK(shell_pairs.hasSchwarzBounds());
+
+    const auto g_libint = GQCP::IntegralCalculator::calculate(libint_engine, shell_pairs, shell_pairs, 1.0e-12)[0];
+    BOOST_CHECK(g_libint.isApprox(ref_g, 1.0e-10));
+
+
+    // Check the Libcint backend.
+    auto libcint_engine = GQCP::IntegralEngine::Libcint(op, shell_set);
+    const auto g_libcint = GQCP::IntegralCalculator::calculate(libcint_engine, shell_pairs, shell_pairs, 1.0e-12)[0];
+    BOOST_CHECK(g_libcint.isApprox(GQCP::IntegralCalculator::calculateLibcintIntegrals(op, scalar_basis), 1.0e-10));
+}
@@ -0,0 +1,103 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "FourIndexTransformation"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/FourIndexTransformation.hpp"
+#include "Mathematical/Representation/SquareRankFourTensor.hpp"
+
+
+/*
+ *  MARK: Helper functions
+ */
+
+/**
+ *  Calculate the four-index transformation through sequential einsum contractions, which serves as a reference.
+ */
+GQCP::Tensor<double, 4> referenceTransformed(const GQCP::Tensor<double, 4>& g, const GQCP::MatrixX<double>& C1, const GQCP::MatrixX<double>& C2, const GQCP::MatrixX<double>& C3, const GQCP::MatrixX<double>& C4) {
+
+    const GQCP::Tensor<double, 2> C1_tensor = Eigen::TensorMap<Eigen::Tensor<const double, 2>>(C1.data(), C1.rows(), C1.cols());
+    const GQCP::Tensor<double, 2> C2_tensor = Eigen::TensorMap<Eigen::Tensor<const double, 2>>(C2.data(), C2.rows(), C2.cols());
+    const GQCP::Tensor<double, 2> C3_tensor = Eigen::TensorMap<Eigen::Tensor<const double, 2>>(C3.data(), C3.rows(), C3.cols());
+    const GQCP::Tensor<double, 2> C4_tensor = Eigen::TensorMap<Eigen::Tensor<const double, 2>>(C4.data(), C4.rows(), C4.cols());
+
+    const auto temp_1 = g.einsum<1>("TUVW,VR->TURW", C3_tensor).einsum<1>("TURW,WS->TURS", C4_tensor);
+    const auto temp_2 = C2_tensor.einsum<1>("UQ,TURS->TQRS", temp_1);
+    return C1_tensor.einsum<1>("TP,TQRS->PQRS", temp_2);
+}
+
+
+/*
+ *  MARK: Tests
+ */
+
+/**
+ *  Check if the blocked four-index transformation with a different (rectangular) transformation matrix for every axis matches the einsum-based reference.
+ */
+BOOST_AUTO_TEST_CASE(fourIndexTransformed) {
+
+    const size_t K = 6;
+    const auto g = GQCP::SquareRankFourTensor<double>::Random(K);
+
+    const GQCP::MatrixX<double> C1 = GQCP::MatrixX<double>::Random(K, 2);
+    const GQCP::MatrixX<double> C2 = GQCP::MatrixX<double>::Random(K, 4);
+    const GQCP::MatrixX<double> C3 = GQCP::MatrixX<double>::Random(K, 3);
+    const GQCP::MatrixX<double> C4 = GQCP::MatrixX<double>::Random(K, 5);
+
+    const auto g_transformed = GQCP::fourIndexTransformed(g, C1, C2, C3, C4);
+    BOOST_CHECK_EQUAL(g_transformed.dimension(0), 2);
+    BOOST_CHECK_EQUAL(g_transformed.dimension(3), 5);
+    BOOST_CHECK(g_transformed.isApprox(referenceTransformed(g, C1, C2, C3, C4), 1.0e-10));
+
+
+    // Check a transformation that increases the dimension of some of the axes.
+    const GQCP::MatrixX<double> C5 = GQCP::MatrixX<double>::Random(K, 8);
+    BOOST_CHECK(GQCP::fourIndexTransformed(g, C5, C1, C5, C2).isApprox(referenceTransformed(g, C5, C1, C5, C2), 1.0e-10));
+}
+
+
+/**
+ *  Check if transforming only the first or the last two axes matches the einsum-based reference, with identity matrices for the untransformed axes.
+ */
+BOOST_AUTO_TEST_CASE(pairTransformed) {
+
+    const size_t K = 5;
+    const auto g = GQCP::SquareRankFourTensor<double>::Random(K);
+
+    const GQCP::MatrixX<double> C1 = GQCP::MatrixX<double>::Random(K, 3);
+    const GQCP::MatrixX<double> C2 = GQCP::MatrixX<double>::Random(K, 4);
+    const GQCP::MatrixX<double> I = GQCP::MatrixX<double>::Identity(K, K);
+
+    BOOST_CHECK(GQCP::firstPairTransformed(g, C1, C2).isApprox(referenceTransformed(g, C1, C2, I, I), 1.0e-10));
+    BOOST_CHECK(GQCP::secondPairTransformed(g, C1, C2).isApprox(referenceTransformed(g, I, I, C1, C2), 1.0e-10));
+}
+
+
+/**
+ *  Check if the four-index transformation throws when the dimensions of the transformation matrices are incompatible.
+ */
+BOOST_AUTO_TEST_CASE(fourIndexTransformed_throws) {
+
+    const auto g = GQCP::SquareRankFourTensor<double>::Random(3);
+    const GQCP::MatrixX<double> C = GQCP::MatrixX<double>::Random(3, 3);
+    const GQCP::MatrixX<double> C_wrong = GQCP::MatrixX<double>::Random(4, 3);
+
+    BOOST_CHECK_THROW(GQCP::fourIndexTransformed(g, C, C, C_wrong, C), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::secondPairTransformed(g, C, C_wrong), std::invalid_argument);
+}
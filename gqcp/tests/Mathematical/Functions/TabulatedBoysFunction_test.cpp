@@ -0,0 +1,87 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "TabulatedBoysFunction"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Functions/BoysFunction.hpp"
+#include "Mathematical/Functions/TabulatedBoysFunction.hpp"
+
+
+/**
+ *  Check if the tabulated Boys function reproduces the reference (hypergeometric) implementation, both below and above the maximum tabulated argument.
+ */
+BOOST_AUTO_TEST_CASE(reference_values) {
+
+    const GQCP::BoysFunction reference_boys_function {};
+    const GQCP::TabulatedBoysFunction boys_function {};
+
+    for (const double x : {0.0, 1.0e-08, 0.0249, 0.5, 1.23456, 7.77, 15.3, 29.999, 39.99, 40.0, 45.6, 120.0}) {
+        for (size_t n = 0; n <= 16; n++) {
+            BOOST_CHECK(std::abs(boys_function(n, x) - reference_boys_function(n, x)) < 1.0e-14);
+        }
+    }
+}
+
+
+/**
+ *  Check if the values that are calculated through the recursions are equal to the ones that are calculated one by one.
+ */
+BOOST_AUTO_TEST_CASE(valuesUpTo) {
+
+    const GQCP::TabulatedBoysFunction boys_function {};
+    const size_t N = 12;
+
+    // Check the single-argument API.
+    for (const double x : {0.0, 0.3, 12.34, 39.99, 55.0}) {
+        const auto values = boys_function.valuesUpTo(N, x);
+
+        for (size_t n = 0; n <= N; n++) {
+            BOOST_CHECK(std::abs(values(n) - boys_function(n, x)) < 1.0e-14);
+        }
+    }
+
+
+    // Check the batched API.
+    GQCP::VectorX<double> x {5};
+    x << 0.0, 0.3, 12.34, 39.99, 55.0;
+    const auto values = boys_function.valuesUpTo(N, x);
+
+    BOOST_REQUIRE(values.rows() == 5);
+    BOOST_REQUIRE(values.cols() == N + 1);
+    for (size_t i = 0; i < 5; i++) {
+        for (size_t n = 0; n <= N; n++) {
+            BOOST_CHECK(std::abs(values(i, n) - boys_function(n, x(i))) < 1.0e-14);
+        }
+    }
+}
+
+
+/**
+ *  Check if the tabulated Boys function throws when it is asked for an order that is not tabulated.
+ */
+BOOST_AUTO_TEST_CASE(maximum_order) {
+
+    const GQCP::TabulatedBoysFunction boys_function {8};
+
+    BOOST_CHECK_NO_THROW(boys_function(8, 1.0));
+    BOOST_CHECK_THROW(boys_function(9, 1.0), std::invalid_argument);
+    BOOST_CHECK_THROW(boys_function.valuesUpTo(9, 1.0), std::invalid_argument);
+
+    BOOST_CHECK_THROW(GQCP::TabulatedBoysFunction(37), std::invalid_argument);
+}
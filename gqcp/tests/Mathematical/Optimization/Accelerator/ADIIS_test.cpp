@@ -0,0 +1,91 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "ADIIS"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Optimization/Accelerator/ADIIS.hpp"
+
+#include <vector>
+
+
+/**
+ *  Check if the ADIIS coefficients minimize the ARH energy function on the simplex, by comparing with a scan over the simplex. Scalar 'density matrices' and 'Fock matrices' are used, for which tr(D F) = D * F.
+ */
+BOOST_AUTO_TEST_CASE(coefficients) {
+
+    const std::vector<double> densities {0.3, -1.2, 0.8};
+    const std::vector<double> fock_matrices {1.1, 0.4, -0.7};
+    const auto trace = [](const double D, const double F) { return D * F; };
+
+    GQCP::ADIIS<double> adiis {3};
+    for (size_t n = 1; n <= densities.size(); n++) {
+        adiis.update(std::vector<double> {densities.begin(), densities.begin() + n}, std::vector<double> {fock_matrices.begin(), fock_matrices.begin() + n}, trace);
+    }
+    BOOST_REQUIRE(adiis.subspaceDimension() == 3);
+
+    // The ARH energy function, relative to the last iterate.
+    const auto f = [&densities, &fock_matrices](const GQCP::VectorX<double>& c) {
+        double value = 0.0;
+        for (size_t i = 0; i < 3; i++) {
+            value += c(i) * (densities[i] - densities[2]) * fock_matrices[2];
+            for (size_t j = 0; j < 3; j++) {
+                value += 0.5 * c(i) * c(j) * (densities[i] - densities[2]) * (fock_matrices[j] - fock_matrices[2]);
+            }
+        }
+        return value;
+    };
+
+    const auto c = adiis.coefficients();
+    BOOST_CHECK(std::abs(c.sum() - 1.0) < 1.0e-12);
+    BOOST_CHECK(c.minCoeff() >= 0.0);
+
+    double minimum = f(c);
+    for (size_t a = 0; a <= 100; a++) {
+        for (size_t b = 0; a + b <= 100; b++) {
+            GQCP::VectorX<double> trial {3};
+            trial << a / 100.0, b / 100.0, (100 - a - b) / 100.0;
+            minimum = std::min(minimum, f(trial));
+        }
+    }
+    BOOST_CHECK(f(c) <= minimum + 1.0e-12);
+}
+
+
+/**
+ *  Check the blending of DIIS and ADIIS coefficients.
+ */
+BOOST_AUTO_TEST_CASE(blend) {
+
+    GQCP::ADIIS<double> adiis {2, 1.0e-01, 1.0e-04};
+    const auto trace = [](const double D, const double F) { return D * F; };
+    adiis.update(std::vector<double> {1.0}, std::vector<double> {2.0}, trace);
+    adiis.update(std::vector<double> {1.0, 0.5}, std::vector<double> {2.0, 1.5}, trace);
+
+    GQCP::VectorX<double> diis_coefficients {2};
+    diis_coefficients << -0.5, 1.5;
+
+    BOOST_CHECK(adiis.blend(diis_coefficients, 1.0e-05).isApprox(diis_coefficients, 1.0e-12));
+    BOOST_CHECK(adiis.blend(diis_coefficients, 1.0).isApprox(adiis.coefficients(), 1.0e-12));
+
+    const GQCP::VectorX<double> half_blend = 0.5 * adiis.coefficients() + 0.5 * diis_coefficients;
+    BOOST_CHECK(adiis.blend(diis_coefficients, 0.05).isApprox(half_blend, 1.0e-12));
+
+    const GQCP::VectorX<double> wrong_coefficients = GQCP::VectorX<double>::Ones(3);
+    BOOST_CHECK_THROW(adiis.blend(wrong_coefficients, 1.0), std::invalid_argument);
+}
@@ -0,0 +1,74 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "DIIS"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Optimization/Accelerator/DIIS.hpp"
+#include "Utilities/RingBuffer.hpp"
+
+
+/**
+ *  Check if the incremental DIIS accelerator, which only calculates the overlaps of the newest error vector, finds the same coefficients and accelerated subject as the stateless one.
+ */
+BOOST_AUTO_TEST_CASE(incremental) {
+
+    const size_t maximum_subspace_dimension = 3;
+
+    GQCP::RingBuffer<GQCP::VectorX<double>> errors {4};
+    GQCP::RingBuffer<GQCP::SquareMatrix<double>> subjects {4};
+    GQCP::DIIS<double> incremental_diis {maximum_subspace_dimension};
+
+    for (size_t k = 0; k < 7; k++) {
+        errors.push_back(GQCP::VectorX<double>::Random(5));
+        subjects.push_back(GQCP::SquareMatrix<double>::Random(3));
+        incremental_diis.update(errors);
+
+        // Compare with the stateless DIIS accelerator on copies of the most recent iterates.
+        const auto n = std::min(maximum_subspace_dimension, errors.size());
+        BOOST_CHECK(incremental_diis.subspaceDimension() == n);
+
+        const std::vector<GQCP::VectorX<double>> last_errors {errors.end() - n, errors.end()};
+        const std::vector<GQCP::SquareMatrix<double>> last_subjects {subjects.end() - n, subjects.end()};
+
+        const GQCP::DIIS<double> diis {};
+        BOOST_CHECK(incremental_diis.coefficients().isApprox(diis.calculateDIISCoefficients(last_errors), 1.0e-12));
+        BOOST_CHECK(incremental_diis.accelerate(subjects).isApprox(diis.accelerate(last_subjects, last_errors), 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if a history with a single error vector starts a new incremental subspace.
+ */
+BOOST_AUTO_TEST_CASE(restart) {
+
+    GQCP::DIIS<double> diis {6};
+
+    std::vector<GQCP::VectorX<double>> errors {GQCP::VectorX<double>::Random(4), GQCP::VectorX<double>::Random(4)};
+    diis.update(std::vector<GQCP::VectorX<double>> {errors[0]});
+    diis.update(errors);
+    BOOST_CHECK(diis.subspaceDimension() == 2);
+
+    diis.update(std::vector<GQCP::VectorX<double>> {errors[1]});
+    BOOST_CHECK(diis.subspaceDimension() == 1);
+    BOOST_CHECK(std::abs(diis.coefficients()(0) - 1.0) < 1.0e-12);
+
+    diis.reset();
+    BOOST_CHECK_THROW(diis.coefficients(), std::logic_error);
+}
@@ -147,6 +147,9 @@ BOOST_AUTO_TEST_CASE(Davidson_Liu_50) {
     BOOST_CHECK(std::abs(test_lowest_eigenvalue - ref_lowest_eigenvalue) < 1.0e-08);
     BOOST_CHECK(test_lowest_eigenvector.isEqualEigenvectorAs(ref_lowest_eigenvector, 1.0e-08));
     BOOST_CHECK(std::abs(test_lowest_eigenvector.norm() - 1) < 1.0e-12);
+
+    // The Davidson steps calculate their per-column vectors in the environment's scratch memory.
+    BOOST_CHECK(davidson_solver.peakScratchBytes() >= N * sizeof(double));
 }
 
 
@@ -363,3 +366,98 @@ BOOST_AUTO_TEST_CASE(Davidson_Liu_1000_number_of_requested_eigenpairs) {
         BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
     }
 }
+
+
+/**
+ *  Check if the mixed-precision Davidson algorithm, which stores the subspace vectors in single precision until the residuals are small enough, converges to the double-precision results for a number of requested eigenpairs and a forced subspace collapse.
+ */
+BOOST_AUTO_TEST_CASE(MixedPrecisionDavidson_Liu_1000) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+
+    // Build up the example matrix.
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+
+
+    // Solve the eigenvalue problem with Eigen.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+    const GQCP::MatrixX<double> ref_lowest_eigenvectors = eigensolver.eigenvectors().topLeftCorner(N, number_of_requested_eigenpairs);
+
+
+    // Solve using our mixed-precision Davidson diagonalization algorithm, supplying a number of initial guesses.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    auto davidson_environment = GQCP::EigenproblemEnvironment<double>::Iterative(A, X_0);
+    auto davidson_solver = GQCP::EigenproblemSolver::MixedPrecisionDavidson(3, 10);  // number_of_requested_eigenpairs=3, maximum_subspace_dimension=10
+    davidson_solver.perform(davidson_environment);
+
+    BOOST_CHECK(!davidson_environment.isSubspaceSinglePrecision());  // The final iterations should have been performed in double precision.
+
+    for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+        BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-08);
+
+        const GQCP::VectorX<double> davidson_eigenvector = davidson_environment.eigenvectors.col(i);
+        const GQCP::VectorX<double> ref_eigenvector = ref_lowest_eigenvectors.col(i);
+        BOOST_CHECK(davidson_eigenvector.isEqualEigenvectorAs(ref_eigenvector, 1.0e-08));
+
+        BOOST_CHECK(std::abs(davidson_environment.eigenvectors.col(i).norm() - 1) < 1.0e-12);
+    }
+
+
+    // The switch threshold should be larger than the convergence threshold, and well above the single-precision round-off.
+    BOOST_CHECK_THROW(GQCP::EigenproblemSolver::MixedPrecisionDavidson(1, 15, 1.0e-08, 1.0e-12, 128, 1.0e-03, 1.0e-10), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::EigenproblemSolver::MixedPrecisionDavidson(3, 10, 1.0e-08, 1.0e-12, 128, 1.0e-03, 2.0e-08), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the mixed-precision Davidson algorithm switches to double precision when the residuals stagnate above the switch threshold, or when the maximum number of single-precision iterations is reached.
+ *
+ *  Since the matrix is scaled up, the residual norms that can be reached with single-precision subspace vectors lie above the switch threshold.
+ */
+BOOST_AUTO_TEST_CASE(MixedPrecisionDavidson_Liu_1000_stagnation) {
+
+    const size_t number_of_requested_eigenpairs = 3;
+
+    // Build up the example matrix.
+    const size_t N = 1000;
+    GQCP::SquareMatrix<double> A = GQCP::SquareMatrix<double>::Ones(N, N);
+    for (size_t i = 0; i < N; i++) {
+        if (i < 5) {
+            A(i, i) = 1 + 0.1 * i;
+        } else {
+            A(i, i) = 2 * (i + 1) - 1;
+        }
+    }
+    A *= 1.0e+04;
+
+
+    // Solve the eigenvalue problem with Eigen.
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver {A};
+    const GQCP::VectorX<double> ref_lowest_eigenvalues = eigensolver.eigenvalues().head(number_of_requested_eigenpairs);
+
+
+    // Solve using our mixed-precision Davidson diagonalization algorithm, once with the stagnation fallback and once with a single allowed single-precision iteration.
+    const GQCP::MatrixX<double> X_0 = GQCP::MatrixX<double>::Identity(N, N).topLeftCorner(N, number_of_requested_eigenpairs);
+
+    for (const size_t maximum_number_of_single_precision_iterations : {32, 1}) {
+        auto davidson_environment = GQCP::EigenproblemEnvironment<double>::Iterative(A, X_0);
+        auto davidson_solver = GQCP::EigenproblemSolver::MixedPrecisionDavidson(3, 10, 1.0e-06, 1.0e-12, 128, 1.0e-03, 1.0e-04, maximum_number_of_single_precision_iterations);
+        davidson_solver.perform(davidson_environment);
+
+        BOOST_CHECK(!davidson_environment.isSubspaceSinglePrecision());
+
+        for (size_t i = 0; i < number_of_requested_eigenpairs; i++) {
+            BOOST_CHECK(std::abs(davidson_environment.eigenvalues(i) - ref_lowest_eigenvalues(i)) < 1.0e-06);
+        }
+    }
+}
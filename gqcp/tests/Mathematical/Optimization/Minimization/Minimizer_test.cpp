@@ -89,3 +89,71 @@ BOOST_AUTO_TEST_CASE(minimization_example) {
 
     BOOST_CHECK(solution.isZero(1.0e-08));  // The analytical minimizer of f(x) is x=(0,0).
 }
+
+
+/**
+ *  Check the minimization of the function f(x) = x.x through augmented Hessian steps, using both the Hessian and its matrix-free products with vectors.
+ */
+BOOST_AUTO_TEST_CASE(augmented_hessian_example) {
+
+    GQCP::VectorX<double> x0 {2};  // The initial guess.
+    x0 << 4, 2;
+
+    // With the dense Hessian.
+    GQCP::MinimizationEnvironment<double> dense_environment {x0, grad, H};
+    auto dense_minimizer = GQCP::Minimizer<double>::AugmentedHessian();
+    dense_minimizer.perform(dense_environment);
+
+    BOOST_CHECK(dense_environment.variables.back().isZero(1.0e-08));
+
+
+    // With the matrix-free Hessian-vector products.
+    const auto hessian_vector_product = [](const GQCP::VectorX<double>& x, const GQCP::VectorX<double>& v) { return GQCP::VectorX<double> {H(x) * v}; };
+    const auto hessian_diagonal = [](const GQCP::VectorX<double>& x) { return GQCP::VectorX<double> {H(x).diagonal()}; };
+
+    GQCP::MinimizationEnvironment<double> matrix_free_environment {x0, grad, hessian_vector_product, hessian_diagonal};
+    auto matrix_free_minimizer = GQCP::Minimizer<double>::AugmentedHessian();
+    matrix_free_minimizer.perform(matrix_free_environment);
+
+    BOOST_CHECK(matrix_free_environment.variables.back().isZero(1.0e-08));
+
+    // Every step is restricted to the trust radius.
+    for (size_t i = 1; i < matrix_free_environment.variables.size(); i++) {
+        BOOST_CHECK((matrix_free_environment.variables[i] - matrix_free_environment.variables[i - 1]).norm() < 0.5 + 1.0e-08);
+    }
+}
+
+
+/**
+ *  Check the minimization of the (non-convex) Rosenbrock function f(x, y) = (1 - x)^2 + 100 (y - x^2)^2 through matrix-free augmented Hessian steps.
+ */
+BOOST_AUTO_TEST_CASE(augmented_hessian_rosenbrock) {
+
+    const auto rosenbrock_gradient = [](const GQCP::VectorX<double>& x) {
+        GQCP::VectorX<double> g {2};
+        g << -2 * (1 - x(0)) - 400 * x(0) * (x(1) - x(0) * x(0)),
+            200 * (x(1) - x(0) * x(0));
+        return g;
+    };
+
+    const auto rosenbrock_hessian = [](const GQCP::VectorX<double>& x) {
+        GQCP::SquareMatrix<double> H {2};
+        // clang-format off
+        H << 2 - 400 * x(1) + 1200 * x(0) * x(0), -400 * x(0),
+             -400 * x(0),                          200;
+        // clang-format on
+        return H;
+    };
+
+    const auto hessian_vector_product = [rosenbrock_hessian](const GQCP::VectorX<double>& x, const GQCP::VectorX<double>& v) { return GQCP::VectorX<double> {rosenbrock_hessian(x) * v}; };
+    const auto hessian_diagonal = [rosenbrock_hessian](const GQCP::VectorX<double>& x) { return GQCP::VectorX<double> {rosenbrock_hessian(x).diagonal()}; };
+
+    GQCP::VectorX<double> x0 {2};  // The initial guess, in which the Hessian is indefinite.
+    x0 << -1.2, 1.0;
+
+    GQCP::MinimizationEnvironment<double> environment {x0, rosenbrock_gradient, hessian_vector_product, hessian_diagonal};
+    auto minimizer = GQCP::Minimizer<double>::AugmentedHessian(0.25, 1.0e-10, 256);
+    minimizer.perform(environment);
+
+    BOOST_CHECK(environment.variables.back().isApprox(GQCP::VectorX<double>::Ones(2), 1.0e-08));  // The minimizer of the Rosenbrock function is (1,1).
+}
@@ -96,3 +96,56 @@ BOOST_AUTO_TEST_CASE(nl_syseq_example) {
 
     BOOST_CHECK(solution.isZero(1.0e-08));  // The analytical solution of f(x) = (0,0) is x=(0,0).
 }
+
+
+/**
+ *  Check the solution of a non-linear system of equations with a non-singular Jacobian through the Newton-Krylov solver, both with and without a matrix-free Jacobian-vector product.
+ */
+BOOST_AUTO_TEST_CASE(nl_syseq_newton_krylov) {
+
+    // The system of equations (x0^2 + x1^2 - 4, x0 - x1) = (0, 0) has the solution x=(sqrt(2), sqrt(2)) in the first quadrant.
+    const GQCP::VectorFunction<double> f = [](const GQCP::VectorX<double>& x) {
+        GQCP::VectorX<double> f {2};
+        // clang-format off
+        f << x(0) * x(0) + x(1) * x(1) - 4,
+             x(0) - x(1);
+        // clang-format on
+        return f;
+    };
+
+    const GQCP::MatrixFunction<double> J = [](const GQCP::VectorX<double>& x) {
+        GQCP::MatrixX<double> J {2, 2};
+        // clang-format off
+        J << 2 * x(0), 2 * x(1),
+             1,        -1;
+        // clang-format on
+        return J;
+    };
+
+    const GQCP::JacobianVectorProductFunction<double> J_product = [](const GQCP::VectorX<double>& x, const GQCP::VectorX<double>& y) {
+        GQCP::VectorX<double> Jy {2};
+        // clang-format off
+        Jy << 2 * x(0) * y(0) + 2 * x(1) * y(1),
+              y(0) - y(1);
+        // clang-format on
+        return Jy;
+    };
+
+    GQCP::VectorX<double> x {2};  // The initial guess.
+    x << 3, 2;
+
+    GQCP::VectorX<double> ref_solution {2};
+    ref_solution << std::sqrt(2.0), std::sqrt(2.0);
+
+
+    // Do the numerical optimization with a matrix-free Jacobian-vector product, and with products with the full Jacobian.
+    GQCP::NonLinearEquationEnvironment<double> matrix_free_environment {x, f, J, J_product};
+    auto matrix_free_solver = GQCP::NonLinearEquationSolver<double>::NewtonKrylov();
+    matrix_free_solver.perform(matrix_free_environment);
+    BOOST_CHECK(matrix_free_environment.variables.back().isApprox(ref_solution, 1.0e-08));
+
+    GQCP::NonLinearEquationEnvironment<double> environment {x, f, J};
+    auto solver = GQCP::NonLinearEquationSolver<double>::NewtonKrylov();
+    solver.perform(environment);
+    BOOST_CHECK(environment.variables.back().isApprox(ref_solution, 1.0e-08));
+}
@@ -0,0 +1,182 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "ContractionPlan_test"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/ContractionPlan.hpp"
+#include "Mathematical/Representation/Tensor.hpp"
+
+
+/**
+ *  Check if a plan that is parsed at compile time avoids permutations of the tensors whenever their axes can be viewed as matrices directly.
+ */
+BOOST_AUTO_TEST_CASE(compile_time_layouts) {
+
+    // "ijef,efab->ijab" is a plain matrix-matrix product.
+    static constexpr GQCP::ContractionPlan<4, 4, 4> particle_particle_plan {"ijef,efab->ijab"};
+    static_assert(particle_particle_plan.numberOfShuffledOperands() == 0, "The particle-particle ladder should not require any permutations.");
+    static_assert(!particle_particle_plan.needsOutputShuffle(), "The particle-particle ladder should not require any permutations.");
+
+    // "mnab,mnij->ijab" can be calculated as B^T A without copies, after which the product is transposed to obtain the requested axes.
+    static constexpr GQCP::ContractionPlan<4, 4, 4> hole_hole_plan {"mnab, mnij -> ijab"};
+    static_assert(hole_hole_plan.numberOfShuffledOperands() == 0, "The hole-hole ladder should not require any permutations.");
+    static_assert(!hole_hole_plan.needsOutputShuffle(), "The hole-hole ladder should not require any permutations.");
+
+    // The contracted axes of "ijkl,kj->il" are in a different order for both tensors, so one of them has to be permuted.
+    static constexpr GQCP::ContractionPlan<4, 2, 2> exchange_plan {"ijkl", "kj", "il"};
+    static_assert(exchange_plan.numberOfShuffledOperands() == 1, "One of the tensors should be permuted for an exchange-like contraction.");
+}
+
+
+/**
+ *  Check if the contractions with a plan match loop-based implementations, for small tensors (for which Eigen's tensor contraction module is used) and larger tensors (for which a matrix-matrix product is used).
+ */
+BOOST_AUTO_TEST_CASE(contractions) {
+
+    static constexpr GQCP::ContractionPlan<4, 4, 4> plan {"imae,mbej->ijab"};
+
+    for (const size_t d : {2, 7}) {
+        const size_t dim_i = d;
+        const size_t dim_m = d + 1;
+        const size_t dim_a = d + 2;
+        const size_t dim_e = d + 3;
+        const size_t dim_b = d + 4;
+
+        GQCP::Tensor<double, 4> T1 {dim_i, dim_m, dim_a, dim_e};
+        T1.setRandom();
+        GQCP::Tensor<double, 4> T2 {dim_m, dim_b, dim_e, dim_i};
+        T2.setRandom();
+
+        GQCP::Tensor<double, 4> ref {dim_i, dim_i, dim_a, dim_b};
+        ref.setZero();
+        for (size_t i = 0; i < dim_i; i++) {
+            for (size_t j = 0; j < dim_i; j++) {
+                for (size_t a = 0; a < dim_a; a++) {
+                    for (size_t b = 0; b < dim_b; b++) {
+                        for (size_t m = 0; m < dim_m; m++) {
+                            for (size_t e = 0; e < dim_e; e++) {
+                                ref(i, j, a, b) += T1(i, m, a, e) * T2(m, b, e, j);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        BOOST_CHECK(plan.contract(T1, T2).isApprox(ref, 1.0e-12));
+        BOOST_CHECK(T1.einsum(plan, T2).isApprox(ref, 1.0e-12));
+        BOOST_CHECK(T1.einsum<2>("imae,mbej->ijab", T2).isApprox(ref, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if the output axes are permuted correctly when the requested output is a cyclic permutation of the axes that survive the contraction.
+ *
+ *  Eigen's shuffle takes, for every output axis, the position of the corresponding intermediate axis. For transpositions this coincides with its inverse, but a 3-cycle such as "ijk" -> "jki" tells both apart.
+ */
+BOOST_AUTO_TEST_CASE(cyclic_output_permutation) {
+
+    static constexpr GQCP::ContractionPlan<4, 2, 4> plan {"ijkx,xl->jkil"};
+    static_assert(plan.needsOutputShuffle(), "A cyclic permutation of the output axes cannot be obtained by transposing the product.");
+
+    for (const size_t d : {2, 7}) {
+        const size_t dim_i = d;
+        const size_t dim_j = d + 1;
+        const size_t dim_k = d + 2;
+        const size_t dim_x = d + 3;
+        const size_t dim_l = d + 4;
+
+        GQCP::Tensor<double, 4> T {dim_i, dim_j, dim_k, dim_x};
+        T.setRandom();
+        GQCP::Tensor<double, 2> M {dim_x, dim_l};
+        M.setRandom();
+
+        GQCP::Tensor<double, 4> ref {dim_j, dim_k, dim_i, dim_l};
+        ref.setZero();
+        for (size_t i = 0; i < dim_i; i++) {
+            for (size_t j = 0; j < dim_j; j++) {
+                for (size_t k = 0; k < dim_k; k++) {
+                    for (size_t l = 0; l < dim_l; l++) {
+                        for (size_t x = 0; x < dim_x; x++) {
+                            ref(j, k, i, l) += T(i, j, k, x) * M(x, l);
+                        }
+                    }
+                }
+            }
+        }
+
+        BOOST_CHECK(plan.contract(T, M).isApprox(ref, 1.0e-12));
+        BOOST_CHECK(T.einsum(plan, M).isApprox(ref, 1.0e-12));
+        BOOST_CHECK(T.einsum<1>(M, "ijkx", "xl", "jkil").isApprox(ref, 1.0e-12));
+    }
+}
+
+
+/**
+ *  Check if contractions with a matrix, including full contractions, are correct.
+ */
+BOOST_AUTO_TEST_CASE(matrix_contractions) {
+
+    const size_t dim = 4;
+    GQCP::Tensor<double, 4> g {dim, dim, dim, dim};
+    g.setRandom();
+    const GQCP::MatrixX<double> D = GQCP::MatrixX<double>::Random(dim, dim);
+
+    static constexpr GQCP::ContractionPlan<4, 2, 2> exchange_plan {"utvs, su -> tv"};
+    static constexpr GQCP::ContractionPlan<2, 2, 0> trace_plan {"tv, tv ->"};
+
+    const auto K = g.einsum(exchange_plan, D);
+    const auto exchange_element = K.einsum(trace_plan, D);
+
+    GQCP::MatrixX<double> K_ref = GQCP::MatrixX<double>::Zero(dim, dim);
+    double exchange_element_ref = 0.0;
+    for (size_t t = 0; t < dim; t++) {
+        for (size_t v = 0; v < dim; v++) {
+            for (size_t u = 0; u < dim; u++) {
+                for (size_t s = 0; s < dim; s++) {
+                    K_ref(t, v) += g(u, t, v, s) * D(s, u);
+                }
+            }
+            exchange_element_ref += K_ref(t, v) * D(t, v);
+        }
+    }
+
+    BOOST_CHECK(K.asMatrix().isApprox(K_ref, 1.0e-12));
+    BOOST_CHECK(std::abs(exchange_element(0) - exchange_element_ref) < 1.0e-12);
+}
+
+
+/**
+ *  Check if inconsistent labels are rejected.
+ */
+BOOST_AUTO_TEST_CASE(plan_throws) {
+
+    using Plan = GQCP::ContractionPlan<2, 2, 2>;
+
+    BOOST_CHECK_THROW(Plan("ijk,kl->il"), std::invalid_argument);       // wrong number of labels
+    BOOST_CHECK_THROW(Plan("ij,jk,kl->il"), std::invalid_argument);     // too many operands
+    BOOST_CHECK_THROW(Plan("ij,kl->ik"), std::invalid_argument);        // nothing to contract over
+    BOOST_CHECK_THROW(Plan("ij,jk->ij"), std::invalid_argument);        // the output labels don't match
+    BOOST_CHECK_THROW(Plan("ii,ik->ik"), std::invalid_argument);        // repeated labels
+
+    GQCP::Tensor<double, 2> A {2, 3};
+    GQCP::Tensor<double, 2> B {4, 2};
+    BOOST_CHECK_THROW(Plan("ij,jk->ik").contract(A, B), std::invalid_argument);  // mismatching dimensions
+}
@@ -148,3 +148,33 @@ BOOST_AUTO_TEST_CASE(operator_call_AP1roG) {
     BOOST_CHECK_EQUAL(variables(1, 3), 5);
     BOOST_CHECK_EQUAL(variables(1, 4), 6);
 }
+
+
+/**
+ *  Check if operator() works for non-contiguous index sets, and if it throws for indices that are not part of the slice.
+ */
+BOOST_AUTO_TEST_CASE(operator_call_non_contiguous) {
+
+    // Imagine the following 2x2 slice is part of an implicit 4x4 matrix:
+    // x 1 x 2
+    // x 3 x 4
+    // x x x x
+    // x x x x
+    GQCP::MatrixX<size_t> slice {2, 2};
+    // clang-format off
+    slice << 1, 2,
+             3, 4;
+    // clang-format on
+
+    const auto B = GQCP::ImplicitMatrixSlice<size_t>::FromIndices({0, 1}, {1, 3}, slice);
+
+    BOOST_CHECK(B(0, 1) == 1);
+    BOOST_CHECK(B(0, 3) == 2);
+    BOOST_CHECK(B(1, 1) == 3);
+    BOOST_CHECK(B(1, 3) == 4);
+
+    BOOST_CHECK_THROW(B(0, 0), std::out_of_range);  // Below the smallest column index.
+    BOOST_CHECK_THROW(B(0, 2), std::out_of_range);  // A gap in the column indices.
+    BOOST_CHECK_THROW(B(0, 4), std::out_of_range);  // Above the largest column index.
+    BOOST_CHECK_THROW(B(2, 1), std::out_of_range);  // Above the largest row index.
+}
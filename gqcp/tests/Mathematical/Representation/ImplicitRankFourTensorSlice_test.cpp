@@ -44,3 +44,28 @@ BOOST_AUTO_TEST_CASE(operator_call) {
     BOOST_CHECK(dense_slice_representation(0, 1, 1, 0) == 3);
     BOOST_CHECK(dense_slice_representation(0, 1, 0, 1) == 4);
 }
+
+
+/**
+ *  Check if the matrix view on an implicit rank-four tensor slice has the same elements as its pair-wise reduced matrix representation, and if the index conversion works for non-contiguous index sets.
+ */
+BOOST_AUTO_TEST_CASE(matrixView_non_contiguous) {
+
+    // Create an implicit rank-four tensor slice whose second axis has a gap.
+    auto B = GQCP::ImplicitRankFourTensorSlice<double>::ZeroFromIndices({0, 1}, {2, 5}, {1, 2, 3}, {4});
+
+    B(1, 5, 3, 4) = 1.0;
+    B(0, 2, 1, 4) = 2.0;
+    BOOST_CHECK(B.asTensor()(1, 1, 2, 0) == 1.0);
+    BOOST_CHECK(B.asTensor()(0, 0, 0, 0) == 2.0);
+
+    BOOST_CHECK_THROW(B(0, 3, 1, 4), std::out_of_range);
+    BOOST_CHECK_THROW(B(0, 2, 0, 4), std::out_of_range);
+
+
+    // Check the matrix view and the strides.
+    BOOST_CHECK(B.asTensor().pairWiseReduced().isApprox(B.matrixView()));
+
+    const auto strides = B.strides();
+    BOOST_CHECK(*(B.data() + 1 * strides[0] + 1 * strides[1] + 2 * strides[2]) == 1.0);
+}
@@ -0,0 +1,103 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "PackedSquareRankFourTensor"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Transformations/FourIndexTransformation.hpp"
+#include "Mathematical/Representation/PackedSquareRankFourTensor.hpp"
+
+
+/**
+ *  Check if all eight permutations of an element share the same packed storage, and if packing an unpacked tensor is the identity.
+ */
+BOOST_AUTO_TEST_CASE(packing) {
+
+    const size_t K = 4;
+    const auto g_packed = GQCP::PackedSquareRankFourTensor<double>::Random(K);
+    BOOST_CHECK_EQUAL(g_packed.Eigen().size(), 55);  // 10 pairs, so 10 * 11 / 2 unique elements.
+
+    const auto g = g_packed.unpacked();
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            for (size_t r = 0; r < K; r++) {
+                for (size_t s = 0; s < K; s++) {
+                    const auto value = g(p, q, r, s);
+
+                    BOOST_CHECK_EQUAL(g(q, p, r, s), value);
+                    BOOST_CHECK_EQUAL(g(p, q, s, r), value);
+                    BOOST_CHECK_EQUAL(g(q, p, s, r), value);
+                    BOOST_CHECK_EQUAL(g(r, s, p, q), value);
+                    BOOST_CHECK_EQUAL(g(s, r, p, q), value);
+                    BOOST_CHECK_EQUAL(g(r, s, q, p), value);
+                    BOOST_CHECK_EQUAL(g(s, r, q, p), value);
+                }
+            }
+        }
+    }
+
+    const GQCP::PackedSquareRankFourTensor<double> g_repacked {g};
+    BOOST_CHECK(g_repacked.isApprox(g_packed, 1.0e-12));
+    BOOST_CHECK(GQCP::PackedSquareRankFourTensor<double>::FromPairMatrix(g_packed.pairMatrix()).isApprox(g_packed, 1.0e-12));
+}
+
+
+/**
+ *  Check if the packed direct and exchange contractions are equal to the corresponding `einsum` contractions of the unpacked tensor.
+ */
+BOOST_AUTO_TEST_CASE(contractions) {
+
+    const size_t K = 5;
+    const auto g_packed = GQCP::PackedSquareRankFourTensor<double>::Random(K);
+    const auto g = g_packed.unpacked();
+
+    const auto D = GQCP::SquareMatrix<double>::Random(K);  // Deliberately not symmetric.
+    const auto ref_J = g.einsum<2>("ijkl,kl->ij", D).asMatrix();
+    const auto ref_K = g.einsum<2>("ijkl,kj->il", D).asMatrix();
+
+    BOOST_CHECK(g_packed.contractDirect(D).isApprox(ref_J, 1.0e-12));
+    BOOST_CHECK(g_packed.contractExchange(D).isApprox(ref_K, 1.0e-12));
+}
+
+
+/**
+ *  Check if a basis transformation of the packed tensor is equal to the four-index transformation of the unpacked tensor.
+ */
+BOOST_AUTO_TEST_CASE(transformed) {
+
+    const size_t K = 5;
+    const auto g_packed = GQCP::PackedSquareRankFourTensor<double>::Random(K);
+    const auto T = GQCP::SquareMatrix<double>::Random(K);
+
+    const GQCP::SquareRankFourTensor<double> ref_g_transformed {GQCP::fourIndexTransformed(g_packed.unpacked(), T, T, T, T)};
+    BOOST_CHECK(g_packed.transformed(T).unpacked().isApprox(ref_g_transformed, 1.0e-12));
+
+    BOOST_CHECK_THROW(g_packed.transformed(GQCP::SquareMatrix<double>::Random(K + 1)), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the dimension is deduced from the packed elements, and if an incompatible number of elements throws.
+ */
+BOOST_AUTO_TEST_CASE(constructor) {
+
+    const GQCP::PackedSquareRankFourTensor<double> g {GQCP::VectorX<double>::Zero(21)};  // 6 pairs, so 6 * 7 / 2 unique elements.
+    BOOST_CHECK_EQUAL(g.dimension(), 3);
+
+    BOOST_CHECK_THROW(GQCP::PackedSquareRankFourTensor<double> {GQCP::VectorX<double>::Zero(20)}, std::invalid_argument);
+}
@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Mathematical/Representation/SquareRankFourTensor.hpp"
+#include "Utilities/complex.hpp"
 
 
 /**
@@ -127,3 +128,64 @@ BOOST_AUTO_TEST_CASE(pairWiseStrictReduced) {
 
     BOOST_CHECK(M2_ref.isApprox(T2.pairWiseStrictReduced()));
 }
+
+
+/**
+ *  Check if the fused direct and exchange contractions are equal to the corresponding `einsum` contractions, also for complex tensors.
+ */
+BOOST_AUTO_TEST_CASE(contractDirectAndExchange) {
+
+    const size_t dim = 4;
+
+    const auto T = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const std::vector<GQCP::SquareMatrix<double>> matrices {GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim)};
+    const auto JK = T.contractDirectAndExchange(matrices);
+
+    for (size_t n = 0; n < matrices.size(); n++) {
+        const auto ref_J = T.einsum<2>("ijkl,kl->ij", matrices[n]).asMatrix();
+        const auto ref_K = T.einsum<2>("ijkl,kj->il", matrices[n]).asMatrix();
+
+        BOOST_CHECK(JK.first[n].isApprox(ref_J, 1.0e-12));
+        BOOST_CHECK(JK.second[n].isApprox(ref_K, 1.0e-12));
+        BOOST_CHECK(T.contractDirect(matrices[n]).isApprox(ref_J, 1.0e-12));
+        BOOST_CHECK(T.contractExchange(matrices[n]).isApprox(ref_K, 1.0e-12));
+    }
+
+
+    const GQCP::SquareRankFourTensor<GQCP::complex> T_complex {T.cast<GQCP::complex>() * GQCP::complex(0.5, 1.0)};
+    const auto D_complex = GQCP::SquareMatrix<GQCP::complex>::Random(dim);
+    const auto JK_complex = T_complex.contractDirectAndExchange({D_complex});
+
+    BOOST_CHECK(JK_complex.first[0].isApprox(T_complex.einsum<2>("ijkl,kl->ij", D_complex).asMatrix(), 1.0e-12));
+    BOOST_CHECK(JK_complex.second[0].isApprox(T_complex.einsum<2>("ijkl,kj->il", D_complex).asMatrix(), 1.0e-12));
+
+    BOOST_CHECK_THROW(T.contractDirectAndExchange({GQCP::SquareMatrix<double>::Random(dim + 1)}), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the matrix slices of a square rank-four tensor are views on the correct elements.
+ */
+BOOST_AUTO_TEST_CASE(matrixSlice) {
+
+    const size_t dim = 4;
+    const auto T = GQCP::SquareRankFourTensor<double>::Random(dim);
+
+    // Check the slices T(p i j s), T(p s j i) and T(i b j a).
+    const size_t i = 1;
+    const size_t j = 3;
+    const auto slice_03 = T.matrixSlice(0, 3, i, j);
+    const auto slice_01 = T.matrixSlice(0, 1, j, i);
+    const auto slice_31 = T.matrixSlice(3, 1, i, j);
+
+    for (size_t p = 0; p < dim; p++) {
+        for (size_t s = 0; s < dim; s++) {
+            BOOST_CHECK_EQUAL(slice_03(p, s), T(p, i, j, s));
+            BOOST_CHECK_EQUAL(slice_01(p, s), T(p, s, j, i));
+            BOOST_CHECK_EQUAL(slice_31(p, s), T(i, s, j, p));
+        }
+    }
+
+    BOOST_CHECK_THROW(T.matrixSlice(0, 0, i, j), std::invalid_argument);
+    BOOST_CHECK_THROW(T.matrixSlice(0, 4, i, j), std::invalid_argument);
+}
@@ -0,0 +1,96 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "TensorContraction_test"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/TensorContraction.hpp"
+
+
+/**
+ *  Check if a contraction of two rank-four tensors over two axes, that requires permutations of both tensors and of the result, matches a loop-based implementation.
+ */
+BOOST_AUTO_TEST_CASE(rank_four_contraction) {
+
+    // Set up two rank-four tensors with different dimensions along every axis.
+    GQCP::Tensor<double, 4> T1 {2, 3, 4, 5};  // labels "imae"
+    T1.setRandom();
+    GQCP::Tensor<double, 4> T2 {3, 6, 5, 2};  // labels "mbej"
+    T2.setRandom();
+
+    // Calculate the reference result sum_{me} T1(i,m,a,e) T2(m,b,e,j) through loops.
+    GQCP::Tensor<double, 4> ref {2, 2, 4, 6};  // labels "ijab"
+    ref.setZero();
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            for (size_t a = 0; a < 4; a++) {
+                for (size_t b = 0; b < 6; b++) {
+                    for (size_t m = 0; m < 3; m++) {
+                        for (size_t e = 0; e < 5; e++) {
+                            ref(i, j, a, b) += T1(i, m, a, e) * T2(m, b, e, j);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    const auto result = GQCP::contractThroughMatrixProduct<4>(T1, "imae", T2, "mbej", "ijab");
+    BOOST_CHECK(result.isApprox(ref, 1.0e-12));
+}
+
+
+/**
+ *  Check if contractions that reduce to a matrix-vector product, an outer product and a full contraction are correct.
+ */
+BOOST_AUTO_TEST_CASE(special_contractions) {
+
+    GQCP::MatrixX<double> A = GQCP::MatrixX<double>::Random(3, 4);
+    GQCP::MatrixX<double> B = GQCP::MatrixX<double>::Random(4, 3);
+    const auto A_tensor = GQCP::asRankTwoTensor(A);
+    const auto B_tensor = GQCP::asRankTwoTensor(B);
+
+    // A matrix-matrix product, and the transpose of it.
+    const GQCP::MatrixX<double> AB = A * B;
+    BOOST_CHECK(GQCP::contractThroughMatrixProduct<2>(A_tensor, "ik", B_tensor, "kj", "ij").asMatrix().isApprox(AB, 1.0e-12));
+    BOOST_CHECK(GQCP::contractThroughMatrixProduct<2>(A_tensor, "ik", B_tensor, "kj", "ji").asMatrix().isApprox(AB.transpose(), 1.0e-12));
+
+    // An outer product.
+    const auto outer = GQCP::contractThroughMatrixProduct<4>(A_tensor, "ia", A_tensor, "jb", "ijab");
+    BOOST_CHECK(std::abs(outer(2, 1, 3, 0) - A(2, 3) * A(1, 0)) < 1.0e-12);
+
+    // A full contraction, i.e. the trace of a matrix product.
+    const auto trace = GQCP::contractThroughMatrixProduct<0>(A_tensor, "ij", B_tensor, "ji", "");
+    BOOST_CHECK(std::abs(trace() - AB.trace()) < 1.0e-12);
+}
+
+
+/**
+ *  Check if contractThroughMatrixProduct throws when the labels are inconsistent.
+ */
+BOOST_AUTO_TEST_CASE(contraction_throws) {
+
+    GQCP::Tensor<double, 2> A {3, 4};
+    A.setRandom();
+    GQCP::Tensor<double, 2> B {5, 3};
+    B.setRandom();
+
+    BOOST_CHECK_THROW(GQCP::contractThroughMatrixProduct<2>(A, "ijk", B, "jk", "ik"), std::invalid_argument);  // wrong number of labels
+    BOOST_CHECK_THROW(GQCP::contractThroughMatrixProduct<2>(A, "ij", B, "kl", "ik"), std::invalid_argument);   // the output labels don't match
+    BOOST_CHECK_THROW(GQCP::contractThroughMatrixProduct<2>(A, "ij", B, "jk", "ik"), std::invalid_argument);   // mismatching dimensions
+}
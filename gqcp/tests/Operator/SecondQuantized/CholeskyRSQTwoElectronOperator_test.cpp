@@ -0,0 +1,161 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "CholeskyRSQTwoElectronOperator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/Integrals/IntegralCalculator.hpp"
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Operator/SecondQuantized/CholeskyRSQTwoElectronOperator.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+
+
+/**
+ *  Check if the pivoted Cholesky decompositions, both of the dense integrals and on the fly through Libint2, reproduce every two-electron integral to within the threshold, using fewer than K^2 Cholesky vectors.
+ */
+BOOST_AUTO_TEST_CASE(decomposition_h2o_sto3g) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const GQCP::ScalarRSQTwoElectronOperator<double> g_op {GQCP::IntegralCalculator::calculateLibintIntegrals(GQCP::CoulombRepulsionOperator(), scalar_basis)};
+
+    for (const auto threshold : {1.0e-04, 1.0e-08}) {
+        const auto cholesky_op = GQCP::CholeskyRSQTwoElectronOperator::FromDense(g_op, threshold);
+        const auto libint_cholesky_op = GQCP::CholeskyRSQTwoElectronOperator::Libint(scalar_basis, threshold);
+
+        BOOST_CHECK_EQUAL(cholesky_op.numberOfOrbitals(), K);
+        BOOST_CHECK(cholesky_op.numberOfCholeskyVectors() < K * K);
+        BOOST_CHECK_EQUAL(libint_cholesky_op.numberOfCholeskyVectors(), cholesky_op.numberOfCholeskyVectors());
+
+        const auto g = g_op.parameters();
+        const auto g_cholesky = cholesky_op.parameters();
+        const auto g_libint_cholesky = libint_cholesky_op.parameters();
+        for (size_t p = 0; p < K; p++) {
+            for (size_t q = 0; q < K; q++) {
+                for (size_t r = 0; r < K; r++) {
+                    for (size_t s = 0; s < K; s++) {
+                        BOOST_CHECK(std::abs(g_cholesky(p, q, r, s) - g(p, q, r, s)) < threshold);
+                        BOOST_CHECK(std::abs(g_libint_cholesky(p, q, r, s) - g(p, q, r, s)) < threshold);
+                        BOOST_CHECK(std::abs(cholesky_op(p, q, r, s) - g_cholesky(p, q, r, s)) < 1.0e-12);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if basis transformations and Jacobi rotations of the Cholesky vectors are equivalent to the ones of the reconstructed two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(transformed_and_rotated) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto cholesky_op = GQCP::CholeskyRSQTwoElectronOperator::Libint(scalar_basis, 1.0e-10);
+    const auto g_op = cholesky_op.dense();
+
+    const auto T = GQCP::RTransformation<double>::Random(K);
+    BOOST_CHECK(cholesky_op.transformed(T).parameters().isApprox(g_op.transformed(T).parameters(), 1.0e-10));
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.7};
+    BOOST_CHECK(cholesky_op.rotated(jacobi_rotation).parameters().isApprox(g_op.rotated(jacobi_rotation).parameters(), 1.0e-10));
+}
+
+
+/**
+ *  Check if the expectation values, (super-)Fockian matrices, direct and exchange matrices and effective one-electron partition are equal to the ones of the reconstructed two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(contractions) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto K = scalar_basis.numberOfBasisFunctions();
+
+    const auto cholesky_op = GQCP::CholeskyRSQTwoElectronOperator::Libint(scalar_basis, 1.0e-10);
+    const auto g_op = cholesky_op.dense();
+    const auto& g = g_op.parameters();
+
+    const GQCP::Orbital1DM<double> D {GQCP::SquareMatrix<double>::Random(K)};
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+
+    BOOST_CHECK(std::abs(cholesky_op.calculateExpectationValue(d)() - g_op.calculateExpectationValue(d)()) < 1.0e-10);
+    BOOST_CHECK(cholesky_op.calculateFockianMatrix(D, d)().isApprox(g_op.calculateFockianMatrix(D, d)(), 1.0e-10));
+    BOOST_CHECK(cholesky_op.calculateSuperFockianMatrix(D, d)().isApprox(g_op.calculateSuperFockianMatrix(D, d)(), 1.0e-10));
+    BOOST_CHECK(cholesky_op.effectiveOneElectronPartition().parameters().isApprox(g_op.effectiveOneElectronPartition().parameters(), 1.0e-10));
+
+    const auto ref_J = g.einsum<2>("pqrs,rs->pq", D.matrix()).asMatrix();
+    const auto ref_K = g.einsum<2>("pqrs,rq->ps", D.matrix()).asMatrix();
+    BOOST_CHECK(cholesky_op.calculateDirectMatrix(D).isApprox(ref_J, 1.0e-10));
+    BOOST_CHECK(cholesky_op.calculateExchangeMatrix(D).isApprox(ref_K, 1.0e-10));
+}
+
+
+/**
+ *  Check if a Hamiltonian with Cholesky-decomposed two-electron integrals behaves like the one with the reconstructed integrals, also after a basis transformation.
+ */
+BOOST_AUTO_TEST_CASE(hamiltonian) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const auto K = spin_orbital_basis.numberOfSpatialOrbitals();
+
+    const auto h = spin_orbital_basis.quantize(GQCP::KineticOperator()) + spin_orbital_basis.quantize(GQCP::NuclearAttractionOperator(molecule.nuclearFramework()));
+    const auto cholesky_op = GQCP::CholeskyRSQTwoElectronOperator::Libint(spin_orbital_basis.scalarBasis(), 1.0e-10);
+
+    auto cholesky_hamiltonian = GQCP::CholeskyRSQHamiltonian {h, cholesky_op};
+    auto hamiltonian = GQCP::RSQHamiltonian<double> {h, cholesky_op.dense()};
+
+    const auto T = GQCP::RTransformation<double>::RandomUnitary(K);
+    cholesky_hamiltonian.transform(T);
+    hamiltonian.transform(T);
+
+    const GQCP::Orbital1DM<double> D {GQCP::SquareMatrix<double>::Random(K)};
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+
+    BOOST_CHECK(std::abs(cholesky_hamiltonian.calculateExpectationValue(D, d) - hamiltonian.calculateExpectationValue(D, d)) < 1.0e-10);
+    BOOST_CHECK(cholesky_hamiltonian.calculateFockianMatrix(D, d).isApprox(hamiltonian.calculateFockianMatrix(D, d), 1.0e-10));
+    BOOST_CHECK(cholesky_hamiltonian.calculateEffectiveOneElectronIntegrals().parameters().isApprox(hamiltonian.calculateEffectiveOneElectronIntegrals().parameters(), 1.0e-10));
+
+    const auto orbital_space = GQCP::OrbitalSpace::Implicit({{GQCP::OccupationType::k_occupied, 5}, {GQCP::OccupationType::k_virtual, 2}});
+    BOOST_CHECK(cholesky_hamiltonian.calculateInactiveFockian(orbital_space).parameters().isApprox(hamiltonian.calculateInactiveFockian(orbital_space).parameters(), 1.0e-10));
+
+
+    // Check if the Cholesky vectors of the contributions are appended.
+    cholesky_hamiltonian += cholesky_op.transformed(T);
+    BOOST_CHECK_EQUAL(cholesky_hamiltonian.twoElectron().numberOfCholeskyVectors(), 2 * cholesky_op.numberOfCholeskyVectors());
+    BOOST_CHECK_EQUAL(cholesky_hamiltonian.twoElectronContributions().size(), 2);
+}
+
+
+/**
+ *  Check if the constructor throws when the Cholesky vectors are not square.
+ */
+BOOST_AUTO_TEST_CASE(constructor_throws) {
+
+    const GQCP::DensityFittingFactors rectangular_vectors {GQCP::MatrixX<double>::Random(12, 5), 3, 4};
+    BOOST_CHECK_THROW(GQCP::CholeskyRSQTwoElectronOperator {rectangular_vectors}, std::invalid_argument);
+
+    const auto zero_op = GQCP::CholeskyRSQTwoElectronOperator::Zero(3);
+    BOOST_CHECK_EQUAL(zero_op.numberOfCholeskyVectors(), 0);
+    BOOST_CHECK(zero_op.parameters().isApprox(GQCP::SquareRankFourTensor<double>::Zero(3), 1.0e-12));
+}
@@ -0,0 +1,127 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "PackedRSQTwoElectronOperator"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Operator/SecondQuantized/PackedRSQTwoElectronOperator.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+
+
+/**
+ *  Check if basis transformations and Jacobi rotations of the packed two-electron integrals are equivalent to the ones of the unpacked two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(transformed_and_rotated) {
+
+    const size_t K = 5;
+    const auto packed_op = GQCP::PackedRSQTwoElectronOperator::Random(K);
+    const auto g_op = packed_op.dense();
+
+    const auto T = GQCP::RTransformation<double>::Random(K);
+    BOOST_CHECK(packed_op.transformed(T).parameters().unpacked().isApprox(g_op.transformed(T).parameters(), 1.0e-12));
+
+    const GQCP::JacobiRotation jacobi_rotation {4, 1, 0.7};
+    BOOST_CHECK(packed_op.rotated(jacobi_rotation).parameters().unpacked().isApprox(g_op.rotated(jacobi_rotation).parameters(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the expectation values, (super-)Fockian matrices, direct and exchange matrices and effective one-electron partition are equal to the ones of the unpacked two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(contractions) {
+
+    const size_t K = 5;
+    const auto packed_op = GQCP::PackedRSQTwoElectronOperator::Random(K);
+    const auto g_op = packed_op.dense();
+    const auto& g = g_op.parameters();
+
+    const GQCP::Orbital1DM<double> D {GQCP::SquareMatrix<double>::Random(K)};
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+
+    BOOST_CHECK(std::abs(packed_op.calculateExpectationValue(d)() - g_op.calculateExpectationValue(d)()) < 1.0e-12);
+    BOOST_CHECK(packed_op.calculateFockianMatrix(D, d)().isApprox(g_op.calculateFockianMatrix(D, d)(), 1.0e-12));
+    BOOST_CHECK(packed_op.calculateSuperFockianMatrix(D, d)().isApprox(g_op.calculateSuperFockianMatrix(D, d)(), 1.0e-12));
+    BOOST_CHECK(packed_op.effectiveOneElectronPartition().parameters().isApprox(g_op.effectiveOneElectronPartition().parameters(), 1.0e-12));
+
+    const auto ref_J = g.einsum<2>("pqrs,rs->pq", D.matrix()).asMatrix();
+    const auto ref_K = g.einsum<2>("pqrs,rq->ps", D.matrix()).asMatrix();
+    BOOST_CHECK(packed_op.calculateDirectMatrix(D).isApprox(ref_J, 1.0e-12));
+    BOOST_CHECK(packed_op.calculateExchangeMatrix(D).isApprox(ref_K, 1.0e-12));
+}
+
+
+/**
+ *  Check if a packed Hamiltonian, read in from an FCIDUMP file, behaves like the dense one, also after a basis transformation and when adding contributions.
+ */
+BOOST_AUTO_TEST_CASE(hamiltonian_FCIDUMP) {
+
+    auto packed_hamiltonian = GQCP::PackedRSQHamiltonian::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = hamiltonian.numberOfOrbitals();
+
+    BOOST_CHECK(packed_hamiltonian.twoElectron().parameters().unpacked().isApprox(hamiltonian.twoElectron().parameters(), 1.0e-12));
+
+    const auto T = GQCP::RTransformation<double>::RandomUnitary(K);
+    packed_hamiltonian.transform(T);
+    hamiltonian.transform(T);
+
+    const GQCP::Orbital1DM<double> D {GQCP::SquareMatrix<double>::Random(K)};
+    const GQCP::Orbital2DM<double> d {GQCP::SquareRankFourTensor<double>::Random(K)};
+
+    BOOST_CHECK(std::abs(packed_hamiltonian.calculateExpectationValue(D, d) - hamiltonian.calculateExpectationValue(D, d)) < 1.0e-10);
+    BOOST_CHECK(packed_hamiltonian.calculateFockianMatrix(D, d).isApprox(hamiltonian.calculateFockianMatrix(D, d), 1.0e-10));
+    BOOST_CHECK(packed_hamiltonian.calculateEffectiveOneElectronIntegrals().parameters().isApprox(hamiltonian.calculateEffectiveOneElectronIntegrals().parameters(), 1.0e-10));
+
+    const auto orbital_space = GQCP::OrbitalSpace::Implicit({{GQCP::OccupationType::k_occupied, 5}, {GQCP::OccupationType::k_virtual, 2}});
+    BOOST_CHECK(packed_hamiltonian.calculateInactiveFockian(orbital_space).parameters().isApprox(hamiltonian.calculateInactiveFockian(orbital_space).parameters(), 1.0e-10));
+
+
+    // Check if the vector space arithmetic acts on the packed storage.
+    const auto packed_op = packed_hamiltonian.twoElectron();
+    const auto packed_sum = packed_op + 2.0 * packed_op;
+    BOOST_CHECK(packed_sum.parameters().isApprox(packed_op.parameters() * 3.0, 1.0e-12));
+}
+
+
+/**
+ *  Check if a lazily evaluated linear combination of packed two-electron operators matches the eagerly evaluated one, and acts on the packed storage.
+ */
+BOOST_AUTO_TEST_CASE(lazy_linear_combination) {
+
+    const size_t K = 4;
+    const double a = 0.5;
+    const double b = -1.5;
+
+    const auto packed_op1 = GQCP::PackedRSQTwoElectronOperator::Random(K);
+    const auto packed_op2 = GQCP::PackedRSQTwoElectronOperator::Random(K);
+    const auto packed_op3 = GQCP::PackedRSQTwoElectronOperator::Random(K);
+
+    const auto eager_result = a * packed_op1 + b * packed_op2 - packed_op3;
+    const GQCP::PackedRSQTwoElectronOperator lazy_result = a * packed_op1.lazy() + b * packed_op2.lazy() - packed_op3;
+    BOOST_CHECK(lazy_result.parameters().isApprox(eager_result.parameters(), 1.0e-12));
+
+    // The packed result should equal the combination of the unpacked operators.
+    const auto dense_result = a * packed_op1.dense() + b * packed_op2.dense() - packed_op3.dense();
+    BOOST_CHECK(lazy_result.parameters().unpacked().isApprox(dense_result.parameters(), 1.0e-12));
+
+    // Check the in-place accumulation of an expression.
+    auto accumulated = packed_op3;
+    accumulated -= a * packed_op1.lazy() - packed_op2.lazy() / 2.0;
+    const auto accumulated_ref = packed_op3 - a * packed_op1 + 0.5 * packed_op2;
+    BOOST_CHECK(accumulated.parameters().isApprox(accumulated_ref.parameters(), 1.0e-12));
+}
@@ -238,6 +238,41 @@ BOOST_AUTO_TEST_CASE(SimpleSQOneElectronOperator_negation) {
 }
 
 
+/**
+ *  Check if a lazily evaluated linear combination of one-electron operators matches the eagerly evaluated one.
+ */
+BOOST_AUTO_TEST_CASE(SimpleSQOneElectronOperator_lazy_linear_combination) {
+
+    const size_t dim = 4;
+    const double a = 0.5;
+    const double b = -1.5;
+
+    // Initialize some random vector operators.
+    const auto op1 = GQCP::VectorRSQOneElectronOperator<double> {std::vector<GQCP::SquareMatrix<double>> {GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim)}};
+    const auto op2 = GQCP::VectorRSQOneElectronOperator<double> {std::vector<GQCP::SquareMatrix<double>> {GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim)}};
+    const auto op3 = GQCP::VectorRSQOneElectronOperator<double> {std::vector<GQCP::SquareMatrix<double>> {GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim), GQCP::SquareMatrix<double>::Random(dim)}};
+
+    // Check the single-pass evaluation against the eager arithmetic.
+    const auto eager_result = a * op1 + b * op2 - op3;
+    const GQCP::VectorRSQOneElectronOperator<double> lazy_result = a * op1.lazy() + b * op2.lazy() - op3;
+    for (size_t i = 0; i < 3; i++) {
+        BOOST_CHECK(lazy_result.parameters(i).isApprox(eager_result.parameters(i), 1.0e-12));
+    }
+
+    // Check the in-place accumulation of an expression.
+    auto accumulated = op3;
+    accumulated -= a * op1.lazy() - op2.lazy() / 2.0;
+    const auto accumulated_ref = op3 - a * op1 + 0.5 * op2;
+    for (size_t i = 0; i < 3; i++) {
+        BOOST_CHECK(accumulated.parameters(i).isApprox(accumulated_ref.parameters(i), 1.0e-12));
+    }
+
+    // Check that operators of different dimensions can't be combined.
+    const auto op_small = GQCP::VectorRSQOneElectronOperator<double>::Zero(dim - 1);
+    BOOST_CHECK_THROW(op1.lazy() + op_small, std::invalid_argument);
+}
+
+
 /**
  *  Check if dot product multiplication of a SimpleSQOneElectronOperator with a Vector with the same components is correctly implemented.
  */
@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Operator/SecondQuantized/GSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/RSQTwoElectronOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
 #include "Utilities/miscellaneous.hpp"
@@ -332,6 +333,53 @@ BOOST_AUTO_TEST_CASE(transform_with_jacobi_matrix) {
 }
 
 
+/**
+ *  Check if transforming directly into a block of the orbital space yields the corresponding block of the fully transformed two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(transformedBlock) {
+
+    const size_t dim = 6;
+    const GQCP::ScalarRSQTwoElectronOperator<double> op {GQCP::SquareRankFourTensor<double>::Random(dim)};
+    const auto T = GQCP::RTransformation<double>::Random(dim);
+    const auto orbital_space = GQCP::OrbitalSpace::Implicit({{GQCP::OccupationType::k_occupied, 2}, {GQCP::OccupationType::k_active, 1}, {GQCP::OccupationType::k_virtual, 3}});
+
+    const auto g_transformed = op.transformed(T).parameters();
+
+    const auto occupied = GQCP::OccupationType::k_occupied;
+    const auto active = GQCP::OccupationType::k_active;
+    const auto virtual_ = GQCP::OccupationType::k_virtual;
+    for (const auto& types : std::vector<std::array<GQCP::OccupationType, 4>> {{occupied, virtual_, occupied, virtual_}, {occupied, occupied, virtual_, virtual_}, {active, active, active, active}, {virtual_, active, occupied, virtual_}}) {
+        const auto block = op.transformedBlock(T, orbital_space, types[0], types[1], types[2], types[3]);
+
+        for (const auto& p : orbital_space.indices(types[0])) {
+            for (const auto& q : orbital_space.indices(types[1])) {
+                for (const auto& r : orbital_space.indices(types[2])) {
+                    for (const auto& s : orbital_space.indices(types[3])) {
+                        BOOST_CHECK(std::abs(block(p, q, r, s) - g_transformed(p, q, r, s)) < 1.0e-10);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  Check if the in-place Jacobi rotation kernel gives the same result as a basis transformation with the corresponding Jacobi rotation matrix.
+ */
+BOOST_AUTO_TEST_CASE(jacobi_rotation_kernel) {
+
+    const size_t dim = 5;
+    const GQCP::ScalarRSQTwoElectronOperator<double> op {GQCP::SquareRankFourTensor<double>::Random(dim)};
+
+    for (const auto& jacobi_rotation : {GQCP::JacobiRotation {4, 2, 0.56}, GQCP::JacobiRotation {1, 0, -1.3}, GQCP::JacobiRotation {3, 1, 2.1}}) {
+        const auto T = GQCP::RTransformation<double>::FromJacobi(jacobi_rotation, dim);
+
+        BOOST_CHECK(op.rotated(jacobi_rotation).parameters().isApprox(op.transformed(T).parameters(), 1.0e-12));
+    }
+}
+
+
 /**
  *  Check if antisymmetrizing two-electron integrals works as expected.
  * 
@@ -420,3 +468,48 @@ BOOST_AUTO_TEST_CASE(chemists_physicists) {
     const auto g_again = V.convertedToChemistsNotation();
     BOOST_CHECK(g_again.parameters().isApprox(g.parameters(), 1.0e-12));
 }
+
+
+/**
+ *  Check if lazily evaluated linear combinations of restricted and general two-electron operators match the eagerly evaluated ones.
+ */
+BOOST_AUTO_TEST_CASE(lazy_linear_combination) {
+
+    const size_t dim = 3;
+    const double a = 0.5;
+    const double b = -1.5;
+
+    // Check a restricted linear combination and an in-place accumulation against the eager arithmetic.
+    const GQCP::ScalarRSQTwoElectronOperator<double> r_op1 {GQCP::SquareRankFourTensor<double>::Random(dim)};
+    const GQCP::ScalarRSQTwoElectronOperator<double> r_op2 {GQCP::SquareRankFourTensor<double>::Random(dim)};
+    const GQCP::ScalarRSQTwoElectronOperator<double> r_op3 {GQCP::SquareRankFourTensor<double>::Random(dim)};
+
+    const auto r_eager_result = a * r_op1 + b * r_op2 - r_op3;
+    const GQCP::ScalarRSQTwoElectronOperator<double> r_lazy_result = a * r_op1.lazy() + b * r_op2.lazy() - r_op3;
+    BOOST_CHECK(r_lazy_result.parameters().isApprox(r_eager_result.parameters(), 1.0e-12));
+
+    auto r_accumulated = r_op3;
+    r_accumulated -= a * r_op1.lazy() - r_op2.lazy() / 2.0;
+    r_accumulated += r_op1;
+    const auto r_accumulated_ref = r_op3 - a * r_op1 + 0.5 * r_op2 + r_op1;
+    BOOST_CHECK(r_accumulated.parameters().isApprox(r_accumulated_ref.parameters(), 1.0e-12));
+
+    auto r_difference = r_op1;
+    r_difference -= r_op2;
+    BOOST_CHECK(r_difference.parameters().isApprox((r_op1 + (-r_op2)).parameters(), 1.0e-12));
+
+
+    // Check a general linear combination against the eager arithmetic.
+    const GQCP::ScalarGSQTwoElectronOperator<double> g_op1 {GQCP::SquareRankFourTensor<double>::Random(2 * dim)};
+    const GQCP::ScalarGSQTwoElectronOperator<double> g_op2 {GQCP::SquareRankFourTensor<double>::Random(2 * dim)};
+
+    const auto g_eager_result = -g_op1 + b * g_op2;
+    const GQCP::ScalarGSQTwoElectronOperator<double> g_lazy_result = -g_op1.lazy() + g_op2.lazy() * b;
+    BOOST_CHECK(g_lazy_result.parameters().isApprox(g_eager_result.parameters(), 1.0e-12));
+
+
+    // Check that operators of different dimensions can't be combined.
+    auto r_op_small = GQCP::ScalarRSQTwoElectronOperator<double>::Zero(dim - 1);
+    BOOST_CHECK_THROW(r_op1.lazy() + r_op_small, std::invalid_argument);
+    BOOST_CHECK_THROW(r_op_small -= r_op1, std::invalid_argument);
+}
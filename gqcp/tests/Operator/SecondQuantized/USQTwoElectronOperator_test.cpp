@@ -216,6 +216,32 @@ BOOST_AUTO_TEST_CASE(USQTwoElectronOperator_addition) {
 }
 
 
+/**
+ *  Check if the in-place subtraction of unrestricted two-electron operators acts on every spin-component separately.
+ */
+BOOST_AUTO_TEST_CASE(USQTwoElectronOperator_subtraction) {
+
+    const size_t dim = 2;
+
+    // Initialize two test unrestricted two-electron operators with different spin-components.
+    const auto g_aa = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const auto g_ab = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const auto g_ba = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const auto g_bb = GQCP::SquareRankFourTensor<double>::Random(dim);
+    const GQCP::ScalarUSQTwoElectronOperator<double> op1 {g_aa, g_ab, g_ba, g_bb};
+    const GQCP::ScalarUSQTwoElectronOperator<double> op2 {g_bb, g_ba, g_ab, g_aa};
+
+
+    // Check the result against the subtraction of the spin-components.
+    auto op_diff = op1;
+    op_diff -= op2;
+    BOOST_CHECK(op_diff.alphaAlpha().parameters().isApprox((op1.alphaAlpha() - op2.alphaAlpha()).parameters(), 1.0e-12));
+    BOOST_CHECK(op_diff.alphaBeta().parameters().isApprox((op1.alphaBeta() - op2.alphaBeta()).parameters(), 1.0e-12));
+    BOOST_CHECK(op_diff.betaAlpha().parameters().isApprox((op1.betaAlpha() - op2.betaAlpha()).parameters(), 1.0e-12));
+    BOOST_CHECK(op_diff.betaBeta().parameters().isApprox((op1.betaBeta() - op2.betaBeta()).parameters(), 1.0e-12));
+}
+
+
 /**
  *  Check if the scalar multiplication with an unrestricted two-electron operator works as expected.
  */
@@ -105,3 +105,70 @@ BOOST_AUTO_TEST_CASE(h2o_crawdad) {
     BOOST_CHECK(std::abs(ccd_correlation_energy - ref_ccd_correlation_energy) < 1.0e-08);
     BOOST_CHECK(environment_ccd.t2_amplitudes.back().asImplicitRankFourTensorSlice().asTensor().isApprox(environment_ccsd_ref.t2_amplitudes.back().asImplicitRankFourTensorSlice().asTensor()) == true);
 }
+
+
+/**
+ *  Check if the DIIS CCD solver converges to the same correlation energy as the plain CCD solver, and does so in fewer iterations.
+ *
+ *  The DIIS accelerator has to combine the T2-amplitudes that belong to its error vectors, i.e. the ones before acceleration. Combining the environment's T2-amplitudes instead (which are overwritten by the accelerated ones) makes this calculation diverge.
+ *
+ *  The system under consideration is LiH in a 6-31G basisset, read from an FCIDUMP file, for which the spinor Hamiltonian is constructed from the restricted one.
+ */
+BOOST_AUTO_TEST_CASE(lih_631g_diis) {
+
+    const auto r_sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/lih_631g_caitlin.FCIDUMP");
+    const auto K = r_sq_hamiltonian.numberOfOrbitals();
+    const auto M = 2 * K;
+    const size_t N_P = 2;
+
+
+    // Set up the spin-blocked spinor Hamiltonian, in which the first K spinors are alpha spin-orbitals and the last K spinors are beta spin-orbitals.
+    const auto& h = r_sq_hamiltonian.core().parameters();
+    const auto& g = r_sq_hamiltonian.twoElectron().parameters();
+
+    GQCP::SquareMatrix<double> h_g = GQCP::SquareMatrix<double>::Zero(M);
+    h_g.topLeftCorner(K, K) = h;
+    h_g.bottomRightCorner(K, K) = h;
+
+    GQCP::SquareRankFourTensor<double> g_g {M};
+    g_g.setZero();
+    for (size_t p = 0; p < M; p++) {
+        for (size_t q = 0; q < M; q++) {
+            for (size_t r = 0; r < M; r++) {
+                for (size_t s = 0; s < M; s++) {
+                    if ((p / K == q / K) && (r / K == s / K)) {  // Only the integrals in which both electrons keep their spin survive.
+                        g_g(p, q, r, s) = g(p % K, q % K, r % K, s % K);
+                    }
+                }
+            }
+        }
+    }
+
+    const GQCP::GSQHamiltonian<double> g_sq_hamiltonian {GQCP::ScalarGSQOneElectronOperator<double> {h_g}, GQCP::ScalarGSQTwoElectronOperator<double> {g_g}};
+
+
+    // The lowest N_P spatial orbitals are occupied for both spins.
+    std::vector<size_t> occupied_indices;
+    std::vector<size_t> virtual_indices;
+    for (size_t p = 0; p < M; p++) {
+        if (p % K < N_P) {
+            occupied_indices.push_back(p);
+        } else {
+            virtual_indices.push_back(p);
+        }
+    }
+    const GQCP::OrbitalSpace orbital_space {occupied_indices, virtual_indices};
+
+
+    // Optimize the CCD model parameters with the plain and the DIIS solvers.
+    auto plain_environment = GQCP::CCSDEnvironment<double>::PerturbativeCCD(g_sq_hamiltonian, orbital_space);
+    auto plain_solver = GQCP::CCDSolver<double>::Plain();
+    const auto plain_qc_structure = GQCP::QCMethod::CCD<double>().optimize(plain_solver, plain_environment);
+
+    auto diis_environment = GQCP::CCSDEnvironment<double>::PerturbativeCCD(g_sq_hamiltonian, orbital_space);
+    auto diis_solver = GQCP::CCDSolver<double>::DIIS();
+    const auto diis_qc_structure = GQCP::QCMethod::CCD<double>().optimize(diis_solver, diis_environment);
+
+    BOOST_CHECK(std::abs(plain_qc_structure.groundStateEnergy() - diis_qc_structure.groundStateEnergy()) < 1.0e-08);
+    BOOST_CHECK(diis_solver.numberOfIterations() < plain_solver.numberOfIterations());
+}
@@ -106,6 +106,63 @@ BOOST_AUTO_TEST_CASE(h2o_crawdad) {
 }
 
 
+/**
+ *  Check if the mixed-precision CCSD solver, which evaluates the CCSD intermediates and amplitude equations in single precision during its first iterations, converges to the same correlation energy as the double-precision CCSD solver.
+ *
+ *  The system under consideration is H2O in an STO-3G basisset, for which a reference by crawdad (https://github.com/CrawfordGroup/ProgrammingProjects/tree/master/Project%2305) is available.
+ */
+BOOST_AUTO_TEST_CASE(h2o_crawdad_mixed_precision) {
+
+    // Prepare the canonical RHF spin-orbital basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const auto N = molecule.numberOfElectrons();
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> r_spinor_basis {molecule, "STO-3G"};
+    const auto r_sq_hamiltonian = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // in an AO basis.
+    const auto K = r_spinor_basis.numberOfSpatialOrbitals();
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(N, r_sq_hamiltonian, r_spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {r_sq_hamiltonian};
+    const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
+
+    r_spinor_basis.transform(rhf_parameters.expansion());
+
+
+    // Quantize the molecular Hamiltonian in the corresponding general spinor basis, and determine the orbital space.
+    const auto g_spinor_basis = GQCP::GSpinorBasis<double, GQCP::GTOShell>::FromRestricted(r_spinor_basis);
+    const auto g_sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));
+
+    const auto reference_onv = GQCP::SpinUnresolvedONV::GHF(2 * K, N, rhf_parameters.spinOrbitalEnergiesBlocked());
+    const auto orbital_space = reference_onv.orbitalSpace();
+
+
+    // Optimize the CCSD model parameters using the mixed-precision solver.
+    auto environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto solver = GQCP::CCSDSolver<double>::MixedPrecision(1.0e-05);  // Switch to double precision once the amplitudes change less than 1.0e-05.
+    const auto ccsd_correlation_energy = GQCP::QCMethod::CCSD<double>().optimize(solver, environment).groundStateEnergy();
+
+    const double ref_ccsd_correlation_energy = -0.070680088376;
+    BOOST_CHECK(std::abs(ccsd_correlation_energy - ref_ccsd_correlation_energy) < 1.0e-08);
+
+    BOOST_CHECK(environment.V_A_single.dimension() == 0);  // The final iterations should have been performed in double precision.
+
+
+    // A switch threshold just above the convergence threshold can't be reached in single precision, so the solver should switch once the change in the amplitudes stagnates.
+    auto stagnation_environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto stagnation_solver = GQCP::CCSDSolver<double>::MixedPrecision(2.0e-08);
+    const auto stagnation_correlation_energy = GQCP::QCMethod::CCSD<double>().optimize(stagnation_solver, stagnation_environment).groundStateEnergy();
+
+    BOOST_CHECK(std::abs(stagnation_correlation_energy - ref_ccsd_correlation_energy) < 1.0e-08);
+    BOOST_CHECK(stagnation_environment.V_A_single.dimension() == 0);
+
+
+    // The switch threshold should be larger than the convergence threshold.
+    BOOST_CHECK_THROW(GQCP::CCSDSolver<double>::MixedPrecision(1.0e-10, 1.0e-08), std::invalid_argument);
+    BOOST_CHECK_THROW(GQCP::CCSDSolver<double>::MixedPrecision(1.0e-08, 1.0e-08), std::invalid_argument);
+}
+
+
 /**
  *  Validate the correctness of complex-valued CCSD by checking it against the complex FCI results for H2.
  * 
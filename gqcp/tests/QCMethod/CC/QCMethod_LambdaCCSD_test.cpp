@@ -0,0 +1,269 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "LambdaCCSD"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/SpinorBasis/GSpinorBasis.hpp"
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Mathematical/Optimization/LinearEquation/LinearEquationSolver.hpp"
+#include "ONVBasis/SpinUnresolvedONV.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCMethod/CC/CCSD.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/CC/CCSDSolver.hpp"
+#include "QCMethod/CC/LambdaCCSD.hpp"
+#include "QCMethod/CC/LambdaCCSDSolver.hpp"
+#include "QCMethod/HF/RHF/DiagonalRHFFockMatrixObjective.hpp"
+#include "QCMethod/HF/RHF/RHF.hpp"
+#include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
+
+
+/**
+ *  Check if the CCSD response density matrices, calculated from the Λ-amplitudes, reproduce the CCSD energy. Since the CCSD Lagrangian is linear in the one- and two-electron integrals, the expectation value of the Hamiltonian with respect to the (unrelaxed and relaxed) response density matrices should equal the RHF energy plus the CCSD correlation energy.
+ *
+ *  The system under consideration is H2O in an STO-3G basisset, for which the CCSD correlation energy was obtained by crawdad (https://github.com/CrawfordGroup/ProgrammingProjects/tree/master/Project%2305).
+ */
+BOOST_AUTO_TEST_CASE(h2o_crawdad_energy) {
+
+    // Prepare the canonical RHF spin-orbital basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const auto N = molecule.numberOfElectrons();
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> r_spinor_basis {molecule, "STO-3G"};
+    const auto r_sq_hamiltonian = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // in an AO basis.
+    const auto K = r_spinor_basis.numberOfSpatialOrbitals();
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(N, r_sq_hamiltonian, r_spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain(1.0e-10);
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {r_sq_hamiltonian};
+    const auto rhf_qc_structure = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment);
+    const auto rhf_parameters = rhf_qc_structure.groundStateParameters();
+    const auto rhf_electronic_energy = rhf_qc_structure.groundStateEnergy();
+
+    r_spinor_basis.transform(rhf_parameters.expansion());
+
+
+    // Create a GSpinorBasis, quantize the molecular Hamiltonian in it and optimize the CCSD model parameters.
+    const auto g_spinor_basis = GQCP::GSpinorBasis<double, GQCP::GTOShell>::FromRestricted(r_spinor_basis);
+    const auto g_sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In the canonical restricted spin-orbitals.
+
+    const auto reference_onv = GQCP::SpinUnresolvedONV::GHF(2 * K, N, rhf_parameters.spinOrbitalEnergiesBlocked());
+    const auto orbital_space = reference_onv.orbitalSpace();
+
+    auto environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto ccsd_solver = GQCP::CCSDSolver<double>::Plain(1.0e-10);
+    const auto ccsd_qc_structure = GQCP::QCMethod::CCSD<double>().optimize(ccsd_solver, environment);
+    const auto ccsd_correlation_energy = ccsd_qc_structure.groundStateEnergy();
+
+    const double ref_ccsd_correlation_energy = -0.070680088376;
+    BOOST_REQUIRE(std::abs(ccsd_correlation_energy - ref_ccsd_correlation_energy) < 1.0e-08);
+
+
+    // Solve the Λ-equations, which don't change the CCSD correlation energy.
+    auto lambda_solver = GQCP::LambdaCCSDSolver<double>::DIIS(6, 6, 1.0e-10);
+    const auto lambda_qc_structure = GQCP::QCMethod::LambdaCCSD<double>().optimize(lambda_solver, environment);
+    const auto& lambda_ccsd_parameters = lambda_qc_structure.groundStateParameters();
+
+    BOOST_CHECK(std::abs(lambda_qc_structure.groundStateEnergy() - ccsd_correlation_energy) < 1.0e-12);
+
+
+    // Check the unrelaxed response density matrices.
+    const auto D = lambda_ccsd_parameters.calculate1DM();
+    const auto d = lambda_ccsd_parameters.calculate2DM();
+
+    BOOST_CHECK(std::abs(D.matrix().trace() - static_cast<double>(N)) < 1.0e-10);
+    BOOST_CHECK(std::abs(g_sq_hamiltonian.calculateExpectationValue(D, d) - (rhf_electronic_energy + ccsd_correlation_energy)) < 1.0e-08);
+
+
+    // Check the relaxed response density matrices. Since the occupied-virtual Fock matrix elements vanish for the RHF reference, the orbital response doesn't change the energy.
+    auto linear_solver = GQCP::LinearEquationSolver<double>::ColPivHouseholderQR();
+    const auto z = GQCP::QCMethod::LambdaCCSD<double>().calculateOrbitalResponse(linear_solver, g_sq_hamiltonian, lambda_ccsd_parameters);
+
+    const auto D_relaxed = lambda_ccsd_parameters.calculateRelaxed1DM(z);
+    const auto d_relaxed = lambda_ccsd_parameters.calculateRelaxed2DM(z);
+
+    BOOST_CHECK(std::abs(D_relaxed.matrix().trace() - static_cast<double>(N)) < 1.0e-10);
+    BOOST_CHECK(std::abs(g_sq_hamiltonian.calculateExpectationValue(D_relaxed, d_relaxed) - (rhf_electronic_energy + ccsd_correlation_energy)) < 1.0e-08);
+}
+
+
+/**
+ *  Check if the plain and DIIS Λ-CCSD solvers find the same Λ-amplitudes.
+ *
+ *  The system under consideration is H2O in an STO-3G basisset.
+ */
+BOOST_AUTO_TEST_CASE(h2o_plain_vs_diis) {
+
+    // Prepare the canonical RHF spin-orbital basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const auto N = molecule.numberOfElectrons();
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> r_spinor_basis {molecule, "STO-3G"};
+    const auto r_sq_hamiltonian = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // in an AO basis.
+    const auto K = r_spinor_basis.numberOfSpatialOrbitals();
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(N, r_sq_hamiltonian, r_spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain(1.0e-10);
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {r_sq_hamiltonian};
+    const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
+
+    r_spinor_basis.transform(rhf_parameters.expansion());
+
+    const auto g_spinor_basis = GQCP::GSpinorBasis<double, GQCP::GTOShell>::FromRestricted(r_spinor_basis);
+    const auto g_sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In the canonical restricted spin-orbitals.
+    const auto orbital_space = GQCP::SpinUnresolvedONV::GHF(2 * K, N, rhf_parameters.spinOrbitalEnergiesBlocked()).orbitalSpace();
+
+    auto environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto ccsd_solver = GQCP::CCSDSolver<double>::Plain(1.0e-10);
+    GQCP::QCMethod::CCSD<double>().optimize(ccsd_solver, environment);
+
+
+    // Solve the Λ-equations in two copies of the converged CCSD environment.
+    auto plain_environment = environment;
+    auto plain_solver = GQCP::LambdaCCSDSolver<double>::Plain(1.0e-10);
+    const auto plain_parameters = GQCP::QCMethod::LambdaCCSD<double>().optimize(plain_solver, plain_environment).groundStateParameters();
+
+    auto diis_environment = environment;
+    auto diis_solver = GQCP::LambdaCCSDSolver<double>::DIIS(6, 6, 1.0e-10);
+    const auto diis_parameters = GQCP::QCMethod::LambdaCCSD<double>().optimize(diis_solver, diis_environment).groundStateParameters();
+
+    BOOST_CHECK(plain_parameters.lambda1Amplitudes().asImplicitMatrixSlice().asMatrix().isApprox(diis_parameters.lambda1Amplitudes().asImplicitMatrixSlice().asMatrix(), 1.0e-08));
+    BOOST_CHECK(plain_parameters.lambda2Amplitudes().asImplicitRankFourTensorSlice().asMatrix().isApprox(diis_parameters.lambda2Amplitudes().asImplicitRankFourTensorSlice().asMatrix(), 1.0e-08));
+}
+
+
+/**
+ *  Check the unrelaxed and relaxed CCSD response one-electron density matrices against central finite differences of the CCSD energy with respect to a one-electron perturbation ε P. Contrary to energy expectation values, these derivatives are sensitive to the Λ-amplitudes and the orbital response.
+ *
+ *  In the unrelaxed case, the perturbed energies are calculated in the fixed, unperturbed RHF orbitals: dE/dε = Tr(D P). In the relaxed case, the RHF orbitals are re-optimized at every perturbation: dE/dε = Tr(D_relaxed P).
+ *
+ *  The system under consideration is LiH in a 6-31G basisset, read from an FCIDUMP file.
+ */
+BOOST_AUTO_TEST_CASE(lih_631g_finite_differences) {
+
+    const auto r_sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/lih_631g_caitlin.FCIDUMP");
+    const auto K = r_sq_hamiltonian.numberOfOrbitals();
+    const auto M = 2 * K;
+    const size_t N_P = 2;
+
+
+    // The canonical RHF orbitals, expressed in the orthonormal orbitals of the FCIDUMP file.
+    const auto optimize_rhf_orbitals = [K, N_P](const GQCP::RSQHamiltonian<double>& sq_hamiltonian) {
+        const GQCP::ScalarRSQOneElectronOperator<double> S {GQCP::SquareMatrix<double>::Identity(K)};
+        auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(2 * N_P, sq_hamiltonian, S);
+        auto diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS(6, 6, 1.0e-12, 1000);
+        diis_rhf_scf_solver.perform(rhf_environment);
+
+        return sq_hamiltonian.transformed(rhf_environment.coefficient_matrices.back());
+    };
+
+    // The spin-blocked spinor Hamiltonian, in which the first K spinors are alpha spin-orbitals and the last K spinors are beta spin-orbitals.
+    const auto to_spin_blocked = [K, M](const GQCP::RSQHamiltonian<double>& sq_hamiltonian) {
+        const auto& h = sq_hamiltonian.core().parameters();
+        const auto& g = sq_hamiltonian.twoElectron().parameters();
+
+        GQCP::SquareMatrix<double> h_g = GQCP::SquareMatrix<double>::Zero(M);
+        h_g.topLeftCorner(K, K) = h;
+        h_g.bottomRightCorner(K, K) = h;
+
+        GQCP::SquareRankFourTensor<double> g_g {M};
+        g_g.setZero();
+        for (size_t p = 0; p < M; p++) {
+            for (size_t q = 0; q < M; q++) {
+                for (size_t r = 0; r < M; r++) {
+                    for (size_t s = 0; s < M; s++) {
+                        if ((p / K == q / K) && (r / K == s / K)) {  // Only the integrals in which both electrons keep their spin survive.
+                            g_g(p, q, r, s) = g(p % K, q % K, r % K, s % K);
+                        }
+                    }
+                }
+            }
+        }
+
+        return GQCP::GSQHamiltonian<double> {GQCP::ScalarGSQOneElectronOperator<double> {h_g}, GQCP::ScalarGSQTwoElectronOperator<double> {g_g}};
+    };
+
+    // The lowest N_P spatial orbitals are occupied for both spins.
+    std::vector<size_t> occupied_indices;
+    std::vector<size_t> virtual_indices;
+    for (size_t p = 0; p < M; p++) {
+        if (p % K < N_P) {
+            occupied_indices.push_back(p);
+        } else {
+            virtual_indices.push_back(p);
+        }
+    }
+    const GQCP::OrbitalSpace orbital_space {occupied_indices, virtual_indices};
+
+    // The total CCSD electronic energy: the reference energy and the CCSD correlation energy.
+    const auto calculate_ccsd_energy = [&orbital_space](const GQCP::GSQHamiltonian<double>& sq_hamiltonian) {
+        const auto& h = sq_hamiltonian.core().parameters();
+        const auto F = sq_hamiltonian.calculateInactiveFockian(orbital_space).parameters();
+
+        double reference_energy = 0.0;
+        for (const auto& i : orbital_space.indices(GQCP::OccupationType::k_occupied)) {
+            reference_energy += 0.5 * (h(i, i) + F(i, i));
+        }
+
+        auto environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(sq_hamiltonian, orbital_space);
+        auto ccsd_solver = GQCP::CCSDSolver<double>::Plain(1.0e-12, 500);
+        return reference_energy + GQCP::QCMethod::CCSD<double>().optimize(ccsd_solver, environment).groundStateEnergy();
+    };
+
+
+    // Solve the CCSD and Λ-CCSD equations and the orbital response for the unperturbed Hamiltonian, in the canonical RHF spin-orbitals.
+    const auto r_sq_hamiltonian_mo = optimize_rhf_orbitals(r_sq_hamiltonian);
+    const auto g_sq_hamiltonian = to_spin_blocked(r_sq_hamiltonian_mo);
+
+    auto environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto ccsd_solver = GQCP::CCSDSolver<double>::Plain(1.0e-12, 500);
+    GQCP::QCMethod::CCSD<double>().optimize(ccsd_solver, environment);
+
+    auto lambda_solver = GQCP::LambdaCCSDSolver<double>::DIIS(6, 6, 1.0e-12, 500);
+    const auto lambda_ccsd_parameters = GQCP::QCMethod::LambdaCCSD<double>().optimize(lambda_solver, environment).groundStateParameters();
+
+    auto linear_solver = GQCP::LinearEquationSolver<double>::ColPivHouseholderQR();
+    const auto z = GQCP::QCMethod::LambdaCCSD<double>().calculateOrbitalResponse(linear_solver, g_sq_hamiltonian, lambda_ccsd_parameters);
+
+    const auto D = lambda_ccsd_parameters.calculate1DM().matrix();
+    const auto D_relaxed = lambda_ccsd_parameters.calculateRelaxed1DM(z).matrix();
+
+
+    // Perturb the core Hamiltonian in the RHF orbitals with a spin-independent, symmetric operator that couples all orbitals.
+    GQCP::SquareMatrix<double> P_r {K};
+    for (size_t p = 0; p < K; p++) {
+        for (size_t q = 0; q < K; q++) {
+            P_r(p, q) = 1.0 / (1.0 + p + q);
+        }
+    }
+    GQCP::SquareMatrix<double> P = GQCP::SquareMatrix<double>::Zero(M);
+    P.topLeftCorner(K, K) = P_r;
+    P.bottomRightCorner(K, K) = P_r;
+
+    const double epsilon = 5.0e-05;
+    const auto& g_op = r_sq_hamiltonian_mo.twoElectron();
+    const GQCP::RSQHamiltonian<double> plus_hamiltonian {GQCP::ScalarRSQOneElectronOperator<double> {r_sq_hamiltonian_mo.core().parameters() + epsilon * P_r}, g_op};
+    const GQCP::RSQHamiltonian<double> minus_hamiltonian {GQCP::ScalarRSQOneElectronOperator<double> {r_sq_hamiltonian_mo.core().parameters() - epsilon * P_r}, g_op};
+
+    const double unrelaxed_derivative = (calculate_ccsd_energy(to_spin_blocked(plus_hamiltonian)) - calculate_ccsd_energy(to_spin_blocked(minus_hamiltonian))) / (2 * epsilon);
+    BOOST_CHECK(std::abs(unrelaxed_derivative - (D.array() * P.array()).sum()) < 1.0e-07);
+
+    const double relaxed_derivative = (calculate_ccsd_energy(to_spin_blocked(optimize_rhf_orbitals(plus_hamiltonian))) - calculate_ccsd_energy(to_spin_blocked(optimize_rhf_orbitals(minus_hamiltonian)))) / (2 * epsilon);
+    BOOST_CHECK(std::abs(relaxed_derivative - (D_relaxed.array() * P.array()).sum()) < 1.0e-07);
+}
@@ -0,0 +1,206 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "PerturbativeTriples"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/SpinorBasis/GSpinorBasis.hpp"
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Basis/Transformations/JacobiRotation.hpp"
+#include "ONVBasis/SpinUnresolvedONV.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCMethod/CC/CCSD.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/CC/CCSDSolver.hpp"
+#include "QCMethod/CC/PerturbativeTriples.hpp"
+#include "QCMethod/CC/RCCSD.hpp"
+#include "QCMethod/CC/RCCSDSolver.hpp"
+#include "QCMethod/HF/RHF/DiagonalRHFFockMatrixObjective.hpp"
+#include "QCMethod/HF/RHF/RHF.hpp"
+#include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
+
+
+/**
+ *  Check the (T) correction, in both the general spinor basis and the spin-adapted closed-shell formulation, with a reference by crawdad (https://github.com/CrawfordGroup/ProgrammingProjects/tree/master/Project%2306).
+ *
+ *  The system under consideration is H2O in an STO-3G basisset.
+ */
+BOOST_AUTO_TEST_CASE(h2o_crawdad) {
+
+    // Prepare the canonical RHF spin-orbital basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const auto N = molecule.numberOfElectrons();
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> r_spinor_basis {molecule, "STO-3G"};
+    const auto r_sq_hamiltonian = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // in an AO basis
+    const auto K = r_spinor_basis.numberOfSpatialOrbitals();
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(N, r_sq_hamiltonian, r_spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {r_sq_hamiltonian};
+    const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
+
+    r_spinor_basis.transform(rhf_parameters.expansion());
+
+    const double ref_triples_correction = -0.000099877272;
+
+
+    // Check the (T) correction for the spin-orbital CCSD amplitudes.
+    const auto g_spinor_basis = GQCP::GSpinorBasis<double, GQCP::GTOShell>::FromRestricted(r_spinor_basis);
+    const auto g_sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In the canonical restricted spin-orbitals.
+    const auto orbital_space = GQCP::SpinUnresolvedONV::GHF(2 * K, N, rhf_parameters.spinOrbitalEnergiesBlocked()).orbitalSpace();
+
+    auto g_environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto g_solver = GQCP::CCSDSolver<double>::Plain();
+    const auto ccsd_parameters = GQCP::QCMethod::CCSD<double>().optimize(g_solver, g_environment).groundStateParameters();
+
+    const auto g_triples_correction = GQCP::calculatePerturbativeTriplesCorrection(g_sq_hamiltonian, ccsd_parameters);
+    BOOST_CHECK(std::abs(g_triples_correction - ref_triples_correction) < 1.0e-10);
+
+
+    // Check the (T) correction for the spin-adapted closed-shell CCSD amplitudes, and check that the result does not depend on the number of threads.
+    const auto r_sq_hamiltonian_mo = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In the canonical RHF spin-orbitals.
+
+    auto r_environment = GQCP::CCSDEnvironment<double>::PerturbativeRCCSD(r_sq_hamiltonian_mo, rhf_parameters);
+    auto r_solver = GQCP::RCCSDSolver<double>::Plain();
+    const auto rccsd_parameters = GQCP::QCMethod::RCCSD<double>().optimize(r_solver, r_environment).groundStateParameters();
+
+    const auto r_triples_correction = GQCP::calculatePerturbativeTriplesCorrection(r_sq_hamiltonian_mo, rccsd_parameters, 1);
+    BOOST_CHECK(std::abs(r_triples_correction - ref_triples_correction) < 1.0e-10);
+
+    const auto r_triples_correction_threaded = GQCP::calculatePerturbativeTriplesCorrection(r_sq_hamiltonian_mo, rccsd_parameters, 4);
+    BOOST_CHECK(std::abs(r_triples_correction_threaded - r_triples_correction) < 1.0e-14);
+}
+
+
+/**
+ *  Check if the (T) corrections in the general spinor basis and in the spin-adapted closed-shell formulation agree for a non-canonical reference, i.e. one for which the occupied-virtual block of the Fock matrix does not vanish, such that the f_ia t_jk^bc-term of the disconnected triples contributes.
+ *
+ *  The system under consideration is H2O in an STO-3G basisset, read from an FCIDUMP file. Arbitrary spin-adapted amplitudes are used, since both formulations should agree for any such amplitudes.
+ */
+BOOST_AUTO_TEST_CASE(h2o_non_canonical) {
+
+    // Mix an occupied and a virtual canonical orbital, such that the reference is no longer canonical.
+    auto r_sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    r_sq_hamiltonian.rotate(GQCP::JacobiRotation(5, 1, 0.3));
+
+    const auto K = r_sq_hamiltonian.numberOfOrbitals();
+    const auto M = 2 * K;
+    const size_t N_P = 5;
+
+
+    // Set up the spin-blocked spinor Hamiltonian, in which the first K spinors are alpha spin-orbitals and the last K spinors are beta spin-orbitals.
+    const auto& h = r_sq_hamiltonian.core().parameters();
+    const auto& g = r_sq_hamiltonian.twoElectron().parameters();
+
+    GQCP::SquareMatrix<double> h_g = GQCP::SquareMatrix<double>::Zero(M);
+    h_g.topLeftCorner(K, K) = h;
+    h_g.bottomRightCorner(K, K) = h;
+
+    GQCP::SquareRankFourTensor<double> g_g {M};
+    g_g.setZero();
+    for (size_t p = 0; p < M; p++) {
+        for (size_t q = 0; q < M; q++) {
+            for (size_t r = 0; r < M; r++) {
+                for (size_t s = 0; s < M; s++) {
+                    if ((p / K == q / K) && (r / K == s / K)) {  // Only the integrals in which both electrons keep their spin survive.
+                        g_g(p, q, r, s) = g(p % K, q % K, r % K, s % K);
+                    }
+                }
+            }
+        }
+    }
+
+    const GQCP::GSQHamiltonian<double> g_sq_hamiltonian {GQCP::ScalarGSQOneElectronOperator<double> {h_g}, GQCP::ScalarGSQTwoElectronOperator<double> {g_g}};
+
+
+    // Set up the orbital spaces: the lowest N_P spatial orbitals are occupied for both spins.
+    const auto r_orbital_space = GQCP::OrbitalSpace::Implicit({{GQCP::OccupationType::k_occupied, N_P}, {GQCP::OccupationType::k_virtual, K - N_P}});
+    const auto occupied = GQCP::OccupationType::k_occupied;
+    const auto virtual_ = GQCP::OccupationType::k_virtual;
+
+    std::vector<size_t> occupied_indices;
+    std::vector<size_t> virtual_indices;
+    for (size_t p = 0; p < M; p++) {
+        if (p % K < N_P) {
+            occupied_indices.push_back(p);
+        } else {
+            virtual_indices.push_back(p);
+        }
+    }
+    const GQCP::OrbitalSpace g_orbital_space {occupied_indices, virtual_indices};
+
+    BOOST_REQUIRE(r_sq_hamiltonian.calculateInactiveFockian(r_orbital_space).parameters().block(0, N_P, N_P, K - N_P).norm() > 1.0e-03);
+
+
+    // Create arbitrary spin-adapted amplitudes, which satisfy t_ij^ab = t_ji^ba.
+    const auto t1_function = [](const size_t i, const size_t a) { return 0.05 * std::sin(1.0 + i + 2.0 * a); };
+    const auto t2_function = [](const size_t i, const size_t j, const size_t a, const size_t b) {
+        return 0.02 * (std::cos(1.0 + i + 2.0 * j + 3.0 * a + 5.0 * b) + std::cos(1.0 + j + 2.0 * i + 3.0 * b + 5.0 * a));
+    };
+
+    auto r_t1 = r_orbital_space.initializeRepresentableObjectFor<double>(occupied, virtual_);
+    auto r_t2 = r_orbital_space.initializeRepresentableObjectFor<double>(occupied, occupied, virtual_, virtual_);
+    for (const auto& i : r_orbital_space.indices(occupied)) {
+        for (const auto& a : r_orbital_space.indices(virtual_)) {
+            r_t1(i, a) = t1_function(i, a);
+
+            for (const auto& j : r_orbital_space.indices(occupied)) {
+                for (const auto& b : r_orbital_space.indices(virtual_)) {
+                    r_t2(i, j, a, b) = t2_function(i, j, a, b);
+                }
+            }
+        }
+    }
+
+
+    // The corresponding spin-orbital amplitudes read t_IJ^AB = delta(IA) delta(JB) t_ij^ab - delta(IB) delta(JA) t_ij^ba, in which the deltas denote equal spins.
+    auto g_t1 = g_orbital_space.initializeRepresentableObjectFor<double>(occupied, virtual_);
+    auto g_t2 = g_orbital_space.initializeRepresentableObjectFor<double>(occupied, occupied, virtual_, virtual_);
+    for (const auto& I : g_orbital_space.indices(occupied)) {
+        for (const auto& A : g_orbital_space.indices(virtual_)) {
+            g_t1(I, A) = (I / K == A / K) ? t1_function(I % K, A % K) : 0.0;
+
+            for (const auto& J : g_orbital_space.indices(occupied)) {
+                for (const auto& B : g_orbital_space.indices(virtual_)) {
+                    const auto i = I % K;
+                    const auto j = J % K;
+                    const auto a = A % K;
+                    const auto b = B % K;
+
+                    double value = 0.0;
+                    if ((I / K == A / K) && (J / K == B / K)) {
+                        value += t2_function(i, j, a, b);
+                    }
+                    if ((I / K == B / K) && (J / K == A / K)) {
+                        value -= t2_function(i, j, b, a);
+                    }
+                    g_t2(I, J, A, B) = value;
+                }
+            }
+        }
+    }
+
+    const GQCP::QCModel::RCCSD<double> rccsd_parameters {GQCP::T1Amplitudes<double>(r_t1, r_orbital_space), GQCP::T2Amplitudes<double>(r_t2, r_orbital_space)};
+    const GQCP::QCModel::CCSD<double> ccsd_parameters {GQCP::T1Amplitudes<double>(g_t1, g_orbital_space), GQCP::T2Amplitudes<double>(g_t2, g_orbital_space)};
+
+
+    const auto r_triples_correction = GQCP::calculatePerturbativeTriplesCorrection(r_sq_hamiltonian, rccsd_parameters);
+    const auto g_triples_correction = GQCP::calculatePerturbativeTriplesCorrection(g_sq_hamiltonian, ccsd_parameters);
+    BOOST_CHECK(std::abs(g_triples_correction - r_triples_correction) < 1.0e-12);
+}
@@ -0,0 +1,139 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "RCCSD"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Basis/SpinorBasis/GSpinorBasis.hpp"
+#include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "ONVBasis/SpinUnresolvedONV.hpp"
+#include "Operator/FirstQuantized/NuclearRepulsionOperator.hpp"
+#include "Operator/SecondQuantized/SQHamiltonian.hpp"
+#include "QCMethod/CC/CCSD.hpp"
+#include "QCMethod/CC/CCSDEnvironment.hpp"
+#include "QCMethod/CC/CCSDSolver.hpp"
+#include "QCMethod/CC/RCCSD.hpp"
+#include "QCMethod/CC/RCCSDSolver.hpp"
+#include "QCMethod/HF/RHF/DiagonalRHFFockMatrixObjective.hpp"
+#include "QCMethod/HF/RHF/RHF.hpp"
+#include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
+
+
+/**
+ *  Check if the implementation of spin-adapted closed-shell CCSD is correct, by comparing with a reference by crawdad (https://github.com/CrawfordGroup/ProgrammingProjects/tree/master/Project%2305).
+ *
+ *  The system under consideration is H2O in an STO-3G basisset.
+ */
+BOOST_AUTO_TEST_CASE(h2o_crawdad) {
+
+    // Prepare the canonical RHF spin-orbital basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const auto N = molecule.numberOfElectrons();
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "STO-3G"};
+    auto sq_hamiltonian = spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // in an AO basis
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(N, sq_hamiltonian, spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {sq_hamiltonian};
+    const auto rhf_qc_structure = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment);
+    const auto rhf_parameters = rhf_qc_structure.groundStateParameters();
+
+    sq_hamiltonian.transform(rhf_parameters.expansion());  // Now in the RHF orbital basis.
+
+
+    // Initialize an environment suitable for spin-adapted closed-shell CCSD. Since we're working with a Hartree-Fock reference, the initial correlation energy is the MP2 correlation energy.
+    auto environment = GQCP::CCSDEnvironment<double>::PerturbativeRCCSD(sq_hamiltonian, rhf_parameters);
+
+    const double ref_mp2_correction_energy = -0.049149636120;
+    BOOST_REQUIRE(environment.t1_amplitudes.back().asImplicitMatrixSlice().asMatrix().isZero(1.0e-08));  // for a HF reference, the perturbative T1 amplitudes are zero
+    BOOST_REQUIRE(std::abs(environment.correlation_energies.back() - ref_mp2_correction_energy) < 1.0e-10);
+
+
+    // Prepare the RCCSD solver and optimize the RCCSD model parameters.
+    auto solver = GQCP::RCCSDSolver<double>::Plain();
+    const auto rccsd_qc_structure = GQCP::QCMethod::RCCSD<double>().optimize(solver, environment);
+    const auto rccsd_correlation_energy = rccsd_qc_structure.groundStateEnergy();
+
+    const double ref_ccsd_correlation_energy = -0.070680088376;
+    BOOST_CHECK(std::abs(rccsd_correlation_energy - ref_ccsd_correlation_energy) < 1.0e-08);
+}
+
+
+/**
+ *  Check if the DIIS-accelerated spin-adapted closed-shell CCSD amplitudes correspond to the spin-orbital CCSD amplitudes, for H2O in an STO-3G basisset.
+ * 
+ *  The alpha-beta spin-orbital T2-amplitudes t_{i_alpha j_beta}^{a_alpha b_beta} should be equal to the spatial-orbital T2-amplitudes.
+ */
+BOOST_AUTO_TEST_CASE(h2o_RCCSD_vs_CCSD) {
+
+    // Prepare the canonical RHF spin-orbital basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const auto N = molecule.numberOfElectrons();
+    const auto N_P = N / 2;
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> r_spinor_basis {molecule, "STO-3G"};
+    const auto r_sq_hamiltonian = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // in an AO basis
+    const auto K = r_spinor_basis.numberOfSpatialOrbitals();
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(N, r_sq_hamiltonian, r_spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {r_sq_hamiltonian};
+    const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
+
+    r_spinor_basis.transform(rhf_parameters.expansion());
+
+
+    // Do the spin-adapted closed-shell CCSD calculation.
+    const auto r_sq_hamiltonian_mo = r_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In the canonical RHF spin-orbitals.
+    auto r_environment = GQCP::CCSDEnvironment<double>::PerturbativeRCCSD(r_sq_hamiltonian_mo, rhf_parameters);
+    auto r_solver = GQCP::RCCSDSolver<double>::DIIS();
+    const auto rccsd_qc_structure = GQCP::QCMethod::RCCSD<double>().optimize(r_solver, r_environment);
+
+
+    // Do the spin-orbital CCSD calculation.
+    const auto g_spinor_basis = GQCP::GSpinorBasis<double, GQCP::GTOShell>::FromRestricted(r_spinor_basis);
+    const auto g_sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));
+    const auto orbital_space = GQCP::SpinUnresolvedONV::GHF(2 * K, N, rhf_parameters.spinOrbitalEnergiesBlocked()).orbitalSpace();
+
+    auto g_environment = GQCP::CCSDEnvironment<double>::PerturbativeCCSD(g_sq_hamiltonian, orbital_space);
+    auto g_solver = GQCP::CCSDSolver<double>::Plain();
+    const auto ccsd_qc_structure = GQCP::QCMethod::CCSD<double>().optimize(g_solver, g_environment);
+
+
+    // Check the correlation energies and the amplitudes.
+    BOOST_CHECK(std::abs(rccsd_qc_structure.groundStateEnergy() - ccsd_qc_structure.groundStateEnergy()) < 1.0e-08);
+
+    const auto& t1_r = rccsd_qc_structure.groundStateParameters().t1Amplitudes();
+    const auto& t2_r = rccsd_qc_structure.groundStateParameters().t2Amplitudes();
+    const auto& t1_g = ccsd_qc_structure.groundStateParameters().t1Amplitudes();
+    const auto& t2_g = ccsd_qc_structure.groundStateParameters().t2Amplitudes();
+
+    // In the blocked spin-orbital basis, the alpha spin-orbitals come first, so the beta spin-orbital that belongs to spatial orbital p has index p + K.
+    for (size_t i = 0; i < N_P; i++) {
+        for (size_t a = N_P; a < K; a++) {
+            BOOST_CHECK(std::abs(t1_r(i, a) - t1_g(i, a)) < 1.0e-06);
+
+            for (size_t j = 0; j < N_P; j++) {
+                for (size_t b = N_P; b < K; b++) {
+                    BOOST_CHECK(std::abs(t2_r(i, j, a, b) - t2_g(i, j + K, a, b + K)) < 1.0e-06);
+                }
+            }
+        }
+    }
+}
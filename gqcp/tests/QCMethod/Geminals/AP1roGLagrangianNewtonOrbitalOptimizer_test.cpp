@@ -67,3 +67,38 @@ BOOST_AUTO_TEST_CASE(lih_6_31G_orbital_optimize) {
     // We don't have reference data, so all we can do is check if orbital optimization lowers the energy
     BOOST_CHECK(optimized_energy < initial_energy);
 }
+
+
+/**
+ *  Check if re-solving the AP1roG PSEs with a Newton-Krylov solver during the Newton orbital optimization leads to the same optimized energy as the default Newton solver.
+ */
+BOOST_AUTO_TEST_CASE(lih_6_31G_orbital_optimize_newton_krylov) {
+
+    // Construct the molecular Hamiltonian in the RHF basis
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/lih_olsens.xyz");
+    const auto N_P = molecule.numberOfElectrons() / 2;
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "6-31G"};
+    auto sq_hamiltonian = spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In an AO basis.
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), sq_hamiltonian, spinor_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {sq_hamiltonian};
+    const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
+    transform(rhf_parameters.expansion(), spinor_basis, sq_hamiltonian);
+
+    const GQCP::AP1roGGeminalCoefficients G_initial {N_P, spinor_basis.numberOfSpatialOrbitals()};  // zero initial guess
+
+
+    // Do an AP1roG orbital optimization with both PSE solvers, starting from the same orbitals.
+    auto newton_spinor_basis = spinor_basis;
+    auto newton_sq_hamiltonian = sq_hamiltonian;
+    auto hessian_modifier = std::make_shared<GQCP::IterativeIdentitiesHessianModifier>();
+    GQCP::AP1roGLagrangianNewtonOrbitalOptimizer newton_orbital_optimizer {G_initial, hessian_modifier, 1.0e-04};
+    newton_orbital_optimizer.optimize(newton_spinor_basis, newton_sq_hamiltonian);
+
+    const auto newton_krylov_solver = GQCP::NonLinearEquationSolver<double>::NewtonKrylov();
+    GQCP::AP1roGLagrangianNewtonOrbitalOptimizer newton_krylov_orbital_optimizer {G_initial, hessian_modifier, newton_krylov_solver, 1.0e-04};
+    newton_krylov_orbital_optimizer.optimize(spinor_basis, sq_hamiltonian);
+
+    BOOST_CHECK(std::abs(newton_krylov_orbital_optimizer.electronicEnergy() - newton_orbital_optimizer.electronicEnergy()) < 1.0e-06);
+}
@@ -117,3 +117,32 @@ BOOST_AUTO_TEST_CASE(h2_631gdp_weak_interaction_limit) {
         BOOST_CHECK(std::abs(ap1rog_coefficients(i) - ref_ap1rog_coefficients(i)) < 1.0e-05);
     }
 }
+
+
+/**
+ *  Check if the matrix-free Newton-Krylov solver finds the same AP1roG solution as the Newton solver.
+ *  The test system is H2O in a 6-31G basis, read from an FCIDUMP file.
+ */
+BOOST_AUTO_TEST_CASE(h2o_631g_newton_krylov) {
+
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_631g_klaas.FCIDUMP");
+    const size_t N_P = 5;
+
+
+    // Do an AP1roG calculation using the Newton solver and using the Newton-Krylov solver.
+    auto newton_solver = GQCP::NonLinearEquationSolver<double>::Newton();
+    auto newton_environment = GQCP::PSEnvironment::AP1roG(sq_hamiltonian, N_P);
+    const auto newton_qc_structure = GQCP::QCMethod::AP1roG(sq_hamiltonian, N_P).optimize(newton_solver, newton_environment);
+
+    auto newton_krylov_solver = GQCP::NonLinearEquationSolver<double>::NewtonKrylov();
+    auto newton_krylov_environment = GQCP::PSEnvironment::AP1roG(sq_hamiltonian, N_P);
+    const auto newton_krylov_qc_structure = GQCP::QCMethod::AP1roG(sq_hamiltonian, N_P).optimize(newton_krylov_solver, newton_krylov_environment);
+
+
+    // Check the results.
+    BOOST_CHECK(std::abs(newton_qc_structure.groundStateEnergy() - newton_krylov_qc_structure.groundStateEnergy()) < 1.0e-10);
+
+    const auto newton_coefficients = newton_qc_structure.groundStateParameters().geminalCoefficients().asVector();
+    const auto newton_krylov_coefficients = newton_krylov_qc_structure.groundStateParameters().geminalCoefficients().asVector();
+    BOOST_CHECK(newton_coefficients.isApprox(newton_krylov_coefficients, 1.0e-08));
+}
@@ -19,6 +19,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Basis/Integrals/DirectJKBuilder.hpp"
 #include "Basis/SpinorBasis/GSpinorBasis.hpp"
 #include "Operator/FirstQuantized/NuclearRepulsionOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
@@ -352,3 +353,138 @@ BOOST_AUTO_TEST_CASE(h3_sto3g_complex) {
     // Check if the converged energy matches the reference energy.
     BOOST_CHECK(std::abs((ghf_ground_state_energy + nuc_rep) - reference_energy) < 1.0e-06);
 }
+
+
+/**
+ *  Check if the direct GHF Fock matrix, which is built from the spin-blocks of the density matrix, is equal to the conventional one, for a density matrix with non-zero off-diagonal spin-blocks.
+ */
+BOOST_AUTO_TEST_CASE(direct_fock_matrix) {
+
+    const auto molecule = GQCP::Molecule::HRingFromDistance(3, 1.0);  // H3-triangle, 1 bohr apart
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<double, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+    const auto sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto jk_builder = std::make_shared<GQCP::DirectJKBuilder>(GQCP::DirectJKBuilder::Libint(scalar_basis));
+    auto environment = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(N, sq_hamiltonian.core(), S, jk_builder);
+
+
+    // Let the direct Fock matrix calculation step act on a random (symmetric) density matrix.
+    const GQCP::SquareMatrix<double> P_random = GQCP::SquareMatrix<double>::Random(6);
+    const GQCP::G1DM<double> P {P_random + P_random.transpose()};
+    environment.density_matrices.push_back(P);
+
+    GQCP::GHFFockMatrixCalculation<double>().execute(environment);
+    const auto ref_F = GQCP::QCModel::GHF<double>::calculateScalarBasisFockMatrix(P, sq_hamiltonian);
+
+    BOOST_CHECK(environment.fock_matrices.back().parameters().isApprox(ref_F.parameters(), 1.0e-12));
+}
+
+
+/**
+ *  Check if the direct DIIS GHF SCF solver, which never stores the two-electron integrals, finds the same energy as the conventional one.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_direct_diis) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto N = molecule.numberOfElectrons();
+
+    const GQCP::GSpinorBasis<double, GQCP::GTOShell> g_spinor_basis {molecule, "STO-3G"};
+    const auto S = g_spinor_basis.overlap();
+    const auto sq_hamiltonian = g_spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));
+
+
+    // Perform a conventional and a direct GHF calculation.
+    auto environment = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(N, sq_hamiltonian, S);
+    auto solver = GQCP::GHFSCFSolver<double>::DIIS();
+    const auto qc_structure = GQCP::QCMethod::GHF<double>().optimize(solver, environment);
+
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto jk_builder = std::make_shared<GQCP::DirectJKBuilder>(GQCP::DirectJKBuilder::Libint(scalar_basis));
+    auto direct_environment = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(N, sq_hamiltonian.core(), S, jk_builder);
+    auto direct_solver = GQCP::GHFSCFSolver<double>::DIIS();
+    const auto direct_qc_structure = GQCP::QCMethod::GHF<double>().optimize(direct_solver, direct_environment);
+
+    BOOST_CHECK(std::abs(direct_qc_structure.groundStateEnergy() - qc_structure.groundStateEnergy()) < 1.0e-08);
+}
+
+
+/**
+ *  Set up the spin-blocked spinor Hamiltonian of H2O/STO-3G, in which the first K spinors are alpha spin-orbitals and the last K spinors are beta spin-orbitals. The integrals are expressed in an orthonormal basis.
+ */
+GQCP::GSQHamiltonian<double> spinBlockedH2OHamiltonian() {
+
+    const auto r_sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto K = r_sq_hamiltonian.numberOfOrbitals();
+    const auto M = 2 * K;
+
+    const auto& h = r_sq_hamiltonian.core().parameters();
+    const auto& g = r_sq_hamiltonian.twoElectron().parameters();
+
+    GQCP::SquareMatrix<double> h_g = GQCP::SquareMatrix<double>::Zero(M);
+    h_g.topLeftCorner(K, K) = h;
+    h_g.bottomRightCorner(K, K) = h;
+
+    GQCP::SquareRankFourTensor<double> g_g {M};
+    g_g.setZero();
+    for (size_t p = 0; p < M; p++) {
+        for (size_t q = 0; q < M; q++) {
+            for (size_t r = 0; r < M; r++) {
+                for (size_t s = 0; s < M; s++) {
+                    if ((p / K == q / K) && (r / K == s / K)) {  // Only the integrals in which both electrons keep their spin survive.
+                        g_g(p, q, r, s) = g(p % K, q % K, r % K, s % K);
+                    }
+                }
+            }
+        }
+    }
+
+    return GQCP::GSQHamiltonian<double> {GQCP::ScalarGSQOneElectronOperator<double> {h_g}, GQCP::ScalarGSQTwoElectronOperator<double> {g_g}};
+}
+
+
+/**
+ *  Check if the second-order GHF SCF solver finds the same energy as the DIIS GHF SCF solver for the open-shell H2O+, in fewer iterations.
+ */
+BOOST_AUTO_TEST_CASE(h2o_cation_sto3g_second_order) {
+
+    const auto sq_hamiltonian = spinBlockedH2OHamiltonian();
+    const GQCP::ScalarGSQOneElectronOperator<double> S {GQCP::SquareMatrix<double>::Identity(sq_hamiltonian.numberOfOrbitals())};
+
+    auto diis_environment = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(9, sq_hamiltonian, S);
+    auto diis_solver = GQCP::GHFSCFSolver<double>::DIIS();
+    diis_solver.perform(diis_environment);
+
+    auto second_order_environment = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(9, sq_hamiltonian, S);
+    auto second_order_solver = GQCP::GHFSCFSolver<double>::SecondOrder();
+    second_order_solver.perform(second_order_environment);
+
+    BOOST_CHECK(std::abs(second_order_environment.electronic_energies.back() - diis_environment.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK(second_order_solver.numberOfIterations() < diis_solver.numberOfIterations());
+}
+
+
+/**
+ *  Check if a second-order GHF SCF solver that is performed twice, on the open-shell H2O+, starts every run from its own initial trust radius: both runs should take the same number of iterations.
+ */
+BOOST_AUTO_TEST_CASE(h2o_cation_sto3g_second_order_rerun) {
+
+    const auto sq_hamiltonian = spinBlockedH2OHamiltonian();
+    const GQCP::ScalarGSQOneElectronOperator<double> S {GQCP::SquareMatrix<double>::Identity(sq_hamiltonian.numberOfOrbitals())};
+
+    auto second_order_solver = GQCP::GHFSCFSolver<double>::SecondOrder();
+
+    auto environment1 = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(9, sq_hamiltonian, S);
+    second_order_solver.perform(environment1);
+    const auto number_of_iterations1 = second_order_solver.numberOfIterations();
+
+    auto environment2 = GQCP::GHFSCFEnvironment<double>::WithCoreGuess(9, sq_hamiltonian, S);
+    second_order_solver.perform(environment2);
+    const auto number_of_iterations2 = second_order_solver.numberOfIterations();
+
+    BOOST_CHECK(std::abs(environment1.electronic_energies.back() - environment2.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK_EQUAL(number_of_iterations1, number_of_iterations2);
+}
@@ -19,6 +19,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Basis/Integrals/DensityFittedJKBuilder.hpp"
+#include "Basis/Integrals/DirectJKBuilder.hpp"
+#include "Basis/Integrals/InCoreJKBuilder.hpp"
 #include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
 #include "Operator/FirstQuantized/NuclearRepulsionOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
@@ -356,6 +359,34 @@ BOOST_AUTO_TEST_CASE(h2_631gdp_diis) {
     BOOST_CHECK(std::abs(rhf_environment.electronic_energies.back() - ref_electronic_energy) < 1.0e-06);
 }
 
+/**
+ *  Check if our second-order RHF SCF solver finds the same solution for H2O as the one from Crawdad. This example is taken from (http://sirius.chem.vt.edu/wiki/doku.php?id=crawdad:programming:project3), but the input .xyz-file was converted to Angstrom.
+ */
+BOOST_AUTO_TEST_CASE(crawdad_h2o_sto3g_second_order) {
+
+    const double ref_total_energy = -74.9420799281920;
+
+
+    // Do our own RHF calculation.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const auto sq_hamiltonian = spin_orbital_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In an AO basis.
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), sq_hamiltonian, spin_orbital_basis.overlap());
+    auto second_order_rhf_scf_solver = GQCP::RHFSCFSolver<double>::SecondOrder();
+    second_order_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the total energy, and check if the solution is a stationary point of the RHF energy: the converged Fock matrix should be diagonal in the basis of the converged orbitals.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::NuclearRepulsionOperator(molecule.nuclearFramework()).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+
+    const auto& C = rhf_environment.coefficient_matrices.back().matrix();
+    const GQCP::SquareMatrix<double> F_MO = C.transpose() * rhf_environment.fock_matrices.back().parameters() * C;
+    BOOST_CHECK(F_MO.isDiagonal(1.0e-05));
+}
+
+
 /**
  *  The real RHF solution of a equilateral H_4 ring is internally stable, but externally unstable, both real->complex and restricted->unrestricted. (As confirmed by the implementation of @xdvriend.)
  *  This test checks whether the lower lying complex RHF solution can indeed be found.
@@ -382,3 +413,102 @@ BOOST_AUTO_TEST_CASE(h4_ccpvdz_complex) {
     // Check if the converged energy matches the reference energy.
     BOOST_CHECK(std::abs((rhf_ground_state_energy + nuc_rep) - reference_energy) < 1.0e-06);
 }
+
+
+/**
+ *  Check if the direct DIIS RHF SCF solver, which never stores the two-electron integrals, finds the same energy as the conventional one.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_horton_direct_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    // Perform a direct RHF calculation: only the core Hamiltonian is quantized.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const auto H_core = spin_orbital_basis.quantize(GQCP::KineticOperator()) + spin_orbital_basis.quantize(GQCP::NuclearAttractionOperator(molecule.nuclearFramework()));
+    const auto jk_builder = std::make_shared<GQCP::DirectJKBuilder>(GQCP::DirectJKBuilder::Libint(spin_orbital_basis.scalarBasis()));
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), H_core, spin_orbital_basis.overlap(), jk_builder);
+    auto diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS();
+    diis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the calculated energy with the reference.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::NuclearRepulsionOperator(molecule.nuclearFramework()).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
+
+
+/**
+ *  Check if a density-fitted RHF calculation, in which the Fock matrices are built from the density fitting factors, yields the same energy as a conventional RHF calculation on the density-fitted two-electron integrals.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_density_fitted_diis) {
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "6-31G"};
+    const auto H_core = spin_orbital_basis.quantize(GQCP::KineticOperator()) + spin_orbital_basis.quantize(GQCP::NuclearAttractionOperator(molecule.nuclearFramework()));
+    const auto jk_builder = std::make_shared<GQCP::DensityFittedJKBuilder>(GQCP::DensityFittedJKBuilder::Libint(spin_orbital_basis.scalarBasis(), auxiliary_scalar_basis));
+
+
+    // Perform the density-fitted RHF calculation.
+    auto df_rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), H_core, spin_orbital_basis.overlap(), jk_builder);
+    auto diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS();
+    diis_rhf_scf_solver.perform(df_rhf_environment);
+
+
+    // Perform a conventional RHF calculation with the density-fitted two-electron integrals.
+    const GQCP::ScalarRSQTwoElectronOperator<double> g {GQCP::SquareRankFourTensor<double>(jk_builder->densityFittingFactors().calculateIntegrals())};
+    const GQCP::RSQHamiltonian<double> hamiltonian {H_core, g};
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), hamiltonian, spin_orbital_basis.overlap().parameters());
+    auto reference_diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS();
+    reference_diis_rhf_scf_solver.perform(rhf_environment);
+
+    BOOST_CHECK(std::abs(df_rhf_environment.electronic_energies.back() - rhf_environment.electronic_energies.back()) < 1.0e-08);
+}
+
+
+/**
+ *  Check if an RHF calculation in which the Fock matrices are built from packed in-core two-electron integrals yields the same energy as the conventional one.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_horton_in_core_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const auto sq_hamiltonian = spin_orbital_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In an AO basis.
+    const auto jk_builder = std::make_shared<GQCP::InCoreJKBuilder>(GQCP::PackedSquareRankFourTensor<double>(sq_hamiltonian.twoElectron().parameters()));
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), sq_hamiltonian.core(), spin_orbital_basis.overlap(), jk_builder);
+    auto diis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::DIIS();
+    diis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the calculated energy with the reference.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::NuclearRepulsionOperator(molecule.nuclearFramework()).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
+
+
+/**
+ *  Check if the ADIIS-DIIS RHF SCF solver, which blends the DIIS coefficients with ADIIS coefficients in the early iterations, finds the same energy as the DIIS RHF SCF solver.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_horton_adiis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const auto sq_hamiltonian = spin_orbital_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), sq_hamiltonian, spin_orbital_basis.overlap());
+    auto adiis_rhf_scf_solver = GQCP::RHFSCFSolver<double>::ADIIS();
+    adiis_rhf_scf_solver.perform(rhf_environment);
+
+
+    // Check the calculated energy with the reference.
+    const double total_energy = rhf_environment.electronic_energies.back() + GQCP::NuclearRepulsionOperator(molecule.nuclearFramework()).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
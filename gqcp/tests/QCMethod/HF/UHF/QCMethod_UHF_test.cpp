@@ -19,6 +19,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Basis/Integrals/DirectJKBuilder.hpp"
 #include "Basis/SpinorBasis/USpinOrbitalBasis.hpp"
 #include "Operator/FirstQuantized/NuclearRepulsionOperator.hpp"
 #include "Operator/SecondQuantized/SQHamiltonian.hpp"
@@ -179,3 +180,81 @@ BOOST_AUTO_TEST_CASE(h3_sto3g_complex) {
     // Reference value from GHF thesis code of @xdvriend.
     BOOST_CHECK(std::abs(S2.calculateExpectationValue(D, d) - 0.8378834125123873) < 1.0e-06);
 }
+
+
+/**
+ *  Check if the direct DIIS UHF SCF solver, which never stores the two-electron integrals, finds the same energy as the conventional one.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_direct_diis) {
+
+    const double ref_total_energy = -74.942080055631;
+
+    // Perform a direct UHF calculation: only the core Hamiltonian is quantized.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto N_alpha = molecule.numberOfElectronPairs();
+    const auto N_beta = molecule.numberOfElectronPairs();
+
+    const GQCP::USpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "STO-3G"};
+    const auto H_core = spinor_basis.quantize(GQCP::KineticOperator()) + spinor_basis.quantize(GQCP::NuclearAttractionOperator(molecule.nuclearFramework()));
+    const GQCP::ScalarBasis<GQCP::GTOShell> scalar_basis {molecule, "STO-3G"};
+    const auto jk_builder = std::make_shared<GQCP::DirectJKBuilder>(GQCP::DirectJKBuilder::Libint(scalar_basis));
+
+    auto uhf_environment = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(N_alpha, N_beta, H_core, spinor_basis.overlap(), jk_builder);
+    auto diis_uhf_scf_solver = GQCP::UHFSCFSolver<double>::DIIS();
+    diis_uhf_scf_solver.perform(uhf_environment);
+
+
+    // Check the calculated energy with the reference.
+    const double total_energy = uhf_environment.electronic_energies.back() + GQCP::NuclearRepulsionOperator(molecule.nuclearFramework()).value();
+    BOOST_CHECK(std::abs(total_energy - ref_total_energy) < 1.0e-06);
+}
+
+
+/**
+ *  Check if the second-order UHF SCF solver finds the same energy as the DIIS UHF SCF solver for H2O, in fewer iterations.
+ */
+BOOST_AUTO_TEST_CASE(h2o_sto3g_second_order) {
+
+    // The integrals are expressed in an orthonormal basis, so the overlap matrix is the unit matrix.
+    const auto r_sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto sq_hamiltonian = GQCP::USQHamiltonian<double>::FromRestricted(r_sq_hamiltonian);
+    const auto K = r_sq_hamiltonian.numberOfOrbitals();
+    const GQCP::ScalarUSQOneElectronOperator<double> S {GQCP::SquareMatrix<double>::Identity(K), GQCP::SquareMatrix<double>::Identity(K)};
+
+    auto diis_environment = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(5, 5, sq_hamiltonian, S);
+    auto diis_uhf_scf_solver = GQCP::UHFSCFSolver<double>::DIIS();
+    diis_uhf_scf_solver.perform(diis_environment);
+
+    auto second_order_environment = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(5, 5, sq_hamiltonian, S);
+    auto second_order_uhf_scf_solver = GQCP::UHFSCFSolver<double>::SecondOrder();
+    second_order_uhf_scf_solver.perform(second_order_environment);
+
+    BOOST_CHECK(std::abs(second_order_environment.electronic_energies.back() - diis_environment.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK(second_order_uhf_scf_solver.numberOfIterations() < diis_uhf_scf_solver.numberOfIterations());
+}
+
+
+/**
+ *  Check if a second-order UHF SCF solver that is performed twice, on the open-shell H2O+, starts every run from its own initial trust radius: both runs should take the same number of iterations.
+ */
+BOOST_AUTO_TEST_CASE(h2o_cation_sto3g_second_order_rerun) {
+
+    // The integrals are expressed in an orthonormal basis, so the overlap matrix is the unit matrix.
+    const auto r_sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto sq_hamiltonian = GQCP::USQHamiltonian<double>::FromRestricted(r_sq_hamiltonian);
+    const auto K = r_sq_hamiltonian.numberOfOrbitals();
+    const GQCP::ScalarUSQOneElectronOperator<double> S {GQCP::SquareMatrix<double>::Identity(K), GQCP::SquareMatrix<double>::Identity(K)};
+
+    auto second_order_uhf_scf_solver = GQCP::UHFSCFSolver<double>::SecondOrder();
+
+    auto environment1 = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(5, 4, sq_hamiltonian, S);
+    second_order_uhf_scf_solver.perform(environment1);
+    const auto number_of_iterations1 = second_order_uhf_scf_solver.numberOfIterations();
+
+    auto environment2 = GQCP::UHFSCFEnvironment<double>::WithCoreGuess(5, 4, sq_hamiltonian, S);
+    second_order_uhf_scf_solver.perform(environment2);
+    const auto number_of_iterations2 = second_order_uhf_scf_solver.numberOfIterations();
+
+    BOOST_CHECK(std::abs(environment1.electronic_energies.back() - environment2.electronic_energies.back()) < 1.0e-08);
+    BOOST_CHECK_EQUAL(number_of_iterations1, number_of_iterations2);
+}
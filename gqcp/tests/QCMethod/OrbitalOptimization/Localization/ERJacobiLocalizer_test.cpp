@@ -21,6 +21,20 @@
 
 #include "QCMethod/OrbitalOptimization/Localization/ERJacobiLocalizer.hpp"
 
+
+/**
+ *  An Edmiston-Ruedenberg localizer that rotates the Hamiltonian and spinor basis with the full rotation matrix in every iteration, instead of applying the Jacobi rotation in place.
+ */
+class FullRotationERJacobiLocalizer: public GQCP::ERJacobiLocalizer {
+public:
+    using GQCP::ERJacobiLocalizer::ERJacobiLocalizer;
+
+    void applyNewRotation(GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell>& spinor_basis, GQCP::RSQHamiltonian<double>& sq_hamiltonian) override {
+        GQCP::BaseOrbitalOptimizer::applyNewRotation(spinor_basis, sq_hamiltonian);
+    }
+};
+
+
 /**
  *  Check if the Edmiston-Ruedenberg localization index is raised after a localization procedure.
  * 
@@ -49,3 +63,40 @@ BOOST_AUTO_TEST_CASE(localization_index_raises) {
 
     BOOST_CHECK(D_after > D_before);
 }
+
+
+/**
+ *  Check if applying the optimal Jacobi rotations in place yields the same localized Hamiltonian and spinor basis as rotating with the full rotation matrices.
+ * 
+ *  The test system is H2O in an STO-3G basisset.
+ */
+BOOST_AUTO_TEST_CASE(in_place_Jacobi_rotations) {
+
+    // Prepare the molecular Hamiltonian in the Löwdin-basis.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o.xyz");
+    const auto N_P = molecule.numberOfElectronPairs();
+
+    GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spinor_basis {molecule, "STO-3G"};
+    spinor_basis.lowdinOrthonormalize();
+    auto sq_hamiltonian = spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));  // In the Löwdin basis.
+
+    auto full_spinor_basis = spinor_basis;
+    auto full_sq_hamiltonian = sq_hamiltonian;
+
+
+    // Localize with both localizers and check if they followed the same path.
+    GQCP::ERJacobiLocalizer localizer {N_P, 1.0e-08};
+    localizer.optimize(spinor_basis, sq_hamiltonian);
+
+    FullRotationERJacobiLocalizer full_localizer {N_P, 1.0e-08};
+    full_localizer.optimize(full_spinor_basis, full_sq_hamiltonian);
+
+    BOOST_CHECK_EQUAL(localizer.numberOfIterations(), full_localizer.numberOfIterations());
+    BOOST_CHECK(spinor_basis.expansion().matrix().isApprox(full_spinor_basis.expansion().matrix(), 1.0e-10));
+    BOOST_CHECK(sq_hamiltonian.core().parameters().isApprox(full_sq_hamiltonian.core().parameters(), 1.0e-10));
+    BOOST_CHECK(sq_hamiltonian.twoElectron().parameters().isApprox(full_sq_hamiltonian.twoElectron().parameters(), 1.0e-10));
+
+    // The localized Hamiltonian should also be the one that belongs to the localized spinor basis.
+    const auto quantized_sq_hamiltonian = spinor_basis.quantize(GQCP::FQMolecularHamiltonian(molecule));
+    BOOST_CHECK(sq_hamiltonian.twoElectron().parameters().isApprox(quantized_sq_hamiltonian.twoElectron().parameters(), 1.0e-08));
+}
@@ -46,6 +46,10 @@ BOOST_AUTO_TEST_CASE(crawdad_sto3g_H2O) {
     const GQCP::DiagonalRHFFockMatrixObjective<double> objective {hamiltonian};
     const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
 
+    // Check if the RMP2 energy correction that only transforms the (ia|jb) integrals from the AO basis is correct.
+    const double ao_energy_correction = GQCP::calculateRMP2EnergyCorrection(hamiltonian.twoElectron(), rhf_parameters);
+    BOOST_CHECK(std::abs(ao_energy_correction - ref_energy_correction) < 1.0e-08);
+
     hamiltonian.transform(rhf_parameters.expansion());  // Now in the RHF orbital basis.
 
 
@@ -80,3 +84,34 @@ BOOST_AUTO_TEST_CASE(crawdad_sto3g_CH4) {
     double energy_correction = GQCP::calculateRMP2EnergyCorrection(hamiltonian, rhf_parameters);
     BOOST_CHECK(std::abs(energy_correction - ref_energy_correction) < 1.0e-08);
 }
+
+
+/**
+ *  Check if the density-fitted RMP2 energy correction, which only builds the (ia|jb) integrals from the occupied-virtual factors, is equal to the RMP2 energy correction that uses the full set of density-fitted two-electron integrals.
+ *  The test system is H2O in an STO-3G basisset, using the 6-31G basis as an auxiliary basis.
+ */
+BOOST_AUTO_TEST_CASE(density_fitted_sto3g_H2O) {
+
+    // Create a molecular Hamiltonian in the AO basis, whose two-electron integrals are density-fitted.
+    const auto molecule = GQCP::Molecule::ReadXYZ("data/h2o_crawdad.xyz");
+    const GQCP::RSpinOrbitalBasis<double, GQCP::GTOShell> spin_orbital_basis {molecule, "STO-3G"};
+    const GQCP::ScalarBasis<GQCP::GTOShell> auxiliary_scalar_basis {molecule, "6-31G"};
+
+    const auto factors = GQCP::DensityFittingFactors::Libint(spin_orbital_basis.scalarBasis(), auxiliary_scalar_basis);
+    const auto H_core = spin_orbital_basis.quantize(GQCP::KineticOperator()) + spin_orbital_basis.quantize(GQCP::NuclearAttractionOperator(molecule.nuclearFramework()));
+    const GQCP::ScalarRSQTwoElectronOperator<double> g {GQCP::SquareRankFourTensor<double>(factors.calculateIntegrals())};
+    auto hamiltonian = GQCP::RSQHamiltonian<double>(H_core, g);
+
+    auto rhf_environment = GQCP::RHFSCFEnvironment<double>::WithCoreGuess(molecule.numberOfElectrons(), hamiltonian, spin_orbital_basis.overlap().parameters());
+    auto plain_rhf_scf_solver = GQCP::RHFSCFSolver<double>::Plain();
+    const GQCP::DiagonalRHFFockMatrixObjective<double> objective {hamiltonian};
+    const auto rhf_parameters = GQCP::QCMethod::RHF<double>().optimize(objective, plain_rhf_scf_solver, rhf_environment).groundStateParameters();
+
+    hamiltonian.transform(rhf_parameters.expansion());  // Now in the RHF orbital basis.
+
+
+    // Check if both RMP2 energy corrections are equal.
+    const auto ref_energy_correction = GQCP::calculateRMP2EnergyCorrection(hamiltonian, rhf_parameters);
+    const auto energy_correction = GQCP::calculateRMP2EnergyCorrection(factors, rhf_parameters);
+    BOOST_CHECK(std::abs(energy_correction - ref_energy_correction) < 1.0e-10);
+}
@@ -0,0 +1,57 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "QCModel_AP1roG"
+
+#include <boost/test/unit_test.hpp>
+
+#include "QCModel/Geminals/AP1roG.hpp"
+
+
+/**
+ *  Check if the PSEs and their Jacobian are equal to their element-wise definitions, and if the matrix-free Jacobian-vector product is equal to the product with the full Jacobian.
+ */
+BOOST_AUTO_TEST_CASE(pse_jacobian) {
+
+    // Use the water molecule in a 6-31G basis (K = 13), with its 5 electron pairs, and some arbitrary geminal coefficients.
+    const auto sq_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_631g_klaas.FCIDUMP");
+    const size_t K = sq_hamiltonian.numberOfOrbitals();
+    const size_t N_P = 5;
+
+    const GQCP::VectorX<double> g = 0.1 * GQCP::VectorX<double>::Random(N_P * (K - N_P));
+    const auto G = GQCP::AP1roGGeminalCoefficients::FromColumnMajor(g, N_P, K);
+
+
+    const auto F = GQCP::QCModel::AP1roG::calculatePSECoordinateFunctions(sq_hamiltonian, G);
+    const auto J = GQCP::QCModel::AP1roG::calculatePSEJacobian(sq_hamiltonian, G);
+    for (size_t i = 0; i < N_P; i++) {
+        for (size_t a = N_P; a < K; a++) {
+            BOOST_CHECK(std::abs(F(i, a) - GQCP::QCModel::AP1roG::calculatePSECoordinateFunction(sq_hamiltonian, G, i, a)) < 1.0e-12);
+
+            for (size_t j = 0; j < N_P; j++) {
+                for (size_t b = N_P; b < K; b++) {
+                    BOOST_CHECK(std::abs(J(i, a, j, b) - GQCP::QCModel::AP1roG::calculatePSEJacobianElement(sq_hamiltonian, G, i, a, j, b)) < 1.0e-12);
+                }
+            }
+        }
+    }
+
+
+    const GQCP::VectorX<double> y = GQCP::VectorX<double>::Random(N_P * (K - N_P));
+    const auto J_product = GQCP::QCModel::AP1roG::callablePSEJacobianProduct(sq_hamiltonian, N_P);
+    BOOST_CHECK(J_product(g, y).isApprox(J.asMatrix() * y, 1.0e-12));
+}
@@ -76,3 +76,29 @@ BOOST_AUTO_TEST_CASE(GHF_DMs_scalar_basis) {
 
     BOOST_CHECK(std::abs(ghf_energy - expectation_value) < 1.0e-12);
 }
+
+
+/**
+ *  Check if the matrix-free products with the real GHF stability matrices are equal to the products with the dense stability matrices.
+ */
+BOOST_AUTO_TEST_CASE(matrix_free_stability) {
+
+    // Since only the structure of the stability matrices is tested, the integrals of the water molecule in an STO-3G basis are interpreted as spinor integrals (M = 7), with 3 electrons and orbital energies that are chosen by hand.
+    const auto r_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const GQCP::GSQHamiltonian<double> hamiltonian {GQCP::ScalarGSQOneElectronOperator<double> {r_hamiltonian.core().parameters()}, GQCP::ScalarGSQTwoElectronOperator<double> {r_hamiltonian.twoElectron().parameters()}};
+    const size_t M = r_hamiltonian.numberOfOrbitals();
+    const size_t N = 3;
+
+    GQCP::VectorX<double> orbital_energies {M};
+    orbital_energies << -20.5, -1.3, -0.7, -0.55, -0.5, 0.2, 0.3;
+    const GQCP::QCModel::GHF<double> ghf {N, orbital_energies, GQCP::GTransformation<double> {GQCP::SquareMatrix<double>::Identity(M)}};
+
+    const auto stability_matrices = ghf.calculateStabilityMatrices(hamiltonian);
+    const GQCP::MatrixX<double> internal = stability_matrices.internal();
+    const GQCP::MatrixX<double> real_complex = stability_matrices.realComplex();
+
+    const GQCP::VectorX<double> x = GQCP::VectorX<double>::Random(internal.cols());
+    BOOST_CHECK(ghf.internalStabilityEnvironment(hamiltonian).matrix_vector_product_function(x).isApprox(internal * x, 1.0e-12));
+    BOOST_CHECK(ghf.realComplexStabilityEnvironment(hamiltonian).matrix_vector_product_function(x).isApprox(real_complex * x, 1.0e-12));
+    BOOST_CHECK(ghf.calculateStabilityMatrixDiagonal(hamiltonian).isApprox(internal.diagonal(), 1.0e-12));
+}
@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Basis/SpinorBasis/RSpinOrbitalBasis.hpp"
+#include "Mathematical/Optimization/Eigenproblem/Davidson/DavidsonSolver.hpp"
 #include "QCMethod/HF/RHF/DiagonalRHFFockMatrixObjective.hpp"
 #include "QCMethod/HF/RHF/RHF.hpp"
 #include "QCMethod/HF/RHF/RHFSCFSolver.hpp"
@@ -158,6 +159,76 @@ BOOST_AUTO_TEST_CASE(RHF_DMs_scalar_basis) {
 }
 
 
+/**
+ *  Check if the RHF orbital Hessian is equal to its element-wise definition, and if the matrix-free Hessian-vector product is equal to the product with the full Hessian.
+ */
+BOOST_AUTO_TEST_CASE(orbital_hessian) {
+
+    // Use the water molecule in an STO-3G basis (K = 7), with its 5 electron pairs.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const size_t K = hamiltonian.numberOfOrbitals();
+    const size_t N_P = 5;
+
+    const auto hessian = GQCP::QCModel::RHF<double>::calculateOrbitalHessianTensor(hamiltonian, N_P);
+    for (size_t a = N_P; a < K; a++) {
+        for (size_t i = 0; i < N_P; i++) {
+            for (size_t b = N_P; b < K; b++) {
+                for (size_t j = 0; j < N_P; j++) {
+                    BOOST_CHECK(std::abs(hessian(a, i, b, j) - GQCP::QCModel::RHF<double>::calculateOrbitalHessianElement(hamiltonian, N_P, a, i, b, j)) < 1.0e-12);
+                }
+            }
+        }
+    }
+
+
+    const GQCP::VectorX<double> x = GQCP::VectorX<double>::Random(N_P * (K - N_P));
+    const auto sigma = GQCP::QCModel::RHF<double>::calculateOrbitalHessianVectorProduct(hamiltonian, N_P, x);
+    BOOST_CHECK(sigma.isApprox(hessian.asMatrix() * x, 1.0e-12));
+
+    BOOST_CHECK_THROW(GQCP::QCModel::RHF<double>::calculateOrbitalHessianVectorProduct(hamiltonian, N_P, GQCP::VectorX<double>::Random(3)), std::invalid_argument);
+}
+
+
+/**
+ *  Check if the matrix-free products with the real RHF stability matrices are equal to the products with the dense stability matrices, and if the Davidson solver finds their lowest eigenvalues.
+ */
+BOOST_AUTO_TEST_CASE(matrix_free_stability) {
+
+    // Use the water molecule in a 6-31G basis (K = 13), with its 5 electron pairs. Since only the structure of the stability matrices is tested, the orbital energies are chosen by hand.
+    const auto hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_631g_klaas.FCIDUMP");
+    const size_t K = hamiltonian.numberOfOrbitals();
+    const size_t N_P = 5;
+
+    GQCP::VectorX<double> orbital_energies {K};
+    orbital_energies << -20.5, -1.3, -0.7, -0.55, -0.5, 0.2, 0.3, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5;
+    const GQCP::QCModel::RHF<double> rhf {N_P, orbital_energies, GQCP::RTransformation<double>::Identity(K)};
+
+    const auto stability_matrices = rhf.calculateStabilityMatrices(hamiltonian);
+    const std::vector<std::pair<GQCP::MatrixX<double>, GQCP::EigenproblemEnvironment<double>>> cases {
+        {stability_matrices.internal(), rhf.internalStabilityEnvironment(hamiltonian, 2)},
+        {stability_matrices.realComplex(), rhf.realComplexStabilityEnvironment(hamiltonian, 2)},
+        {stability_matrices.restrictedUnrestricted(), rhf.restrictedUnrestrictedStabilityEnvironment(hamiltonian, 2)}};
+
+    const GQCP::VectorX<double> x = GQCP::VectorX<double>::Random(N_P * (K - N_P));
+    for (auto stability_case : cases) {
+        const auto& stability_matrix = stability_case.first;
+        auto& environment = stability_case.second;
+
+        BOOST_CHECK(environment.matrix_vector_product_function(x).isApprox(stability_matrix * x, 1.0e-12));
+        BOOST_CHECK(environment.diagonal.isApprox(stability_matrix.diagonal(), 1.0e-12));
+
+        // Only the two lowest eigenvalues are requested from the Davidson solver.
+        auto solver = GQCP::EigenproblemSolver::Davidson(2);
+        solver.perform(environment);
+
+        const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> dense_solver {stability_matrix};
+        BOOST_CHECK(environment.eigenvalues.isApprox(dense_solver.eigenvalues().head(2), 1.0e-06));
+    }
+
+    BOOST_CHECK_THROW(rhf.calculateStabilityMatrixVectorProduct(hamiltonian, GQCP::VectorX<double>::Random(3), true, 1.0), std::invalid_argument);
+}
+
+
 /**
  *  Check the calculation of the ipsocentric current density and the intermediates for its calculation. The test system is H2, 1 au apart in an STO-3G basis set.
  *
@@ -158,3 +158,35 @@ BOOST_AUTO_TEST_CASE(UHF_DMs_scalar_basis) {
 
     BOOST_CHECK(std::abs(uhf_energy - expectation_value) < 1.0e-12);
 }
+
+
+/**
+ *  Check if the matrix-free products with the real UHF stability matrices are equal to the products with the dense stability matrices.
+ */
+BOOST_AUTO_TEST_CASE(matrix_free_stability) {
+
+    // Use the water molecule in an STO-3G basis (K = 7), with 5 alpha and 5 beta electrons, in its restricted orbitals. Since only the structure of the stability matrices is tested, the orbital energies are chosen by hand.
+    const auto r_hamiltonian = GQCP::RSQHamiltonian<double>::FromFCIDUMP("data/h2o_sto3g_klaas.FCIDUMP");
+    const auto hamiltonian = GQCP::USQHamiltonian<double>::FromRestricted(r_hamiltonian);
+    const size_t K = r_hamiltonian.numberOfOrbitals();
+    const size_t N = 5;
+
+    GQCP::VectorX<double> orbital_energies {K};
+    orbital_energies << -20.5, -1.3, -0.7, -0.55, -0.5, 0.2, 0.3;
+    const GQCP::QCModel::UHF<double> uhf {N, N, orbital_energies, orbital_energies, GQCP::UTransformation<double>::Identity(K)};
+
+    const auto stability_matrices = uhf.calculateStabilityMatrices(hamiltonian);
+    const GQCP::MatrixX<double> internal = stability_matrices.internal();
+    const GQCP::MatrixX<double> real_complex = stability_matrices.realComplex();
+    const GQCP::MatrixX<double> unrestricted_generalized = stability_matrices.unrestrictedGeneralized();
+
+    const GQCP::VectorX<double> x = GQCP::VectorX<double>::Random(internal.cols());
+    BOOST_CHECK(uhf.internalStabilityEnvironment(hamiltonian).matrix_vector_product_function(x).isApprox(internal * x, 1.0e-12));
+    BOOST_CHECK(uhf.internalStabilityEnvironment(hamiltonian).diagonal.isApprox(internal.diagonal(), 1.0e-12));
+    BOOST_CHECK(uhf.realComplexStabilityEnvironment(hamiltonian).matrix_vector_product_function(x).isApprox(real_complex * x, 1.0e-12));
+    BOOST_CHECK(uhf.realComplexStabilityEnvironment(hamiltonian).diagonal.isApprox(real_complex.diagonal(), 1.0e-12));
+
+    const GQCP::VectorX<double> y = GQCP::VectorX<double>::Random(unrestricted_generalized.cols());
+    BOOST_CHECK(uhf.unrestrictedGeneralizedStabilityEnvironment(hamiltonian).matrix_vector_product_function(y).isApprox(unrestricted_generalized * y, 1.0e-12));
+    BOOST_CHECK(uhf.unrestrictedGeneralizedStabilityEnvironment(hamiltonian).diagonal.isApprox(unrestricted_generalized.diagonal(), 1.0e-12));
+}
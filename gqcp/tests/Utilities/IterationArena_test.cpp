@@ -0,0 +1,127 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "IterationArena"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Utilities/IterationArena.hpp"
+
+#include <complex>
+#include <cstdint>
+
+
+/**
+ *  Check if the scratch objects that are handed out are aligned, don't overlap and have the requested dimensions.
+ */
+BOOST_AUTO_TEST_CASE(allocation) {
+
+    GQCP::IterationArena arena;
+
+    auto A = arena.matrix<double>(3, 5);
+    auto v = arena.vector<std::complex<double>>(7);
+    auto T = arena.tensor<double>(2, 3, 4, 5);
+
+    BOOST_CHECK(A.rows() == 3 && A.cols() == 5);
+    BOOST_CHECK(v.size() == 7);
+    BOOST_CHECK(T.dimension(0) == 2 && T.dimension(3) == 5 && T.size() == 120);
+
+    for (const void* pointer : {static_cast<const void*>(A.data()), static_cast<const void*>(v.data()), static_cast<const void*>(T.data())}) {
+        BOOST_CHECK(reinterpret_cast<std::uintptr_t>(pointer) % GQCP::IterationArena::Alignment == 0);
+    }
+
+    // Writing to one scratch object shouldn't affect another one.
+    A.setConstant(1.0);
+    v.setConstant(2.0);
+    T.setConstant(3.0);
+    BOOST_CHECK(A.isApprox(Eigen::MatrixXd::Constant(3, 5, 1.0), 1.0e-12));
+
+    BOOST_CHECK(arena.bytesInUse() >= 15 * sizeof(double) + 7 * sizeof(std::complex<double>) + 120 * sizeof(double));
+}
+
+
+/**
+ *  Check if an arena reaches a steady state in which no more blocks are allocated, even if the first iteration needed more than one block.
+ */
+BOOST_AUTO_TEST_CASE(steady_state) {
+
+    GQCP::IterationArena arena;
+
+    const auto iteration = [&arena]() {
+        for (size_t n = 1; n <= 16; n++) {
+            auto M = arena.matrix<double>(10 * n, 10);
+            M.setZero();
+        }
+    };
+
+    iteration();
+    const auto peak_bytes = arena.peakBytes();
+    BOOST_CHECK(arena.numberOfBlockAllocations() > 1);
+    BOOST_CHECK(peak_bytes >= 1360 * sizeof(double));
+
+    // After the first reset, the blocks are merged into one block, which should suffice for all the following iterations.
+    arena.reset();
+    BOOST_CHECK(arena.bytesInUse() == 0);
+    const auto number_of_block_allocations = arena.numberOfBlockAllocations();
+
+    for (size_t i = 0; i < 5; i++) {
+        iteration();
+        arena.reset();
+    }
+    BOOST_CHECK(arena.numberOfBlockAllocations() == number_of_block_allocations);
+    BOOST_CHECK(arena.peakBytes() == peak_bytes);
+}
+
+
+/**
+ *  Check if reserving memory up front avoids any further block allocations, and if copies start out empty.
+ */
+BOOST_AUTO_TEST_CASE(reserve_and_copy) {
+
+    GQCP::IterationArena arena {1 << 20};
+    BOOST_CHECK(arena.capacity() >= (1 << 20));
+    BOOST_CHECK(arena.numberOfBlockAllocations() == 1);
+
+    arena.matrix<double>(100, 100);
+    arena.vector<double>(1000);
+    BOOST_CHECK(arena.numberOfBlockAllocations() == 1);
+
+    const GQCP::IterationArena copy {arena};
+    BOOST_CHECK(copy.bytesInUse() == 0);
+    BOOST_CHECK(copy.capacity() == arena.capacity());
+}
+
+
+/**
+ *  Check if reserving memory while an iteration is in progress doesn't count the unused tails of the blocks that have been skipped as available room.
+ */
+BOOST_AUTO_TEST_CASE(reserve_after_skipped_block) {
+
+    GQCP::IterationArena arena;
+
+    // The second allocation doesn't fit in the tail of the first block, so a second block is allocated and the tail of the first one is skipped.
+    arena.allocate(3000);
+    arena.allocate(2000);
+    BOOST_CHECK(arena.numberOfBlockAllocations() == 2);
+
+    const auto largest_allocation = arena.capacity() - arena.bytesInUse() - 64;
+    arena.reserve(largest_allocation);
+    const auto number_of_block_allocations = arena.numberOfBlockAllocations();
+
+    arena.allocate(largest_allocation);
+    BOOST_CHECK(arena.numberOfBlockAllocations() == number_of_block_allocations);
+}
@@ -0,0 +1,172 @@
+// This file is part of GQCG-GQCP.
+//
+// Copyright (C) 2017-2020  the GQCG developers
+//
+// GQCG-GQCP is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// GQCG-GQCP is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
+
+#define BOOST_TEST_MODULE "RingBuffer"
+
+#include <boost/test/unit_test.hpp>
+
+#include "Mathematical/Representation/Matrix.hpp"
+#include "Utilities/RingBuffer.hpp"
+
+
+/**
+ *  Check if the constructor throws upon receiving a zero capacity.
+ */
+BOOST_AUTO_TEST_CASE(constructor) {
+
+    BOOST_CHECK_NO_THROW(GQCP::RingBuffer<int>(1));
+    BOOST_CHECK_THROW(GQCP::RingBuffer<int>(0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a full ring buffer overwrites its oldest elements.
+ */
+BOOST_AUTO_TEST_CASE(push_back) {
+
+    GQCP::RingBuffer<int> buffer {3};
+    BOOST_CHECK(buffer.empty());
+
+    buffer.push_back(1);
+    buffer.push_back(2);
+    BOOST_CHECK(buffer.size() == 2);
+    BOOST_CHECK(buffer.front() == 1);
+    BOOST_CHECK(buffer.back() == 2);
+
+    buffer.push_back(3);
+    buffer.push_back(4);
+    buffer.push_back(5);
+    BOOST_CHECK(buffer.size() == 3);
+    BOOST_CHECK(buffer.capacity() == 3);
+
+    const std::vector<int> ref_elements {3, 4, 5};
+    BOOST_CHECK(buffer.asVector() == ref_elements);
+    BOOST_CHECK(buffer[0] == 3);
+    BOOST_CHECK(buffer[2] == 5);
+}
+
+
+/**
+ *  Check if removing and re-adding the most recent element works, also when the buffer has wrapped around.
+ */
+BOOST_AUTO_TEST_CASE(pop_back) {
+
+    GQCP::RingBuffer<int> buffer {3};
+    BOOST_CHECK_THROW(buffer.pop_back(), std::out_of_range);
+
+    for (int i = 1; i <= 4; i++) {
+        buffer.push_back(i);
+    }
+
+    buffer.pop_back();
+    BOOST_CHECK(buffer.back() == 3);
+
+    buffer.push_back(6);
+    const std::vector<int> ref_elements {2, 3, 6};
+    BOOST_CHECK(buffer.asVector() == ref_elements);
+
+    buffer.back() = 7;
+    BOOST_CHECK(buffer.back() == 7);
+
+    buffer.clear();
+    BOOST_CHECK(buffer.empty());
+}
+
+
+/**
+ *  Check if the last elements of a ring buffer can be selected through its iterators, which is how DIIS uses the iteration history.
+ */
+BOOST_AUTO_TEST_CASE(iterators) {
+
+    GQCP::RingBuffer<int> buffer {4};
+    for (int i = 1; i <= 6; i++) {
+        buffer.push_back(i);
+    }
+
+    BOOST_CHECK(buffer.end() - buffer.begin() == 4);
+
+    const std::vector<int> last_two {buffer.end() - 2, buffer.end()};
+    const std::vector<int> ref_last_two {5, 6};
+    BOOST_CHECK(last_two == ref_last_two);
+}
+
+
+/**
+ *  Check if changing the capacity of a ring buffer keeps its most recent elements.
+ */
+BOOST_AUTO_TEST_CASE(setCapacity) {
+
+    GQCP::RingBuffer<int> buffer {3};
+    for (int i = 1; i <= 5; i++) {
+        buffer.push_back(i);
+    }
+
+    buffer.setCapacity(2);
+    const std::vector<int> ref_elements_1 {4, 5};
+    BOOST_CHECK(buffer.asVector() == ref_elements_1);
+
+    buffer.setCapacity(4);
+    buffer.push_back(6);
+    buffer.push_back(7);
+    const std::vector<int> ref_elements_2 {4, 5, 6, 7};
+    BOOST_CHECK(buffer.asVector() == ref_elements_2);
+
+    BOOST_CHECK_THROW(buffer.setCapacity(0), std::invalid_argument);
+}
+
+
+/**
+ *  Check if a copy of a ring buffer can add one of its own elements, which requires that its storage isn't reallocated.
+ */
+BOOST_AUTO_TEST_CASE(copy_push_back_self) {
+
+    GQCP::RingBuffer<GQCP::VectorX<double>> buffer {4};
+    buffer.push_back(GQCP::VectorX<double>::Constant(3, 1.0));
+
+    auto copy = buffer;
+    for (size_t i = 0; i < 3; i++) {
+        copy.push_back(copy.back());
+        copy.back() *= 2.0;
+    }
+
+    BOOST_CHECK(copy.size() == 4);
+    BOOST_CHECK(buffer.size() == 1);
+    BOOST_CHECK(copy.back().isApprox(GQCP::VectorX<double>::Constant(3, 8.0), 1.0e-12));
+}
+
+
+/**
+ *  Check if `assign_back` re-uses the storage of a recycled slot for Eigen expressions.
+ */
+BOOST_AUTO_TEST_CASE(assign_back) {
+
+    GQCP::RingBuffer<GQCP::VectorX<double>> buffer {2};
+
+    const GQCP::VectorX<double> v1 = GQCP::VectorX<double>::Constant(3, 1.0);
+    const GQCP::VectorX<double> v2 = GQCP::VectorX<double>::Constant(3, 2.0);
+    buffer.assign_back(v1 + v1);
+    buffer.assign_back(v2);
+    BOOST_CHECK(buffer.size() == 2);
+    BOOST_CHECK(buffer.front().isApprox(v2, 1.0e-12));
+
+    // The oldest slot is overwritten, in place.
+    const auto* const oldest_storage = buffer.front().data();
+    buffer.assign_back(v1 - v2);
+    BOOST_CHECK(buffer.size() == 2);
+    BOOST_CHECK(buffer.back().isApprox(-v1, 1.0e-12));
+    BOOST_CHECK(buffer.back().data() == oldest_storage);
+}
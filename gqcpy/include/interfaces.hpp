@@ -1132,6 +1132,7 @@ void bindQCMethodHartreeFockSCFEnvironmentInterface(Class& py_class) {
     // The C++ type corresponding to the Python class.
     using Type = typename Class::type;
     using Scalar = typename Type::Scalar;
+    using OrbitalEnergies = typename decltype(Type::orbital_energies)::Value;
 
 
     py_class
@@ -1144,27 +1145,50 @@ void bindQCMethodHartreeFockSCFEnvironmentInterface(Class& py_class) {
 
         .def_readwrite("electronic_energies", &Type::electronic_energies)
 
-        .def_readwrite("orbital_energies", &Type::orbital_energies)
+        .def_property(
+            "orbital_energies",
+            [](const Type& environment) {
+                return environment.orbital_energies.asVector();
+            },
+            [](Type& environment, const std::vector<OrbitalEnergies>& new_orbital_energies) {
+                environment.orbital_energies.clear();
+                for (const auto& orbital_energies : new_orbital_energies) {
+                    environment.orbital_energies.push_back(orbital_energies);
+                }
+            })
+
+        .def_property(
+            "history_depth",
+            &Type::historyDepth,
+            &Type::setHistoryDepth)
 
         /*
          *  MARK: Read-only 'getters'
          */
 
-        .def_readonly(
+        .def_property_readonly(
             "coefficient_matrices",
-            &Type::coefficient_matrices)
+            [](const Type& environment) {
+                return environment.coefficient_matrices.asVector();
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "density_matrices",
-            &Type::density_matrices)
+            [](const Type& environment) {
+                return environment.density_matrices.asVector();
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "fock_matrices",
-            &Type::fock_matrices)
+            [](const Type& environment) {
+                return environment.fock_matrices.asVector();
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "error_vectors",
-            &Type::error_vectors)
+            [](const Type& environment) {
+                return environment.error_vectors.asVector();
+            })
 
         .def_readonly(
             "sq_hamiltonian",
@@ -1188,6 +1212,15 @@ void bindHartreeFockSCFSolverInterface(Class& py_class) {
 
 
     py_class
+        .def_static(
+            "ADIIS",
+            &Type::ADIIS,
+            py::arg("minimum_subspace_dimension") = 2,
+            py::arg("maximum_subspace_dimension") = 6,
+            py::arg("threshold") = 1.0e-08,
+            py::arg("maximum_number_of_iterations") = 128,
+            "Return a DIIS HF SCF solver whose DIIS coefficients are blended with ADIIS coefficients while the error is large. It uses the combination of norm of the difference of two consecutive density matrices as a convergence criterion.")
+
         .def_static(
             "DIIS",
             &Type::DIIS,
@@ -82,6 +82,11 @@ void bindIterativeAlgorithm(py::module& module, const std::string& suffix, const
             &IterativeAlgorithm<Environment>::numberOfIterations,
             "Return the number of iterations that have been performed")
 
+        .def(
+            "peakScratchBytes",
+            &IterativeAlgorithm<Environment>::peakScratchBytes,
+            "Return the largest number of bytes of scratch memory that a single iteration has used from the environment's arena, as measured at the end of the last call to perform")
+
         .def(
             "perform",
             [](IterativeAlgorithm<Environment>& algorithm, Environment& environment) {
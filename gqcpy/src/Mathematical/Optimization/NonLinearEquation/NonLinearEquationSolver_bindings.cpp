@@ -40,6 +40,17 @@ void bindNonLinearEquationSolver(py::module& module) {
         py::arg("threshold") = 1.0e-08,
         py::arg("maximum_number_of_iterations") = 128,
         "Return an iterative algorithm that performs Newton steps to solve a system of equations.");
+
+    module_non_linear_equation_solver.def(
+        "NewtonKrylov",
+        [](const double threshold = 1.0e-08, const size_t maximum_number_of_iterations = 128, const double relative_tolerance = 1.0e-06, const size_t maximum_krylov_dimension = 64) {
+            return NonLinearEquationSolver<double>::NewtonKrylov(threshold, maximum_number_of_iterations, relative_tolerance, maximum_krylov_dimension);
+        },
+        py::arg("threshold") = 1.0e-08,
+        py::arg("maximum_number_of_iterations") = 128,
+        py::arg("relative_tolerance") = 1.0e-06,
+        py::arg("maximum_krylov_dimension") = 64,
+        "Return an iterative algorithm that performs inexact Newton steps, solving the Newton equations by GMRES, to solve a system of equations.");
 }
 
 
@@ -73,14 +73,24 @@ void bindCCSDEnvironmentInterface(Class& py_class) {
             &CCSDEnvironment<Scalar>::correlation_energies)
 
 
+        .def_property(
+            "history_depth",
+            &CCSDEnvironment<Scalar>::historyDepth,
+            &CCSDEnvironment<Scalar>::setHistoryDepth)
+
+
         // Define read-only 'getters'.
-        .def_readonly(
+        .def_property_readonly(
             "t1_amplitudes",
-            &CCSDEnvironment<Scalar>::t1_amplitudes)
+            [](const CCSDEnvironment<Scalar>& environment) {
+                return environment.t1_amplitudes.asVector();
+            })
 
-        .def_readonly(
+        .def_property_readonly(
             "t2_amplitudes",
-            &CCSDEnvironment<Scalar>::t2_amplitudes)
+            [](const CCSDEnvironment<Scalar>& environment) {
+                return environment.t2_amplitudes.asVector();
+            })
 
 
         // Bind methods for the replacement of the most current iterates.
@@ -68,6 +68,17 @@ void bindCCSDSolver(py::module& module) {
     py::class_<CCSDSolver<double>> py_CCSDSolver_d {module, "CCSDSolver_d", "A factory class that can construct CCSD solvers for real-valued calculations."};
     bindCCSDSolverInterface(py_CCSDSolver_d);
 
+    py_CCSDSolver_d
+        .def_static(
+            "MixedPrecision",
+            [](const double switch_threshold, const double threshold, const size_t maximum_number_of_iterations) {
+                return CCSDSolver<double>::MixedPrecision(switch_threshold, threshold, maximum_number_of_iterations);
+            },
+            py::arg("switch_threshold") = 1.0e-05,
+            py::arg("threshold") = 1.0e-08,
+            py::arg("maximum_number_of_iterations") = 128,
+            "Return a mixed-precision CCSD solver that evaluates the CCSD intermediates and amplitude equations in single precision until the change in the amplitudes drops below the switch threshold or stagnates, and that uses the norm of the difference of consecutive amplitudes as a convergence criterion.");
+
     // Complex-valued Python bindings.
     py::class_<CCSDSolver<complex>> py_CCSDSolver_cd {module, "CCSDSolver_cd", "A factory class that can construct CCSD solvers for complex-valued calculations."};
     bindCCSDSolverInterface(py_CCSDSolver_cd);
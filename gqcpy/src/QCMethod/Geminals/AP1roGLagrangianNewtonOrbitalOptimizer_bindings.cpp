@@ -15,7 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with GQCG-GQCP.  If not, see <http://www.gnu.org/licenses/>.
 
+#include "Mathematical/Algorithm/IterativeAlgorithm.hpp"
 #include "Mathematical/Optimization/Minimization/IterativeIdentitiesHessianModifier.hpp"
+#include "Mathematical/Optimization/NonLinearEquation/NonLinearEquationEnvironment.hpp"
 #include "QCMethod/Geminals/AP1roGLagrangianNewtonOrbitalOptimizer.hpp"
 
 #include <pybind11/eigen.h>
@@ -48,6 +50,15 @@ void bindAP1roGLagrangianNewtonOrbitalOptimizer(py::module& module) {
              py::arg("pse_convergence_threshold") = 1.0e-08,
              py::arg("pse_maximum_number_of_iterations") = 128)
 
+        .def(py::init([](const AP1roGGeminalCoefficients& G, const IterativeAlgorithm<NonLinearEquationEnvironment<double>>& pse_solver, const double oo_convergence_threshold = 1.0e-08, const size_t oo_maximum_number_of_iterations = 128) {
+                 auto hessian_modifier = std::make_shared<IterativeIdentitiesHessianModifier>();
+                 return AP1roGLagrangianNewtonOrbitalOptimizer(G, hessian_modifier, pse_solver, oo_convergence_threshold, oo_maximum_number_of_iterations);
+             }),
+             py::arg("G"),
+             py::arg("pse_solver"),
+             py::arg("oo_convergence_threshold") = 1.0e-08,
+             py::arg("oo_maximum_number_of_iterations") = 128)
+
 
         // PUBLIC METHODS
 